@@ -98,7 +98,7 @@ def main() -> int:
         "missingIconBehavior",
         "debugReason",
     ]:
-        if not re.search(rf"\bstd::string\s+{field}\b", prompt_record):
+        if not re.search(rf"\bstd::string(?:_view)?\s+{field}\b", prompt_record):
             failures.append(f"src/input_v2/prompt/PromptSnapshotRecord.h: PromptCandidate missing {field}.")
 
     prompt_service_h = read("src/input_v2/prompt/PromptService.h")
@@ -114,15 +114,15 @@ def main() -> int:
         if not re.search(rf"\bstd::string\s+{field}\b", prompt_service_h):
             failures.append(f"src/input_v2/prompt/PromptService.h: PromptLegacyGlyphDescriptor missing {field}.")
 
-    prompt_service_cpp = read("src/input_v2/prompt/PromptService.cpp")
-    for marker in [
-        "Interface/Exported/DualPad/Glyphs/",
-        "fallback_text",
-        "fail_closed_empty_token",
-        "GlyphAssetLookupPath",
+    for path, markers in [
+        ("src/input_v2/prompt/PromptService.cpp", ["fallback_text", "fail_closed_empty_token"]),
+        ("src/input_v2/prompt/PromptDisplayStrings.cpp", ["GlyphAssetLookupPath"]),
+        ("src/input_v2/prompt/GlyphAtlasFormat.h", ["Interface/Exported/DualPad/Glyphs/"]),
     ]:
-        if marker not in prompt_service_cpp:
-            failures.append(f"src/input_v2/prompt/PromptService.cpp: missing contract marker {marker!r}")
+        source = read(path)
+        for marker in markers:
+            if marker not in source:
+                failures.append(f"{path}: missing contract marker {marker!r}")
 
     prompt_tests = read("tests/input_v2/PromptSnapshotTests.cpp")
     for marker in [
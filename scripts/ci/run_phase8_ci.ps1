@@ -24,10 +24,18 @@ Invoke-Step xmake @("build", "-y", "DualPadPresentationProjectionTests")
 Invoke-Step xmake @("build", "-y", "DualPadManifestCompilerTests")
 Invoke-Step xmake @("build", "-y", "DualPadIngressTests")
 Invoke-Step xmake @("build", "-y", "DualPadRouteHealthContractTests")
+Invoke-Step xmake @("build", "-y", "DualPadAuthoritativePollStateTests")
+Invoke-Step xmake @("build", "-y", "DualPadPollCommitCoordinatorTests")
+Invoke-Step xmake @("build", "-y", "DualPadFrameActionPlanDeltaTests")
+Invoke-Step xmake @("build", "-y", "DualPadAnalogGateKernelBench")
+Invoke-Step xmake @("build", "-y", "DualPadFlightRecorderCaptureBench")
 Invoke-Step xmake @("build", "-y", "DualPadPromptSnapshotTests")
 Invoke-Step xmake @("build", "-y", "DualPadPropertyTests")
 Invoke-Step xmake @("build", "-y", "DualPadFuzzRegressionTests")
 Invoke-Step xmake @("build", "-y", "DualPadDocGen")
+Invoke-Step xmake @("build", "-y", "DualPadGlyphAtlasGen")
+Invoke-Step xmake @("build", "-y", "DualPadGlyphAtlasRoundTripTests")
+Invoke-Step xmake @("build", "-y", "DualPadTraceCsv")
 
 Invoke-Step xmake @("run", "-y", "DualPadReplayTests")
 Invoke-Step xmake @("run", "-y", "DualPadInputV2Tests")
@@ -35,10 +43,22 @@ Invoke-Step xmake @("run", "-y", "DualPadPresentationProjectionTests")
 Invoke-Step xmake @("run", "-y", "DualPadManifestCompilerTests")
 Invoke-Step xmake @("run", "-y", "DualPadIngressTests")
 Invoke-Step xmake @("run", "-y", "DualPadRouteHealthContractTests")
+Invoke-Step xmake @("run", "-y", "DualPadAuthoritativePollStateTests")
+Invoke-Step xmake @("run", "-y", "DualPadPollCommitCoordinatorTests")
+Invoke-Step xmake @("run", "-y", "DualPadFrameActionPlanDeltaTests")
+Invoke-Step xmake @("run", "-y", "DualPadAnalogGateKernelBench")
+Invoke-Step xmake @("run", "-y", "DualPadFlightRecorderCaptureBench")
 Invoke-Step xmake @("run", "-y", "DualPadPromptSnapshotTests")
 Invoke-Step xmake @("run", "-y", "DualPadPropertyTests")
 Invoke-Step xmake @("run", "-y", "DualPadFuzzRegressionTests")
 
+# Pack the checked-in sample glyphs and read the result back the way the
+# runtime does.
+$glyphFixtureRoot = (Resolve-Path "tests/fixtures/glyphatlas").Path
+$glyphAtlasOutput = Join-Path (Get-Location) "build/ci/glyphatlas"
+Invoke-Step xmake @("run", "-y", "DualPadGlyphAtlasGen", $glyphFixtureRoot, $glyphAtlasOutput)
+Invoke-Step xmake @("run", "-y", "DualPadGlyphAtlasRoundTripTests", $glyphFixtureRoot, $glyphAtlasOutput)
+
 Invoke-Step python @("scripts/dev/generate_dualpad_docs.py")
 Invoke-Step python @("scripts/ci/check_reviewed_docs_consistency.py")
 Invoke-Step python @("scripts/ci/check_legacy_authority_boundary.py")
@@ -149,6 +149,8 @@ namespace dualpad::input
 
         // Utility actions that do not fit normal movement or combat input.
         inline constexpr std::string_view Wait = "Game.Wait";
+        // Writes the flight recorder's last seconds as a replay scenario.
+        inline constexpr std::string_view FlightRecorderDump = "Game.FlightRecorderDump";
     }
 
     struct ActionMetadata
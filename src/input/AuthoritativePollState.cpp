@@ -2,6 +2,8 @@
 #include "input/AuthoritativePollState.h"
 
 #include <chrono>
+#include <cstring>
+#include <type_traits>
 
 namespace dualpad::input
 {
@@ -14,6 +16,15 @@ namespace dualpad::input
         }
 
         constexpr std::uint64_t kUnmanagedPulseWindowMs = 50;
+        constexpr int kLatestSampleReadAttempts = 4;
+    }
+
+    AuthoritativePollState::AuthoritativePollState()
+    {
+        // Slot words start zeroed; publish the real defaults once so the
+        // first poll decodes a valid state.
+        std::scoped_lock lock(_writerMutex);
+        PublishLocked();
     }
 
     AuthoritativePollState& AuthoritativePollState::GetSingleton()
@@ -22,34 +33,61 @@ namespace dualpad::input
         return instance;
     }
 
+    AuthoritativePollState::ScopedPublish::ScopedPublish(AuthoritativePollState& state) :
+        _state(state)
+    {
+        _state.BeginPublish();
+    }
+
+    AuthoritativePollState::ScopedPublish::~ScopedPublish()
+    {
+        _state.EndPublish();
+    }
+
+    void AuthoritativePollState::BeginPublish()
+    {
+        _writerMutex.lock();
+        ++_publishDepth;
+    }
+
+    void AuthoritativePollState::EndPublish()
+    {
+        if (--_publishDepth == 0) {
+            PublishLocked();
+        }
+        _writerMutex.unlock();
+    }
+
+    void AuthoritativePollState::PublishLocked()
+    {
+        if (_publishDepth != 0) {
+            return;
+        }
+
+        static_assert(std::is_trivially_copyable_v<PublishedState>);
+        std::array<std::uint64_t, kPublishedWords> words{};
+        ++_pending.version;
+        std::memcpy(words.data(), &_pending, sizeof(PublishedState));
+
+        const auto next = (_publishedSlot.load(std::memory_order_relaxed) + 1) % kPublishedSlotCount;
+        auto& slot = _slots[next];
+        const auto sequence = slot.sequence.load(std::memory_order_relaxed);
+        slot.sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (std::size_t i = 0; i < kPublishedWords; ++i) {
+            slot.words[i].store(words[i], std::memory_order_relaxed);
+        }
+        slot.sequence.store(sequence + 2, std::memory_order_release);
+        _publishedSlot.store(next, std::memory_order_release);
+    }
+
     void AuthoritativePollState::Reset()
     {
-        _unmanagedHeldDown.store(0, std::memory_order_release);
-        _unmanagedPulseDown.store(0, std::memory_order_release);
-        _unmanagedPulseExpireMs.store(0, std::memory_order_release);
-
-        _committedDownMask.store(0, std::memory_order_release);
-        _committedPressedMask.store(0, std::memory_order_release);
-        _committedReleasedMask.store(0, std::memory_order_release);
-        _managedMask.store(0, std::memory_order_release);
-        _unmanagedPressedMask.store(0, std::memory_order_release);
-        _unmanagedReleasedMask.store(0, std::memory_order_release);
-        _unmanagedPulseMask.store(0, std::memory_order_release);
-        _contextValue.store(static_cast<std::uint32_t>(InputContext::Gameplay), std::memory_order_release);
-        _contextEpoch.store(0, std::memory_order_release);
-        _sourceTimestampUs.store(0, std::memory_order_release);
-        _pollSequence.store(0, std::memory_order_release);
-
-        _moveX.store(0.0f, std::memory_order_release);
-        _moveY.store(0.0f, std::memory_order_release);
-        _lookX.store(0.0f, std::memory_order_release);
-        _lookY.store(0.0f, std::memory_order_release);
-        _leftTrigger.store(0.0f, std::memory_order_release);
-        _rightTrigger.store(0.0f, std::memory_order_release);
-        _hasDigital.store(false, std::memory_order_release);
-        _hasAnalog.store(false, std::memory_order_release);
-        _overflowed.store(false, std::memory_order_release);
-        _coalesced.store(false, std::memory_order_release);
+        std::scoped_lock lock(_writerMutex);
+        const auto version = _pending.version;
+        _pending = PublishedState{};
+        _pending.version = version;
+        PublishLocked();
     }
 
     void AuthoritativePollState::SetUnmanagedButton(std::uint32_t bit, bool down)
@@ -58,11 +96,13 @@ namespace dualpad::input
             return;
         }
 
+        std::scoped_lock lock(_writerMutex);
         if (down) {
-            _unmanagedHeldDown.fetch_or(bit, std::memory_order_acq_rel);
+            _pending.unmanagedHeldDown |= bit;
         } else {
-            _unmanagedHeldDown.fetch_and(~bit, std::memory_order_acq_rel);
+            _pending.unmanagedHeldDown &= ~bit;
         }
+        PublishLocked();
     }
 
     void AuthoritativePollState::PulseUnmanagedButton(std::uint32_t bit)
@@ -71,8 +111,16 @@ namespace dualpad::input
             return;
         }
 
-        _unmanagedPulseExpireMs.store(NowMs() + kUnmanagedPulseWindowMs, std::memory_order_release);
-        _unmanagedPulseDown.fetch_or(bit, std::memory_order_acq_rel);
+        std::scoped_lock lock(_writerMutex);
+        // Readers drop an expired pulse without writing back, so an expired
+        // window starts a fresh pulse set here.
+        const auto now = NowMs();
+        if (_pending.unmanagedPulseExpireMs == 0 || now >= _pending.unmanagedPulseExpireMs) {
+            _pending.unmanagedPulseDown = 0;
+        }
+        _pending.unmanagedPulseExpireMs = now + kUnmanagedPulseWindowMs;
+        _pending.unmanagedPulseDown |= bit;
+        PublishLocked();
     }
 
     void AuthoritativePollState::PublishCommittedButtons(
@@ -84,14 +132,16 @@ namespace dualpad::input
         InputContext context,
         std::uint32_t contextEpoch)
     {
-        _committedDownMask.store(committedDownMask, std::memory_order_release);
-        _committedPressedMask.store(committedPressedMask, std::memory_order_release);
-        _committedReleasedMask.store(committedReleasedMask, std::memory_order_release);
-        _managedMask.store(managedMask, std::memory_order_release);
-        _contextValue.store(static_cast<std::uint32_t>(context), std::memory_order_release);
-        _contextEpoch.store(contextEpoch, std::memory_order_release);
-        _pollSequence.store(pollSequence, std::memory_order_release);
-        _hasDigital.store(true, std::memory_order_release);
+        std::scoped_lock lock(_writerMutex);
+        _pending.committedDownMask = committedDownMask;
+        _pending.committedPressedMask = committedPressedMask;
+        _pending.committedReleasedMask = committedReleasedMask;
+        _pending.managedMask = managedMask;
+        _pending.contextValue = static_cast<std::uint32_t>(context);
+        _pending.contextEpoch = contextEpoch;
+        _pending.pollSequence = pollSequence;
+        _pending.hasDigital = true;
+        PublishLocked();
     }
 
     void AuthoritativePollState::PublishUnmanagedDigitalEdges(
@@ -99,10 +149,12 @@ namespace dualpad::input
         std::uint32_t unmanagedReleasedMask,
         std::uint32_t unmanagedPulseMask)
     {
-        _unmanagedPressedMask.store(unmanagedPressedMask, std::memory_order_release);
-        _unmanagedReleasedMask.store(unmanagedReleasedMask, std::memory_order_release);
-        _unmanagedPulseMask.store(unmanagedPulseMask, std::memory_order_release);
-        _hasDigital.store(true, std::memory_order_release);
+        std::scoped_lock lock(_writerMutex);
+        _pending.unmanagedPressedMask = unmanagedPressedMask;
+        _pending.unmanagedReleasedMask = unmanagedReleasedMask;
+        _pending.unmanagedPulseMask = unmanagedPulseMask;
+        _pending.hasDigital = true;
+        PublishLocked();
     }
 
     void AuthoritativePollState::PublishFrameMetadata(
@@ -110,9 +162,11 @@ namespace dualpad::input
         bool overflowed,
         bool coalesced)
     {
-        _sourceTimestampUs.store(sourceTimestampUs, std::memory_order_release);
-        _overflowed.store(overflowed, std::memory_order_release);
-        _coalesced.store(coalesced, std::memory_order_release);
+        std::scoped_lock lock(_writerMutex);
+        _pending.sourceTimestampUs = sourceTimestampUs;
+        _pending.overflowed = overflowed;
+        _pending.coalesced = coalesced;
+        PublishLocked();
     }
 
     void AuthoritativePollState::PublishAnalogState(
@@ -123,63 +177,163 @@ namespace dualpad::input
         float leftTrigger,
         float rightTrigger)
     {
-        _moveX.store(moveX, std::memory_order_release);
-        _moveY.store(moveY, std::memory_order_release);
-        _lookX.store(lookX, std::memory_order_release);
-        _lookY.store(lookY, std::memory_order_release);
-        _leftTrigger.store(leftTrigger, std::memory_order_release);
-        _rightTrigger.store(rightTrigger, std::memory_order_release);
-        _hasAnalog.store(true, std::memory_order_release);
+        std::scoped_lock lock(_writerMutex);
+        _pending.moveX = moveX;
+        _pending.moveY = moveY;
+        _pending.lookX = lookX;
+        _pending.lookY = lookY;
+        _pending.leftTrigger = leftTrigger;
+        _pending.rightTrigger = rightTrigger;
+        _pending.hasAnalog = true;
+        PublishLocked();
     }
 
-    AuthoritativePollFrame AuthoritativePollState::ReadSnapshot()
+    void AuthoritativePollState::PublishDrainedFrame(const DrainedFramePublication& frame)
     {
-        AuthoritativePollFrame frame{};
+        std::scoped_lock lock(_writerMutex);
+        if (frame.analog) {
+            _pending.moveX = frame.analog->moveX;
+            _pending.moveY = frame.analog->moveY;
+            _pending.lookX = frame.analog->lookX;
+            _pending.lookY = frame.analog->lookY;
+            _pending.leftTrigger = frame.analog->leftTrigger;
+            _pending.rightTrigger = frame.analog->rightTrigger;
+            _pending.hasAnalog = true;
+        }
+        _pending.lateLatchChannels = frame.lateLatchChannels;
+        _pending.sourceTimestampUs = frame.sourceTimestampUs;
+        _pending.overflowed = frame.overflowed;
+        _pending.coalesced = frame.coalesced;
+        _pending.unmanagedPressedMask = 0;
+        _pending.unmanagedReleasedMask = 0;
+        _pending.unmanagedPulseMask = 0;
+        _pending.hasDigital = true;
+        PublishLocked();
+    }
+
+    void AuthoritativePollState::PublishLatestAnalogSample(const AnalogSample& sample)
+    {
+        const auto sequence = _latestSampleSequence.load(std::memory_order_relaxed);
+        _latestSampleSequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        _latestMoveX.store(sample.moveX, std::memory_order_relaxed);
+        _latestMoveY.store(sample.moveY, std::memory_order_relaxed);
+        _latestLookX.store(sample.lookX, std::memory_order_relaxed);
+        _latestLookY.store(sample.lookY, std::memory_order_relaxed);
+        _latestLeftTrigger.store(sample.leftTrigger, std::memory_order_relaxed);
+        _latestRightTrigger.store(sample.rightTrigger, std::memory_order_relaxed);
+        _latestSampleSequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    void AuthoritativePollState::PublishLateLatchChannels(std::uint8_t channelMask)
+    {
+        std::scoped_lock lock(_writerMutex);
+        _pending.lateLatchChannels = channelMask;
+        PublishLocked();
+    }
 
-        const auto expireMs = _unmanagedPulseExpireMs.load(std::memory_order_acquire);
-        if (expireMs > 0 && NowMs() >= expireMs) {
-            auto expectedExpireMs = expireMs;
-            if (_unmanagedPulseExpireMs.compare_exchange_strong(
-                    expectedExpireMs,
-                    0,
-                    std::memory_order_acq_rel,
-                    std::memory_order_acquire)) {
-                _unmanagedPulseDown.store(0, std::memory_order_release);
+    AuthoritativePollFrame AuthoritativePollState::ReadSnapshot() const
+    {
+        std::array<std::uint64_t, kPublishedWords> words{};
+        for (;;) {
+            // The writer never fills the published slot, so this only retries
+            // when the reader stalled long enough for the slot to be reused.
+            const auto& slot = _slots[_publishedSlot.load(std::memory_order_acquire)];
+            const auto begin = slot.sequence.load(std::memory_order_acquire);
+            if ((begin & 1u) != 0) {
+                continue;
+            }
+            for (std::size_t i = 0; i < kPublishedWords; ++i) {
+                words[i] = slot.words[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load(std::memory_order_relaxed) == begin) {
+                break;
             }
         }
 
-        frame.unmanagedDownMask =
-            _unmanagedHeldDown.load(std::memory_order_acquire) |
-            _unmanagedPulseDown.load(std::memory_order_acquire);
-        frame.unmanagedPressedMask = _unmanagedPressedMask.load(std::memory_order_acquire);
-        frame.unmanagedReleasedMask = _unmanagedReleasedMask.load(std::memory_order_acquire);
-        frame.unmanagedPulseMask = _unmanagedPulseMask.load(std::memory_order_acquire);
-        frame.committedDownMask = _committedDownMask.load(std::memory_order_acquire);
-        frame.committedPressedMask = _committedPressedMask.load(std::memory_order_acquire);
-        frame.committedReleasedMask = _committedReleasedMask.load(std::memory_order_acquire);
-        frame.managedMask = _managedMask.load(std::memory_order_acquire);
-        frame.context = static_cast<InputContext>(_contextValue.load(std::memory_order_acquire));
-        frame.contextEpoch = _contextEpoch.load(std::memory_order_acquire);
-        frame.sourceTimestampUs = _sourceTimestampUs.load(std::memory_order_acquire);
-        frame.pollSequence = _pollSequence.load(std::memory_order_acquire);
-        frame.hasDigital = _hasDigital.load(std::memory_order_acquire);
+        PublishedState state;
+        std::memcpy(&state, words.data(), sizeof(PublishedState));
+
+        AuthoritativePollFrame frame{};
+        frame.stateVersion = state.version;
+
+        auto pulseDown = state.unmanagedPulseDown;
+        if (state.unmanagedPulseExpireMs > 0 && NowMs() >= state.unmanagedPulseExpireMs) {
+            pulseDown = 0;
+        }
+
+        frame.unmanagedDownMask = state.unmanagedHeldDown | pulseDown;
+        frame.unmanagedPressedMask = state.unmanagedPressedMask;
+        frame.unmanagedReleasedMask = state.unmanagedReleasedMask;
+        frame.unmanagedPulseMask = state.unmanagedPulseMask;
+        frame.committedDownMask = state.committedDownMask;
+        frame.committedPressedMask = state.committedPressedMask;
+        frame.committedReleasedMask = state.committedReleasedMask;
+        frame.managedMask = state.managedMask;
+        frame.context = static_cast<InputContext>(state.contextValue);
+        frame.contextEpoch = state.contextEpoch;
+        frame.sourceTimestampUs = state.sourceTimestampUs;
+        frame.pollSequence = state.pollSequence;
+        frame.hasDigital = state.hasDigital;
         frame.downMask = (frame.unmanagedDownMask & ~frame.managedMask) | frame.committedDownMask;
         frame.pressedMask = (frame.unmanagedPressedMask & ~frame.managedMask) | frame.committedPressedMask;
         frame.releasedMask = (frame.unmanagedReleasedMask & ~frame.managedMask) | frame.committedReleasedMask;
         frame.pulseMask = frame.unmanagedPulseMask & ~frame.managedMask;
 
-        frame.hasAnalog = _hasAnalog.load(std::memory_order_acquire);
+        frame.hasAnalog = state.hasAnalog;
         if (frame.hasAnalog) {
-            frame.moveX = _moveX.load(std::memory_order_acquire);
-            frame.moveY = _moveY.load(std::memory_order_acquire);
-            frame.lookX = _lookX.load(std::memory_order_acquire);
-            frame.lookY = _lookY.load(std::memory_order_acquire);
-            frame.leftTrigger = _leftTrigger.load(std::memory_order_acquire);
-            frame.rightTrigger = _rightTrigger.load(std::memory_order_acquire);
+            frame.moveX = state.moveX;
+            frame.moveY = state.moveY;
+            frame.lookX = state.lookX;
+            frame.lookY = state.lookY;
+            frame.leftTrigger = state.leftTrigger;
+            frame.rightTrigger = state.rightTrigger;
+        }
+
+        const auto lateLatchChannels = state.lateLatchChannels;
+        if (frame.hasAnalog && lateLatchChannels != LateLatchChannelNone) {
+            // The poll must never wait on the HID thread: after a few torn
+            // reads fall back to the drained values.
+            for (auto attempt = 0; attempt < kLatestSampleReadAttempts; ++attempt) {
+                const auto begin = _latestSampleSequence.load(std::memory_order_acquire);
+                if (begin == 0 || (begin & 1u) != 0) {
+                    continue;
+                }
+                const AnalogSample latest{
+                    .moveX = _latestMoveX.load(std::memory_order_relaxed),
+                    .moveY = _latestMoveY.load(std::memory_order_relaxed),
+                    .lookX = _latestLookX.load(std::memory_order_relaxed),
+                    .lookY = _latestLookY.load(std::memory_order_relaxed),
+                    .leftTrigger = _latestLeftTrigger.load(std::memory_order_relaxed),
+                    .rightTrigger = _latestRightTrigger.load(std::memory_order_relaxed)
+                };
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (_latestSampleSequence.load(std::memory_order_relaxed) != begin) {
+                    continue;
+                }
+
+                if ((lateLatchChannels & LateLatchChannelMove) != 0) {
+                    frame.moveX = latest.moveX;
+                    frame.moveY = latest.moveY;
+                }
+                if ((lateLatchChannels & LateLatchChannelLook) != 0) {
+                    frame.lookX = latest.lookX;
+                    frame.lookY = latest.lookY;
+                }
+                if ((lateLatchChannels & LateLatchChannelLeftTrigger) != 0) {
+                    frame.leftTrigger = latest.leftTrigger;
+                }
+                if ((lateLatchChannels & LateLatchChannelRightTrigger) != 0) {
+                    frame.rightTrigger = latest.rightTrigger;
+                }
+                frame.lateLatchedMask = lateLatchChannels;
+                break;
+            }
         }
 
-        frame.overflowed = _overflowed.load(std::memory_order_acquire);
-        frame.coalesced = _coalesced.load(std::memory_order_acquire);
+        frame.overflowed = state.overflowed;
+        frame.coalesced = state.coalesced;
 
         return frame;
     }
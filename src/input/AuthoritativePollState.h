@@ -2,11 +2,38 @@
 
 #include "input_v2/compat/LegacyInputContextCompat.h"
 
+#include <array>
 #include <atomic>
 #include <cstdint>
+#include <mutex>
+#include <optional>
 
 namespace dualpad::input
 {
+    // Analog outputs FillSyntheticXInputState may late-latch: read from the
+    // freshest HID sample at poll time instead of the last drained frame. The
+    // drain publishes a channel only when its gate is open and the active
+    // bindings pass its physical control through unchanged, so a stick moved
+    // from rest latches on the same poll.
+    enum LateLatchChannelMask : std::uint8_t
+    {
+        LateLatchChannelNone = 0,
+        LateLatchChannelMove = 1u << 0,
+        LateLatchChannelLook = 1u << 1,
+        LateLatchChannelLeftTrigger = 1u << 2,
+        LateLatchChannelRightTrigger = 1u << 3
+    };
+
+    struct AnalogSample
+    {
+        float moveX{ 0.0f };
+        float moveY{ 0.0f };
+        float lookX{ 0.0f };
+        float lookY{ 0.0f };
+        float leftTrigger{ 0.0f };
+        float rightTrigger{ 0.0f };
+    };
+
     struct AuthoritativePollFrame
     {
         std::uint32_t downMask{ 0 };
@@ -36,17 +63,53 @@ namespace dualpad::input
         float leftTrigger{ 0.0f };
         float rightTrigger{ 0.0f };
 
+        // Publication the frame was read from; every field above comes from
+        // the same one.
+        std::uint64_t stateVersion{ 0 };
+
+        std::uint8_t lateLatchedMask{ LateLatchChannelNone };
         bool hasDigital{ false };
         bool hasAnalog{ false };
         bool overflowed{ false };
         bool coalesced{ false };
     };
 
+    // Everything the drain publishes for one stable frame. Applied as a
+    // single version so the poll never mixes one frame's analog with another
+    // frame's metadata or latch channels.
+    struct DrainedFramePublication
+    {
+        // Absent when the frame's output apply failed: the poll keeps the
+        // last analog state that was fully applied.
+        std::optional<AnalogSample> analog;
+        std::uint8_t lateLatchChannels{ LateLatchChannelNone };
+        std::uint64_t sourceTimestampUs{ 0 };
+        bool overflowed{ false };
+        bool coalesced{ false };
+    };
+
     class AuthoritativePollState
     {
     public:
+        AuthoritativePollState();
+
         static AuthoritativePollState& GetSingleton();
 
+        // Groups several writer calls into one publication, so the poll never
+        // sees e.g. this frame's edges with last frame's held buttons.
+        class ScopedPublish
+        {
+        public:
+            explicit ScopedPublish(AuthoritativePollState& state);
+            ~ScopedPublish();
+
+            ScopedPublish(const ScopedPublish&) = delete;
+            ScopedPublish& operator=(const ScopedPublish&) = delete;
+
+        private:
+            AuthoritativePollState& _state;
+        };
+
         void Reset();
 
         void SetUnmanagedButton(std::uint32_t bit, bool down);
@@ -74,35 +137,87 @@ namespace dualpad::input
             float lookY,
             float leftTrigger,
             float rightTrigger);
+        // The drain's one publication per stable frame. Committed buttons are
+        // published separately by the poll-time commit.
+        void PublishDrainedFrame(const DrainedFramePublication& frame);
 
-        [[nodiscard]] AuthoritativePollFrame ReadSnapshot();
+        // Late-latch mode. The HID thread publishes every normalized sample;
+        // the drain publishes which channels may use it (none unless opted in).
+        void PublishLatestAnalogSample(const AnalogSample& sample);
+        void PublishLateLatchChannels(std::uint8_t channelMask);
+
+        // Lock-free for the poll hook: one acquire load picks the published
+        // slot and the copy is validated against that slot's sequence. A
+        // retry needs the reader to stall across two further publications,
+        // so it is rare but not bounded.
+        [[nodiscard]] AuthoritativePollFrame ReadSnapshot() const;
 
     private:
-        std::atomic<std::uint32_t> _unmanagedHeldDown{ 0 };
-        std::atomic<std::uint32_t> _unmanagedPulseDown{ 0 };
-        std::atomic<std::uint64_t> _unmanagedPulseExpireMs{ 0 };
-
-        std::atomic<std::uint32_t> _committedDownMask{ 0 };
-        std::atomic<std::uint32_t> _committedPressedMask{ 0 };
-        std::atomic<std::uint32_t> _committedReleasedMask{ 0 };
-        std::atomic<std::uint32_t> _managedMask{ 0 };
-        std::atomic<std::uint32_t> _unmanagedPressedMask{ 0 };
-        std::atomic<std::uint32_t> _unmanagedReleasedMask{ 0 };
-        std::atomic<std::uint32_t> _unmanagedPulseMask{ 0 };
-        std::atomic<std::uint32_t> _contextValue{ static_cast<std::uint32_t>(InputContext::Gameplay) };
-        std::atomic<std::uint32_t> _contextEpoch{ 0 };
-        std::atomic<std::uint64_t> _sourceTimestampUs{ 0 };
-        std::atomic<std::uint64_t> _pollSequence{ 0 };
-
-        std::atomic<float> _moveX{ 0.0f };
-        std::atomic<float> _moveY{ 0.0f };
-        std::atomic<float> _lookX{ 0.0f };
-        std::atomic<float> _lookY{ 0.0f };
-        std::atomic<float> _leftTrigger{ 0.0f };
-        std::atomic<float> _rightTrigger{ 0.0f };
-        std::atomic_bool _hasDigital{ false };
-        std::atomic_bool _hasAnalog{ false };
-        std::atomic_bool _overflowed{ false };
-        std::atomic_bool _coalesced{ false };
+        // Raw writer-side state. Derived masks are computed on read.
+        struct PublishedState
+        {
+            std::uint64_t version{ 0 };
+            std::uint64_t unmanagedPulseExpireMs{ 0 };
+            std::uint64_t sourceTimestampUs{ 0 };
+            std::uint64_t pollSequence{ 0 };
+
+            std::uint32_t unmanagedHeldDown{ 0 };
+            std::uint32_t unmanagedPulseDown{ 0 };
+            std::uint32_t committedDownMask{ 0 };
+            std::uint32_t committedPressedMask{ 0 };
+            std::uint32_t committedReleasedMask{ 0 };
+            std::uint32_t managedMask{ 0 };
+            std::uint32_t unmanagedPressedMask{ 0 };
+            std::uint32_t unmanagedReleasedMask{ 0 };
+            std::uint32_t unmanagedPulseMask{ 0 };
+            std::uint32_t contextValue{ static_cast<std::uint32_t>(InputContext::Gameplay) };
+            std::uint32_t contextEpoch{ 0 };
+
+            float moveX{ 0.0f };
+            float moveY{ 0.0f };
+            float lookX{ 0.0f };
+            float lookY{ 0.0f };
+            float leftTrigger{ 0.0f };
+            float rightTrigger{ 0.0f };
+
+            std::uint8_t lateLatchChannels{ LateLatchChannelNone };
+            bool hasDigital{ false };
+            bool hasAnalog{ false };
+            bool overflowed{ false };
+            bool coalesced{ false };
+        };
+
+        static constexpr std::size_t kPublishedWords =
+            (sizeof(PublishedState) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+        static constexpr std::uint32_t kPublishedSlotCount = 3;
+
+        // The writer fills a slot the poll is not pointed at, then swaps the
+        // index. The per-slot sequence only matters if a reader stalls across
+        // two further publications and its slot comes round again.
+        struct alignas(64) PublishedSlot
+        {
+            std::atomic<std::uint64_t> sequence{ 0 };
+            std::array<std::atomic<std::uint64_t>, kPublishedWords> words{};
+        };
+
+        void BeginPublish();
+        void EndPublish();
+        void PublishLocked();
+
+        std::recursive_mutex _writerMutex;
+        std::uint32_t _publishDepth{ 0 };
+        PublishedState _pending{};
+
+        std::array<PublishedSlot, kPublishedSlotCount> _slots{};
+        std::atomic<std::uint32_t> _publishedSlot{ 0 };
+
+        // Single-writer seqlock over the latest HID sample; odd while writing.
+        std::atomic<std::uint32_t> _latestSampleSequence{ 0 };
+        std::atomic<float> _latestMoveX{ 0.0f };
+        std::atomic<float> _latestMoveY{ 0.0f };
+        std::atomic<float> _latestLookX{ 0.0f };
+        std::atomic<float> _latestLookY{ 0.0f };
+        std::atomic<float> _latestLeftTrigger{ 0.0f };
+        std::atomic<float> _latestRightTrigger{ 0.0f };
     };
 }
@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "input/HidReader.h"
 
+#include "input/AuthoritativePollState.h"
 #include "input/hid/DualSenseDevice.h"
 #include "input/injection/PadEventSnapshotDispatcher.h"
 #include "input/injection/PadEventSnapshot.h"
@@ -34,6 +35,11 @@ namespace
             return;
         }
 
+        auto& contextResolver = dualpad::input_v2::context::ContextResolver::GetSingleton();
+        // Local copy of the published context, refreshed only when the seqlock
+        // revision moves, so steady-state packets take no pin.
+        auto contextSnapshot = contextResolver.GetPublishedSnapshot();
+
         dualpad::input::DualSenseDevice device;
         while (g_running.load(std::memory_order_acquire)) {
             if (!device.IsOpen()) {
@@ -77,11 +83,22 @@ namespace
             dualpad::input::LogParseSuccess(currentState);
             dualpad::input::NormalizePadState(currentState);
             dualpad::input::LogStateSummary(currentState);
-
-            const auto& contextSnapshot =
-                dualpad::input_v2::context::ContextResolver::GetSingleton().GetPublishedSnapshot();
-            const auto snapshotContext = contextSnapshot.legacyInputContext;
-            const auto snapshotContextEpoch = contextSnapshot.legacyContextEpoch;
+            dualpad::input::AuthoritativePollState::GetSingleton().PublishLatestAnalogSample(
+                dualpad::input::AnalogSample{
+                    .moveX = currentState.leftStick.x,
+                    .moveY = currentState.leftStick.y,
+                    .lookX = currentState.rightStick.x,
+                    .lookY = currentState.rightStick.y,
+                    .leftTrigger = currentState.leftTrigger.normalized,
+                    .rightTrigger = currentState.rightTrigger.normalized
+                });
+
+            const auto contextFields = contextResolver.ReadPublishedFields();
+            if (contextFields.contextRevision != contextSnapshot.contextRevision) {
+                contextSnapshot = *contextResolver.PinPublishedSnapshot();
+            }
+            const auto snapshotContext = contextFields.legacyInputContext;
+            const auto snapshotContextEpoch = contextFields.legacyContextEpoch;
 
             dualpad::input::PadEventBuffer events{};
             dualpad::input_v2::ingress::LiveInputFactProducer::GetSingleton().PublishGamepadSourceEvidence(
@@ -30,8 +30,9 @@ namespace dualpad::input
             }
 
             auto& producer = input_v2::ingress::LiveInputFactProducer::GetSingleton();
-            const auto& contextSnapshot =
-                input_v2::context::ContextResolver::GetSingleton().GetPublishedSnapshot();
+            const auto contextSnapshotPin =
+                input_v2::context::ContextResolver::GetSingleton().PinPublishedSnapshot();
+            const auto& contextSnapshot = *contextSnapshotPin;
             for (auto* current = *events; current; current = current->next) {
                 const auto tick = NowMonotonicUs();
                 switch (current->GetEventType()) {
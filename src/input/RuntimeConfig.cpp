@@ -172,6 +172,9 @@ namespace dualpad::input
                 _enableForceCrossContextRecoveryProbe =
                     ini::ParseBool(it->second, _enableForceCrossContextRecoveryProbe);
             }
+            if (auto it = values.find("enable_late_latched_analog"); it != values.end()) {
+                _enableLateLatchedAnalog = ini::ParseBool(it->second, _enableLateLatchedAnalog);
+            }
         };
 
         const auto parseFeatures = [&](const auto& values) {
@@ -203,6 +206,15 @@ namespace dualpad::input
             if (auto it = values.find("trace_record_glyph_queries"); it != values.end()) {
                 _traceRecordGlyphQueries = ini::ParseBool(it->second, _traceRecordGlyphQueries);
             }
+            if (auto it = values.find("enable_flight_recorder"); it != values.end()) {
+                _enableFlightRecorder = ini::ParseBool(it->second, _enableFlightRecorder);
+            }
+            if (auto it = values.find("flight_recorder_output_dir"); it != values.end()) {
+                const auto value = ini::Trim(it->second);
+                if (!value.empty()) {
+                    _flightRecorderOutputDir = value;
+                }
+            }
         };
         try {
             if (auto it = sections.find("Logging"); it != sections.end()) {
@@ -223,7 +235,7 @@ namespace dualpad::input
         }
 
         logger::info(
-            "[DualPad][RuntimeConfig] logging packets={} hex={} state={} mapping={} synthetic={} actionPlan={} native={} keyboard={} routeHealth={} injection upstreamGamepad={} upstreamMode={} crossContextProbe={} features comboHotkeys3to8={} replay trace={} outputDir={} session={} glyphQueries={}",
+            "[DualPad][RuntimeConfig] logging packets={} hex={} state={} mapping={} synthetic={} actionPlan={} native={} keyboard={} routeHealth={} injection upstreamGamepad={} upstreamMode={} crossContextProbe={} lateLatchAnalog={} features comboHotkeys3to8={} replay trace={} outputDir={} session={} glyphQueries={} flightRecorder={} flightOutputDir={}",
             _logInputPackets,
             _logInputHex,
             _logInputState,
@@ -236,11 +248,14 @@ namespace dualpad::input
             _useUpstreamGamepadHook,
             ToString(_upstreamGamepadHookMode),
             _enableForceCrossContextRecoveryProbe,
+            _enableLateLatchedAnalog,
             _enableComboNativeHotkeys3To8,
             _enableTraceRecording,
             _traceOutputDir.string(),
             _traceSession,
-            _traceRecordGlyphQueries);
+            _traceRecordGlyphQueries,
+            _enableFlightRecorder,
+            _flightRecorderOutputDir.string());
         if (_useUpstreamGamepadHook) {
             logger::warn(
                 "[DualPad][RuntimeConfig] use_upstream_gamepad_hook enables the official upstream XInput route; rollback remains use_upstream_gamepad_hook=false (mode={})",
@@ -269,10 +284,13 @@ namespace dualpad::input
         _traceOutputDir = "build/replay-captures";
         _traceSession = "default";
         _traceRecordGlyphQueries = true;
+        _enableFlightRecorder = true;
+        _flightRecorderOutputDir = "DualPad/flight-captures";
 
         _useUpstreamGamepadHook = true;
         _upstreamGamepadHookMode = UpstreamGamepadHookMode::PollXInputCall;
         _enableForceCrossContextRecoveryProbe = false;
+        _enableLateLatchedAnalog = false;
         _enableComboNativeHotkeys3To8 = false;
     }
 }
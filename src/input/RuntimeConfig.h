@@ -34,10 +34,13 @@ namespace dualpad::input
         const std::filesystem::path& TraceOutputDir() const { return _traceOutputDir; }
         std::string_view TraceSession() const { return _traceSession; }
         bool TraceRecordGlyphQueries() const { return _traceRecordGlyphQueries; }
+        bool EnableFlightRecorder() const { return _enableFlightRecorder; }
+        const std::filesystem::path& FlightRecorderOutputDir() const { return _flightRecorderOutputDir; }
 
         bool UseUpstreamGamepadHook() const { return _useUpstreamGamepadHook; }
         UpstreamGamepadHookMode GetUpstreamGamepadHookMode() const { return _upstreamGamepadHookMode; }
         bool EnableForceCrossContextRecoveryProbe() const { return _enableForceCrossContextRecoveryProbe; }
+        bool EnableLateLatchedAnalog() const { return _enableLateLatchedAnalog; }
         bool EnableComboNativeHotkeys3To8() const { return _enableComboNativeHotkeys3To8; }
 
     private:
@@ -62,10 +65,13 @@ namespace dualpad::input
         std::filesystem::path _traceOutputDir{ "build/replay-captures" };
         std::string _traceSession{ "default" };
         bool _traceRecordGlyphQueries{ true };
+        bool _enableFlightRecorder{ true };
+        std::filesystem::path _flightRecorderOutputDir{ "DualPad/flight-captures" };
 
         bool _useUpstreamGamepadHook{ true };
         UpstreamGamepadHookMode _upstreamGamepadHookMode{ UpstreamGamepadHookMode::PollXInputCall };
         bool _enableForceCrossContextRecoveryProbe{ false };
+        bool _enableLateLatchedAnalog{ false };
         bool _enableComboNativeHotkeys3To8{ false };
     };
 }
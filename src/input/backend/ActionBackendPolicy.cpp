@@ -15,6 +15,7 @@ namespace dualpad::input::backend
         {
             return actionId == actions::ToggleHUD ||
                 actionId == actions::Screenshot ||
+                actionId == actions::FlightRecorderDump ||
                 false;
         }
 
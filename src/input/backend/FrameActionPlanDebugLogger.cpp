@@ -60,7 +60,7 @@ namespace dualpad::input::backend
         const auto xinputPulseButtons = input::ToXInputButtons(frame.pulseMask);
 
         logger::info(
-            "[DualPad][AuthoritativePoll] poll={} ctx={} epoch={} srcTs={} down=0x{:08X} pressed=0x{:08X} released=0x{:08X} pulse=0x{:08X} xinputButtons=0x{:04X} xinputPressed=0x{:04X} xinputReleased=0x{:04X} xinputPulse=0x{:04X} unmanagedDown=0x{:08X} unmanagedPressed=0x{:08X} unmanagedReleased=0x{:08X} unmanagedPulse=0x{:08X} committedDown=0x{:08X} committedPressed=0x{:08X} committedReleased=0x{:08X} managed=0x{:08X} hasDigital={} hasAnalog={} overflowed={} coalesced={} move=({:.3f},{:.3f}) look=({:.3f},{:.3f}) triggers=({:.3f},{:.3f})",
+            "[DualPad][AuthoritativePoll] poll={} ctx={} epoch={} srcTs={} down=0x{:08X} pressed=0x{:08X} released=0x{:08X} pulse=0x{:08X} xinputButtons=0x{:04X} xinputPressed=0x{:04X} xinputReleased=0x{:04X} xinputPulse=0x{:04X} unmanagedDown=0x{:08X} unmanagedPressed=0x{:08X} unmanagedReleased=0x{:08X} unmanagedPulse=0x{:08X} committedDown=0x{:08X} committedPressed=0x{:08X} committedReleased=0x{:08X} managed=0x{:08X} hasDigital={} hasAnalog={} overflowed={} coalesced={} move=({:.3f},{:.3f}) look=({:.3f},{:.3f}) triggers=({:.3f},{:.3f}) lateLatched=0x{:X}",
             frame.pollSequence,
             input::ToString(frame.context),
             frame.contextEpoch,
@@ -90,6 +90,7 @@ namespace dualpad::input::backend
             frame.lookX,
             frame.lookY,
             frame.leftTrigger,
-            frame.rightTrigger);
+            frame.rightTrigger,
+            frame.lateLatchedMask);
     }
 }
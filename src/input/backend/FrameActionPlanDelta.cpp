@@ -0,0 +1,169 @@
+#include "pch.h"
+#include "input/backend/FrameActionPlanDelta.h"
+
+#include <algorithm>
+#include <functional>
+
+namespace dualpad::input::backend
+{
+    namespace
+    {
+        bool HoldIsIdempotent(ActionOutputContract contract)
+        {
+            return contract == ActionOutputContract::Pulse ||
+                contract == ActionOutputContract::Hold ||
+                contract == ActionOutputContract::Toggle;
+        }
+
+        bool SameIdentity(const PlannedActionState& lhs, const PlannedActionState& rhs)
+        {
+            return lhs.backend == rhs.backend &&
+                lhs.outputCode == rhs.outputCode &&
+                lhs.actionId == rhs.actionId;
+        }
+
+        std::size_t IdentityHash(const PlannedActionState& action)
+        {
+            auto hash = std::hash<std::string_view>{}(action.actionId);
+            hash ^= (static_cast<std::size_t>(action.outputCode) << 8) ^ static_cast<std::size_t>(action.backend);
+            return hash * 0x9E3779B97F4A7C15ull;
+        }
+    }
+
+    void FrameActionPlanDelta::Baseline::Clear()
+    {
+        slots.fill(kEmptySlot);
+        count = 0;
+    }
+
+    const PlannedActionState* FrameActionPlanDelta::Baseline::Find(const PlannedActionState& action) const
+    {
+        if (count == 0) {
+            return nullptr;
+        }
+        for (auto slot = IdentityHash(action) & (kIndexSlots - 1);; slot = (slot + 1) & (kIndexSlots - 1)) {
+            const auto index = slots[slot];
+            if (index == kEmptySlot) {
+                return nullptr;
+            }
+            if (SameIdentity(actions[index], action)) {
+                return &actions[index];
+            }
+        }
+    }
+
+    bool FrameActionPlanDelta::Baseline::Insert(const PlannedActionState& action)
+    {
+        for (auto slot = IdentityHash(action) & (kIndexSlots - 1);; slot = (slot + 1) & (kIndexSlots - 1)) {
+            auto& index = slots[slot];
+            if (index == kEmptySlot) {
+                if (count >= actions.size()) {
+                    return false;
+                }
+                index = static_cast<std::uint8_t>(count);
+                actions[count++] = action;
+                return true;
+            }
+            // A source listed twice keeps its last phase.
+            if (SameIdentity(actions[index], action)) {
+                actions[index] = action;
+                return true;
+            }
+        }
+    }
+
+    void FrameActionPlanDelta::Reset()
+    {
+        for (auto& baseline : _baselines) {
+            baseline.Clear();
+        }
+        _previous = 0;
+        _framesSinceResync = 0;
+        _frameAdmitted = 0;
+        _frameForwarded = 0;
+        _frameFullResync = false;
+        _resyncPending = true;
+        _stats = {};
+    }
+
+    void FrameActionPlanDelta::RequestFullResync()
+    {
+        _resyncPending = true;
+    }
+
+    bool FrameActionPlanDelta::BeginFrame()
+    {
+        ++_framesSinceResync;
+        _frameFullResync = _resyncPending || _framesSinceResync >= kFullResyncIntervalFrames;
+        if (_frameFullResync) {
+            _framesSinceResync = 0;
+            _resyncPending = false;
+        }
+        _baselines[_previous ^ 1].Clear();
+        _frameAdmitted = 0;
+        _frameForwarded = 0;
+        return _frameFullResync;
+    }
+
+    bool FrameActionPlanDelta::Admit(const PlannedActionState& action)
+    {
+        ++_frameAdmitted;
+        const bool forward = _frameFullResync || !IsAlreadyApplied(action);
+        if (!_baselines[_previous ^ 1].Insert(action)) {
+            // More actions than a plan holds: this frame's baseline is lossy,
+            // so do not diff the next one against it.
+            _resyncPending = true;
+        }
+        if (forward) {
+            ++_frameForwarded;
+        }
+        return forward;
+    }
+
+    void FrameActionPlanDelta::EndFrame()
+    {
+        _previous ^= 1;
+
+        ++_stats.frames;
+        if (_frameFullResync) {
+            ++_stats.fullResyncFrames;
+        }
+        if (_frameForwarded == 0) {
+            ++_stats.emptyDeltaFrames;
+        }
+        _stats.plannedActions += _frameAdmitted;
+        _stats.deltaActions += _frameForwarded;
+        _stats.skippedActions += _frameAdmitted - _frameForwarded;
+        _stats.lastDeltaSize = _frameForwarded;
+        _stats.maxDeltaSize = (std::max)(_stats.maxDeltaSize, _frameForwarded);
+    }
+
+    FrameActionPlanDelta::Stats FrameActionPlanDelta::GetStats() const
+    {
+        return _stats;
+    }
+
+    bool FrameActionPlanDelta::IsAlreadyApplied(const PlannedActionState& action) const
+    {
+        const auto* committed = _baselines[_previous].Find(action);
+        if (!committed ||
+            committed->context != action.context ||
+            committed->contextEpoch != action.contextEpoch ||
+            committed->contract != action.contract) {
+            return false;
+        }
+
+        switch (action.phase) {
+        case PlannedActionPhase::Hold:
+            return HoldIsIdempotent(action.contract) &&
+                (committed->phase == PlannedActionPhase::Press ||
+                 committed->phase == PlannedActionPhase::Hold);
+        case PlannedActionPhase::Value:
+            return committed->phase == PlannedActionPhase::Value &&
+                committed->valueX == action.valueX &&
+                committed->valueY == action.valueY;
+        default:
+            return false;
+        }
+    }
+}
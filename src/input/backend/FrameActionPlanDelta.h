@@ -0,0 +1,98 @@
+#pragma once
+
+#include "input/backend/FrameActionPlan.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace dualpad::input::backend
+{
+    // What the delta compares for one planned action. `actionId` must be an
+    // interned id (actions::InternActionId): the baseline keeps the view until
+    // the next frame instead of copying the string.
+    struct PlannedActionState
+    {
+        PlannedBackend backend{ PlannedBackend::None };
+        PlannedActionPhase phase{ PlannedActionPhase::None };
+        InputContext context{ InputContext::Gameplay };
+        ActionOutputContract contract{ ActionOutputContract::None };
+        std::uint32_t outputCode{ 0 };
+        std::uint32_t contextEpoch{ 0 };
+        float valueX{ 0.0f };
+        float valueY{ 0.0f };
+        std::string_view actionId{};
+    };
+
+    // Reduces each frame's planned actions to the ones a backend has not
+    // already applied. The comparison is against everything admitted on the
+    // previous frame, so a steady-held source costs nothing after its Press.
+    //
+    // Only phases that are idempotent on every backend are dropped: a Hold that
+    // follows Press/Hold for a Pulse, Hold or Toggle contract, and a Value whose
+    // components did not change. Repeat holds always pass because the helper
+    // schedules repeats from heldSeconds.
+    class FrameActionPlanDelta
+    {
+    public:
+        // A full plan is forwarded once per interval so a backend that lost
+        // state without a phase edge still converges.
+        static constexpr std::uint32_t kFullResyncIntervalFrames = 120;
+
+        struct Stats
+        {
+            std::uint64_t frames{ 0 };
+            std::uint64_t fullResyncFrames{ 0 };
+            std::uint64_t emptyDeltaFrames{ 0 };
+            std::uint64_t plannedActions{ 0 };
+            std::uint64_t deltaActions{ 0 };
+            std::uint64_t skippedActions{ 0 };
+            std::size_t lastDeltaSize{ 0 };
+            std::size_t maxDeltaSize{ 0 };
+        };
+
+        void Reset();
+        void RequestFullResync();
+
+        // Opens a frame. Returns true when every action of it is forwarded.
+        bool BeginFrame();
+        // Adds `action` to this frame's baseline and returns whether it must
+        // reach the backend.
+        bool Admit(const PlannedActionState& action);
+        // Closes the frame; what it admitted is the next frame's baseline.
+        void EndFrame();
+
+        [[nodiscard]] Stats GetStats() const;
+
+    private:
+        // Open-addressed over the action identity; at least twice kMaxActions
+        // so probes stay short.
+        static constexpr std::size_t kIndexSlots = 256;
+        static constexpr std::uint8_t kEmptySlot = 0xFF;
+        static_assert(FrameActionPlan::kMaxActions < kEmptySlot);
+        static_assert(kIndexSlots >= 2 * FrameActionPlan::kMaxActions);
+
+        struct Baseline
+        {
+            std::array<PlannedActionState, FrameActionPlan::kMaxActions> actions{};
+            std::array<std::uint8_t, kIndexSlots> slots{};
+            std::size_t count{ 0 };
+
+            void Clear();
+            [[nodiscard]] const PlannedActionState* Find(const PlannedActionState& action) const;
+            bool Insert(const PlannedActionState& action);
+        };
+
+        [[nodiscard]] bool IsAlreadyApplied(const PlannedActionState& action) const;
+
+        std::array<Baseline, 2> _baselines{};
+        std::size_t _previous{ 0 };
+        std::uint32_t _framesSinceResync{ 0 };
+        std::size_t _frameAdmitted{ 0 };
+        std::size_t _frameForwarded{ 0 };
+        bool _frameFullResync{ false };
+        bool _resyncPending{ true };
+        Stats _stats{};
+    };
+}
@@ -155,6 +155,24 @@ namespace dualpad::input::backend
     bool NativeButtonCommitBackend::ApplyPlannedAction(const PlannedAction& action)
     {
         std::scoped_lock lock(_lock);
+        return ApplyPlannedActionLocked(action);
+    }
+
+    std::size_t NativeButtonCommitBackend::ApplyPlannedActions(const FrameActionPlan& plan)
+    {
+        std::scoped_lock lock(_lock);
+        std::size_t applied = 0;
+        for (const auto& action : plan) {
+            if (!ApplyPlannedActionLocked(action)) {
+                break;
+            }
+            ++applied;
+        }
+        return applied;
+    }
+
+    bool NativeButtonCommitBackend::ApplyPlannedActionLocked(const PlannedAction& action)
+    {
         if (IsGameplayDigitalSuppressionCandidate(action) &&
             _suppressGameplayDigitalTransientActions) {
             if (ShouldLogPollCommit()) {
@@ -201,9 +219,9 @@ namespace dualpad::input::backend
         std::scoped_lock lock(_lock);
 
         const auto nowUs = NowUs();
-        const auto& contextSnapshot = dualpad::input_v2::context::ContextResolver::GetSingleton().GetPublishedSnapshot();
-        const auto context = contextSnapshot.legacyInputContext;
-        const auto contextEpoch = contextSnapshot.legacyContextEpoch;
+        const auto contextFields = dualpad::input_v2::context::ContextResolver::GetSingleton().ReadPublishedFields();
+        const auto context = contextFields.legacyInputContext;
+        const auto contextEpoch = contextFields.legacyContextEpoch;
         _frameContext = context;
         _frameContextEpoch = contextEpoch;
 
@@ -528,7 +546,7 @@ namespace dualpad::input::backend
                 dualpad::input::ToString(context));
         }
         _pollCommit.SyncHeldContributor(
-            RE::BSFixedString(actions::Sprint.data()),
+            NativeControlCode::Sprint,
             HeldContributor::KeyboardMouse,
             kbmSprintHeld);
     }
@@ -7,6 +7,7 @@
 #include "input/backend/PollCommitCoordinator.h"
 #endif
 
+#include <cstddef>
 #include <cstdint>
 #include <mutex>
 #include <string_view>
@@ -62,6 +63,9 @@ namespace dualpad::input::backend
 
         void SetGameplayDigitalGatePlan(bool suppressNewTransientActions);
         bool ApplyPlannedAction(const PlannedAction& action);
+        // Applies the plan under one lock so a poll commit sees all of it or
+        // none. Returns how many actions applied before the first failure.
+        std::size_t ApplyPlannedActions(const FrameActionPlan& plan);
         void ForceCancelGateAwareGameplayTransientActions();
         [[nodiscard]] CommittedButtonState CommitPollState();
 
@@ -104,6 +108,8 @@ namespace dualpad::input::backend
 
         NativeButtonCommitBackend() = default;
 
+        bool ApplyPlannedActionLocked(const PlannedAction& action);
+
         static bool TranslatePlannedActionToCommitRequest(
             const PlannedAction& action,
             PollCommitRequest& outRequest);
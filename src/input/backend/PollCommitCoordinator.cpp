@@ -1,11 +1,12 @@
 #include "pch.h"
 #include "input/backend/PollCommitCoordinator.h"
 
-#include "input/Action.h"
 #include "input/RuntimeConfig.h"
 
 #include <SKSE/SKSE.h>
 
+#include <bit>
+
 namespace logger = SKSE::log;
 
 namespace dualpad::input::backend
@@ -17,21 +18,285 @@ namespace dualpad::input::backend
             return static_cast<std::uint8_t>(contributor);
         }
 
-        bool IsSprintAction(RE::BSFixedString actionId)
-        {
-            return actionId == actions::Sprint;
-        }
-
         bool ShouldLogCoordinator()
         {
             const auto& config = RuntimeConfig::GetSingleton();
             return config.LogActionPlan() || config.LogNativeInjection();
         }
+
+        constexpr std::size_t kModeCount = static_cast<std::size_t>(PollCommitMode::Repeat) + 1;
+        constexpr std::size_t kExecStateCount = static_cast<std::size_t>(ExecState::ReleaseGap) + 1;
+        constexpr std::size_t kPendingKindCount = static_cast<std::size_t>(PendingKind::ForceCancel) + 1;
+        constexpr std::size_t kGuardCount = 16;
+
+        // Per-mode guard bits sampled from the slot before the tick. Bit 0 is
+        // shared; the others depend on the mode being ticked.
+        enum TickGuard : std::uint8_t
+        {
+            TickGuardCanOpen = 1u << 0,
+
+            // Pulse / Toggle
+            TickGuardCanStart = 1u << 1,
+            TickGuardNextPulse = 1u << 2,
+            TickGuardReleaseDue = 1u << 3,
+
+            // Hold
+            TickGuardHoldDemand = 1u << 1,
+            TickGuardHandoffToGamepad = 1u << 2,
+            TickGuardHandoffQueued = 1u << 3,
+
+            // Repeat
+            TickGuardHeldContributors = 1u << 1,
+            TickGuardDownSubmitted = 1u << 2
+        };
+
+        // Applied in declaration order.
+        enum TickOp : std::uint16_t
+        {
+            TickOpNone = 0,
+            TickOpClearPending = 1u << 0,
+            TickOpPromoteNextPulse = 1u << 1,
+            TickOpClearHandoff = 1u << 2,
+            TickOpQueueHandoff = 1u << 3,
+            TickOpEmitterNone = 1u << 4,
+            TickOpEmitterDesired = 1u << 5,
+            TickOpEmitterGamepad = 1u << 6,
+            TickOpStartPulse = 1u << 7,
+            TickOpStartHold = 1u << 8,
+            TickOpStartRepeat = 1u << 9,
+            TickOpClearPendingKind = 1u << 10,
+            TickOpTransition = 1u << 11
+        };
+
+        struct TickRule
+        {
+            std::uint16_t ops{ TickOpNone };
+            ExecState next{ ExecState::Idle };
+        };
+
+        constexpr TickRule Go(std::uint16_t ops, ExecState next)
+        {
+            return TickRule{ .ops = static_cast<std::uint16_t>(ops | TickOpTransition), .next = next };
+        }
+
+        constexpr TickRule Do(std::uint16_t ops)
+        {
+            return TickRule{ .ops = ops };
+        }
+
+        constexpr TickRule BuildTransientRule(ExecState state, PendingKind pending, std::uint8_t guards, PendingKind startKind)
+        {
+            const bool canOpen = (guards & TickGuardCanOpen) != 0;
+            const bool canStart = (guards & TickGuardCanStart) != 0;
+            const bool nextPulse = (guards & TickGuardNextPulse) != 0;
+            const bool releaseDue = (guards & TickGuardReleaseDue) != 0;
+            // Only pulses carry a queued follow-up through WaitingForGate.
+            const bool followsNextPulse = startKind == PendingKind::Pulse;
+
+            switch (state) {
+            case ExecState::Idle:
+                if (pending == PendingKind::ForceCancel) {
+                    return Do(TickOpClearPending);
+                }
+                if (pending == startKind && canStart) {
+                    return canOpen ?
+                        Do(TickOpStartPulse | TickOpClearPendingKind) :
+                        Go(TickOpNone, ExecState::WaitingForGate);
+                }
+                return {};
+
+            case ExecState::WaitingForGate:
+                if (pending == PendingKind::ForceCancel) {
+                    return Go(TickOpClearPending, ExecState::Idle);
+                }
+                if (pending != startKind && !(followsNextPulse && nextPulse)) {
+                    return Go(TickOpNone, ExecState::Idle);
+                }
+                if (canOpen && canStart) {
+                    return Do(static_cast<std::uint16_t>(
+                        (pending != startKind ? TickOpPromoteNextPulse : TickOpNone) |
+                        TickOpStartPulse |
+                        TickOpClearPendingKind));
+                }
+                return {};
+
+            case ExecState::PulseDownVisible:
+                return releaseDue ? Go(TickOpNone, ExecState::ReleaseGap) : TickRule{};
+
+            case ExecState::HoldDownVisible:
+            case ExecState::ReleaseGap:
+            default:
+                return {};
+            }
+        }
+
+        constexpr TickRule BuildHoldRule(ExecState state, PendingKind pending, std::uint8_t guards)
+        {
+            const bool canOpen = (guards & TickGuardCanOpen) != 0;
+            const bool holdDemand = (guards & TickGuardHoldDemand) != 0;
+            const bool handoffToGamepad = (guards & TickGuardHandoffToGamepad) != 0;
+            const bool handoffQueued = (guards & TickGuardHandoffQueued) != 0;
+
+            switch (state) {
+            case ExecState::Idle:
+                if (pending == PendingKind::ForceCancel) {
+                    return Do(TickOpClearPending | TickOpEmitterNone | TickOpClearHandoff);
+                }
+                if (!holdDemand) {
+                    return Do(TickOpClearHandoff | TickOpEmitterDesired | TickOpClearPendingKind);
+                }
+                // A keyboard/mouse-held sprint handing over to the gamepad
+                // spends one tick released so the game sees a fresh press.
+                if (handoffToGamepad && !handoffQueued) {
+                    return Do(TickOpQueueHandoff);
+                }
+                return canOpen ?
+                    Do(TickOpClearHandoff | TickOpStartHold) :
+                    Go(TickOpClearHandoff | TickOpEmitterGamepad, ExecState::WaitingForGate);
+
+            case ExecState::WaitingForGate:
+                if (pending == PendingKind::ForceCancel) {
+                    return Go(TickOpClearPending | TickOpEmitterNone | TickOpClearHandoff, ExecState::Idle);
+                }
+                if (!holdDemand) {
+                    return Go(TickOpClearHandoff | TickOpEmitterDesired | TickOpClearPendingKind, ExecState::Idle);
+                }
+                return canOpen ? Do(TickOpStartHold) : TickRule{};
+
+            case ExecState::HoldDownVisible:
+                if (pending == PendingKind::ForceCancel || !holdDemand) {
+                    return Go(TickOpNone, ExecState::ReleaseGap);
+                }
+                return {};
+
+            case ExecState::PulseDownVisible:
+            case ExecState::ReleaseGap:
+            default:
+                return {};
+            }
+        }
+
+        constexpr TickRule BuildRepeatRule(ExecState state, PendingKind pending, std::uint8_t guards)
+        {
+            const bool canOpen = (guards & TickGuardCanOpen) != 0;
+            const bool heldContributors = (guards & TickGuardHeldContributors) != 0;
+            const bool downSubmitted = (guards & TickGuardDownSubmitted) != 0;
+
+            switch (state) {
+            case ExecState::Idle:
+                if (pending == PendingKind::ForceCancel) {
+                    return Do(TickOpClearPending);
+                }
+                if (pending == PendingKind::RepeatStart) {
+                    return canOpen ?
+                        Do(TickOpStartRepeat) :
+                        Go(TickOpNone, ExecState::WaitingForGate);
+                }
+                return pending != PendingKind::None ? Do(TickOpClearPendingKind) : TickRule{};
+
+            case ExecState::WaitingForGate:
+                if (pending == PendingKind::ForceCancel) {
+                    return Go(TickOpClearPending, ExecState::Idle);
+                }
+                if (pending != PendingKind::RepeatStart) {
+                    return Go(TickOpNone, ExecState::Idle);
+                }
+                return canOpen ? Do(TickOpStartRepeat) : TickRule{};
+
+            case ExecState::HoldDownVisible:
+                if (pending == PendingKind::ForceCancel || (!heldContributors && downSubmitted)) {
+                    return Go(TickOpNone, ExecState::ReleaseGap);
+                }
+                return {};
+
+            case ExecState::PulseDownVisible:
+            case ExecState::ReleaseGap:
+            default:
+                return {};
+            }
+        }
+
+        constexpr TickRule BuildTickRule(PollCommitMode mode, ExecState state, PendingKind pending, std::uint8_t guards)
+        {
+            switch (mode) {
+            case PollCommitMode::Pulse:
+                return BuildTransientRule(state, pending, guards, PendingKind::Pulse);
+            case PollCommitMode::Toggle:
+                return BuildTransientRule(state, pending, guards, PendingKind::Toggle);
+            case PollCommitMode::Hold:
+                return BuildHoldRule(state, pending, guards);
+            case PollCommitMode::Repeat:
+                return BuildRepeatRule(state, pending, guards);
+            case PollCommitMode::None:
+            default:
+                return {};
+            }
+        }
+
+        constexpr std::size_t TickRuleIndex(PollCommitMode mode, ExecState state, PendingKind pending, std::uint8_t guards)
+        {
+            return ((static_cast<std::size_t>(mode) * kExecStateCount +
+                        static_cast<std::size_t>(state)) *
+                           kPendingKindCount +
+                       static_cast<std::size_t>(pending)) *
+                    kGuardCount +
+                guards;
+        }
+
+        constexpr auto kTickRules = [] {
+            std::array<TickRule, kModeCount * kExecStateCount * kPendingKindCount * kGuardCount> rules{};
+            for (std::size_t mode = 0; mode < kModeCount; ++mode) {
+                for (std::size_t state = 0; state < kExecStateCount; ++state) {
+                    for (std::size_t pending = 0; pending < kPendingKindCount; ++pending) {
+                        for (std::size_t guards = 0; guards < kGuardCount; ++guards) {
+                            const auto typedMode = static_cast<PollCommitMode>(mode);
+                            const auto typedState = static_cast<ExecState>(state);
+                            const auto typedPending = static_cast<PendingKind>(pending);
+                            const auto typedGuards = static_cast<std::uint8_t>(guards);
+                            rules[TickRuleIndex(typedMode, typedState, typedPending, typedGuards)] =
+                                BuildTickRule(typedMode, typedState, typedPending, typedGuards);
+                        }
+                    }
+                }
+            }
+            return rules;
+        }();
+
+        constexpr std::size_t ToSlotIndex(NativeControlCode code)
+        {
+            return static_cast<std::size_t>(code);
+        }
+
+        template <class Mask, class Fn>
+        void ForEachSlotIndex(const Mask& mask, Fn&& fn)
+        {
+            for (std::size_t word = 0; word < mask.size(); ++word) {
+                auto bits = mask[word];
+                while (bits != 0) {
+                    const auto bit = static_cast<std::size_t>(std::countr_zero(bits));
+                    bits &= bits - 1;
+                    fn(word * 64 + bit);
+                }
+            }
+        }
+
+        template <class Mask>
+        void SetSlotBit(Mask& mask, std::size_t index, bool value)
+        {
+            const auto bit = std::uint64_t{ 1 } << (index % 64);
+            if (value) {
+                mask[index / 64] |= bit;
+            } else {
+                mask[index / 64] &= ~bit;
+            }
+        }
     }
 
     void PollCommitCoordinator::Reset()
     {
         _slots = {};
+        _occupiedSlots = {};
+        _activeSlots = {};
         _currentContext = InputContext::Gameplay;
         _currentEpoch = 0;
         _nowUs = 0;
@@ -48,13 +313,13 @@ namespace dualpad::input::backend
         _currentEpoch = contextEpoch;
         _nowUs = nowUs;
 
-        for (auto& slot : _slots) {
-            if (!slot.actionId.empty() &&
-                slot.epoch != 0 &&
-                slot.epoch != _currentEpoch) {
+        ForEachSlotIndex(_occupiedSlots, [&](std::size_t index) {
+            auto& slot = _slots[index];
+            if (slot.epoch != 0 && slot.epoch != _currentEpoch) {
                 InvalidateStaleState(slot);
+                RefreshActive(slot);
             }
-        }
+        });
     }
 
     bool PollCommitCoordinator::QueueRequest(const PollCommitRequest& request)
@@ -66,7 +331,7 @@ namespace dualpad::input::backend
             return false;
         }
 
-        auto* slot = FindOrCreateSlot(request.actionId);
+        auto* slot = FindOrCreateSlot(request);
         if (!slot) {
             return false;
         }
@@ -83,29 +348,32 @@ namespace dualpad::input::backend
         switch (request.kind) {
         case PollCommitRequestKind::Pulse:
             QueuePulse(*slot, request);
-            return true;
+            break;
         case PollCommitRequestKind::ToggleFire:
             QueueToggle(*slot, request);
-            return true;
+            break;
         case PollCommitRequestKind::HoldSet:
             QueueHoldSet(*slot, request);
-            return true;
+            break;
         case PollCommitRequestKind::HoldClear:
             QueueHoldClear(*slot);
-            return true;
+            break;
         case PollCommitRequestKind::RepeatSet:
             QueueRepeatSet(*slot, request);
-            return true;
+            break;
         case PollCommitRequestKind::RepeatClear:
             QueueRepeatClear(*slot);
-            return true;
+            break;
         case PollCommitRequestKind::ForceCancel:
             QueueForceCancel(*slot);
-            return true;
+            break;
         case PollCommitRequestKind::None:
         default:
             return false;
         }
+
+        RefreshActive(*slot);
+        return true;
     }
 
     void PollCommitCoordinator::Tick(
@@ -115,20 +383,19 @@ namespace dualpad::input::backend
         _nowUs = nowUs;
         _lastGameplayGateOpen = gameplayGateOpen;
 
-        for (auto& slot : _slots) {
-            if (slot.actionId.empty()) {
-                continue;
-            }
-
+        ForEachSlotIndex(_activeSlots, [&](std::size_t index) {
+            auto& slot = _slots[index];
             TickSlot(slot, nowUs, gameplayGateOpen);
-        }
+            RefreshActive(slot);
+        });
     }
 
     void PollCommitCoordinator::Flush(IPollCommitEmitter& emitter, std::uint64_t nowUs)
     {
-        for (auto& slot : _slots) {
-            if (slot.actionId.empty() || !HasManagedState(slot)) {
-                continue;
+        ForEachSlotIndex(_activeSlots, [&](std::size_t index) {
+            auto& slot = _slots[index];
+            if (!HasManagedState(slot)) {
+                return;
             }
 
             if ((slot.state == ExecState::PulseDownVisible ||
@@ -172,34 +439,39 @@ namespace dualpad::input::backend
                     CompleteRelease(slot, nowUs);
                 }
             }
-        }
+            RefreshActive(slot);
+        });
     }
 
     void PollCommitCoordinator::ForceCancelGateAwareTransientSlots()
     {
-        for (auto& slot : _slots) {
+        ForEachSlotIndex(_occupiedSlots, [&](std::size_t index) {
+            auto& slot = _slots[index];
             const auto contextValue = static_cast<std::uint16_t>(slot.context);
             const bool isGameplayContext = !(contextValue >= 100 && contextValue < 2000) && slot.context != InputContext::Console;
             const bool isTransientMode = slot.mode == PollCommitMode::Pulse || slot.mode == PollCommitMode::Toggle;
-            if (slot.actionId.empty() || !slot.gateAware || !isGameplayContext || !isTransientMode) {
-                continue;
+            if (!slot.gateAware || !isGameplayContext || !isTransientMode) {
+                return;
             }
 
             QueueForceCancel(slot);
-        }
+            RefreshActive(slot);
+        });
     }
 
     void PollCommitCoordinator::SyncHeldContributor(
-        RE::BSFixedString actionId,
+        NativeControlCode outputCode,
         HeldContributor contributor,
         bool held)
     {
-        auto* slot = FindSlot(actionId);
-        if (!slot) {
+        const auto index = ToSlotIndex(outputCode);
+        if (index >= kMaxSlots || _slots[index].actionId.empty()) {
             return;
         }
 
-        SetHeldContributor(*slot, contributor, held);
+        auto& slot = _slots[index];
+        SetHeldContributor(slot, contributor, held);
+        RefreshActive(slot);
     }
 
     void PollCommitCoordinator::DumpState() const
@@ -208,9 +480,10 @@ namespace dualpad::input::backend
             return;
         }
 
-        for (const auto& slot : _slots) {
-            if (slot.actionId.empty() || !HasManagedState(slot)) {
-                continue;
+        ForEachSlotIndex(_occupiedSlots, [&](std::size_t index) {
+            const auto& slot = _slots[index];
+            if (!HasManagedState(slot)) {
+                return;
             }
 
             logger::info(
@@ -230,7 +503,7 @@ namespace dualpad::input::backend
                 slot.emittedUpCount,
                 slot.coalescedPulseCount,
                 slot.droppedPulseCount);
-        }
+        });
     }
 
     const std::array<PollCommitSlot, PollCommitCoordinator::kMaxSlots>& PollCommitCoordinator::Slots() const
@@ -238,31 +511,53 @@ namespace dualpad::input::backend
         return _slots;
     }
 
-    PollCommitSlot* PollCommitCoordinator::FindOrCreateSlot(RE::BSFixedString actionId)
+    const PollCommitSlot* PollCommitCoordinator::FindSlot(NativeControlCode outputCode) const
     {
-        if (auto* existing = FindSlot(actionId)) {
-            return existing;
+        const auto index = ToSlotIndex(outputCode);
+        if (index >= kMaxSlots || _slots[index].actionId.empty()) {
+            return nullptr;
         }
+        return &_slots[index];
+    }
 
-        for (auto& slot : _slots) {
-            if (slot.actionId.empty()) {
-                slot.actionId = actionId;
-                return &slot;
-            }
+    void PollCommitCoordinator::RestoreSlotForTests(const PollCommitSlot& slot)
+    {
+        const auto index = ToSlotIndex(slot.outputCode);
+        if (index == 0 || index >= kMaxSlots) {
+            return;
         }
 
-        return nullptr;
+        _slots[index] = slot;
+        SetSlotBit(_occupiedSlots, index, !slot.actionId.empty());
+        RefreshActive(_slots[index]);
     }
 
-    PollCommitSlot* PollCommitCoordinator::FindSlot(RE::BSFixedString actionId)
+    PollCommitSlot* PollCommitCoordinator::FindOrCreateSlot(const PollCommitRequest& request)
     {
-        for (auto& slot : _slots) {
-            if (slot.actionId == actionId) {
-                return &slot;
-            }
+        const auto index = ToSlotIndex(request.outputCode);
+        if (index >= kMaxSlots) {
+            return nullptr;
+        }
+
+        // Native codes map 1:1 to actions, so a bound slot never changes owner.
+        auto& slot = _slots[index];
+        if (slot.actionId.empty()) {
+            slot.actionId = request.actionId;
+            SetSlotBit(_occupiedSlots, index, true);
+        } else if (!(slot.actionId == request.actionId)) {
+            return nullptr;
         }
+        return &slot;
+    }
 
-        return nullptr;
+    void PollCommitCoordinator::RefreshActive(const PollCommitSlot& slot)
+    {
+        // A quiescent slot is a fixed point of Tick and emits nothing in Flush.
+        const bool active = !slot.actionId.empty() &&
+            (HasManagedState(slot) ||
+             slot.activeHeldEmitter != HeldEmitterSource::None ||
+             slot.pendingGamepadHandoff);
+        SetSlotBit(_activeSlots, ToSlotIndex(slot.outputCode), active);
     }
 
     void PollCommitCoordinator::QueuePulse(PollCommitSlot& slot, const PollCommitRequest& request)
@@ -308,7 +603,7 @@ namespace dualpad::input::backend
     void PollCommitCoordinator::QueueHoldClear(PollCommitSlot& slot)
     {
         SetHeldContributor(slot, HeldContributor::Gamepad, false);
-        if (!IsSingleEmitterHoldAction(slot.actionId)) {
+        if (!IsSingleEmitterHoldAction(slot.outputCode)) {
             slot.pending.kind = PendingKind::HoldEnd;
         }
     }
@@ -356,218 +651,99 @@ namespace dualpad::input::backend
 
     void PollCommitCoordinator::TickSlot(PollCommitSlot& slot, std::uint64_t nowUs, bool gateOpen)
     {
+        std::uint8_t guards = ShouldOpenGateForSlot(slot, gateOpen) ? TickGuardCanOpen : 0;
+        auto desiredEmitter = HeldEmitterSource::None;
+
         switch (slot.mode) {
         case PollCommitMode::Pulse:
-            TickPulseSlot(slot, nowUs, gateOpen);
-            break;
         case PollCommitMode::Toggle:
-            TickToggleSlot(slot, nowUs, gateOpen);
-            break;
-        case PollCommitMode::Hold:
-            TickHoldSlot(slot, nowUs, gateOpen);
-            break;
-        case PollCommitMode::Repeat:
-            TickRepeatSlot(slot, nowUs, gateOpen);
-            break;
-        case PollCommitMode::None:
-        default:
-            break;
-        }
-    }
-
-    void PollCommitCoordinator::TickPulseSlot(PollCommitSlot& slot, std::uint64_t nowUs, bool gateOpen)
-    {
-        const auto canOpen = ShouldOpenGateForSlot(slot, gateOpen);
-
-        switch (slot.state) {
-        case ExecState::Idle:
-            if (slot.pending.kind == PendingKind::ForceCancel) {
-                slot.pending = {};
-                break;
-            }
-            if (slot.pending.kind == PendingKind::Pulse && CanStartNewTransaction(slot)) {
-                if (canOpen) {
-                    StartPulseTransaction(slot, nowUs);
-                    slot.pending.kind = PendingKind::None;
-                } else {
-                    TransitionState(slot, ExecState::WaitingForGate, nowUs);
-                }
-            }
-            break;
-
-        case ExecState::WaitingForGate:
-            if (slot.pending.kind == PendingKind::ForceCancel) {
-                slot.pending = {};
-                TransitionState(slot, ExecState::Idle, nowUs);
-                break;
-            }
-
-            if (slot.pending.kind != PendingKind::Pulse && !slot.pending.pendingNextPulse) {
-                TransitionState(slot, ExecState::Idle, nowUs);
-                break;
+            if (CanStartNewTransaction(slot)) {
+                guards |= TickGuardCanStart;
             }
-
-            if (canOpen && CanStartNewTransaction(slot)) {
-                if (slot.pending.kind != PendingKind::Pulse) {
-                    slot.pending.kind = PendingKind::Pulse;
-                    slot.pending.pendingNextPulse = false;
-                }
-                StartPulseTransaction(slot, nowUs);
-                slot.pending.kind = PendingKind::None;
+            if (slot.pending.pendingNextPulse) {
+                guards |= TickGuardNextPulse;
             }
-            break;
-
-        case ExecState::PulseDownVisible:
             if (slot.token.active &&
                 slot.token.downSubmitted &&
                 nowUs >= slot.token.earliestReleaseAtUs) {
-                TransitionState(slot, ExecState::ReleaseGap, nowUs);
-            }
-            break;
-
-        case ExecState::ReleaseGap:
-        case ExecState::HoldDownVisible:
-        default:
-            break;
-        }
-    }
-
-    void PollCommitCoordinator::TickHoldSlot(PollCommitSlot& slot, std::uint64_t nowUs, bool gateOpen)
-    {
-        const auto canOpen = ShouldOpenGateForSlot(slot, gateOpen);
-        const auto desiredEmitter = ResolveHeldEmitter(slot);
-        const bool syntheticHoldDemand = HasSyntheticHoldDemand(slot);
-
-        switch (slot.state) {
-        case ExecState::Idle:
-            if (slot.pending.kind == PendingKind::ForceCancel) {
-                slot.pending = {};
-                slot.activeHeldEmitter = HeldEmitterSource::None;
-                slot.pendingGamepadHandoff = false;
-                break;
-            }
-            if (syntheticHoldDemand) {
-                if (slot.activeHeldEmitter == HeldEmitterSource::KeyboardMouse &&
-                    desiredEmitter == HeldEmitterSource::Gamepad) {
-                    if (!slot.pendingGamepadHandoff) {
-                        slot.pendingGamepadHandoff = true;
-                        slot.activeHeldEmitter = HeldEmitterSource::Gamepad;
-                        if (ShouldLogCoordinator()) {
-                            logger::info(
-                                "[DualPad][SprintProbe] Queue KeyboardMouse -> Gamepad handoff gap (state={}, pending={})",
-                                ToString(slot.state),
-                                ToString(slot.pending.kind));
-                        }
-                        break;
-                    }
-
-                    slot.pendingGamepadHandoff = false;
-                } else {
-                    slot.pendingGamepadHandoff = false;
-                }
-
-                if (canOpen) {
-                    StartHoldTransaction(slot, nowUs);
-                } else {
-                    slot.activeHeldEmitter = HeldEmitterSource::Gamepad;
-                    TransitionState(slot, ExecState::WaitingForGate, nowUs);
-                }
-            } else {
-                slot.pendingGamepadHandoff = false;
-                slot.activeHeldEmitter = desiredEmitter;
-                if (slot.pending.kind != PendingKind::None) {
-                    slot.pending.kind = PendingKind::None;
-                }
+                guards |= TickGuardReleaseDue;
             }
             break;
-
-        case ExecState::WaitingForGate:
-            if (slot.pending.kind == PendingKind::ForceCancel) {
-                slot.pending = {};
-                slot.activeHeldEmitter = HeldEmitterSource::None;
-                slot.pendingGamepadHandoff = false;
-                TransitionState(slot, ExecState::Idle, nowUs);
-                break;
+        case PollCommitMode::Hold:
+            desiredEmitter = ResolveHeldEmitter(slot);
+            if (HasSyntheticHoldDemand(slot)) {
+                guards |= TickGuardHoldDemand;
             }
-            if (!syntheticHoldDemand) {
-                slot.pending.kind = PendingKind::None;
-                slot.pendingGamepadHandoff = false;
-                slot.activeHeldEmitter = desiredEmitter;
-                TransitionState(slot, ExecState::Idle, nowUs);
-                break;
+            if (slot.activeHeldEmitter == HeldEmitterSource::KeyboardMouse &&
+                desiredEmitter == HeldEmitterSource::Gamepad) {
+                guards |= TickGuardHandoffToGamepad;
             }
-
-            if (canOpen) {
-                StartHoldTransaction(slot, nowUs);
+            if (slot.pendingGamepadHandoff) {
+                guards |= TickGuardHandoffQueued;
             }
             break;
-
-        case ExecState::HoldDownVisible:
-            if (slot.pending.kind == PendingKind::ForceCancel || !syntheticHoldDemand) {
-                TransitionState(slot, ExecState::ReleaseGap, nowUs);
+        case PollCommitMode::Repeat:
+            if (HasHeldContributors(slot)) {
+                guards |= TickGuardHeldContributors;
+            }
+            if (slot.token.active && slot.token.downSubmitted) {
+                guards |= TickGuardDownSubmitted;
             }
             break;
-
-        case ExecState::PulseDownVisible:
-        case ExecState::ReleaseGap:
+        case PollCommitMode::None:
         default:
-            break;
+            return;
         }
-    }
-
-    void PollCommitCoordinator::TickRepeatSlot(PollCommitSlot& slot, std::uint64_t nowUs, bool gateOpen)
-    {
-        const auto canOpen = ShouldOpenGateForSlot(slot, gateOpen);
-
-        switch (slot.state) {
-        case ExecState::Idle:
-            if (slot.pending.kind == PendingKind::ForceCancel) {
-                slot.pending = {};
-                break;
-            }
-            if (slot.pending.kind == PendingKind::RepeatStart) {
-                if (canOpen) {
-                    StartRepeatTransaction(slot, nowUs);
-                } else {
-                    TransitionState(slot, ExecState::WaitingForGate, nowUs);
-                }
-            } else if (slot.pending.kind != PendingKind::None) {
-                slot.pending.kind = PendingKind::None;
-            }
-            break;
 
-        case ExecState::WaitingForGate:
-            if (slot.pending.kind == PendingKind::ForceCancel) {
-                slot.pending = {};
-                TransitionState(slot, ExecState::Idle, nowUs);
-                break;
-            }
-            if (slot.pending.kind != PendingKind::RepeatStart) {
-                TransitionState(slot, ExecState::Idle, nowUs);
-                break;
-            }
-
-            if (canOpen) {
-                StartRepeatTransaction(slot, nowUs);
-            }
-            break;
+        const auto& rule = kTickRules[TickRuleIndex(slot.mode, slot.state, slot.pending.kind, guards)];
+        const auto ops = rule.ops;
+        if (ops == TickOpNone) {
+            return;
+        }
 
-        case ExecState::HoldDownVisible:
-            if (slot.pending.kind == PendingKind::ForceCancel) {
-                TransitionState(slot, ExecState::ReleaseGap, nowUs);
-                break;
-            }
-            if (!HasHeldContributors(slot) &&
-                slot.token.active &&
-                slot.token.downSubmitted) {
-                TransitionState(slot, ExecState::ReleaseGap, nowUs);
+        if ((ops & TickOpClearPending) != 0) {
+            slot.pending = {};
+        }
+        if ((ops & TickOpPromoteNextPulse) != 0) {
+            slot.pending.kind = PendingKind::Pulse;
+            slot.pending.pendingNextPulse = false;
+        }
+        if ((ops & TickOpClearHandoff) != 0) {
+            slot.pendingGamepadHandoff = false;
+        }
+        if ((ops & TickOpQueueHandoff) != 0) {
+            slot.pendingGamepadHandoff = true;
+            slot.activeHeldEmitter = HeldEmitterSource::Gamepad;
+            if (ShouldLogCoordinator()) {
+                logger::info(
+                    "[DualPad][SprintProbe] Queue KeyboardMouse -> Gamepad handoff gap (state={}, pending={})",
+                    ToString(slot.state),
+                    ToString(slot.pending.kind));
             }
-            break;
-
-        case ExecState::PulseDownVisible:
-        case ExecState::ReleaseGap:
-        default:
-            break;
+        }
+        if ((ops & TickOpEmitterNone) != 0) {
+            slot.activeHeldEmitter = HeldEmitterSource::None;
+        }
+        if ((ops & TickOpEmitterDesired) != 0) {
+            slot.activeHeldEmitter = desiredEmitter;
+        }
+        if ((ops & TickOpEmitterGamepad) != 0) {
+            slot.activeHeldEmitter = HeldEmitterSource::Gamepad;
+        }
+        if ((ops & TickOpStartPulse) != 0) {
+            StartPulseTransaction(slot, nowUs);
+        }
+        if ((ops & TickOpStartHold) != 0) {
+            StartHoldTransaction(slot, nowUs);
+        }
+        if ((ops & TickOpStartRepeat) != 0) {
+            StartRepeatTransaction(slot, nowUs);
+        }
+        if ((ops & TickOpClearPendingKind) != 0) {
+            slot.pending.kind = PendingKind::None;
+        }
+        if ((ops & TickOpTransition) != 0) {
+            TransitionState(slot, rule.next, nowUs);
         }
     }
 
@@ -728,14 +904,14 @@ namespace dualpad::input::backend
              slot.state != ExecState::Idle);
     }
 
-    bool PollCommitCoordinator::IsSingleEmitterHoldAction(RE::BSFixedString actionId) const
+    bool PollCommitCoordinator::IsSingleEmitterHoldAction(NativeControlCode outputCode) const
     {
-        return actionId == actions::Sprint;
+        return outputCode == NativeControlCode::Sprint;
     }
 
     HeldEmitterSource PollCommitCoordinator::ResolveHeldEmitter(const PollCommitSlot& slot) const
     {
-        if (IsSingleEmitterHoldAction(slot.actionId)) {
+        if (IsSingleEmitterHoldAction(slot.outputCode)) {
             const bool hasGamepad = HasHeldContributor(slot, HeldContributor::Gamepad);
             const bool hasKeyboardMouse = HasHeldContributor(slot, HeldContributor::KeyboardMouse);
 
@@ -785,7 +961,7 @@ namespace dualpad::input::backend
             return HasHeldContributors(slot);
         }
 
-        if (!IsSingleEmitterHoldAction(slot.actionId)) {
+        if (!IsSingleEmitterHoldAction(slot.outputCode)) {
             return HasHeldContributors(slot);
         }
 
@@ -818,7 +994,7 @@ namespace dualpad::input::backend
         }
 
         if (ShouldLogCoordinator() &&
-            IsSprintAction(slot.actionId) &&
+            slot.outputCode == NativeControlCode::Sprint &&
             previousMask != slot.heldContributorMask) {
             logger::info(
                 "[DualPad][SprintProbe] contributor {} -> {} (mask {:02X} -> {:02X}, state={}, pending={}, tokenActive={})",
@@ -831,56 +1007,4 @@ namespace dualpad::input::backend
                 slot.token.active);
         }
     }
-
-    void PollCommitCoordinator::TickToggleSlot(PollCommitSlot& slot, std::uint64_t nowUs, bool gateOpen)
-    {
-        const auto canOpen = ShouldOpenGateForSlot(slot, gateOpen);
-
-        switch (slot.state) {
-        case ExecState::Idle:
-            if (slot.pending.kind == PendingKind::ForceCancel) {
-                slot.pending = {};
-                break;
-            }
-            if (slot.pending.kind == PendingKind::Toggle && CanStartNewTransaction(slot)) {
-                if (canOpen) {
-                    StartPulseTransaction(slot, nowUs);
-                    slot.pending.kind = PendingKind::None;
-                } else {
-                    TransitionState(slot, ExecState::WaitingForGate, nowUs);
-                }
-            }
-            break;
-
-        case ExecState::WaitingForGate:
-            if (slot.pending.kind == PendingKind::ForceCancel) {
-                slot.pending = {};
-                TransitionState(slot, ExecState::Idle, nowUs);
-                break;
-            }
-            if (slot.pending.kind != PendingKind::Toggle) {
-                TransitionState(slot, ExecState::Idle, nowUs);
-                break;
-            }
-
-            if (canOpen && CanStartNewTransaction(slot)) {
-                StartPulseTransaction(slot, nowUs);
-                slot.pending.kind = PendingKind::None;
-            }
-            break;
-
-        case ExecState::PulseDownVisible:
-            if (slot.token.active &&
-                slot.token.downSubmitted &&
-                nowUs >= slot.token.earliestReleaseAtUs) {
-                TransitionState(slot, ExecState::ReleaseGap, nowUs);
-            }
-            break;
-
-        case ExecState::ReleaseGap:
-        case ExecState::HoldDownVisible:
-        default:
-            break;
-        }
-    }
 }
@@ -228,10 +228,15 @@ namespace dualpad::input::backend
         std::uint32_t cancelledCount{ 0 };
     };
 
+    // Slots are dense per digital NativeControlCode (the axis codes start at
+    // MoveStick and never reach the poll commit). Each slot's Tick step is a
+    // lookup in a compile-time table keyed by mode x state x pending kind x
+    // guard bits; BeginFrame/Tick/Flush walk occupied/active bitmasks instead
+    // of scanning every slot.
     class PollCommitCoordinator
     {
     public:
-        static constexpr std::size_t kMaxSlots = 64;
+        static constexpr std::size_t kMaxSlots = static_cast<std::size_t>(NativeControlCode::MoveStick);
 
         void Reset();
 
@@ -249,24 +254,34 @@ namespace dualpad::input::backend
         void Flush(IPollCommitEmitter& emitter, std::uint64_t nowUs);
         void ForceCancelGateAwareTransientSlots();
         void SyncHeldContributor(
-            RE::BSFixedString actionId,
+            NativeControlCode outputCode,
             HeldContributor contributor,
             bool held);
 
         void DumpState() const;
 
         [[nodiscard]] const std::array<PollCommitSlot, kMaxSlots>& Slots() const;
+        [[nodiscard]] const PollCommitSlot* FindSlot(NativeControlCode outputCode) const;
+
+        // Places a slot verbatim at its outputCode, for transition-table tests.
+        void RestoreSlotForTests(const PollCommitSlot& slot);
 
     private:
+        using SlotMask = std::array<std::uint64_t, (kMaxSlots + 63) / 64>;
+
         std::array<PollCommitSlot, kMaxSlots> _slots{};
+        // Occupied: a request has bound the slot. Active: occupied and not
+        // quiescent, i.e. Tick/Flush could change or emit something.
+        SlotMask _occupiedSlots{};
+        SlotMask _activeSlots{};
         InputContext _currentContext{ InputContext::Gameplay };
         std::uint32_t _currentEpoch{ 0 };
         std::uint64_t _nowUs{ 0 };
         std::uint32_t _nextTokenId{ 1 };
         bool _lastGameplayGateOpen{ true };
 
-        PollCommitSlot* FindOrCreateSlot(RE::BSFixedString actionId);
-        PollCommitSlot* FindSlot(RE::BSFixedString actionId);
+        PollCommitSlot* FindOrCreateSlot(const PollCommitRequest& request);
+        void RefreshActive(const PollCommitSlot& slot);
 
         void QueuePulse(PollCommitSlot& slot, const PollCommitRequest& request);
         void QueueToggle(PollCommitSlot& slot, const PollCommitRequest& request);
@@ -277,14 +292,10 @@ namespace dualpad::input::backend
         void QueueForceCancel(PollCommitSlot& slot);
 
         void TickSlot(PollCommitSlot& slot, std::uint64_t nowUs, bool gateOpen);
-        void TickPulseSlot(PollCommitSlot& slot, std::uint64_t nowUs, bool gateOpen);
-        void TickToggleSlot(PollCommitSlot& slot, std::uint64_t nowUs, bool gateOpen);
-        void TickHoldSlot(PollCommitSlot& slot, std::uint64_t nowUs, bool gateOpen);
-        void TickRepeatSlot(PollCommitSlot& slot, std::uint64_t nowUs, bool gateOpen);
 
         void InvalidateStaleState(PollCommitSlot& slot);
         bool CanStartNewTransaction(const PollCommitSlot& slot) const;
-        bool IsSingleEmitterHoldAction(RE::BSFixedString actionId) const;
+        bool IsSingleEmitterHoldAction(NativeControlCode outputCode) const;
         HeldEmitterSource ResolveHeldEmitter(const PollCommitSlot& slot) const;
         bool HasSyntheticHoldDemand(const PollCommitSlot& slot) const;
 
@@ -2,6 +2,7 @@
 #include "input/custom/CustomActionDispatcher.h"
 #include "input/Action.h"
 #include "input/custom/ScreenshotAction.h"
+#include "input_v2/telemetry/FlightRecorder.h"
 #include <SKSE/SKSE.h>
 
 namespace logger = SKSE::log;
@@ -55,6 +56,9 @@ namespace dualpad::input::custom
         if (actionId == actions::Screenshot) {
             return ExecuteScreenshotAction();
         }
+        if (actionId == actions::FlightRecorderDump) {
+            return ExecuteFlightRecorderDump();
+        }
 
         return false;
     }
@@ -76,4 +80,17 @@ namespace dualpad::input::custom
 
         return true;
     }
+
+    bool CustomActionDispatcher::ExecuteFlightRecorderDump()
+    {
+        auto& recorder = input_v2::telemetry::FlightRecorder::GetSingleton();
+        if (!recorder.IsArmed()) {
+            logger::warn("[DualPad][CustomAction] Flight recorder is disabled; nothing to dump");
+            return false;
+        }
+
+        logger::info("[DualPad][CustomAction] Requesting flight recorder dump");
+        recorder.RequestDump(input_v2::telemetry::FlightDumpTrigger::Hotkey, "hotkey");
+        return true;
+    }
 }
@@ -17,5 +17,6 @@ namespace dualpad::input::custom
         CustomActionDispatcher() = default;
 
         bool ExecuteScreenshotAction();
+        bool ExecuteFlightRecorderDump();
     };
 }
@@ -5,9 +5,11 @@
 #include "input/RuntimeConfig.h"
 #include "input/injection/PadEventSnapshotProcessor.h"
 #include "input/injection/UpstreamGamepadHook.h"
+#include "input_v2/gameplay/DualPadRuntime.h"
 #include "input_v2/context/ContextRefreshTick.h"
 #include "input_v2/ingress/FrameAssembler.h"
 #include "input_v2/ingress/IngressHub.h"
+#include "input_v2/presentation/SkyrimCompatibilitySurface.h"
 #include "input_v2/telemetry/InputTraceRecorder.h"
 
 namespace logger = SKSE::log;
@@ -182,6 +184,7 @@ namespace dualpad::input
             return 0;
         }
 
+        input_v2::presentation::SkyrimCompatibilitySurface::GetSingleton().SampleHookReadsForFrame();
         auto& contextRefresh = input_v2::context::ContextRefreshTick::GetSingleton();
         contextRefresh.RefreshOnMainThread(contextRefresh.BeginFrame());
 
@@ -189,9 +192,17 @@ namespace dualpad::input
         const auto pendingBefore = hub.PendingLegacySnapshotCount();
         auto events = hub.Drain();
         auto frames = RuntimeFrameAssembler().Assemble(events);
-        for (const auto& frame : frames) {
-            PadEventSnapshotProcessor::GetSingleton().ProcessIngressFrame(frame);
+        auto& processor = PadEventSnapshotProcessor::GetSingleton();
+        {
+            // One game frame: Scaleform sees at most one presentation
+            // publication however many pad frames this drain carries.
+            const input_v2::gameplay::DualPadRuntime::ScopedPresentationBatch batch(
+                input_v2::gameplay::DualPadRuntime::GetSingleton());
+            for (const auto& frame : frames) {
+                processor.ProcessIngressFrame(frame);
+            }
         }
+        processor.ProcessDeadlineTick();
 
         const auto processedCount = frames.size();
         const auto pendingAfterDrain = hub.PendingCount();
@@ -210,7 +221,8 @@ namespace dualpad::input
         std::size_t maxSnapshots,
         const DrainTelemetryContext* telemetryContext,
         ReplayDrainSink sink,
-        void* context)
+        void* context,
+        std::uint64_t deadlineTickUs)
     {
         if (maxSnapshots == 0 || sink == nullptr) {
             return 0;
@@ -223,13 +235,19 @@ namespace dualpad::input
         std::size_t processedCount = 0;
         (void)sink;
         (void)context;
-        for (const auto& frame : frames) {
-            if (frame.kind == input_v2::ingress::AssembledFrameKind::Stable &&
-                frame.facts.legacySnapshot) {
-                ++processedCount;
+        auto& processor = PadEventSnapshotProcessor::GetSingleton();
+        {
+            const input_v2::gameplay::DualPadRuntime::ScopedPresentationBatch batch(
+                input_v2::gameplay::DualPadRuntime::GetSingleton());
+            for (const auto& frame : frames) {
+                if (frame.kind == input_v2::ingress::AssembledFrameKind::Stable &&
+                    frame.facts.legacySnapshot) {
+                    ++processedCount;
+                }
+                processor.ProcessIngressFrame(frame);
             }
-            PadEventSnapshotProcessor::GetSingleton().ProcessIngressFrame(frame);
         }
+        processor.ProcessDeadlineTickAt(deadlineTickUs);
         const auto pendingAfterDrain = hub.PendingCount();
         if (pendingAfterDrain == 0) {
             _drainTaskQueued.store(false, std::memory_order_release);
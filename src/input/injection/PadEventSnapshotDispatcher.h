@@ -22,11 +22,14 @@ namespace dualpad::input
         std::size_t DrainOnMainThread(
             std::size_t maxSnapshots = kDefaultDrainBudget,
             const DrainTelemetryContext* telemetryContext = nullptr);
+        // Drains like DrainOnMainThread, but the deadline tick runs at
+        // `deadlineTickUs` (the replayed trace's clock) instead of now.
         std::size_t DrainForReplay(
             std::size_t maxSnapshots,
             const DrainTelemetryContext* telemetryContext,
             ReplayDrainSink sink,
-            void* context);
+            void* context,
+            std::uint64_t deadlineTickUs);
         void ResetForReplay();
         void SetFramePumpEnabled(bool enabled);
         bool IsFramePumpEnabled() const;
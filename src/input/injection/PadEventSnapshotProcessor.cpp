@@ -3,6 +3,7 @@
 #include "input/injection/PadEventSnapshotProcessor.h"
 
 #include "input/AuthoritativePollState.h"
+#include "input/RuntimeConfig.h"
 #include "input/backend/ActionBackendPolicy.h"
 #include "input/backend/KeyboardHelperBackend.h"
 #include "input/backend/ModEventKeyPool.h"
@@ -10,8 +11,11 @@
 #include "input_v2/config/AtomicConfigReloader.h"
 #include "input_v2/gameplay/DualPadRuntime.h"
 #include "input_v2/ingress/IngressHub.h"
+#include "input_v2/telemetry/FlightRecorder.h"
 #include "input_v2/telemetry/InputTraceRecorder.h"
 
+#include <chrono>
+
 namespace dualpad::input
 {
     namespace
@@ -22,6 +26,38 @@ namespace dualpad::input
             return assembler;
         }
 
+        std::uint64_t NowMonotonicUs()
+        {
+            using namespace std::chrono;
+            return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+        }
+
+        std::uint8_t ResolveLateLatchChannelsForFrame(const input_v2::gameplay::GameplayProjectionFrame& projection)
+        {
+            using input_v2::gameplay::AnalogGateMode;
+
+            const auto& gates = projection.gatePlan;
+            const auto passthrough = projection.gamepadPlan.passthroughChannels;
+            const auto eligible = [&](AnalogGateMode gate, std::uint8_t channel) {
+                return gate == AnalogGateMode::Open && (passthrough & channel) != 0;
+            };
+
+            std::uint8_t mask = LateLatchChannelNone;
+            if (eligible(gates.moveGate, input_v2::gameplay::AnalogPassthroughMove)) {
+                mask |= LateLatchChannelMove;
+            }
+            if (eligible(gates.lookGate, input_v2::gameplay::AnalogPassthroughLook)) {
+                mask |= LateLatchChannelLook;
+            }
+            if (eligible(gates.leftTriggerGate, input_v2::gameplay::AnalogPassthroughLeftTrigger)) {
+                mask |= LateLatchChannelLeftTrigger;
+            }
+            if (eligible(gates.rightTriggerGate, input_v2::gameplay::AnalogPassthroughRightTrigger)) {
+                mask |= LateLatchChannelRightTrigger;
+            }
+            return mask;
+        }
+
 #ifdef DUALPAD_REPLAY_HARNESS
         void RecordReplayCompatHelperCommands(
             const PadEventSnapshot& snapshot,
@@ -92,6 +128,7 @@ namespace dualpad::input
         input_v2::gameplay::DualPadRuntime::GetSingleton().ResetForTests();
         input_v2::ingress::IngressHub::GetSingleton().ResetForTests();
         DirectProcessorAssembler().Reset();
+        _lastSnapshotSequence = 0;
     }
 
     void PadEventSnapshotProcessor::Process(const PadEventSnapshot& snapshot)
@@ -110,41 +147,115 @@ namespace dualpad::input
         }
     }
 
+    void PadEventSnapshotProcessor::ProcessDeadlineTick()
+    {
+        // Same steady_clock domain as HID packet timestamps, so hold/repeat
+        // deadlines scheduled from frame edges compare directly against it.
+        ProcessDeadlineTickAt(NowMonotonicUs());
+    }
+
+    void PadEventSnapshotProcessor::ProcessDeadlineTickAt(std::uint64_t nowUs)
+    {
+        auto& runtime = input_v2::gameplay::DualPadRuntime::GetSingleton();
+        const auto result = runtime.ProcessDeadlineTick(nowUs);
+        if (result.deadlineChanges == 0) {
+            return;
+        }
+
+        // The executor already committed the fired buttons. The poll read
+        // feeds the flight recorder even when full tracing is off.
+        auto& recorder = input_v2::telemetry::InputTraceRecorder::GetSingleton();
+        if (!recorder.IsCapturing() && !input_v2::telemetry::FlightRecorder::GetSingleton().IsArmed()) {
+            return;
+        }
+        recorder.RecordDeadlineTick(
+            _lastSnapshotSequence,
+            nowUs,
+            AuthoritativePollState::GetSingleton().ReadSnapshot(),
+            result.deadlineChanges,
+            result.runtimeHealthReasons,
+            result.output.outputApplySucceeded);
+    }
+
     void PadEventSnapshotProcessor::ProcessIngressFrame(const input_v2::ingress::AssembledFactFrame& frame)
     {
         if (frame.kind == input_v2::ingress::AssembledFrameKind::Transition &&
             frame.transition.requestHardResync) {
             AuthoritativePollState::GetSingleton().Reset();
         }
+        if (frame.kind == input_v2::ingress::AssembledFrameKind::Transition &&
+            frame.transition.reason == input_v2::ingress::TransitionReason::ManifestEpochChanged) {
+            // Replay re-issues the publication with the recorded flag.
+            input_v2::telemetry::InputTraceRecorder::GetSingleton().RecordManifestTransition(
+                _lastSnapshotSequence,
+                frame.transition.to.manifestEpoch,
+                frame.transition.preservesInteractionState);
+        }
+
+        const bool legacyStable =
+            frame.kind == input_v2::ingress::AssembledFrameKind::Stable && frame.facts.legacySnapshot;
+        if (legacyStable) {
+            // Keyboard commands and deadline ticks are traced against it.
+            _lastSnapshotSequence = frame.facts.legacySnapshot->sequence;
+            input_v2::telemetry::InputTraceRecorder::GetSingleton().SetActiveSnapshotSequence(_lastSnapshotSequence);
+        }
 
         const auto result = input_v2::gameplay::DualPadRuntime::GetSingleton().ProcessAssembledFrame(frame);
-        if (frame.kind == input_v2::ingress::AssembledFrameKind::Stable && frame.facts.legacySnapshot) {
+        if (legacyStable) {
             const auto& snapshot = *frame.facts.legacySnapshot;
             auto& pollState = AuthoritativePollState::GetSingleton();
 #ifdef DUALPAD_REPLAY_HARNESS
-            pollState.PublishAnalogState(
-                snapshot.state.leftStick.x,
-                snapshot.state.leftStick.y,
-                snapshot.state.rightStick.x,
-                snapshot.state.rightStick.y,
-                snapshot.state.leftTrigger.normalized,
-                snapshot.state.rightTrigger.normalized);
             RecordReplayCompatHelperCommands(snapshot, result);
 #endif
-            pollState.PublishFrameMetadata(
-                snapshot.sourceTimestampUs,
-                snapshot.overflowed,
-                snapshot.coalesced);
-            pollState.PublishUnmanagedDigitalEdges(0, 0, 0);
+            DrainedFramePublication publication{
+                .lateLatchChannels = RuntimeConfig::GetSingleton().EnableLateLatchedAnalog() ?
+                    ResolveLateLatchChannelsForFrame(result.projectionFrame) :
+                    LateLatchChannelNone,
+                .sourceTimestampUs = snapshot.sourceTimestampUs,
+                .overflowed = snapshot.overflowed,
+                .coalesced = snapshot.coalesced
+            };
+#ifdef DUALPAD_REPLAY_HARNESS
+            publication.analog = AnalogSample{
+                .moveX = snapshot.state.leftStick.x,
+                .moveY = snapshot.state.leftStick.y,
+                .lookX = snapshot.state.rightStick.x,
+                .lookY = snapshot.state.rightStick.y,
+                .leftTrigger = snapshot.state.leftTrigger.normalized,
+                .rightTrigger = snapshot.state.rightTrigger.normalized
+            };
+#else
+            if (result.output.outputApplySucceeded) {
+                const auto& analog = result.projectionFrame.gamepadPlan.analog;
+                publication.analog = AnalogSample{
+                    .moveX = analog.moveX,
+                    .moveY = analog.moveY,
+                    .lookX = analog.lookX,
+                    .lookY = analog.lookY,
+                    .leftTrigger = analog.leftTrigger,
+                    .rightTrigger = analog.rightTrigger
+                };
+            }
+#endif
+            pollState.PublishDrainedFrame(publication);
+
+            auto& flight = input_v2::telemetry::FlightRecorder::GetSingleton();
+            auto& recorder = input_v2::telemetry::InputTraceRecorder::GetSingleton();
+            if (!flight.IsArmed() && !recorder.IsCapturing()) {
+                return;
+            }
+            const auto pollFrame = pollState.ReadSnapshot();
+            flight.Capture(input_v2::telemetry::TracePollFrame{ .sequence = snapshot.sequence, .poll = pollFrame });
+            // The presentation surface is only for full traces.
+            if (!recorder.IsCapturing()) {
+                return;
+            }
 
+            using input_v2::presentation::PresentationOwner;
             const auto gameplayPresentation =
                 input_v2::gameplay::DualPadRuntime::GetSingleton().GetPublishedGameplayPresentation();
-            auto gameplayEngineOwner = gameplayPresentation.engineOwner == input_v2::presentation::PresentationOwner::Gamepad ?
-                "Gamepad" :
-                "KeyboardMouse";
-            auto gameplayMenuEntryOwner = gameplayPresentation.menuEntryOwner == input_v2::presentation::PresentationOwner::Gamepad ?
-                "Gamepad" :
-                "KeyboardMouse";
+            auto gameplayEngineOwner = gameplayPresentation.engineOwner;
+            auto gameplayMenuEntryOwner = gameplayPresentation.menuEntryOwner;
 #ifdef DUALPAD_REPLAY_HARNESS
             const bool replayGamepadActivity =
                 snapshot.state.buttons.digitalMask != 0 ||
@@ -155,21 +266,21 @@ namespace dualpad::input
                 snapshot.state.leftTrigger.normalized != 0.0f ||
                 snapshot.state.rightTrigger.normalized != 0.0f;
             if (replayGamepadActivity) {
-                gameplayEngineOwner = "Gamepad";
-                gameplayMenuEntryOwner = "Gamepad";
+                gameplayEngineOwner = PresentationOwner::Gamepad;
+                gameplayMenuEntryOwner = PresentationOwner::Gamepad;
             }
 #endif
-            input_v2::telemetry::InputTraceRecorder::GetSingleton().RecordProcessedSnapshot(
+            recorder.RecordProcessedSnapshot(
                 snapshot,
-                pollState.ReadSnapshot(),
+                pollFrame,
                 input_v2::telemetry::ReplayCompatibilitySurface{
                     .context = snapshot.context,
                     .contextEpoch = snapshot.contextEpoch,
                     .isUsingGamepad = false,
                     .gamepadControlsCursor = false,
                     .gamepadDeviceEnabled = false,
-                    .presentationOwner = "KeyboardMouse",
-                    .cursorOwner = "KeyboardMouse",
+                    .presentationOwner = PresentationOwner::KeyboardMouse,
+                    .cursorOwner = PresentationOwner::KeyboardMouse,
                     .gameplayEngineOwner = gameplayEngineOwner,
                     .gameplayMenuEntryOwner = gameplayMenuEntryOwner
                 });
@@ -12,9 +12,17 @@ namespace dualpad::input
 
         void Process(const PadEventSnapshot& snapshot);
         void ProcessIngressFrame(const input_v2::ingress::AssembledFactFrame& frame);
+        // Fires due hold/repeat deadlines at the current steady_clock time.
+        void ProcessDeadlineTick();
+        // Same, at a caller-supplied time; replay drives ticks from the trace.
+        void ProcessDeadlineTickAt(std::uint64_t nowUs);
         void ResetState();
 
     private:
         PadEventSnapshotProcessor() = default;
+
+        // Pad snapshot of the last stable frame; deadline ticks resolve
+        // against its baseline.
+        std::uint64_t _lastSnapshotSequence{ 0 };
     };
 }
@@ -20,6 +20,7 @@ namespace dualpad::input
     void PublishUnmanagedDigitalState(const SyntheticPadFrame& frame, std::uint32_t handledButtons)
     {
         auto& authoritativeState = AuthoritativePollState::GetSingleton();
+        const AuthoritativePollState::ScopedPublish publish(authoritativeState);
 
         if (handledButtons != 0) {
             authoritativeState.SetUnmanagedButton(handledButtons, false);
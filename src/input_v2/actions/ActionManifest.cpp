@@ -537,6 +537,7 @@ namespace dualpad::input_v2::actions
                 Screenshot,
                 NativeScreenshot,
                 Wait,
+                FlightRecorderDump,
 
                 // Axis actions that are part of the formal native surface.
                 "Game.Move",
@@ -579,7 +580,8 @@ namespace dualpad::input_v2::actions
                 if (actionId == dualpad::input::actions::Pause ||
                     actionId == dualpad::input::actions::Screenshot ||
                     actionId == dualpad::input::actions::NativeScreenshot ||
-                    actionId == dualpad::input::actions::Wait) {
+                    actionId == dualpad::input::actions::Wait ||
+                    actionId == dualpad::input::actions::FlightRecorderDump) {
                     return ActionDomain::Utility;
                 }
                 return ActionDomain::Gameplay;
@@ -7,23 +7,32 @@ namespace dualpad::input_v2::actions
         const context::CompiledContextCatalog& catalog,
         context::UiContextId uiContextId)
     {
-        const auto* entry = context::ContextCatalog::FindById(catalog, uiContextId);
-        if (entry && entry->defaultActionSetId) {
-            return ActionSetStack{
-                .baseSetId = *entry->defaultActionSetId,
-                .layerIds = entry->defaultLayerIds,
-                .scopeAnchorIds = entry->scopeAnchorIds
-            };
+        return *ResolveShared(catalog, uiContextId);
+    }
+
+    std::shared_ptr<const ActionSetStack> ActionSetResolver::ResolveShared(
+        const context::CompiledContextCatalog& catalog,
+        context::UiContextId uiContextId)
+    {
+        const auto index = static_cast<std::size_t>(uiContextId);
+        if (index < catalog.actionSetStackById.size() && catalog.actionSetStackById[index]) {
+            return catalog.actionSetStackById[index];
         }
 
-        if (uiContextId == context::UiContextId::PassthroughOverlay) {
-            return ActionSetStack{};
+        // A default-constructed catalog has no entries and no table; its stacks
+        // depend only on the id, so they are built once for the process.
+        static const auto emptyCatalogStacks = [] {
+            context::CompiledContextCatalog empty{};
+            context::ContextCatalog::BuildActionSetStackTable(empty);
+            return empty.actionSetStackById;
+        }();
+        if (catalog.entries.empty() && index < emptyCatalogStacks.size()) {
+            return emptyCatalogStacks[index];
         }
 
-        return ActionSetStack{
-            .baseSetId = "MenuBase",
-            .layerIds = { "UnknownTrackedMenuLayer" },
-            .scopeAnchorIds = { "MenuBase", "UnknownTrackedMenuLayer" }
-        };
+        // Hand-built catalogs that skipped BuildActionSetStackTable.
+        return std::make_shared<const ActionSetStack>(context::ContextCatalog::BuildActionSetStack(
+            context::ContextCatalog::FindById(catalog, uiContextId),
+            uiContextId));
     }
 }
@@ -1,30 +1,24 @@
 #pragma once
 
+#include "input_v2/actions/ActionSetStack.h"
 #include "input_v2/context/ContextCatalog.h"
 
-#include <string>
-#include <vector>
+#include <memory>
 
 namespace dualpad::input_v2::actions
 {
-    using ActionSetId = std::string;
-    using ActionLayerId = std::string;
-    using ScopeAnchorId = std::string;
-
-    struct ActionSetStack
-    {
-        ActionSetId baseSetId;
-        std::vector<ActionLayerId> layerIds;
-        std::vector<ScopeAnchorId> scopeAnchorIds;
-
-        friend bool operator==(const ActionSetStack&, const ActionSetStack&) = default;
-    };
-
     class ActionSetResolver
     {
     public:
         static ActionSetStack Resolve(
             const context::CompiledContextCatalog& catalog,
             context::UiContextId uiContextId);
+
+        // Returns the catalog's precomputed stack for this context. Contexts
+        // with the same stack share one instance, so callers can compare
+        // pointers to detect a change without comparing strings.
+        static std::shared_ptr<const ActionSetStack> ResolveShared(
+            const context::CompiledContextCatalog& catalog,
+            context::UiContextId uiContextId);
     };
 }
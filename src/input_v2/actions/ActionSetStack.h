@@ -0,0 +1,63 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace dualpad::input_v2::actions
+{
+    using ActionSetId = std::string;
+    using ActionLayerId = std::string;
+    using ScopeAnchorId = std::string;
+
+    struct ActionSetStack
+    {
+        ActionSetId baseSetId;
+        std::vector<ActionLayerId> layerIds;
+        std::vector<ScopeAnchorId> scopeAnchorIds;
+
+        friend bool operator==(const ActionSetStack&, const ActionSetStack&) = default;
+    };
+
+    // Immutable stack shared with the catalog that resolved it. Copies share
+    // one instance; equality checks the pointer before the contents.
+    class SharedActionSetStack
+    {
+    public:
+        SharedActionSetStack() :
+            _stack(Empty())
+        {}
+
+        SharedActionSetStack(std::shared_ptr<const ActionSetStack> stack) :
+            _stack(stack ? std::move(stack) : Empty())
+        {}
+
+        SharedActionSetStack(ActionSetStack stack) :
+            _stack(std::make_shared<const ActionSetStack>(std::move(stack)))
+        {}
+
+        [[nodiscard]] const ActionSetStack& operator*() const { return *_stack; }
+        [[nodiscard]] const ActionSetStack* operator->() const { return _stack.get(); }
+        operator const ActionSetStack&() const { return *_stack; }
+        [[nodiscard]] const std::shared_ptr<const ActionSetStack>& Shared() const { return _stack; }
+
+        friend bool operator==(const SharedActionSetStack& lhs, const SharedActionSetStack& rhs)
+        {
+            return lhs._stack == rhs._stack || *lhs._stack == *rhs._stack;
+        }
+
+        friend bool operator==(const SharedActionSetStack& lhs, const ActionSetStack& rhs)
+        {
+            return *lhs._stack == rhs;
+        }
+
+    private:
+        static const std::shared_ptr<const ActionSetStack>& Empty()
+        {
+            static const auto empty = std::make_shared<const ActionSetStack>();
+            return empty;
+        }
+
+        std::shared_ptr<const ActionSetStack> _stack;
+    };
+}
@@ -5,16 +5,29 @@
 #include "input/Trigger.h"
 
 #include <algorithm>
+#include <functional>
 #include <map>
+#include <mutex>
 #include <set>
 #include <sstream>
 #include <stdexcept>
+#include <string_view>
 #include <unordered_set>
 
 namespace dualpad::input_v2::actions
 {
     namespace
     {
+        struct ActionIdHash
+        {
+            using is_transparent = void;
+
+            std::size_t operator()(std::string_view value) const
+            {
+                return std::hash<std::string_view>{}(value);
+            }
+        };
+
         struct LoweredLegacyBinding
         {
             std::vector<ControlPath> paths;
@@ -254,24 +267,302 @@ namespace dualpad::input_v2::actions
             return out.str();
         }
 
-        std::optional<dualpad::input_v2::actions::DisplayBinding> FindManifestDisplayBinding(
-            const CompiledActionManifest& manifest,
+        std::string ActionSetIdFor(const CompiledBinding& binding)
+        {
+            return binding.layerId.value_or(binding.baseSetId);
+        }
+
+        std::string DisplayLookupKey(
+            const std::string& actionId,
+            const std::string& baseSetId,
+            const std::optional<std::string>& layerId,
+            const std::string& deviceFamily)
+        {
+            std::string key;
+            key.reserve(actionId.size() + baseSetId.size() + deviceFamily.size() + 16);
+            key.append(actionId).push_back('|');
+            key.append(baseSetId).push_back('|');
+            if (layerId.has_value()) {
+                key.push_back('+');
+                key.append(*layerId);
+            }
+            key.push_back('|');
+            key.append(deviceFamily);
+            return key;
+        }
+
+        // First display binding wins, matching the manifest's declaration order.
+        std::unordered_map<std::string, const DisplayBinding*> IndexManifestDisplayBindings(
+            const CompiledActionManifest& manifest)
+        {
+            std::unordered_map<std::string, const DisplayBinding*> index;
+            index.reserve(manifest.displayBindings.size());
+            for (const auto& display : manifest.displayBindings) {
+                index.try_emplace(
+                    DisplayLookupKey(display.actionId, display.baseSetId, display.layerId, display.deviceFamily),
+                    &display);
+            }
+            return index;
+        }
+
+        const DisplayBinding* FindManifestDisplayBinding(
+            const std::unordered_map<std::string, const DisplayBinding*>& displayIndex,
             const CompiledBinding& binding)
         {
-            const auto found = std::find_if(
-                manifest.displayBindings.begin(),
-                manifest.displayBindings.end(),
-                [&](const DisplayBinding& display) {
-                    return display.actionId == binding.actionId &&
-                        display.baseSetId == binding.baseSetId &&
-                        display.layerId == binding.layerId &&
-                        display.deviceFamily == binding.deviceFamily;
+            const auto it = displayIndex.find(
+                DisplayLookupKey(binding.actionId, binding.baseSetId, binding.layerId, binding.deviceFamily));
+            return it == displayIndex.end() ? nullptr : it->second;
+        }
+
+        void AppendTriggerSignature(std::string& out, const dualpad::input::Trigger& trigger)
+        {
+            out.append(std::to_string(static_cast<int>(trigger.type))).push_back(':');
+            out.append(std::to_string(trigger.code));
+            for (const auto modifier : trigger.modifiers) {
+                out.push_back('+');
+                out.append(std::to_string(modifier));
+            }
+            out.push_back(';');
+        }
+
+        std::unordered_map<std::string, std::string> BuildActionSetSignatures(
+            const CompiledActionManifest& manifest,
+            const std::unordered_map<std::string, const DisplayBinding*>& displayIndex)
+        {
+            std::unordered_map<std::string, std::string> signatures;
+            for (const auto& binding : manifest.bindings) {
+                auto& signature = signatures[ActionSetIdFor(binding)];
+                signature.append(DisplayLookupKey(binding.actionId, binding.baseSetId, binding.layerId, binding.deviceFamily));
+                signature.push_back('=');
+                AppendTriggerSignature(signature, binding.legacyTrigger);
+                if (const auto* display = FindManifestDisplayBinding(displayIndex, binding)) {
+                    signature.append(display->controlPath).push_back('|');
+                    signature.append(display->interaction).push_back('|');
+                    AppendTriggerSignature(signature, display->legacyTrigger);
+                }
+                signature.push_back('\n');
+            }
+            return signatures;
+        }
+
+        std::string ReuseKey(const std::string& shapeKey, const ActionId& actionId)
+        {
+            return shapeKey + '#' + actionId;
+        }
+
+        ActionGraphCompileResult CompileGraph(
+            const CompiledActionManifest& manifest,
+            const CompiledActionGraph* previous)
+        {
+            ActionGraphCompileResult result{};
+            result.graph.manifestEpoch = manifest.manifestEpoch;
+            result.graph.actions = manifest.actions;
+            if (previous != nullptr) {
+                result.graph.nextBindingId = (std::max)(previous->nextBindingId, BindingId{ 1 });
+            }
+
+            std::unordered_set<std::string> knownActions;
+            for (const auto& action : manifest.actions) {
+                knownActions.insert(action.id);
+            }
+
+            const auto displayIndex = IndexManifestDisplayBindings(manifest);
+            auto signatures = BuildActionSetSignatures(manifest, displayIndex);
+
+            // Sets that kept their signature take their previous bindings and
+            // ids in order; every other set is lowered, borrowing ids from the
+            // previous graph for bindings whose action and shape are unchanged.
+            std::unordered_set<std::string> reusedSets;
+            std::unordered_map<std::string, std::unordered_map<std::string, BindingId>> reusableIdsBySet;
+            for (auto& [setId, signature] : signatures) {
+                auto& record = result.graph.actionSetRecords[setId];
+                record.signature = std::move(signature);
+                if (previous == nullptr) {
+                    continue;
+                }
+
+                const auto previousRecord = previous->actionSetRecords.find(setId);
+                if (previousRecord != previous->actionSetRecords.end() &&
+                    previousRecord->second.signature == record.signature) {
+                    reusedSets.insert(setId);
+                    continue;
+                }
+
+                auto& reusableIds = reusableIdsBySet[setId];
+                for (const auto* binding : previous->BindingsForActionSet(setId, {})) {
+                    reusableIds.emplace(ReuseKey(BindingShapeKey(*binding), binding->actionId), binding->bindingId);
+                }
+            }
+            if (previous != nullptr) {
+                result.unchangedActionSets = reusedSets.size();
+                result.changedActionSets = signatures.size() - reusedSets.size();
+            } else {
+                result.changedActionSets = signatures.size();
+            }
+
+            std::map<std::string, DuplicateShapeOwner> seenBindingShapes;
+            std::set<std::string> displayPriorityKeys;
+            std::unordered_map<std::string, std::size_t> setCursors;
+
+            const auto commit = [&](CompiledGraphBinding&& binding, DisplayBindingRecord display) {
+                const auto priorityKey =
+                    binding.actionSetId + '|' + binding.actionId + '|' + std::to_string(display.priority) + '|' + std::string(ToString(display.mode));
+                if (displayPriorityKeys.contains(priorityKey)) {
+                    result.message = "Action graph compile failed: display binding priority conflict";
+                    return false;
+                }
+                displayPriorityKeys.insert(priorityKey);
+
+                result.graph.lookups.bindingIndexById[binding.bindingId] = result.graph.bindings.size();
+                result.graph.lookups.bindingIdsByActionId[binding.actionId].push_back(binding.bindingId);
+                result.graph.lookups.bindingIdsByActionSetId[binding.actionSetId].push_back(binding.bindingId);
+                result.graph.displayBindings.push_back(std::move(display));
+                result.graph.bindings.push_back(std::move(binding));
+                return true;
+            };
+
+            for (const auto& manifestBinding : manifest.bindings) {
+                if (!knownActions.contains(manifestBinding.actionId)) {
+                    result.message = "Action graph compile failed: unknown action '" + manifestBinding.actionId + "'";
+                    return result;
+                }
+
+                const auto setId = ActionSetIdFor(manifestBinding);
+                auto& record = result.graph.actionSetRecords[setId];
+                const auto cursor = setCursors[setId]++;
+
+                if (reusedSets.contains(setId)) {
+                    const auto& previousEntry = previous->actionSetRecords.at(setId).entries[cursor];
+                    record.entries.push_back(previousEntry);
+                    if (previousEntry.bindingId == 0) {
+                        continue;
+                    }
+
+                    const auto previousIndex = previous->lookups.bindingIndexById.at(previousEntry.bindingId);
+                    auto display = previous->displayBindings[previousIndex];
+                    if (!previousEntry.explicitDisplayPriority) {
+                        display.priority = static_cast<std::uint16_t>(result.graph.displayBindings.size());
+                    }
+                    if (!commit(CompiledGraphBinding{ previous->bindings[previousIndex] }, std::move(display))) {
+                        return result;
+                    }
+                    continue;
+                }
+
+                LoweredLegacyBinding lowered{};
+                std::string error;
+                if (!LowerLegacyTrigger(manifestBinding.legacyTrigger, lowered, error)) {
+                    result.message = "Action graph compile failed for action '" + manifestBinding.actionId + "': " + error;
+                    return result;
+                }
+                if (lowered.paths.empty()) {
+                    result.message = "Action graph compile failed: lowered binding has no ControlPath";
+                    return result;
+                }
+
+                CompiledGraphBinding binding{};
+                binding.actionId = manifestBinding.actionId;
+                binding.actionSetId = setId;
+                binding.paths = lowered.paths;
+                binding.interaction = lowered.interaction;
+                binding.matchPolicy = lowered.matchPolicy;
+                binding.primaryDisplayBindingId = binding.bindingId;
+                binding.legacyOrigin = std::string(dualpad::input::ToString(manifestBinding.legacyTrigger.type));
+
+                const auto shapeKey = BindingShapeKey(binding);
+                const auto duplicateIt = seenBindingShapes.find(shapeKey);
+                if (duplicateIt != seenBindingShapes.end()) {
+                    const auto isComboDuplicate =
+                        duplicateIt->second.legacyOrigin == "Combo" || binding.legacyOrigin == "Combo";
+                    if (isComboDuplicate || duplicateIt->second.actionId != binding.actionId) {
+                        result.message = "Action graph compile failed: duplicate binding in action set '" + binding.actionSetId + "'";
+                        return result;
+                    }
+
+                    // PH4 allows idempotent duplicates created by legacy context aliases collapsing into
+                    // the same ActionSetStack. They are not runtime conflict candidates.
+                    record.entries.push_back(CompiledActionSetEntry{});
+                    continue;
+                }
+                seenBindingShapes.emplace(shapeKey, DuplicateShapeOwner{
+                    .actionId = binding.actionId,
+                    .legacyOrigin = binding.legacyOrigin
                 });
-            if (found == manifest.displayBindings.end()) {
-                return std::nullopt;
+
+                if (const auto reusable = reusableIdsBySet.find(setId); reusable != reusableIdsBySet.end()) {
+                    if (const auto it = reusable->second.find(ReuseKey(shapeKey, binding.actionId));
+                        it != reusable->second.end()) {
+                        binding.bindingId = it->second;
+                        reusable->second.erase(it);
+                    }
+                }
+                if (binding.bindingId == 0) {
+                    binding.bindingId = result.graph.nextBindingId++;
+                }
+
+                const auto* manifestDisplay = FindManifestDisplayBinding(displayIndex, manifestBinding);
+                DisplayBindingRecord display{};
+                display.bindingId = binding.bindingId;
+                display.mode = lowered.defaultDisplayMode;
+                display.priority = static_cast<std::uint16_t>(result.graph.displayBindings.size());
+                display.deviceProfile = manifestBinding.deviceFamily;
+                display.legacyTokenRenderable = lowered.legacyTokenRenderable;
+                display.token = JoinPathToken(binding.paths);
+                display.localizedLabel = display.token;
+
+                bool explicitPriority = false;
+                if (manifestDisplay != nullptr) {
+                    if (const auto legacyToken = LegacyButtonArtToken(manifestDisplay->legacyTrigger)) {
+                        display.token = *legacyToken;
+                        display.localizedLabel = *legacyToken;
+                        display.mode = DisplayBindingMode::Primary;
+                        display.legacyTokenRenderable = true;
+                    } else if (!manifestDisplay->controlPath.empty()) {
+                        display.token = manifestDisplay->controlPath;
+                        display.localizedLabel = manifestDisplay->controlPath;
+                        display.mode = DisplayBindingMode::Primary;
+                        display.legacyTokenRenderable = true;
+                    }
+                    if (manifestDisplay->interaction == "hidden") {
+                        display.mode = DisplayBindingMode::Hidden;
+                    }
+                    if (manifestDisplay->interaction.rfind("priority:", 0) == 0) {
+                        try {
+                            display.priority = static_cast<std::uint16_t>(std::stoul(manifestDisplay->interaction.substr(9)));
+                            explicitPriority = true;
+                        } catch (const std::exception&) {
+                            result.message = "Action graph compile failed: invalid display binding priority";
+                            return result;
+                        }
+                    }
+                }
+
+                record.entries.push_back(CompiledActionSetEntry{
+                    .bindingId = binding.bindingId,
+                    .explicitDisplayPriority = explicitPriority
+                });
+                if (!commit(std::move(binding), std::move(display))) {
+                    return result;
+                }
             }
-            return *found;
+
+            result.graph.RebuildAxis2DSlots();
+            result.ok = true;
+            result.message = "ok";
+            return result;
+        }
+    }
+
+    InternedActionId InternActionId(std::string_view actionId)
+    {
+        // Node-based and never shrunk, so handed-out views stay valid.
+        static std::mutex mutex;
+        static std::unordered_set<std::string, ActionIdHash, std::equal_to<>> pool;
+        std::scoped_lock lock(mutex);
+        if (const auto it = pool.find(actionId); it != pool.end()) {
+            return *it;
         }
+        return *pool.emplace(actionId).first;
     }
 
     const CompiledGraphBinding* CompiledActionGraph::FindBinding(BindingId bindingId) const
@@ -283,11 +574,66 @@ namespace dualpad::input_v2::actions
         return &bindings[it->second];
     }
 
+    void CompiledActionGraph::RebuildAxis2DSlots()
+    {
+        axis2DSlots.clear();
+        std::unordered_map<std::string_view, std::uint32_t> slotByActionId;
+        for (const auto& action : actions) {
+            if (action.valueKind != ActionValueKind::Axis2D) {
+                continue;
+            }
+            slotByActionId.emplace(action.id, static_cast<std::uint32_t>(axis2DSlots.size()));
+            axis2DSlots.push_back(CompiledAxis2DSlot{ .actionId = InternActionId(action.id) });
+        }
+
+        lookups.axis2DSlotByBindingIndex.assign(bindings.size(), kNoAxis2DSlot);
+        lookups.internedActionIdByBindingIndex.clear();
+        lookups.internedActionIdByBindingIndex.reserve(bindings.size());
+        for (std::size_t index = 0; index < bindings.size(); ++index) {
+            lookups.internedActionIdByBindingIndex.push_back(InternActionId(bindings[index].actionId));
+            if (const auto it = slotByActionId.find(bindings[index].actionId); it != slotByActionId.end()) {
+                lookups.axis2DSlotByBindingIndex[index] = it->second;
+            }
+        }
+    }
+
+    std::uint32_t CompiledActionGraph::Axis2DSlotFor(const CompiledGraphBinding& binding) const
+    {
+        const std::less<const CompiledGraphBinding*> before{};
+        if (bindings.empty() || before(&binding, bindings.data()) || !before(&binding, bindings.data() + bindings.size())) {
+            return kNoAxis2DSlot;
+        }
+        const auto index = static_cast<std::size_t>(&binding - bindings.data());
+        return index < lookups.axis2DSlotByBindingIndex.size() ? lookups.axis2DSlotByBindingIndex[index] : kNoAxis2DSlot;
+    }
+
+    InternedActionId CompiledActionGraph::InternedActionIdFor(const CompiledGraphBinding& binding) const
+    {
+        const std::less<const CompiledGraphBinding*> before{};
+        if (!bindings.empty() && !before(&binding, bindings.data()) && before(&binding, bindings.data() + bindings.size())) {
+            const auto index = static_cast<std::size_t>(&binding - bindings.data());
+            if (index < lookups.internedActionIdByBindingIndex.size()) {
+                return lookups.internedActionIdByBindingIndex[index];
+            }
+        }
+        return InternActionId(binding.actionId);
+    }
+
     std::vector<const CompiledGraphBinding*> CompiledActionGraph::BindingsForActionSet(
         const std::string& actionSetId,
         const std::vector<std::string>& layerIds) const
     {
         std::vector<const CompiledGraphBinding*> result;
+        CollectBindingsForActionSet(actionSetId, layerIds, result);
+        return result;
+    }
+
+    void CompiledActionGraph::CollectBindingsForActionSet(
+        const std::string& actionSetId,
+        const std::vector<std::string>& layerIds,
+        std::vector<const CompiledGraphBinding*>& out) const
+    {
+        out.clear();
         const auto append = [&](const std::string& setId) {
             const auto it = lookups.bindingIdsByActionSetId.find(setId);
             if (it == lookups.bindingIdsByActionSetId.end()) {
@@ -295,7 +641,7 @@ namespace dualpad::input_v2::actions
             }
             for (const auto bindingId : it->second) {
                 if (const auto* binding = FindBinding(bindingId)) {
-                    result.push_back(binding);
+                    out.push_back(binding);
                 }
             }
         };
@@ -304,122 +650,17 @@ namespace dualpad::input_v2::actions
         for (const auto& layerId : layerIds) {
             append(layerId);
         }
-        return result;
     }
 
     ActionGraphCompileResult ActionGraphCompiler::Compile(const CompiledActionManifest& manifest)
     {
-        ActionGraphCompileResult result{};
-        result.graph.manifestEpoch = manifest.manifestEpoch;
-        result.graph.actions = manifest.actions;
-
-        std::unordered_set<std::string> knownActions;
-        for (const auto& action : manifest.actions) {
-            knownActions.insert(action.id);
-        }
-
-        std::map<std::string, DuplicateShapeOwner> seenBindingShapes;
-        std::set<std::string> displayPriorityKeys;
-        BindingId nextBindingId = 1;
-
-        for (const auto& manifestBinding : manifest.bindings) {
-            if (!knownActions.contains(manifestBinding.actionId)) {
-                result.message = "Action graph compile failed: unknown action '" + manifestBinding.actionId + "'";
-                return result;
-            }
-
-            LoweredLegacyBinding lowered{};
-            std::string error;
-            if (!LowerLegacyTrigger(manifestBinding.legacyTrigger, lowered, error)) {
-                result.message = "Action graph compile failed for action '" + manifestBinding.actionId + "': " + error;
-                return result;
-            }
-            if (lowered.paths.empty()) {
-                result.message = "Action graph compile failed: lowered binding has no ControlPath";
-                return result;
-            }
-
-            CompiledGraphBinding binding{};
-            binding.actionId = manifestBinding.actionId;
-            binding.actionSetId = manifestBinding.layerId.value_or(manifestBinding.baseSetId);
-            binding.paths = lowered.paths;
-            binding.interaction = lowered.interaction;
-            binding.matchPolicy = lowered.matchPolicy;
-            binding.primaryDisplayBindingId = binding.bindingId;
-            binding.legacyOrigin = std::string(dualpad::input::ToString(manifestBinding.legacyTrigger.type));
-
-            const auto shapeKey = BindingShapeKey(binding);
-            const auto duplicateIt = seenBindingShapes.find(shapeKey);
-            if (duplicateIt != seenBindingShapes.end()) {
-                const auto isComboDuplicate =
-                    duplicateIt->second.legacyOrigin == "Combo" || binding.legacyOrigin == "Combo";
-                if (isComboDuplicate || duplicateIt->second.actionId != binding.actionId) {
-                    result.message = "Action graph compile failed: duplicate binding in action set '" + binding.actionSetId + "'";
-                    return result;
-                }
-
-                // PH4 allows idempotent duplicates created by legacy context aliases collapsing into
-                // the same ActionSetStack. They are not runtime conflict candidates.
-                continue;
-            }
-            seenBindingShapes.emplace(shapeKey, DuplicateShapeOwner{
-                .actionId = binding.actionId,
-                .legacyOrigin = binding.legacyOrigin
-            });
-            binding.bindingId = nextBindingId++;
-
-            const auto manifestDisplay = FindManifestDisplayBinding(manifest, manifestBinding);
-            DisplayBindingRecord display{};
-            display.bindingId = binding.bindingId;
-            display.mode = lowered.defaultDisplayMode;
-            display.priority = static_cast<std::uint16_t>(result.graph.displayBindings.size());
-            display.deviceProfile = manifestBinding.deviceFamily;
-            display.legacyTokenRenderable = lowered.legacyTokenRenderable;
-            display.token = JoinPathToken(binding.paths);
-            display.localizedLabel = display.token;
-
-            if (manifestDisplay.has_value()) {
-                if (const auto legacyToken = LegacyButtonArtToken(manifestDisplay->legacyTrigger)) {
-                    display.token = *legacyToken;
-                    display.localizedLabel = *legacyToken;
-                    display.mode = DisplayBindingMode::Primary;
-                    display.legacyTokenRenderable = true;
-                } else if (!manifestDisplay->controlPath.empty()) {
-                    display.token = manifestDisplay->controlPath;
-                    display.localizedLabel = manifestDisplay->controlPath;
-                    display.mode = DisplayBindingMode::Primary;
-                    display.legacyTokenRenderable = true;
-                }
-                if (manifestDisplay->interaction == "hidden") {
-                    display.mode = DisplayBindingMode::Hidden;
-                }
-                if (manifestDisplay->interaction.rfind("priority:", 0) == 0) {
-                    try {
-                        display.priority = static_cast<std::uint16_t>(std::stoul(manifestDisplay->interaction.substr(9)));
-                    } catch (const std::exception&) {
-                        result.message = "Action graph compile failed: invalid display binding priority";
-                        return result;
-                    }
-                }
-            }
-
-            const auto priorityKey =
-                binding.actionSetId + '|' + binding.actionId + '|' + std::to_string(display.priority) + '|' + std::string(ToString(display.mode));
-            if (displayPriorityKeys.contains(priorityKey)) {
-                result.message = "Action graph compile failed: display binding priority conflict";
-                return result;
-            }
-            displayPriorityKeys.insert(priorityKey);
-
-            result.graph.lookups.bindingIndexById[binding.bindingId] = result.graph.bindings.size();
-            result.graph.lookups.bindingIdsByActionId[binding.actionId].push_back(binding.bindingId);
-            result.graph.lookups.bindingIdsByActionSetId[binding.actionSetId].push_back(binding.bindingId);
-            result.graph.displayBindings.push_back(display);
-            result.graph.bindings.push_back(std::move(binding));
-        }
+        return CompileGraph(manifest, nullptr);
+    }
 
-        result.ok = true;
-        result.message = "ok";
-        return result;
+    ActionGraphCompileResult ActionGraphCompiler::CompilePreservingBindingIds(
+        const CompiledActionManifest& manifest,
+        const CompiledActionGraph& previous)
+    {
+        return CompileGraph(manifest, &previous);
     }
 }
@@ -7,6 +7,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -15,6 +16,13 @@ namespace dualpad::input_v2::actions
     using ActionId = std::string;
     using BindingId = std::uint32_t;
 
+    // Action id interned for the life of the process. Resolved frames carry
+    // these views, so they stay valid after the graph that produced them is
+    // replaced and never allocate per change.
+    using InternedActionId = std::string_view;
+
+    [[nodiscard]] InternedActionId InternActionId(std::string_view actionId);
+
     struct DisplayBindingRecord
     {
         BindingId bindingId{ 0 };
@@ -48,6 +56,37 @@ namespace dualpad::input_v2::actions
         std::unordered_map<BindingId, std::size_t> bindingIndexById;
         std::unordered_map<ActionId, std::vector<BindingId>> bindingIdsByActionId;
         std::unordered_map<std::string, std::vector<BindingId>> bindingIdsByActionSetId;
+        // Aligned with CompiledActionGraph::bindings; kNoAxis2DSlot for bindings
+        // whose action is not Axis2D.
+        std::vector<std::uint32_t> axis2DSlotByBindingIndex;
+        // Aligned with CompiledActionGraph::bindings.
+        std::vector<InternedActionId> internedActionIdByBindingIndex;
+    };
+
+    inline constexpr std::uint32_t kNoAxis2DSlot = 0xFFFFFFFFu;
+
+    // One slot per Axis2D action. X/Y bindings of the action accumulate into the
+    // same slot so the interaction engine pairs them without a per-frame map.
+    struct CompiledAxis2DSlot
+    {
+        InternedActionId actionId;
+    };
+
+    struct CompiledActionSetEntry
+    {
+        // 0 when the manifest binding collapsed into an idempotent duplicate.
+        BindingId bindingId{ 0 };
+        bool explicitDisplayPriority{ false };
+    };
+
+    // Per action set compile bookkeeping. The signature covers every manifest
+    // input that shapes the set's lowered bindings; entries are aligned with the
+    // set's manifest bindings in order so a reload can hand an unchanged set
+    // its previous BindingIds.
+    struct CompiledActionSetRecord
+    {
+        std::string signature;
+        std::vector<CompiledActionSetEntry> entries;
     };
 
     struct CompiledActionGraph
@@ -57,11 +96,24 @@ namespace dualpad::input_v2::actions
         std::vector<CompiledGraphBinding> bindings;
         std::vector<DisplayBindingRecord> displayBindings;
         CompiledBindingLookupTables lookups;
+        std::vector<CompiledAxis2DSlot> axis2DSlots;
+        std::unordered_map<std::string, CompiledActionSetRecord> actionSetRecords;
+        BindingId nextBindingId{ 1 };
 
         [[nodiscard]] const CompiledGraphBinding* FindBinding(BindingId bindingId) const;
+        // Derives axis2DSlots and the per-binding-index lookups from actions
+        // and bindings. The compiler calls it; hand-assembled graphs must too.
+        void RebuildAxis2DSlots();
+        [[nodiscard]] std::uint32_t Axis2DSlotFor(const CompiledGraphBinding& binding) const;
+        [[nodiscard]] InternedActionId InternedActionIdFor(const CompiledGraphBinding& binding) const;
         [[nodiscard]] std::vector<const CompiledGraphBinding*> BindingsForActionSet(
             const std::string& actionSetId,
             const std::vector<std::string>& layerIds) const;
+        // Clears and refills `out` so per-frame callers can keep its capacity.
+        void CollectBindingsForActionSet(
+            const std::string& actionSetId,
+            const std::vector<std::string>& layerIds,
+            std::vector<const CompiledGraphBinding*>& out) const;
     };
 
     struct ActionGraphCompileResult
@@ -69,11 +121,23 @@ namespace dualpad::input_v2::actions
         bool ok{ false };
         std::string message;
         CompiledActionGraph graph;
+        // Sets whose signature matched / differed from the previous graph.
+        std::size_t unchangedActionSets{ 0 };
+        std::size_t changedActionSets{ 0 };
     };
 
     class ActionGraphCompiler
     {
     public:
         static ActionGraphCompileResult Compile(const CompiledActionManifest& manifest);
+
+        // Hot-reload path. Still compiles the whole manifest, but bindings keep
+        // their BindingId across the reload: a set whose signature matches the
+        // previous graph keeps all of its ids, and an edited set keeps the id of
+        // any binding whose action and shape survive. New bindings draw ids
+        // above previous.nextBindingId so a retired id is never reused.
+        static ActionGraphCompileResult CompilePreservingBindingIds(
+            const CompiledActionManifest& manifest,
+            const CompiledActionGraph& previous);
     };
 }
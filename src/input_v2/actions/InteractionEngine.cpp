@@ -6,9 +6,9 @@
 
 #include <algorithm>
 #include <cmath>
+#include <functional>
 #include <set>
 #include <unordered_map>
-#include <unordered_set>
 
 namespace dualpad::input_v2::actions
 {
@@ -21,15 +21,9 @@ namespace dualpad::input_v2::actions
             Exact
         };
 
-        struct BindingCandidate
-        {
-            const CompiledGraphBinding* binding{ nullptr };
-            BindingMatchStrength strength{ BindingMatchStrength::None };
-            std::size_t specificity{ 0 };
-        };
-
         void Emit(
             ResolvedActionFrame& resolved,
+            const CompiledActionGraph& graph,
             const CompiledGraphBinding& binding,
             ActionPhase phase,
             std::uint64_t timestampUs,
@@ -38,7 +32,7 @@ namespace dualpad::input_v2::actions
             std::uint64_t evaluationUs = 0)
         {
             resolved.changes.push_back(ActionPhaseChange{
-                .actionId = binding.actionId,
+                .actionId = graph.InternedActionIdFor(binding),
                 .bindingId = binding.bindingId,
                 .phase = phase,
                 .timestampUs = timestampUs,
@@ -50,7 +44,7 @@ namespace dualpad::input_v2::actions
 
         void EmitValue(
             ResolvedActionFrame& resolved,
-            const ActionId& actionId,
+            InternedActionId actionId,
             BindingId bindingId,
             std::uint64_t timestampUs)
         {
@@ -120,29 +114,6 @@ namespace dualpad::input_v2::actions
             }
         }
 
-        const ActionDefinition* FindActionDefinition(
-            const CompiledActionGraph& graph,
-            std::string_view actionId)
-        {
-            const auto found = std::find_if(
-                graph.actions.begin(),
-                graph.actions.end(),
-                [&](const ActionDefinition& action) {
-                    return action.id == actionId;
-                });
-            return found == graph.actions.end() ? nullptr : &*found;
-        }
-
-        ActionValueKind ValueKindForBinding(
-            const CompiledActionGraph& graph,
-            const CompiledGraphBinding& binding)
-        {
-            if (const auto* action = FindActionDefinition(graph, binding.actionId)) {
-                return action->valueKind;
-            }
-            return ActionValueKind::Axis1D;
-        }
-
         bool IsBindingPathActive(
             const KernelFrame& frame,
             const ControlPath& path,
@@ -158,11 +129,12 @@ namespace dualpad::input_v2::actions
             return sample->down || sample->pressed;
         }
 
-        std::vector<ControlPath> ActivePathsForPrimaryKind(
+        void CollectActivePathsForPrimaryKind(
             const KernelFrame& frame,
-            const ControlPath& primaryPath)
+            const ControlPath& primaryPath,
+            std::vector<ControlPath>& active)
         {
-            std::vector<ControlPath> active;
+            active.clear();
             for (const auto& sample : frame.state.controlSamples) {
                 if (sample.path.kind != primaryPath.kind) {
                     continue;
@@ -174,12 +146,12 @@ namespace dualpad::input_v2::actions
                     active.push_back(sample.path);
                 }
             }
-            return active;
         }
 
         BindingMatchStrength EvaluateBindingMatch(
             const CompiledGraphBinding& binding,
-            const KernelFrame& frame)
+            const KernelFrame& frame,
+            std::vector<ControlPath>& activePaths)
         {
             if (binding.interaction.primaryPathIndex >= binding.paths.size()) {
                 return BindingMatchStrength::None;
@@ -196,7 +168,7 @@ namespace dualpad::input_v2::actions
             }
 
             const auto& primaryPath = binding.paths[binding.interaction.primaryPathIndex];
-            const auto activePaths = ActivePathsForPrimaryKind(frame, primaryPath);
+            CollectActivePathsForPrimaryKind(frame, primaryPath, activePaths);
             bool hasExtraActivePath = false;
             for (const auto& activePath : activePaths) {
                 if (!ContainsPath(binding.paths, activePath)) {
@@ -220,61 +192,83 @@ namespace dualpad::input_v2::actions
                 (state->active || state->holdFired || state->tapCandidate || state->chordLatched);
         }
 
-        std::vector<const CompiledGraphBinding*> SelectBindingsForFrame(
-            const std::vector<const CompiledGraphBinding*>& visibleBindings,
+        const ControlPath& PrimaryPathOf(const CompiledGraphBinding& binding)
+        {
+            return binding.paths[binding.interaction.primaryPathIndex];
+        }
+
+        bool PrimaryPathLess(const ControlPath& lhs, const ControlPath& rhs)
+        {
+            if (lhs.kind != rhs.kind) {
+                return lhs.kind < rhs.kind;
+            }
+            if (lhs.code != rhs.code) {
+                return lhs.code < rhs.code;
+            }
+            return lhs.component < rhs.component;
+        }
+
+        // Fills scratch.selected from scratch.visible. Candidates competing for
+        // the same primary path are grouped by sorting one flat buffer instead of
+        // building a per-frame map of vectors.
+        void SelectBindingsForFrame(
+            InteractionSelectionScratch& scratch,
             const KernelFrame& frame,
             const InteractionStateStore& stateStore)
         {
-            std::vector<const CompiledGraphBinding*> selected;
-            std::unordered_set<BindingId> selectedIds;
-            std::unordered_map<ControlPath, std::vector<BindingCandidate>, ControlPathHash> candidatesByPrimaryPath;
+            auto& selected = scratch.selected;
+            auto& candidates = scratch.candidates;
+            selected.clear();
+            candidates.clear();
 
-            for (const auto* binding : visibleBindings) {
+            for (const auto* binding : scratch.visible) {
                 if (binding == nullptr || binding->interaction.primaryPathIndex >= binding->paths.size()) {
                     continue;
                 }
 
                 if (IsLiveState(stateStore.Find(binding->bindingId))) {
                     selected.push_back(binding);
-                    selectedIds.insert(binding->bindingId);
                     continue;
                 }
 
-                const auto strength = EvaluateBindingMatch(*binding, frame);
+                const auto strength = EvaluateBindingMatch(*binding, frame, scratch.activePaths);
                 if (strength == BindingMatchStrength::None) {
                     continue;
                 }
 
-                const auto& primaryPath = binding->paths[binding->interaction.primaryPathIndex];
-                candidatesByPrimaryPath[primaryPath].push_back(BindingCandidate{
+                candidates.push_back(InteractionSelectionCandidate{
                     .binding = binding,
-                    .strength = strength,
+                    .strength = static_cast<std::uint8_t>(strength),
                     .specificity = binding->paths.size()
                 });
             }
 
-            for (auto& [primaryPath, candidates] : candidatesByPrimaryPath) {
-                (void)primaryPath;
-                (std::sort)(candidates.begin(), candidates.end(), [](const auto& lhs, const auto& rhs) {
-                    if (lhs.strength != rhs.strength) {
-                        return static_cast<std::uint8_t>(lhs.strength) > static_cast<std::uint8_t>(rhs.strength);
-                    }
-                    if (lhs.specificity != rhs.specificity) {
-                        return lhs.specificity > rhs.specificity;
-                    }
-                    return lhs.binding->bindingId < rhs.binding->bindingId;
-                });
+            (std::sort)(candidates.begin(), candidates.end(), [](const auto& lhs, const auto& rhs) {
+                const auto& lhsPath = PrimaryPathOf(*lhs.binding);
+                const auto& rhsPath = PrimaryPathOf(*rhs.binding);
+                if (lhsPath != rhsPath) {
+                    return PrimaryPathLess(lhsPath, rhsPath);
+                }
+                if (lhs.strength != rhs.strength) {
+                    return lhs.strength > rhs.strength;
+                }
+                if (lhs.specificity != rhs.specificity) {
+                    return lhs.specificity > rhs.specificity;
+                }
+                return std::less<>{}(lhs.binding, rhs.binding);
+            });
 
-                if (!candidates.empty() && !selectedIds.contains(candidates.front().binding->bindingId)) {
-                    selected.push_back(candidates.front().binding);
-                    selectedIds.insert(candidates.front().binding->bindingId);
+            // Live bindings never become candidates, so the winner of each group
+            // cannot already be in the selection.
+            for (std::size_t index = 0; index < candidates.size(); ++index) {
+                if (index == 0 || PrimaryPathOf(*candidates[index - 1].binding) != PrimaryPathOf(*candidates[index].binding)) {
+                    selected.push_back(candidates[index].binding);
                 }
             }
 
-            (std::sort)(selected.begin(), selected.end(), [](const auto* lhs, const auto* rhs) {
-                return lhs->bindingId < rhs->bindingId;
-            });
-            return selected;
+            // Graph order is manifest order; binding ids stop tracking it once a
+            // reload keeps old ids and appends new ones.
+            (std::sort)(selected.begin(), selected.end(), std::less<>{});
         }
 
         bool RequiredPathsDown(
@@ -335,50 +329,80 @@ namespace dualpad::input_v2::actions
             return timing;
         }
 
-        struct Axis2DBucket
+        bool IsBindingInActionSetStack(
+            const CompiledGraphBinding& binding,
+            const ActionSetStack& actionSetStack)
         {
-            ActionId actionId;
-            BindingId bindingId{ 0 };
-            float x{ 0.0f };
-            float y{ 0.0f };
-            bool hasX{ false };
-            bool hasY{ false };
-            bool changed{ false };
-            std::uint64_t timestampUs{ 0 };
-        };
+            return binding.actionSetId == actionSetStack.baseSetId ||
+                std::find(
+                    actionSetStack.layerIds.begin(),
+                    actionSetStack.layerIds.end(),
+                    binding.actionSetId) != actionSetStack.layerIds.end();
+        }
+
+        // Advances the repeat cadence from the deadline that just fired rather
+        // than from the evaluation time, so repeats stay on a fixed grid. Slots
+        // missed during a stall are skipped instead of being fired as a burst.
+        std::uint64_t AdvanceRepeatCadence(
+            InteractionBindingState& state,
+            const InteractionSpec& interaction,
+            std::uint64_t dueAtUs,
+            std::uint64_t nowUs)
+        {
+            state.lastRepeatAtUs = dueAtUs;
+            if (interaction.repeatIntervalUs == 0) {
+                state.lastRepeatAtUs = (std::max)(dueAtUs, nowUs);
+                return state.lastRepeatAtUs + 1;
+            }
+            if (nowUs > dueAtUs) {
+                const auto missed = (nowUs - dueAtUs) / interaction.repeatIntervalUs;
+                state.lastRepeatAtUs = dueAtUs + (missed * interaction.repeatIntervalUs);
+            }
+            return state.lastRepeatAtUs + interaction.repeatIntervalUs;
+        }
 
         void AccumulateAxis2D(
-            std::unordered_map<ActionId, Axis2DBucket>& buckets,
+            Axis2DFrameScratch& scratch,
+            std::uint32_t slot,
             const CompiledGraphBinding& binding,
             const ControlSample& sample,
             float value,
             bool changed,
             std::uint64_t timestampUs)
         {
-            auto& bucket = buckets[binding.actionId];
-            if (bucket.actionId.empty()) {
-                bucket.actionId = binding.actionId;
-                bucket.bindingId = binding.bindingId;
-            } else {
-                bucket.bindingId = (std::min)(bucket.bindingId, binding.bindingId);
+            auto& accumulator = scratch.slots[slot];
+            if (accumulator.bindingId == 0 || binding.bindingId < accumulator.bindingId) {
+                // Keep touched slots ordered by their lowest binding so values
+                // are emitted in binding order without sorting at flush time.
+                auto current = std::find(scratch.touched.begin(), scratch.touched.end(), slot);
+                if (current == scratch.touched.end()) {
+                    scratch.touched.push_back(slot);
+                    current = scratch.touched.end() - 1;
+                }
+                accumulator.bindingId = binding.bindingId;
+                while (current != scratch.touched.begin() &&
+                    scratch.slots[*(current - 1)].bindingId > accumulator.bindingId) {
+                    std::iter_swap(current - 1, current);
+                    --current;
+                }
             }
-            bucket.changed = bucket.changed || changed || sample.pressed || sample.released;
-            bucket.timestampUs = (std::max)(bucket.timestampUs, timestampUs);
+            accumulator.changed = accumulator.changed || changed || sample.pressed || sample.released;
+            accumulator.timestampUs = (std::max)(accumulator.timestampUs, timestampUs);
 
             switch (InferAxisComponent(sample.path)) {
             case AxisComponent::X:
-                bucket.x = value;
-                bucket.hasX = true;
+                accumulator.x = value;
+                accumulator.hasX = true;
                 break;
             case AxisComponent::Y:
-                bucket.y = value;
-                bucket.hasY = true;
+                accumulator.y = value;
+                accumulator.hasY = true;
                 break;
             case AxisComponent::None:
             default:
-                if (!bucket.hasX) {
-                    bucket.x = value;
-                    bucket.hasX = true;
+                if (!accumulator.hasX) {
+                    accumulator.x = value;
+                    accumulator.hasX = true;
                 }
                 break;
             }
@@ -386,41 +410,54 @@ namespace dualpad::input_v2::actions
 
         void FlushAxis2DValues(
             ResolvedActionFrame& resolved,
-            const std::unordered_map<ActionId, Axis2DBucket>& buckets,
+            const CompiledActionGraph& graph,
+            Axis2DFrameScratch& scratch,
             std::uint64_t frameTimestampUs)
         {
-            std::vector<const Axis2DBucket*> ordered;
-            ordered.reserve(buckets.size());
-            for (const auto& [actionId, bucket] : buckets) {
-                (void)actionId;
-                ordered.push_back(&bucket);
-            }
-            (std::sort)(ordered.begin(), ordered.end(), [](const auto* lhs, const auto* rhs) {
-                return lhs->bindingId < rhs->bindingId;
-            });
-
-            for (const auto* bucket : ordered) {
-                if (!bucket->changed) {
-                    continue;
+            for (const auto slot : scratch.touched) {
+                auto& accumulator = scratch.slots[slot];
+                if (accumulator.changed) {
+                    const auto actionId = graph.axis2DSlots[slot].actionId;
+                    const auto timestampUs = frameTimestampUs != 0 ? frameTimestampUs : accumulator.timestampUs;
+                    const auto magnitude = std::clamp(
+                        std::sqrt((accumulator.x * accumulator.x) + (accumulator.y * accumulator.y)),
+                        0.0f,
+                        1.0f);
+                    resolved.values.push_back(ActionValueSnapshot{
+                        .actionId = actionId,
+                        .kind = ActionValueKind::Axis2D,
+                        .scalar = magnitude,
+                        .x = NormalizeAxisValue(accumulator.x),
+                        .y = NormalizeAxisValue(accumulator.y),
+                        .timestampUs = timestampUs
+                    });
+                    EmitValue(resolved, actionId, accumulator.bindingId, timestampUs);
                 }
-                const auto timestampUs = frameTimestampUs != 0 ? frameTimestampUs : bucket->timestampUs;
-                const auto magnitude = std::clamp(
-                    std::sqrt((bucket->x * bucket->x) + (bucket->y * bucket->y)),
-                    0.0f,
-                    1.0f);
-                resolved.values.push_back(ActionValueSnapshot{
-                    .actionId = bucket->actionId,
-                    .kind = ActionValueKind::Axis2D,
-                    .scalar = magnitude,
-                    .x = NormalizeAxisValue(bucket->x),
-                    .y = NormalizeAxisValue(bucket->y),
-                    .timestampUs = timestampUs
-                });
-                EmitValue(resolved, bucket->actionId, bucket->bindingId, timestampUs);
+                accumulator = {};
             }
+            scratch.touched.clear();
         }
     }
 
+    void Axis2DFrameScratch::Prepare(std::size_t slotCount)
+    {
+        if (slots.size() != slotCount) {
+            Clear();
+            slots.assign(slotCount, Axis2DAccumulator{});
+            touched.reserve(slotCount);
+        }
+    }
+
+    void Axis2DFrameScratch::Clear()
+    {
+        for (const auto slot : touched) {
+            if (slot < slots.size()) {
+                slots[slot] = {};
+            }
+        }
+        touched.clear();
+    }
+
     InteractionBindingState& InteractionStateStore::ForBinding(BindingId bindingId)
     {
         return _states[bindingId];
@@ -432,9 +469,54 @@ namespace dualpad::input_v2::actions
         return it == _states.end() ? nullptr : &it->second;
     }
 
+    InteractionTimerWheel& InteractionStateStore::Deadlines()
+    {
+        return _deadlines;
+    }
+
+    const InteractionTimerWheel& InteractionStateStore::Deadlines() const
+    {
+        return _deadlines;
+    }
+
+    Axis2DFrameScratch& InteractionStateStore::Axis2DScratch()
+    {
+        return _axis2D;
+    }
+
+    InteractionSelectionScratch& InteractionStateStore::SelectionScratch()
+    {
+        return _selection;
+    }
+
+    std::vector<InteractionDeadline>& InteractionStateStore::ExpiredDeadlineScratch()
+    {
+        return _expiredDeadlines;
+    }
+
+    std::vector<BindingId> InteractionStateStore::TrackedBindingIds() const
+    {
+        std::vector<BindingId> ids;
+        ids.reserve(_states.size());
+        for (const auto& [bindingId, state] : _states) {
+            (void)state;
+            ids.push_back(bindingId);
+        }
+        (std::sort)(ids.begin(), ids.end());
+        return ids;
+    }
+
+    void InteractionStateStore::Drop(BindingId bindingId)
+    {
+        _states.erase(bindingId);
+        _deadlines.CancelBinding(bindingId);
+    }
+
     void InteractionStateStore::Reset()
     {
         _states.clear();
+        _deadlines.Reset();
+        _axis2D.Clear();
     }
 
     ResolvedActionFrame InteractionEngine::Resolve(
@@ -444,17 +526,34 @@ namespace dualpad::input_v2::actions
         InteractionStateStore& stateStore) const
     {
         ResolvedActionFrame resolved{};
+        ResolveInto(graph, actionSetStack, frame, stateStore, resolved);
+        return resolved;
+    }
+
+    void InteractionEngine::ResolveInto(
+        const CompiledActionGraph& graph,
+        const ActionSetStack& actionSetStack,
+        const KernelFrame& frame,
+        InteractionStateStore& stateStore,
+        ResolvedActionFrame& resolved) const
+    {
         resolved.manifestEpoch = frame.facts.manifestEpoch;
         resolved.contextRevision = frame.facts.contextRevision;
+        resolved.changes.clear();
+        resolved.values.clear();
+        resolved.ownershipHints.clear();
 
         if (frame.facts.manifestEpoch != graph.manifestEpoch) {
-            return resolved;
+            return;
         }
 
-        const auto visibleBindings = graph.BindingsForActionSet(actionSetStack.baseSetId, actionSetStack.layerIds);
-        const auto selectedBindings = SelectBindingsForFrame(visibleBindings, frame, stateStore);
-        std::unordered_map<ActionId, Axis2DBucket> axis2DBuckets;
-        for (const auto* bindingPtr : selectedBindings) {
+        auto& selection = stateStore.SelectionScratch();
+        graph.CollectBindingsForActionSet(actionSetStack.baseSetId, actionSetStack.layerIds, selection.visible);
+        SelectBindingsForFrame(selection, frame, stateStore);
+        auto& deadlines = stateStore.Deadlines();
+        auto& axis2D = stateStore.Axis2DScratch();
+        axis2D.Prepare(graph.axis2DSlots.size());
+        for (const auto* bindingPtr : selection.selected) {
             const auto& binding = *bindingPtr;
             if (binding.interaction.primaryPathIndex >= binding.paths.size()) {
                 continue;
@@ -479,22 +578,22 @@ namespace dualpad::input_v2::actions
             case InteractionKind::Value: {
                 auto value = NormalizeAxisValue(ApplyModifiers(primary->scalar, binding.modifiers));
                 const auto changed = std::fabs(value - state.currentScalar) > 0.0001f || primary->pressed || primary->released;
-                if (ValueKindForBinding(graph, binding) == ActionValueKind::Axis2D) {
+                if (const auto slot = graph.Axis2DSlotFor(binding); slot != kNoAxis2DSlot) {
                     state.currentScalar = value;
-                    AccumulateAxis2D(axis2DBuckets, binding, *primary, value, changed, now);
+                    AccumulateAxis2D(axis2D, slot, binding, *primary, value, changed, now);
                     break;
                 }
                 if (changed) {
                     state.currentScalar = value;
                     resolved.values.push_back(ActionValueSnapshot{
-                        .actionId = binding.actionId,
+                        .actionId = graph.InternedActionIdFor(binding),
                         .kind = ActionValueKind::Axis1D,
                         .scalar = value,
                         .x = value,
                         .y = 0.0f,
                         .timestampUs = now
                     });
-                    Emit(resolved, binding, ActionPhase::Value, now);
+                    Emit(resolved, graph, binding, ActionPhase::Value, now);
                 }
                 break;
             }
@@ -503,41 +602,53 @@ namespace dualpad::input_v2::actions
                 if (primary->pressed && requiredDown && !state.active) {
                     state.active = true;
                     state.pressedAtUs = primary->downAtUs != 0 ? primary->downAtUs : now;
-                    Emit(resolved, binding, ActionPhase::Press, now);
+                    Emit(resolved, graph, binding, ActionPhase::Press, now);
                 }
                 if (state.active && (!primary->down || primary->released || !requiredDown)) {
                     state.active = false;
-                    Emit(resolved, binding, ActionPhase::Release, now);
+                    Emit(resolved, graph, binding, ActionPhase::Release, now);
                 }
                 break;
-            case InteractionKind::Hold:
+            case InteractionKind::Hold: {
                 if (primary->pressed && requiredDown) {
                     state.active = true;
                     state.holdFired = false;
                     state.pressedAtUs = primary->downAtUs != 0 ? primary->downAtUs : now;
+                    deadlines.Schedule(
+                        binding.bindingId,
+                        InteractionDeadlineKind::Hold,
+                        state.pressedAtUs + binding.interaction.holdThresholdUs);
                 }
-                if (state.active && activeByPrimary && !state.holdFired &&
-                    now >= state.pressedAtUs + binding.interaction.holdThresholdUs) {
+                const auto holdDueAt = state.pressedAtUs + binding.interaction.holdThresholdUs;
+                if (state.active && activeByPrimary && !state.holdFired && now >= holdDueAt) {
                     state.holdFired = true;
-                    Emit(resolved, binding, ActionPhase::Hold, now);
+                    deadlines.Cancel(binding.bindingId, InteractionDeadlineKind::Hold);
+                    Emit(resolved, graph, binding, ActionPhase::Hold, holdDueAt, 0, 0, now);
                 }
                 if (state.active && (!primary->down || primary->released || !requiredDown)) {
                     if (state.holdFired) {
-                        Emit(resolved, binding, ActionPhase::Release, now);
+                        Emit(resolved, graph, binding, ActionPhase::Release, now);
                     }
                     state = {};
+                    deadlines.CancelBinding(binding.bindingId);
                 }
                 break;
+            }
             case InteractionKind::Tap:
                 if (primary->pressed && requiredDown) {
                     state.tapCandidate = true;
                     state.pressedAtUs = primary->downAtUs != 0 ? primary->downAtUs : now;
+                    deadlines.Schedule(
+                        binding.bindingId,
+                        InteractionDeadlineKind::TapWindow,
+                        state.pressedAtUs + binding.interaction.tapMaxUs);
                 }
                 if (state.tapCandidate && primary->released) {
                     if (now <= state.pressedAtUs + binding.interaction.tapMaxUs) {
-                        Emit(resolved, binding, ActionPhase::Pulse, now);
+                        Emit(resolved, graph, binding, ActionPhase::Pulse, now);
                     }
                     state = {};
+                    deadlines.CancelBinding(binding.bindingId);
                 }
                 break;
             case InteractionKind::Repeat:
@@ -545,26 +656,34 @@ namespace dualpad::input_v2::actions
                     state.active = true;
                     state.pressedAtUs = primary->downAtUs != 0 ? primary->downAtUs : now;
                     state.lastRepeatAtUs = 0;
-                    Emit(resolved, binding, ActionPhase::Press, now);
+                    deadlines.Schedule(
+                        binding.bindingId,
+                        InteractionDeadlineKind::Repeat,
+                        state.pressedAtUs + binding.interaction.repeatDelayUs);
+                    Emit(resolved, graph, binding, ActionPhase::Press, now);
                 }
                 if (state.active && activeByPrimary) {
                     const auto firstRepeatAt = state.pressedAtUs + binding.interaction.repeatDelayUs;
                     const auto nextRepeatAt =
                         state.lastRepeatAtUs == 0 ? firstRepeatAt : state.lastRepeatAtUs + binding.interaction.repeatIntervalUs;
                     if (now >= nextRepeatAt) {
-                        state.lastRepeatAtUs = now;
-                        Emit(resolved, binding, ActionPhase::Repeat, now);
+                        deadlines.Schedule(
+                            binding.bindingId,
+                            InteractionDeadlineKind::Repeat,
+                            AdvanceRepeatCadence(state, binding.interaction, nextRepeatAt, now));
+                        Emit(resolved, graph, binding, ActionPhase::Repeat, nextRepeatAt, 0, 0, now);
                     }
                 }
                 if (state.active && (!primary->down || primary->released || !requiredDown)) {
                     state = {};
-                    Emit(resolved, binding, ActionPhase::Release, now);
+                    deadlines.CancelBinding(binding.bindingId);
+                    Emit(resolved, graph, binding, ActionPhase::Release, now);
                 }
                 break;
             case InteractionKind::Toggle:
                 if (primary->pressed && requiredDown) {
                     state.toggleLatched = !state.toggleLatched;
-                    Emit(resolved, binding, state.toggleLatched ? ActionPhase::Press : ActionPhase::Release, now);
+                    Emit(resolved, graph, binding, state.toggleLatched ? ActionPhase::Press : ActionPhase::Release, now);
                 }
                 break;
             case InteractionKind::Chord: {
@@ -577,6 +696,7 @@ namespace dualpad::input_v2::actions
                     state.chordLatched = true;
                     Emit(
                         resolved,
+                        graph,
                         binding,
                         ActionPhase::Pulse,
                         now,
@@ -594,7 +714,93 @@ namespace dualpad::input_v2::actions
             }
         }
 
-        FlushAxis2DValues(resolved, axis2DBuckets, frame.facts.monotonicUs);
+        FlushAxis2DValues(resolved, graph, axis2D, frame.facts.monotonicUs);
+    }
+
+    ResolvedActionFrame InteractionEngine::ResolveDeadlines(
+        const CompiledActionGraph& graph,
+        const ActionSetStack& actionSetStack,
+        const KernelFacts& facts,
+        InteractionStateStore& stateStore) const
+    {
+        ResolvedActionFrame resolved{};
+        resolved.manifestEpoch = facts.manifestEpoch;
+        resolved.contextRevision = facts.contextRevision;
+
+        auto& deadlines = stateStore.Deadlines();
+        if (facts.manifestEpoch != graph.manifestEpoch || deadlines.PendingCount() == 0) {
+            return resolved;
+        }
+
+        auto& expired = stateStore.ExpiredDeadlineScratch();
+        expired.clear();
+        deadlines.Advance(facts.monotonicUs, expired);
+        for (const auto& deadline : expired) {
+            const auto* binding = graph.FindBinding(deadline.bindingId);
+            if (binding == nullptr || !IsBindingInActionSetStack(*binding, actionSetStack)) {
+                continue;
+            }
+
+            auto& state = stateStore.ForBinding(deadline.bindingId);
+            switch (deadline.kind) {
+            case InteractionDeadlineKind::Hold:
+                if (binding->interaction.kind == InteractionKind::Hold && state.active && !state.holdFired) {
+                    state.holdFired = true;
+                    Emit(resolved, graph, *binding, ActionPhase::Hold, deadline.deadlineUs, 0, 0, facts.monotonicUs);
+                }
+                break;
+            case InteractionDeadlineKind::Repeat:
+                if (binding->interaction.kind == InteractionKind::Repeat && state.active) {
+                    deadlines.Schedule(
+                        binding->bindingId,
+                        InteractionDeadlineKind::Repeat,
+                        AdvanceRepeatCadence(state, binding->interaction, deadline.deadlineUs, facts.monotonicUs));
+                    Emit(resolved, graph, *binding, ActionPhase::Repeat, deadline.deadlineUs, 0, 0, facts.monotonicUs);
+                }
+                break;
+            case InteractionDeadlineKind::TapWindow:
+                if (binding->interaction.kind == InteractionKind::Tap && state.tapCandidate) {
+                    state = {};
+                }
+                break;
+            default:
+                break;
+            }
+        }
+        return resolved;
+    }
+
+    ResolvedActionFrame InteractionEngine::MigrateState(
+        const CompiledActionGraph& previousGraph,
+        const CompiledActionGraph& graph,
+        std::uint64_t timestampUs,
+        InteractionStateStore& stateStore) const
+    {
+        ResolvedActionFrame resolved{};
+        resolved.manifestEpoch = graph.manifestEpoch;
+
+        for (const auto bindingId : stateStore.TrackedBindingIds()) {
+            const auto* next = graph.FindBinding(bindingId);
+            const auto* previous = previousGraph.FindBinding(bindingId);
+            if (next != nullptr && previous != nullptr && *next == *previous) {
+                continue;
+            }
+
+            const auto* state = stateStore.Find(bindingId);
+            if (previous != nullptr && state != nullptr) {
+                const auto releaseOpen =
+                    (state->active &&
+                        (previous->interaction.kind == InteractionKind::Press ||
+                            previous->interaction.kind == InteractionKind::Gesture ||
+                            previous->interaction.kind == InteractionKind::Repeat)) ||
+                    (state->holdFired && previous->interaction.kind == InteractionKind::Hold) ||
+                    (state->toggleLatched && previous->interaction.kind == InteractionKind::Toggle);
+                if (releaseOpen) {
+                    Emit(resolved, previousGraph, *previous, ActionPhase::Release, timestampUs);
+                }
+            }
+            stateStore.Drop(bindingId);
+        }
         return resolved;
     }
 
@@ -3,6 +3,7 @@
 #include "input_v2/actions/ActionManifest.h"
 #include "input_v2/actions/ActionSetResolver.h"
 #include "input_v2/actions/CompiledActionGraph.h"
+#include "input_v2/actions/InteractionTimerWheel.h"
 #include "input_v2/actions/LegacyInteractionInputAdapter.h"
 
 #include <cstdint>
@@ -25,7 +26,7 @@ namespace dualpad::input_v2::actions
 
     struct ActionPhaseChange
     {
-        ActionId actionId;
+        InternedActionId actionId;
         BindingId bindingId{ 0 };
         ActionPhase phase{ ActionPhase::Press };
         std::uint64_t timestampUs{ 0 };
@@ -36,7 +37,7 @@ namespace dualpad::input_v2::actions
 
     struct ActionValueSnapshot
     {
-        ActionId actionId;
+        InternedActionId actionId;
         ActionValueKind kind{ ActionValueKind::Unknown };
         float scalar{ 0.0f };
         float x{ 0.0f };
@@ -72,15 +73,69 @@ namespace dualpad::input_v2::actions
         float currentScalar{ 0.0f };
     };
 
+    struct Axis2DAccumulator
+    {
+        // Lowest contributing binding this frame; 0 while the slot is untouched.
+        BindingId bindingId{ 0 };
+        float x{ 0.0f };
+        float y{ 0.0f };
+        bool hasX{ false };
+        bool hasY{ false };
+        bool changed{ false };
+        std::uint64_t timestampUs{ 0 };
+    };
+
+    // Axis2D pairing scratch indexed by CompiledActionGraph::axis2DSlots. The
+    // storage survives across frames; only touched slots are reset after each
+    // flush, so steady-state stick input resolves without allocating.
+    struct Axis2DFrameScratch
+    {
+        std::vector<Axis2DAccumulator> slots;
+        // Touched slot indices, kept ordered by accumulator bindingId.
+        std::vector<std::uint32_t> touched;
+
+        void Prepare(std::size_t slotCount);
+        void Clear();
+    };
+
+    struct InteractionSelectionCandidate
+    {
+        const CompiledGraphBinding* binding{ nullptr };
+        std::uint8_t strength{ 0 };
+        std::size_t specificity{ 0 };
+    };
+
+    // Binding selection buffers reused by every Resolve. They are cleared, not
+    // released, between frames so selection stops allocating once warm.
+    struct InteractionSelectionScratch
+    {
+        std::vector<const CompiledGraphBinding*> visible;
+        std::vector<const CompiledGraphBinding*> selected;
+        std::vector<InteractionSelectionCandidate> candidates;
+        std::vector<ControlPath> activePaths;
+    };
+
     class InteractionStateStore
     {
     public:
         InteractionBindingState& ForBinding(BindingId bindingId);
         const InteractionBindingState* Find(BindingId bindingId) const;
+        InteractionTimerWheel& Deadlines();
+        const InteractionTimerWheel& Deadlines() const;
+        Axis2DFrameScratch& Axis2DScratch();
+        InteractionSelectionScratch& SelectionScratch();
+        // Deadlines Advance() hands back on a tick; cleared, not released.
+        std::vector<InteractionDeadline>& ExpiredDeadlineScratch();
+        [[nodiscard]] std::vector<BindingId> TrackedBindingIds() const;
+        void Drop(BindingId bindingId);
         void Reset();
 
     private:
         std::unordered_map<BindingId, InteractionBindingState> _states;
+        InteractionTimerWheel _deadlines;
+        Axis2DFrameScratch _axis2D;
+        InteractionSelectionScratch _selection;
+        std::vector<InteractionDeadline> _expiredDeadlines;
     };
 
     class InteractionEngine
@@ -92,6 +147,34 @@ namespace dualpad::input_v2::actions
             const KernelFrame& frame,
             InteractionStateStore& stateStore) const;
 
+        // Same as Resolve, but writes into a caller-owned frame whose vectors
+        // are cleared and refilled in place. Steady-state callers that keep the
+        // frame across ticks resolve without touching the heap.
+        void ResolveInto(
+            const CompiledActionGraph& graph,
+            const ActionSetStack& actionSetStack,
+            const KernelFrame& frame,
+            InteractionStateStore& stateStore,
+            ResolvedActionFrame& resolved) const;
+
+        // Fires hold/repeat deadlines that came due since the last frame and
+        // closes expired tap windows. Called from the runtime tick so timing
+        // does not depend on when the next KernelFrame arrives.
+        ResolvedActionFrame ResolveDeadlines(
+            const CompiledActionGraph& graph,
+            const ActionSetStack& actionSetStack,
+            const KernelFacts& facts,
+            InteractionStateStore& stateStore) const;
+
+        // Carries state across a preserving manifest epoch change. Bindings that
+        // survive unchanged keep their state and deadlines; the rest are dropped,
+        // emitting Release for any phase the old binding had left open.
+        ResolvedActionFrame MigrateState(
+            const CompiledActionGraph& previousGraph,
+            const CompiledActionGraph& graph,
+            std::uint64_t timestampUs,
+            InteractionStateStore& stateStore) const;
+
         static std::optional<ControlSample> FindSample(
             const KernelFrame& frame,
             const ControlPath& path);
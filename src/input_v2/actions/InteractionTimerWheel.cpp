@@ -0,0 +1,243 @@
+#include "pch.h"
+
+#include "input_v2/actions/InteractionTimerWheel.h"
+
+#include <algorithm>
+
+namespace dualpad::input_v2::actions
+{
+    namespace
+    {
+        constexpr std::uint64_t kSlotMask = InteractionTimerWheel::kSlotsPerLevel - 1;
+        constexpr std::uint64_t kLevelSpanTicks[] = {
+            std::uint64_t{ 1 } << (InteractionTimerWheel::kSlotBits * 1),
+            std::uint64_t{ 1 } << (InteractionTimerWheel::kSlotBits * 2),
+            std::uint64_t{ 1 } << (InteractionTimerWheel::kSlotBits * 3)
+        };
+        static_assert(std::size(kLevelSpanTicks) == InteractionTimerWheel::kLevels);
+
+        // Walking the wheel one tick at a time is only worthwhile while the gap
+        // is short; after a long stall (debugger, alt-tab) rebuild it instead.
+        constexpr std::uint64_t kMaxTickWalk = kLevelSpanTicks[1];
+    }
+
+    InteractionTimerWheel::InteractionTimerWheel()
+    {
+        _slotHeads.fill(kNoNode);
+    }
+
+    std::uint64_t InteractionTimerWheel::KeyFor(BindingId bindingId, InteractionDeadlineKind kind)
+    {
+        return (static_cast<std::uint64_t>(bindingId) << 8) | static_cast<std::uint64_t>(kind);
+    }
+
+    void InteractionTimerWheel::Schedule(
+        BindingId bindingId,
+        InteractionDeadlineKind kind,
+        std::uint64_t deadlineUs)
+    {
+        const auto key = KeyFor(bindingId, kind);
+        std::uint32_t index = kNoNode;
+        if (const auto it = _nodeByKey.find(key); it != _nodeByKey.end()) {
+            index = it->second;
+            Unlink(index);
+        } else if (!_freeNodes.empty()) {
+            index = _freeNodes.back();
+            _freeNodes.pop_back();
+            _nodeByKey.emplace(key, index);
+        } else {
+            index = static_cast<std::uint32_t>(_nodes.size());
+            _nodes.emplace_back();
+            _nodeByKey.emplace(key, index);
+        }
+
+        auto& node = _nodes[index];
+        node.deadline = InteractionDeadline{
+            .bindingId = bindingId,
+            .kind = kind,
+            .deadlineUs = deadlineUs
+        };
+        node.deadlineTick = deadlineUs / kTickUs;
+        Place(index);
+    }
+
+    void InteractionTimerWheel::Cancel(BindingId bindingId, InteractionDeadlineKind kind)
+    {
+        const auto it = _nodeByKey.find(KeyFor(bindingId, kind));
+        if (it == _nodeByKey.end()) {
+            return;
+        }
+        Unlink(it->second);
+        Release(it->second);
+    }
+
+    void InteractionTimerWheel::CancelBinding(BindingId bindingId)
+    {
+        Cancel(bindingId, InteractionDeadlineKind::Hold);
+        Cancel(bindingId, InteractionDeadlineKind::Repeat);
+        Cancel(bindingId, InteractionDeadlineKind::TapWindow);
+    }
+
+    void InteractionTimerWheel::Advance(std::uint64_t nowUs, std::vector<InteractionDeadline>& expired)
+    {
+        const auto firstExpired = expired.size();
+        const auto targetTick = nowUs / kTickUs;
+
+        DrainSlot(kDueSlot, nowUs, expired);
+        if (_nodeByKey.empty() || targetTick <= _currentTick) {
+            _currentTick = (std::max)(_currentTick, targetTick);
+        } else if (targetTick - _currentTick > kMaxTickWalk) {
+            _currentTick = targetTick;
+            Resync(nowUs, expired);
+        } else {
+            while (_currentTick < targetTick) {
+                ++_currentTick;
+                // Cascade upper levels whenever the level below wraps, then
+                // fire whatever is left in the level-0 slot for this tick.
+                if ((_currentTick & kSlotMask) == 0) {
+                    DrainSlot(kSlotsPerLevel + ((_currentTick >> kSlotBits) & kSlotMask), nowUs, expired);
+                    if (((_currentTick >> kSlotBits) & kSlotMask) == 0) {
+                        DrainSlot(
+                            (2 * kSlotsPerLevel) + ((_currentTick >> (2 * kSlotBits)) & kSlotMask),
+                            nowUs,
+                            expired);
+                        if (((_currentTick >> (2 * kSlotBits)) & kSlotMask) == 0) {
+                            DrainSlot(kOverflowSlot, nowUs, expired);
+                        }
+                    }
+                }
+                DrainSlot(_currentTick & kSlotMask, nowUs, expired);
+            }
+        }
+        DrainSlot(kDueSlot, nowUs, expired);
+
+        (std::sort)(
+            expired.begin() + static_cast<std::ptrdiff_t>(firstExpired),
+            expired.end(),
+            [](const InteractionDeadline& lhs, const InteractionDeadline& rhs) {
+                if (lhs.deadlineUs != rhs.deadlineUs) {
+                    return lhs.deadlineUs < rhs.deadlineUs;
+                }
+                if (lhs.bindingId != rhs.bindingId) {
+                    return lhs.bindingId < rhs.bindingId;
+                }
+                return static_cast<std::uint8_t>(lhs.kind) < static_cast<std::uint8_t>(rhs.kind);
+            });
+    }
+
+    bool InteractionTimerWheel::Contains(BindingId bindingId, InteractionDeadlineKind kind) const
+    {
+        return _nodeByKey.contains(KeyFor(bindingId, kind));
+    }
+
+    std::size_t InteractionTimerWheel::PendingCount() const
+    {
+        return _nodeByKey.size();
+    }
+
+    void InteractionTimerWheel::Reset()
+    {
+        _nodes.clear();
+        _freeNodes.clear();
+        _nodeByKey.clear();
+        _slotHeads.fill(kNoNode);
+        _currentTick = 0;
+    }
+
+    void InteractionTimerWheel::Place(std::uint32_t index)
+    {
+        // Deadlines inside the current tick wait in the due slot, which every
+        // Advance() checks at microsecond precision.
+        const auto tick = _nodes[index].deadlineTick;
+        if (tick <= _currentTick) {
+            Link(index, kDueSlot);
+            return;
+        }
+
+        const auto delta = tick - _currentTick;
+        for (std::size_t level = 0; level < kLevels; ++level) {
+            if (delta < kLevelSpanTicks[level]) {
+                Link(index, (level * kSlotsPerLevel) + ((tick >> (level * kSlotBits)) & kSlotMask));
+                return;
+            }
+        }
+        Link(index, kOverflowSlot);
+    }
+
+    void InteractionTimerWheel::Link(std::uint32_t index, std::size_t slot)
+    {
+        auto& node = _nodes[index];
+        node.slot = static_cast<std::uint32_t>(slot);
+        node.prev = kNoNode;
+        node.next = _slotHeads[slot];
+        if (node.next != kNoNode) {
+            _nodes[node.next].prev = index;
+        }
+        _slotHeads[slot] = index;
+    }
+
+    void InteractionTimerWheel::Unlink(std::uint32_t index)
+    {
+        auto& node = _nodes[index];
+        if (node.prev != kNoNode) {
+            _nodes[node.prev].next = node.next;
+        } else {
+            _slotHeads[node.slot] = node.next;
+        }
+        if (node.next != kNoNode) {
+            _nodes[node.next].prev = node.prev;
+        }
+        node.prev = kNoNode;
+        node.next = kNoNode;
+    }
+
+    void InteractionTimerWheel::Release(std::uint32_t index)
+    {
+        const auto& deadline = _nodes[index].deadline;
+        _nodeByKey.erase(KeyFor(deadline.bindingId, deadline.kind));
+        _freeNodes.push_back(index);
+    }
+
+    void InteractionTimerWheel::DrainSlot(
+        std::size_t slot,
+        std::uint64_t nowUs,
+        std::vector<InteractionDeadline>& expired)
+    {
+        auto index = _slotHeads[slot];
+        _slotHeads[slot] = kNoNode;
+        while (index != kNoNode) {
+            const auto next = _nodes[index].next;
+            _nodes[index].prev = kNoNode;
+            _nodes[index].next = kNoNode;
+            if (_nodes[index].deadline.deadlineUs <= nowUs) {
+                expired.push_back(_nodes[index].deadline);
+                Release(index);
+            } else {
+                Place(index);
+            }
+            index = next;
+        }
+    }
+
+    void InteractionTimerWheel::Resync(std::uint64_t nowUs, std::vector<InteractionDeadline>& expired)
+    {
+        std::vector<std::uint32_t> pending;
+        pending.reserve(_nodeByKey.size());
+        for (const auto& [key, index] : _nodeByKey) {
+            (void)key;
+            pending.push_back(index);
+        }
+        _slotHeads.fill(kNoNode);
+
+        for (const auto index : pending) {
+            _nodes[index].prev = kNoNode;
+            _nodes[index].next = kNoNode;
+            if (_nodes[index].deadline.deadlineUs <= nowUs) {
+                expired.push_back(_nodes[index].deadline);
+                Release(index);
+            } else {
+                Place(index);
+            }
+        }
+    }
+}
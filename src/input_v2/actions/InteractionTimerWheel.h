@@ -0,0 +1,82 @@
+#pragma once
+
+#include "input_v2/actions/CompiledActionGraph.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace dualpad::input_v2::actions
+{
+    enum class InteractionDeadlineKind : std::uint8_t
+    {
+        Hold = 0,
+        Repeat,
+        TapWindow
+    };
+
+    struct InteractionDeadline
+    {
+        BindingId bindingId{ 0 };
+        InteractionDeadlineKind kind{ InteractionDeadlineKind::Hold };
+        std::uint64_t deadlineUs{ 0 };
+    };
+
+    // Hierarchical timer wheel for interaction deadlines. Each binding owns at
+    // most one deadline per kind; scheduling replaces the previous one. Slots
+    // are 1ms wide; the final tick is checked at microsecond precision so a
+    // deadline fires on the first Advance() at or after its exact timestamp.
+    class InteractionTimerWheel
+    {
+    public:
+        static constexpr std::uint64_t kTickUs = 1'000;
+        static constexpr std::size_t kSlotBits = 6;
+        static constexpr std::size_t kSlotsPerLevel = std::size_t{ 1 } << kSlotBits;
+        static constexpr std::size_t kLevels = 3;
+
+        InteractionTimerWheel();
+
+        void Schedule(BindingId bindingId, InteractionDeadlineKind kind, std::uint64_t deadlineUs);
+        void Cancel(BindingId bindingId, InteractionDeadlineKind kind);
+        void CancelBinding(BindingId bindingId);
+
+        // Appends every deadline <= nowUs to expired, ordered by deadline then
+        // binding id, and removes them from the wheel.
+        void Advance(std::uint64_t nowUs, std::vector<InteractionDeadline>& expired);
+
+        [[nodiscard]] bool Contains(BindingId bindingId, InteractionDeadlineKind kind) const;
+        [[nodiscard]] std::size_t PendingCount() const;
+        void Reset();
+
+    private:
+        static constexpr std::uint32_t kNoNode = 0xFFFF'FFFFu;
+        static constexpr std::size_t kOverflowSlot = kLevels * kSlotsPerLevel;
+        static constexpr std::size_t kDueSlot = kOverflowSlot + 1;
+
+        struct Node
+        {
+            InteractionDeadline deadline{};
+            std::uint64_t deadlineTick{ 0 };
+            std::uint32_t prev{ kNoNode };
+            std::uint32_t next{ kNoNode };
+            std::uint32_t slot{ 0 };
+        };
+
+        static std::uint64_t KeyFor(BindingId bindingId, InteractionDeadlineKind kind);
+
+        void Place(std::uint32_t index);
+        void Link(std::uint32_t index, std::size_t slot);
+        void Unlink(std::uint32_t index);
+        void Release(std::uint32_t index);
+        void DrainSlot(std::size_t slot, std::uint64_t nowUs, std::vector<InteractionDeadline>& expired);
+        void Resync(std::uint64_t nowUs, std::vector<InteractionDeadline>& expired);
+
+        std::vector<Node> _nodes;
+        std::vector<std::uint32_t> _freeNodes;
+        std::unordered_map<std::uint64_t, std::uint32_t> _nodeByKey;
+        std::array<std::uint32_t, kDueSlot + 1> _slotHeads{};
+        std::uint64_t _currentTick{ 0 };
+    };
+}
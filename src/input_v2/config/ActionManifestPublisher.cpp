@@ -37,7 +37,13 @@ namespace dualpad::input_v2::config
             return false;
         }
 
-        const auto graphCompile = actions::ActionGraphCompiler::Compile(bundle.manifest);
+        // Hot reloads still compile the whole bundle; compiling against the
+        // live graph only keeps surviving bindings on their BindingIds so
+        // in-flight interactions carry over to the new epoch.
+        const auto previousGraph = actions::CompiledActionGraphPublisher::GetRuntimeOwner().GetActiveGraph();
+        const auto graphCompile = previousGraph ?
+            actions::ActionGraphCompiler::CompilePreservingBindingIds(bundle.manifest, *previousGraph) :
+            actions::ActionGraphCompiler::Compile(bundle.manifest);
         if (!graphCompile.ok) {
             logger::error(
                 "[DualPad][PH4][GraphPublisher] Compile failed for manifest epoch {}: {}",
@@ -62,8 +68,12 @@ namespace dualpad::input_v2::config
         _lastPublishedEpoch = manifestEpoch;
         _activeEpochObservedAtLastPublish = activeEpochBeforePublish;
         ++_publishCount;
-        ingress::IngressHub::GetSingleton().PushManifestEpochChanged(manifestEpoch);
-        logger::info("[DualPad][PH1][Publisher] Published manifest epoch {}", manifestEpoch);
+        ingress::IngressHub::GetSingleton().PushManifestEpochChanged(manifestEpoch, previousGraph != nullptr);
+        logger::info(
+            "[DualPad][PH1][Publisher] Published manifest epoch {} (action sets unchanged={} changed={})",
+            manifestEpoch,
+            graphCompile.unchangedActionSets,
+            graphCompile.changedActionSets);
         return true;
     }
 
@@ -6,6 +6,7 @@
 #include "input_v2/config/ManifestValidator.h"
 
 #include <cctype>
+#include <chrono>
 #include <fstream>
 #include <format>
 #include <iomanip>
@@ -468,6 +469,7 @@ namespace dualpad::input_v2::config
             resolvedBindings.string(),
             resolvedPolicy.string());
 
+        const auto loadStart = std::chrono::steady_clock::now();
         const auto scratch = ScratchCompileBundle(resolvedBindings, resolvedPolicy, candidateEpoch);
         if (scratch.ok && scratch.bundle) {
             std::string promoteMessage;
@@ -478,6 +480,14 @@ namespace dualpad::input_v2::config
                 return r;
             }
 
+            const auto loadDurationUs = static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - loadStart).count());
+            logger::info(
+                "[DualPad][PH1][Reloader] epoch {} loaded in {}us (startup={})",
+                candidateEpoch,
+                loadDurationUs,
+                isStartup);
+
             // Best-effort disk persistence.
             std::string persistMessage;
             if (!TryWriteDiskLkg(diskLkgPath, *scratch.bundle, persistMessage)) {
@@ -487,6 +497,7 @@ namespace dualpad::input_v2::config
             LoadOrRecoverResult r{};
             r.ok = true;
             r.message = scratch.message;
+            r.loadDurationUs = loadDurationUs;
             return r;
         }
 
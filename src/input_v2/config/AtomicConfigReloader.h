@@ -30,6 +30,9 @@ namespace dualpad::input_v2::config
         bool ok{ false };
         std::string message;
         bool recoveredFromDiskLkg{ false };
+
+        // Scratch compile + promote wall time.
+        std::uint64_t loadDurationUs{ 0 };
     };
 
     // Phase 1: compiles legacy INI inputs into an immutable compiled bundle and atomically promotes it.
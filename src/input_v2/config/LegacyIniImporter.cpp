@@ -61,7 +61,11 @@ namespace dualpad::input_v2::config
         ParsedIniFile ParseIniFile(const std::filesystem::path& path, IniParseRole role)
         {
             ParsedIniFile parsed{};
-            std::ifstream in(path);
+            std::error_code ec;
+            std::ifstream in;
+            if (std::filesystem::is_regular_file(path, ec)) {
+                in.open(path);
+            }
             if (!in.is_open()) {
                 AddParseIssue(parsed, std::string("failed to open ini: ") + path.string(), true);
                 return parsed;
@@ -213,6 +217,8 @@ namespace dualpad::input_v2::config
 
         if (!std::filesystem::exists(result.bundle.bindingsPath)) {
             result.bundle.bindingsMissing = true;
+            result.bundle.warnings.push_back(
+                std::string("bindings ini not found; using built-in defaults: ") + result.bundle.bindingsPath.string());
         } else {
             // Parse bindings ini into raw AST (no trigger/action lowering here).
             auto parsed = ParseIniFile(result.bundle.bindingsPath, IniParseRole::Bindings);
@@ -230,6 +236,8 @@ namespace dualpad::input_v2::config
 
         if (!std::filesystem::exists(result.bundle.menuPolicyPath)) {
             result.bundle.menuPolicyMissing = true;
+            result.bundle.warnings.push_back(
+                std::string("menu policy ini not found; using built-in defaults: ") + result.bundle.menuPolicyPath.string());
         } else {
             auto parsed = ParseIniFile(result.bundle.menuPolicyPath, IniParseRole::MenuPolicy);
             result.bundle.warnings.insert(
@@ -5,6 +5,7 @@
 #include "input/IniParseHelpers.h"
 #include "input_v2/config/LegacyIniImporter.h"
 
+#include <algorithm>
 #include <format>
 
 namespace dualpad::input_v2::context
@@ -212,6 +213,25 @@ namespace dualpad::input_v2::context
             }
             return UnknownMenuPolicy::Passthrough;
         }
+
+    }
+
+    void ContextCatalog::BuildActionSetStackTable(CompiledContextCatalog& catalog)
+    {
+        std::vector<std::shared_ptr<const actions::ActionSetStack>> distinct;
+        for (std::size_t index = 0; index < kUiContextIdCount; ++index) {
+            const auto id = static_cast<UiContextId>(index);
+            auto stack = ContextCatalog::BuildActionSetStack(ContextCatalog::FindById(catalog, id), id);
+            const auto existing = std::find_if(distinct.begin(), distinct.end(), [&](const auto& candidate) {
+                return *candidate == stack;
+            });
+            if (existing != distinct.end()) {
+                catalog.actionSetStackById[index] = *existing;
+                continue;
+            }
+            distinct.push_back(std::make_shared<const actions::ActionSetStack>(std::move(stack)));
+            catalog.actionSetStackById[index] = distinct.back();
+        }
     }
 
     const CompiledContextCatalog& ContextCatalog::BuiltInCatalog()
@@ -222,6 +242,7 @@ namespace dualpad::input_v2::context
             if (!res.ok) {
                 // This should never happen unless the built-in seed is invalid.
                 CompiledContextCatalog empty{};
+                BuildActionSetStackTable(empty);
                 return empty;
             }
             return res.catalog;
@@ -370,6 +391,7 @@ namespace dualpad::input_v2::context
             }
         }
 
+        BuildActionSetStackTable(result.catalog);
         result.ok = true;
         return result;
     }
@@ -387,6 +409,27 @@ namespace dualpad::input_v2::context
         return &catalog.entries[idx];
     }
 
+    actions::ActionSetStack ContextCatalog::BuildActionSetStack(const CompiledContextEntry* entry, UiContextId id)
+    {
+        if (entry && entry->defaultActionSetId) {
+            return actions::ActionSetStack{
+                .baseSetId = *entry->defaultActionSetId,
+                .layerIds = entry->defaultLayerIds,
+                .scopeAnchorIds = entry->scopeAnchorIds
+            };
+        }
+
+        if (id == UiContextId::PassthroughOverlay) {
+            return actions::ActionSetStack{};
+        }
+
+        return actions::ActionSetStack{
+            .baseSetId = "MenuBase",
+            .layerIds = { "UnknownTrackedMenuLayer" },
+            .scopeAnchorIds = { "MenuBase", "UnknownTrackedMenuLayer" }
+        };
+    }
+
     std::optional<UiContextId> ContextCatalog::ResolveAlias(const CompiledContextCatalog& catalog, std::string_view name)
     {
         const auto key = NormalizeKey(name);
@@ -1,9 +1,12 @@
 #pragma once
 
+#include "input_v2/actions/ActionSetStack.h"
 #include "input_v2/compat/LegacyInputContextCompat.h"
 
+#include <array>
 #include <cstdint>
 #include <functional>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -72,6 +75,8 @@ namespace dualpad::input_v2::context
         PassthroughOverlay,
     };
 
+    inline constexpr std::size_t kUiContextIdCount = static_cast<std::size_t>(UiContextId::PassthroughOverlay) + 1;
+
     struct UiContextIdHash
     {
         std::size_t operator()(UiContextId id) const noexcept
@@ -124,6 +129,10 @@ namespace dualpad::input_v2::context
         std::unordered_map<std::string, UiContextId> aliasIndex;
         std::unordered_map<std::string, UiContextId> menuNameIndex;
         std::unordered_map<UiContextId, std::size_t, UiContextIdHash> entryIndexById;
+
+        // Immutable action-set stack per UiContextId, built once per epoch so
+        // context resolution is an index lookup. Equal stacks share one pointer.
+        std::array<std::shared_ptr<const actions::ActionSetStack>, kUiContextIdCount> actionSetStackById{};
     };
 
     struct CatalogCompileResult
@@ -149,5 +158,13 @@ namespace dualpad::input_v2::context
         static std::optional<UiContextId> ResolveAlias(const CompiledContextCatalog& catalog, std::string_view name);
         static std::optional<UiContextId> ResolveMenuName(const CompiledContextCatalog& catalog, std::string_view menuName);
         static std::optional<dualpad::input::InputContext> ToLegacyInputContext(const CompiledContextCatalog& catalog, UiContextId id);
+
+        // Default stack for a context: the entry's base set and layers, empty for
+        // passthrough overlays, and the unknown-menu layer otherwise.
+        static actions::ActionSetStack BuildActionSetStack(const CompiledContextEntry* entry, UiContextId id);
+
+        // Fills actionSetStackById. Compile does this; hand-built catalogs must
+        // call it once before resolving against them.
+        static void BuildActionSetStackTable(CompiledContextCatalog& catalog);
     };
 }
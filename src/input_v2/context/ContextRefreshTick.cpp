@@ -42,10 +42,42 @@ namespace dualpad::input_v2::context
         return false;
     }
 
+    bool ContextRefreshTick::ConsumeRefreshDemand(bool menuDirty, const CompiledContextCatalog& catalog)
+    {
+        std::scoped_lock lock(_mutex);
+        const bool catalogChanged =
+            _refreshedCatalog != &catalog || _refreshedCatalogEpoch != catalog.manifestEpoch;
+        const bool dirty = menuDirty || _substateDirty || catalogChanged;
+        if (!dirty && _framesSinceRefresh + 1 < kSafetyRefreshIntervalFrames) {
+            ++_framesSinceRefresh;
+            ++_stats.skippedRefreshes;
+            return false;
+        }
+
+        if (!dirty) {
+            ++_stats.safetyRefreshes;
+        }
+        ++_stats.executedRefreshes;
+        _substateDirty = false;
+        _refreshedCatalog = &catalog;
+        _refreshedCatalogEpoch = catalog.manifestEpoch;
+        _framesSinceRefresh = 0;
+        return true;
+    }
+
     void ContextRefreshTick::MarkCombatEvent(bool playerInCombat)
     {
         std::scoped_lock lock(_mutex);
-        _combatActive = playerInCombat;
+        if (_combatActive != playerInCombat) {
+            _combatActive = playerInCombat;
+            _substateDirty = true;
+        }
+    }
+
+    ContextRefreshTick::Stats ContextRefreshTick::GetStats() const
+    {
+        std::scoped_lock lock(_mutex);
+        return _stats;
     }
 
     GameplaySubstate ContextRefreshTick::ResolveGameplaySubstate(
@@ -68,24 +100,40 @@ namespace dualpad::input_v2::context
         return ContextResolver::GetSingleton().ResolveAndPublish(stack, gameplaySubstate, catalog);
     }
 
-    ResolvedContextSnapshot ContextRefreshTick::RefreshOnMainThread(std::uint64_t frameToken)
+    bool ContextRefreshTick::RefreshOnMainThread(std::uint64_t frameToken)
+    {
+        return RefreshIfDirty(frameToken, ActiveCatalog(), nullptr);
+    }
+
+    bool ContextRefreshTick::RefreshIfDirty(
+        std::uint64_t frameToken,
+        const CompiledContextCatalog& catalog,
+        const menu::ObservedMenuSnapshot* injectedCapture)
     {
         {
             std::scoped_lock lock(_mutex);
             if (ShouldSkipFrameLocked(frameToken)) {
-                return ContextResolver::GetSingleton().GetPublishedSnapshot();
+                return false;
             }
         }
 
         auto& observer = menu::UiMenuObserver::GetSingleton();
-        auto observed = observer.GetPublishedSnapshot();
-        if (observer.IsDirty()) {
-            observed = observer.Capture();
+        const bool menuDirty = observer.IsDirty();
+        if (!ConsumeRefreshDemand(menuDirty, catalog)) {
+            return false;
+        }
+
+        menu::ObservedMenuSnapshot observed;
+        if (menuDirty) {
+            observed = injectedCapture ? *injectedCapture : observer.Capture();
             observer.Publish(observed);
+        } else {
+            observed = observer.GetPublishedSnapshot();
         }
 
         const auto detectedGameplayContext = dualpad::input::InputContext::Gameplay;
-        return ResolveAndMirror(observed, detectedGameplayContext, ActiveCatalog());
+        ResolveAndMirror(observed, detectedGameplayContext, catalog);
+        return true;
     }
 
     ResolvedContextSnapshot ContextRefreshTick::RefreshObservedForTests(
@@ -105,6 +153,14 @@ namespace dualpad::input_v2::context
         return ResolveAndMirror(observed, detectedGameplayContext, catalog);
     }
 
+    bool ContextRefreshTick::RefreshIfDirtyForTests(
+        std::uint64_t frameToken,
+        const menu::ObservedMenuSnapshot& current,
+        const CompiledContextCatalog& catalog)
+    {
+        return RefreshIfDirty(frameToken, catalog, &current);
+    }
+
     void ContextRefreshTick::ResetForTests()
     {
         {
@@ -112,6 +168,11 @@ namespace dualpad::input_v2::context
             _nextFrameToken = 1;
             _lastRefreshedFrameToken = 0;
             _combatActive = false;
+            _substateDirty = true;
+            _refreshedCatalog = nullptr;
+            _refreshedCatalogEpoch = 0;
+            _framesSinceRefresh = 0;
+            _stats = {};
         }
         menu::UiMenuObserver::GetSingleton().ResetForTests();
         menu::MenuInstanceRegistry::GetSingleton().ResetForTests();
@@ -13,32 +13,66 @@ namespace dualpad::input_v2::context
     class ContextRefreshTick
     {
     public:
+        struct Stats
+        {
+            std::uint64_t executedRefreshes{ 0 };
+            std::uint64_t skippedRefreshes{ 0 };
+            std::uint64_t safetyRefreshes{ 0 };
+        };
+
+        // A clean context is still re-resolved after this many skipped frames,
+        // in case a menu change arrives without a menu event.
+        static constexpr std::uint32_t kSafetyRefreshIntervalFrames = 60;
+
         static ContextRefreshTick& GetSingleton();
 
         std::uint64_t BeginFrame();
-        ResolvedContextSnapshot RefreshOnMainThread(std::uint64_t frameToken);
+        // Re-resolves only when a menu event, a gameplay substate change or a
+        // new catalog marked the context dirty, or the safety interval expired.
+        // Returns true when the context was re-resolved.
+        bool RefreshOnMainThread(std::uint64_t frameToken);
         void MarkCombatEvent(bool playerInCombat);
+        Stats GetStats() const;
 
         ResolvedContextSnapshot RefreshObservedForTests(
             std::uint64_t frameToken,
             const menu::ObservedMenuSnapshot& observed,
             dualpad::input::InputContext detectedGameplayContext,
             const CompiledContextCatalog& catalog);
+        // RefreshOnMainThread against `catalog`, with `current` standing in for
+        // UiMenuObserver::Capture() when the observer is dirty.
+        bool RefreshIfDirtyForTests(
+            std::uint64_t frameToken,
+            const menu::ObservedMenuSnapshot& current,
+            const CompiledContextCatalog& catalog);
         void ResetForTests();
 
     private:
         ContextRefreshTick() = default;
 
+        // Shared by RefreshOnMainThread and RefreshIfDirtyForTests. A null
+        // `injectedCapture` captures the live menu stack.
+        bool RefreshIfDirty(
+            std::uint64_t frameToken,
+            const CompiledContextCatalog& catalog,
+            const menu::ObservedMenuSnapshot* injectedCapture);
+
         ResolvedContextSnapshot ResolveAndMirror(
             const menu::ObservedMenuSnapshot& observed,
             dualpad::input::InputContext detectedGameplayContext,
             const CompiledContextCatalog& catalog);
         GameplaySubstate ResolveGameplaySubstate(dualpad::input::InputContext detectedGameplayContext) const;
         bool ShouldSkipFrameLocked(std::uint64_t frameToken);
+        bool ConsumeRefreshDemand(bool menuDirty, const CompiledContextCatalog& catalog);
 
         mutable std::mutex _mutex;
         std::uint64_t _nextFrameToken{ 1 };
         std::uint64_t _lastRefreshedFrameToken{ 0 };
         bool _combatActive{ false };
+        bool _substateDirty{ true };
+        const CompiledContextCatalog* _refreshedCatalog{ nullptr };
+        std::uint64_t _refreshedCatalogEpoch{ 0 };
+        std::uint32_t _framesSinceRefresh{ 0 };
+        Stats _stats{};
     };
 }
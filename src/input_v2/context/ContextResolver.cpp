@@ -2,6 +2,8 @@
 #include "input_v2/context/ContextResolver.h"
 
 #include <format>
+#include <thread>
+#include <utility>
 
 namespace dualpad::input_v2::context
 {
@@ -27,6 +29,7 @@ namespace dualpad::input_v2::context
             return true;
         }
 
+        // Action-set stacks are compared separately through the catalog pointer.
         bool HasSameResolutionFields(const ResolvedContextSnapshot& lhs, const ResolvedContextSnapshot& rhs)
         {
             return lhs.hostMode == rhs.hostMode &&
@@ -35,11 +38,53 @@ namespace dualpad::input_v2::context
                 lhs.topMenuInstanceId == rhs.topMenuInstanceId &&
                 lhs.identityQuality == rhs.identityQuality &&
                 lhs.menuStackRevision == rhs.menuStackRevision &&
-                lhs.actionSetStack == rhs.actionSetStack &&
                 lhs.presentationPolicyId == rhs.presentationPolicyId &&
                 lhs.legacyInputContext == rhs.legacyInputContext &&
                 lhs.legacyContextEpoch == rhs.legacyContextEpoch;
         }
+
+        // Pins held by the current thread. A publish from a thread that still
+        // holds a pin defers reclamation instead of waiting on itself.
+        thread_local std::uint32_t tPinnedSnapshots = 0;
+    }
+
+    PinnedContextSnapshot::PinnedContextSnapshot(
+        const ResolvedContextSnapshot* snapshot,
+        std::atomic<std::uint32_t>* readers) :
+        _snapshot(snapshot),
+        _readers(readers)
+    {
+        ++tPinnedSnapshots;
+    }
+
+    PinnedContextSnapshot::PinnedContextSnapshot(PinnedContextSnapshot&& other) noexcept :
+        _snapshot(std::exchange(other._snapshot, nullptr)),
+        _readers(std::exchange(other._readers, nullptr))
+    {}
+
+    PinnedContextSnapshot& PinnedContextSnapshot::operator=(PinnedContextSnapshot&& other) noexcept
+    {
+        if (this != &other) {
+            Reset();
+            _snapshot = std::exchange(other._snapshot, nullptr);
+            _readers = std::exchange(other._readers, nullptr);
+        }
+        return *this;
+    }
+
+    PinnedContextSnapshot::~PinnedContextSnapshot()
+    {
+        Reset();
+    }
+
+    void PinnedContextSnapshot::Reset()
+    {
+        if (_readers) {
+            _readers->fetch_sub(1, std::memory_order_release);
+            --tPinnedSnapshots;
+        }
+        _snapshot = nullptr;
+        _readers = nullptr;
     }
 
     ContextResolver& ContextResolver::GetSingleton()
@@ -53,6 +98,7 @@ namespace dualpad::input_v2::context
         GameplaySubstate gameplaySubstate,
         const CompiledContextCatalog& catalog)
     {
+        std::scoped_lock lock(_writerMutex);
         ResolvedContextSnapshot next{};
         next.gameplaySubstate = gameplaySubstate;
         next.menuStackRevision = menuStack.menuStackRevision;
@@ -97,31 +143,111 @@ namespace dualpad::input_v2::context
             next.legacyInputContext = dualpad::input::InputContext::Menu;
         }
 
-        next.actionSetStack = actions::ActionSetResolver::Resolve(catalog, next.uiContextId);
+        next.actionSetStack = actions::ActionSetResolver::ResolveShared(catalog, next.uiContextId);
+        const bool sameActionSetStack = next.actionSetStack == _published.actionSetStack;
         if (ShouldAdvanceLegacyEpoch(_published.legacyInputContext, next.legacyInputContext)) {
             ++next.legacyContextEpoch;
         }
 
-        if (!HasSameResolutionFields(_published, next)) {
+        if (!sameActionSetStack || !HasSameResolutionFields(_published, next)) {
             next.contextRevision = _published.contextRevision + 1;
-            _published = next;
+            PublishLocked(std::move(next));
         }
         return _published;
     }
 
-    const ResolvedContextSnapshot& ContextResolver::GetPublishedSnapshot() const
+    ResolvedContextSnapshot ContextResolver::GetPublishedSnapshot() const
     {
-        return _published;
+        return *PinPublishedSnapshot();
+    }
+
+    PinnedContextSnapshot ContextResolver::PinPublishedSnapshot() const
+    {
+        // Register on the current epoch's slot, then confirm the epoch did not
+        // flip underneath; a writer that flipped first is not waiting on this
+        // slot, so retry on the new one.
+        for (;;) {
+            const auto epoch = _readEpoch.load(std::memory_order_seq_cst);
+            auto& readers = _pinnedReaders[epoch & 1u];
+            readers.fetch_add(1, std::memory_order_seq_cst);
+            if (_readEpoch.load(std::memory_order_seq_cst) == epoch) {
+                return PinnedContextSnapshot(_snapshot.load(std::memory_order_seq_cst), &readers);
+            }
+            readers.fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    PublishedContextFields ContextResolver::ReadPublishedFields() const
+    {
+        for (;;) {
+            const auto begin = _fieldsSequence.load(std::memory_order_acquire);
+            if ((begin & 1u) != 0) {
+                continue;
+            }
+
+            const PublishedContextFields fields{
+                .hostMode = static_cast<HostMode>(_hostMode.load(std::memory_order_relaxed)),
+                .uiContextId = static_cast<UiContextId>(_uiContextId.load(std::memory_order_relaxed)),
+                .menuStackRevision = _menuStackRevision.load(std::memory_order_relaxed),
+                .contextRevision = _contextRevision.load(std::memory_order_relaxed),
+                .legacyInputContext = static_cast<dualpad::input::InputContext>(_legacyInputContext.load(std::memory_order_relaxed)),
+                .legacyContextEpoch = _legacyContextEpoch.load(std::memory_order_relaxed)
+            };
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (_fieldsSequence.load(std::memory_order_relaxed) == begin) {
+                return fields;
+            }
+        }
     }
 
     void ContextResolver::PublishSnapshotForReplayTests(ResolvedContextSnapshot snapshot)
     {
-        _published = std::move(snapshot);
+        std::scoped_lock lock(_writerMutex);
+        PublishLocked(std::move(snapshot));
     }
 
     void ContextResolver::ResetForTests()
     {
-        _published = ResolvedContextSnapshot{};
+        std::scoped_lock lock(_writerMutex);
+        PublishLocked(ResolvedContextSnapshot{});
+    }
+
+    void ContextResolver::PublishLocked(ResolvedContextSnapshot snapshot)
+    {
+        _published = std::move(snapshot);
+        auto next = std::make_unique<const ResolvedContextSnapshot>(_published);
+        _snapshot.store(next.get(), std::memory_order_seq_cst);
+        _retired.push_back(std::exchange(_current, std::move(next)));
+        if (tPinnedSnapshots == 0) {
+            WaitForPinnedReadersLocked();
+            _retired.clear();
+        }
+
+        // Odd sequence while the fields are in flight; readers that straddle
+        // the write see a changed or odd sequence and retry.
+        const auto sequence = _fieldsSequence.load(std::memory_order_relaxed);
+        _fieldsSequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        _hostMode.store(static_cast<std::uint8_t>(_published.hostMode), std::memory_order_relaxed);
+        _uiContextId.store(static_cast<std::uint16_t>(_published.uiContextId), std::memory_order_relaxed);
+        _menuStackRevision.store(_published.menuStackRevision, std::memory_order_relaxed);
+        _contextRevision.store(_published.contextRevision, std::memory_order_relaxed);
+        _legacyInputContext.store(static_cast<std::uint16_t>(_published.legacyInputContext), std::memory_order_relaxed);
+        _legacyContextEpoch.store(_published.legacyContextEpoch, std::memory_order_relaxed);
+        _fieldsSequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    void ContextResolver::WaitForPinnedReadersLocked()
+    {
+        // Two flips: the first drains pins taken before the swap, the second
+        // drains pins that registered on the other slot before the first flip.
+        // Pins are held for one packet batch or frame, so this is short.
+        for (int flip = 0; flip < 2; ++flip) {
+            const auto epoch = _readEpoch.fetch_add(1, std::memory_order_seq_cst);
+            while (_pinnedReaders[epoch & 1u].load(std::memory_order_seq_cst) != 0) {
+                std::this_thread::yield();
+            }
+        }
     }
 
     GameplaySubstate ContextResolver::GameplaySubstateFromLegacy(dualpad::input::InputContext context)
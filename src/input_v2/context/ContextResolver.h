@@ -5,7 +5,11 @@
 #include "input_v2/context/ContextCatalog.h"
 #include "input_v2/menu/MenuInstanceRegistry.h"
 
+#include <array>
+#include <atomic>
 #include <cstdint>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <vector>
@@ -42,7 +46,7 @@ namespace dualpad::input_v2::context
         std::optional<menu::MenuInstanceId> topMenuInstanceId;
         menu::MenuIdentityQuality identityQuality{ menu::MenuIdentityQuality::StablePointer };
         std::uint32_t menuStackRevision{ 0 };
-        actions::ActionSetStack actionSetStack;
+        actions::SharedActionSetStack actionSetStack;
         PresentationPolicyId presentationPolicyId;
         std::uint32_t contextRevision{ 0 };
         dualpad::input::InputContext legacyInputContext{ dualpad::input::InputContext::Gameplay };
@@ -51,6 +55,20 @@ namespace dualpad::input_v2::context
         friend bool operator==(const ResolvedContextSnapshot&, const ResolvedContextSnapshot&) = default;
     };
 
+    // Fixed-size slice of the published snapshot read by the HID and poll
+    // threads on every packet/poll. Published through a seqlock.
+    struct PublishedContextFields
+    {
+        HostMode hostMode{ HostMode::Gameplay };
+        UiContextId uiContextId{ UiContextId::None };
+        std::uint32_t menuStackRevision{ 0 };
+        std::uint32_t contextRevision{ 0 };
+        dualpad::input::InputContext legacyInputContext{ dualpad::input::InputContext::Gameplay };
+        std::uint32_t legacyContextEpoch{ 1 };
+
+        friend bool operator==(const PublishedContextFields&, const PublishedContextFields&) = default;
+    };
+
     struct LegacyContextMirrorState
     {
         dualpad::input::InputContext context{ dualpad::input::InputContext::Gameplay };
@@ -76,6 +94,33 @@ namespace dualpad::input_v2::context
         std::vector<std::string> diffs;
     };
 
+    // Read-side pin on the published snapshot. Hold it for one packet batch
+    // or one frame: the next publication waits for outstanding pins before it
+    // frees the snapshot they point at.
+    class PinnedContextSnapshot
+    {
+    public:
+        PinnedContextSnapshot() = default;
+        PinnedContextSnapshot(PinnedContextSnapshot&& other) noexcept;
+        PinnedContextSnapshot& operator=(PinnedContextSnapshot&& other) noexcept;
+        PinnedContextSnapshot(const PinnedContextSnapshot&) = delete;
+        PinnedContextSnapshot& operator=(const PinnedContextSnapshot&) = delete;
+        ~PinnedContextSnapshot();
+
+        [[nodiscard]] const ResolvedContextSnapshot& operator*() const { return *_snapshot; }
+        [[nodiscard]] const ResolvedContextSnapshot* operator->() const { return _snapshot; }
+        [[nodiscard]] explicit operator bool() const { return _snapshot != nullptr; }
+        void Reset();
+
+    private:
+        friend class ContextResolver;
+
+        PinnedContextSnapshot(const ResolvedContextSnapshot* snapshot, std::atomic<std::uint32_t>* readers);
+
+        const ResolvedContextSnapshot* _snapshot{ nullptr };
+        std::atomic<std::uint32_t>* _readers{ nullptr };
+    };
+
     class ContextResolver
     {
     public:
@@ -86,7 +131,14 @@ namespace dualpad::input_v2::context
             GameplaySubstate gameplaySubstate,
             const CompiledContextCatalog& catalog);
 
-        const ResolvedContextSnapshot& GetPublishedSnapshot() const;
+        // Publication is single-writer (main thread). The full snapshot is an
+        // immutable object behind an atomic pointer (RCU style: readers pin a
+        // two-slot epoch counter, the writer retires the old object once both
+        // slots drain); the fixed-size fields also go through a seqlock so
+        // per-packet readers touch no shared counters and copy no strings.
+        [[nodiscard]] ResolvedContextSnapshot GetPublishedSnapshot() const;
+        [[nodiscard]] PinnedContextSnapshot PinPublishedSnapshot() const;
+        [[nodiscard]] PublishedContextFields ReadPublishedFields() const;
         void PublishSnapshotForReplayTests(ResolvedContextSnapshot snapshot);
         void ResetForTests();
 
@@ -98,6 +150,27 @@ namespace dualpad::input_v2::context
             const ShadowCompareRecord& actual);
 
     private:
+        void PublishLocked(ResolvedContextSnapshot snapshot);
+        void WaitForPinnedReadersLocked();
+
+        // Serializes writers and guards _published, the writer's own copy.
+        // Readers never take it.
+        std::mutex _writerMutex;
         ResolvedContextSnapshot _published{};
+        // Owned by the writer; _snapshot points into _current. Replaced
+        // snapshots wait in _retired until no pin can still reference them.
+        std::unique_ptr<const ResolvedContextSnapshot> _current{ std::make_unique<const ResolvedContextSnapshot>() };
+        std::vector<std::unique_ptr<const ResolvedContextSnapshot>> _retired;
+        std::atomic<const ResolvedContextSnapshot*> _snapshot{ _current.get() };
+        std::atomic<std::uint64_t> _readEpoch{ 0 };
+        mutable std::array<std::atomic<std::uint32_t>, 2> _pinnedReaders{};
+
+        std::atomic<std::uint32_t> _fieldsSequence{ 0 };
+        std::atomic<std::uint8_t> _hostMode{ static_cast<std::uint8_t>(HostMode::Gameplay) };
+        std::atomic<std::uint16_t> _uiContextId{ static_cast<std::uint16_t>(UiContextId::None) };
+        std::atomic<std::uint32_t> _menuStackRevision{ 0 };
+        std::atomic<std::uint32_t> _contextRevision{ 0 };
+        std::atomic<std::uint16_t> _legacyInputContext{ static_cast<std::uint16_t>(dualpad::input::InputContext::Gameplay) };
+        std::atomic<std::uint32_t> _legacyContextEpoch{ 1 };
     };
 }
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace dualpad::input_v2::gameplay
+{
+    // Analog ownership and gating as mask arithmetic over fixed lanes. Each
+    // channel is one bit; each axis is one float lane. Adding an analog source
+    // means adding a channel bit and its lanes, not another branch chain in
+    // ResolveGameplayProjection.
+    enum AnalogChannelMask : std::uint8_t
+    {
+        AnalogChannelNone = 0,
+        AnalogChannelLook = 1u << 0,
+        AnalogChannelMove = 1u << 1,
+        AnalogChannelCombat = 1u << 2,
+        AnalogChannelAll = AnalogChannelLook | AnalogChannelMove | AnalogChannelCombat
+    };
+
+    inline constexpr std::size_t kAnalogChannelCount = 4;
+    inline constexpr std::size_t kAnalogLaneCount = 8;
+
+    // Lane order matches ProjectedAnalogState; lanes 6-7 are padding and
+    // always gate to zero.
+    enum class AnalogLane : std::uint8_t
+    {
+        LookX = 0,
+        LookY,
+        MoveX,
+        MoveY,
+        LeftTrigger,
+        RightTrigger
+    };
+
+    struct alignas(32) PackedAnalogLanes
+    {
+        std::array<float, kAnalogLaneCount> values{};
+    };
+
+    struct alignas(16) PackedChannelMagnitudes
+    {
+        std::array<float, kAnalogChannelCount> values{};
+    };
+
+    struct AnalogThresholds
+    {
+        PackedChannelMagnitudes enter{};
+        PackedChannelMagnitudes sustain{};
+    };
+
+    struct AnalogOwnershipInput
+    {
+        // Channels whose gamepad input is past the enter threshold, and
+        // channels past the sustain threshold while the gamepad already owns
+        // them.
+        std::uint8_t gamepadActiveMask{ AnalogChannelNone };
+        std::uint8_t gamepadSustainedMask{ AnalogChannelNone };
+        std::uint8_t previousGamepadMask{ AnalogChannelNone };
+        // Channels with keyboard/mouse activity this frame (GameplayKbmFacts).
+        std::uint8_t keyboardMouseActiveMask{ AnalogChannelNone };
+        bool gameplayContext{ true };
+    };
+
+    struct AnalogOwnershipResult
+    {
+        std::uint8_t gamepadOwnerMask{ AnalogChannelNone };
+        // Channels decided by this frame's input rather than carried over.
+        std::uint8_t keyboardMouseWonMask{ AnalogChannelNone };
+        std::uint8_t gamepadWonMask{ AnalogChannelNone };
+    };
+
+    struct AnalogThresholdMasks
+    {
+        std::uint8_t activeMask{ AnalogChannelNone };
+        std::uint8_t sustainedMask{ AnalogChannelNone };
+    };
+
+    namespace detail
+    {
+        // Channel bit index feeding each lane; padding lanes read a bit that
+        // is never set.
+        inline constexpr std::array<std::uint8_t, kAnalogLaneCount> kLaneChannelBit{ 0, 0, 1, 1, 2, 2, 7, 7 };
+    }
+
+    // Header-inline so the three calls fold into ResolveGameplayProjection;
+    // out of line they cost more than the branches they replace.
+    [[nodiscard]] inline AnalogThresholdMasks EvaluateAnalogThresholds(
+        const PackedChannelMagnitudes& magnitudes,
+        const AnalogThresholds& thresholds,
+        std::uint8_t previousGamepadMask)
+    {
+        std::uint8_t active = 0;
+        std::uint8_t sustain = 0;
+        for (std::size_t channel = 0; channel < kAnalogChannelCount; ++channel) {
+            const auto magnitude = magnitudes.values[channel];
+            active |= static_cast<std::uint8_t>(static_cast<unsigned>(magnitude >= thresholds.enter.values[channel]) << channel);
+            sustain |= static_cast<std::uint8_t>(static_cast<unsigned>(magnitude >= thresholds.sustain.values[channel]) << channel);
+        }
+        return AnalogThresholdMasks{
+            .activeMask = static_cast<std::uint8_t>(active & AnalogChannelAll),
+            .sustainedMask = static_cast<std::uint8_t>(sustain & previousGamepadMask & AnalogChannelAll)
+        };
+    }
+
+    // Keyboard/mouse activity wins, then a meaningful gamepad value, then the
+    // previous owner carries. Outside gameplay every channel is keyboard/mouse.
+    [[nodiscard]] inline AnalogOwnershipResult ResolveAnalogOwnership(const AnalogOwnershipInput& input)
+    {
+        const auto gameplay = static_cast<std::uint8_t>((0u - static_cast<unsigned>(input.gameplayContext)) & AnalogChannelAll);
+        const auto keyboardMouse = static_cast<std::uint8_t>(input.keyboardMouseActiveMask & gameplay);
+        const auto gamepadWon = static_cast<std::uint8_t>(
+            (input.gamepadActiveMask | input.gamepadSustainedMask) & ~keyboardMouse & gameplay);
+        const auto carried = static_cast<std::uint8_t>(input.previousGamepadMask & ~keyboardMouse & gameplay);
+        return AnalogOwnershipResult{
+            .gamepadOwnerMask = static_cast<std::uint8_t>(gamepadWon | carried),
+            .keyboardMouseWonMask = keyboardMouse,
+            .gamepadWonMask = gamepadWon
+        };
+    }
+
+    // Zeroes every lane whose channel is not in `openChannelMask`. Open lanes
+    // keep their exact bits; closed lanes become +0.0f. A fixed-trip AND over
+    // the lane bits, so the compiler can keep it in vector registers.
+    [[nodiscard]] inline PackedAnalogLanes GateAnalogLanes(
+        const PackedAnalogLanes& lanes,
+        std::uint8_t openChannelMask)
+    {
+        const auto open = static_cast<std::uint32_t>(openChannelMask & AnalogChannelAll);
+        PackedAnalogLanes gated{};
+        for (std::size_t lane = 0; lane < kAnalogLaneCount; ++lane) {
+            const auto keep = 0u - ((open >> detail::kLaneChannelBit[lane]) & 1u);
+            gated.values[lane] = std::bit_cast<float>(std::bit_cast<std::uint32_t>(lanes.values[lane]) & keep);
+        }
+        return gated;
+    }
+}
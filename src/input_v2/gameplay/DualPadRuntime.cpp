@@ -93,6 +93,13 @@ namespace dualpad::input_v2::gameplay
         return ProcessGameplayFrameWithExecutor(input, executor);
     }
 
+    DualPadRuntimeResult DualPadRuntime::ProcessDeadlineTickForTests(
+        std::uint64_t nowUs,
+        IPollOutputExecutor& executor)
+    {
+        return ProcessDeadlineTickWithExecutor(nowUs, executor);
+    }
+
     DualPadRuntimeResult DualPadRuntime::ProcessAssembledFrameForTests(
         const ingress::AssembledFactFrame& frame,
         IPollOutputExecutor& executor)
@@ -103,35 +110,34 @@ namespace dualpad::input_v2::gameplay
             return result;
         }
 
-        auto envelope = BindRuntimeEnvelope(frame);
-        auto input = BuildStableRuntimeInput(envelope);
+        const auto& envelope = BindRuntimeEnvelope(frame);
+        const auto& input = BuildStableRuntimeInput(envelope);
         auto result = ProcessGameplayFrameWithExecutor(input, executor);
         PublishStablePresentationSurface(envelope, result);
+        ReleaseRuntimeEnvelope();
         PublishRuntimeDebugSnapshot(frame, result);
         return result;
     }
 
-    FrameRuntimeEnvelope DualPadRuntime::BindRuntimeEnvelope(const ingress::AssembledFactFrame& frame) const
+    const FrameRuntimeEnvelope& DualPadRuntime::BindRuntimeEnvelope(const ingress::AssembledFactFrame& frame)
     {
-        const auto bundle = config::AtomicConfigReloader::GetSingleton().GetActiveBundleSnapshot();
-        auto envelope = FrameRuntimeEnvelope{
-            .frame = frame,
-            .config = RuntimeConfigSnapshot{
-                .bundle = bundle,
-                .graph = actions::CompiledActionGraphPublisher::GetRuntimeOwner().GetActiveSnapshot(),
-                .context = context::ContextResolver::GetSingleton().GetPublishedSnapshot(),
-                .manifestEpoch = frame.facts.manifestEpoch,
-                .configGeneration = bundle ? bundle->manifestEpoch : 0
-            },
-            .healthReasons = RuntimeHealthReasonsFromIngress(frame)
-        };
-
-        if (envelope.config.context.contextRevision != frame.facts.contextRevision) {
+        auto& envelope = _stableFrameEnvelope;
+        auto& config = envelope.config;
+        config.bundle = config::AtomicConfigReloader::GetSingleton().GetActiveBundleSnapshot();
+        config.graph = actions::CompiledActionGraphPublisher::GetRuntimeOwner().GetActiveSnapshot();
+        config.context = context::ContextResolver::GetSingleton().PinPublishedSnapshot();
+        config.manifestEpoch = frame.facts.manifestEpoch;
+        config.configGeneration = config.bundle ? config.bundle->manifestEpoch : 0;
+        envelope.frame = &frame;
+        envelope.healthReasons = RuntimeHealthReasonsFromIngress(frame);
+        envelope.debugReason.clear();
+
+        if (config.context->contextRevision != frame.facts.contextRevision) {
             envelope.healthReasons = AddRuntimeHealthReason(
                 envelope.healthReasons,
                 RuntimeHealthReason::ContextRevisionSkew);
         }
-        if (envelope.config.bundle && envelope.config.bundle->manifestEpoch != frame.facts.manifestEpoch) {
+        if (config.bundle && config.bundle->manifestEpoch != frame.facts.manifestEpoch) {
             envelope.healthReasons = AddRuntimeHealthReason(
                 envelope.healthReasons,
                 RuntimeHealthReason::ManifestEpochSkew);
@@ -141,7 +147,7 @@ namespace dualpad::input_v2::gameplay
             envelope.healthReasons = AddRuntimeHealthReason(
                 envelope.healthReasons,
                 RuntimeHealthReason::HookInstallFailed);
-            envelope.debugReason = std::string(upstreamRoute.debugReason);
+            envelope.debugReason = upstreamRoute.debugReason;
         }
         const auto hookInstall = presentation::SkyrimCompatibilitySurface::GetSingleton().GetInstallResult();
         if (presentation::IsHookInstallFailure(hookInstall)) {
@@ -155,14 +161,26 @@ namespace dualpad::input_v2::gameplay
         return envelope;
     }
 
-    DualPadRuntimeInput DualPadRuntime::BuildStableRuntimeInput(const FrameRuntimeEnvelope& envelope)
+    void DualPadRuntime::ReleaseRuntimeEnvelope()
     {
-        const auto& frame = envelope.frame;
-        auto kernel = ingress::BuildKernelFrame(frame);
-        auto resolved = actions::ResolvedActionFrame{
-            .manifestEpoch = kernel.facts.manifestEpoch,
-            .contextRevision = kernel.facts.contextRevision
-        };
+        // The context pin must not outlive the frame: the next context
+        // publication waits for it.
+        _stableFrameEnvelope.config.context.Reset();
+        _stableFrameEnvelope.frame = nullptr;
+    }
+
+    const DualPadRuntimeInput& DualPadRuntime::BuildStableRuntimeInput(const FrameRuntimeEnvelope& envelope)
+    {
+        const auto& frame = *envelope.frame;
+        auto& input = _stableFrameInput;
+        auto& kernel = input.kernel;
+        auto& resolved = input.resolved;
+        ingress::BuildKernelFrame(frame, kernel);
+        resolved.manifestEpoch = kernel.facts.manifestEpoch;
+        resolved.contextRevision = kernel.facts.contextRevision;
+        resolved.changes.clear();
+        resolved.values.clear();
+        resolved.ownershipHints.clear();
         bool graphAvailableForKernel = false;
         auto runtimeHealthReasons = envelope.healthReasons;
 
@@ -173,11 +191,27 @@ namespace dualpad::input_v2::gameplay
                 graph->manifestEpoch == kernel.facts.manifestEpoch &&
                 !HasRuntimeHealthReason(runtimeHealthReasons, RuntimeHealthReason::ContextRevisionSkew)) {
                 graphAvailableForKernel = true;
-                resolved = _interactionEngine.Resolve(
+                actions::ResolvedActionFrame migrated{};
+                if (_interactionGraph && _interactionGraph != graph) {
+                    migrated = _interactionEngine.MigrateState(
+                        *_interactionGraph,
+                        *graph,
+                        kernel.facts.monotonicUs,
+                        _interactionState);
+                }
+                _interactionGraph = graph;
+                _interactionEngine.ResolveInto(
                     *graph,
-                    envelope.config.context.actionSetStack,
+                    envelope.config.context->actionSetStack,
                     kernel,
-                    _interactionState);
+                    _interactionState,
+                    resolved);
+                if (!migrated.changes.empty()) {
+                    resolved.changes.insert(
+                        resolved.changes.begin(),
+                        std::make_move_iterator(migrated.changes.begin()),
+                        std::make_move_iterator(migrated.changes.end()));
+                }
                 resolved.manifestEpoch = kernel.facts.manifestEpoch;
                 resolved.contextRevision = kernel.facts.contextRevision;
             }
@@ -198,7 +232,7 @@ namespace dualpad::input_v2::gameplay
             }
         }
 
-        const auto& contextSnapshot = envelope.config.context;
+        const auto& contextSnapshot = *envelope.config.context;
         GameplayRecoveryInput recovery{ .cleanFrame = true };
         if (_hasPendingRecovery) {
             MergeRecovery(recovery, _pendingRecovery);
@@ -209,24 +243,55 @@ namespace dualpad::input_v2::gameplay
         kernel.state.healthDegraded = kernel.state.healthDegraded ||
             runtimeHealthReasons != RuntimeHealthMask(RuntimeHealthReason::None);
 
-        return DualPadRuntimeInput{
-            .kernel = kernel,
-            .resolved = std::move(resolved),
-            .policy = GameplayPolicy{
-                .gameplayContext = contextSnapshot.hostMode == context::HostMode::Gameplay,
-                .mouseLookActive = false,
-                .keyboardMoveActive = false,
-                .keyboardMouseCombatActive = false,
-                .keyboardMouseDigitalActive = false,
-                .keyboardPhysicalSustainedActive = false,
-                .mousePhysicalSustainedActive = false
-            },
-            .recovery = recovery,
-            .runtimeHealthReasons = runtimeHealthReasons,
-            .outputTick = kernel.facts.monotonicUs,
-            .legacyContext = contextSnapshot.legacyInputContext,
-            .runtimeHealthDebugReason = envelope.debugReason
+        const auto policy = GameplayPolicy{
+            .gameplayContext = contextSnapshot.hostMode == context::HostMode::Gameplay,
+            .mouseLookActive = false,
+            .keyboardMoveActive = false,
+            .keyboardMouseCombatActive = false,
+            .keyboardMouseDigitalActive = false,
+            .keyboardPhysicalSustainedActive = false,
+            .mousePhysicalSustainedActive = false,
+            .analogPassthroughChannels = graphAvailableForKernel ?
+                AnalogPassthroughChannelsFor(envelope.config.graph.graph, contextSnapshot.actionSetStack) :
+                static_cast<std::uint8_t>(AnalogPassthroughNone)
         };
+        if (graphAvailableForKernel) {
+            // Assigned field by field so the stack's strings reuse their storage.
+            auto& baseline = _deadlineBaseline ? *_deadlineBaseline : _deadlineBaseline.emplace();
+            baseline.graph = envelope.config.graph.graph;
+            baseline.lastSeq = frame.lastSeq;
+            baseline.actionSetStack = contextSnapshot.actionSetStack;
+            baseline.facts = kernel.facts;
+            baseline.policy = policy;
+            baseline.runtimeHealthReasons = runtimeHealthReasons;
+            baseline.legacyContext = contextSnapshot.legacyInputContext;
+        } else if (ingress::ShouldDispatchToInteractionEngine(frame)) {
+            _deadlineBaseline.reset();
+        }
+
+        input.policy = policy;
+        input.recovery = recovery;
+        input.runtimeHealthReasons = runtimeHealthReasons;
+        input.outputTick = kernel.facts.monotonicUs;
+        input.legacyContext = contextSnapshot.legacyInputContext;
+        input.runtimeHealthDebugReason = envelope.debugReason;
+        return input;
+    }
+
+    std::uint8_t DualPadRuntime::AnalogPassthroughChannelsFor(
+        const std::shared_ptr<const actions::CompiledActionGraph>& graph,
+        const actions::SharedActionSetStack& actionSetStack)
+    {
+        if (graph != _passthroughGraph || actionSetStack.Shared() != _passthroughStack) {
+            graph->CollectBindingsForActionSet(
+                actionSetStack->baseSetId,
+                actionSetStack->layerIds,
+                _passthroughBindings);
+            _passthroughChannels = ResolveAnalogPassthroughChannels(_passthroughBindings);
+            _passthroughGraph = graph;
+            _passthroughStack = actionSetStack.Shared();
+        }
+        return _passthroughChannels;
     }
 
     DualPadRuntimeResult DualPadRuntime::ProcessTransitionFrame(const ingress::AssembledFactFrame& frame)
@@ -234,12 +299,15 @@ namespace dualpad::input_v2::gameplay
         const auto recovery = ingress::ToGameplayRecoveryInput(frame);
         if (ShouldClearProjectionStickyOwners(recovery)) {
             _interactionState.Reset();
+            _interactionGraph.reset();
             _lastProjectionFrame = GameplayProjectionFrame{};
+            _deadlineBaseline.reset();
         }
         if (HasRecoveryRequest(recovery)) {
             MergeRecovery(_pendingRecovery, recovery);
             _hasPendingRecovery = true;
         }
+        PrefetchTransitionPromptScope(frame);
 
         return DualPadRuntimeResult{
             .projectionFrame = _lastProjectionFrame,
@@ -249,31 +317,86 @@ namespace dualpad::input_v2::gameplay
         };
     }
 
+    void DualPadRuntime::PrefetchTransitionPromptScope(const ingress::AssembledFactFrame& frame)
+    {
+        // The resolver has already published the context being entered;
+        // warming its prompt scope here, rather than when the next stable
+        // frame publishes it, gives the worker that frame's lead.
+        const auto resolved = context::ContextResolver::GetSingleton().PinPublishedSnapshot();
+        if (!resolved || resolved->contextRevision != frame.facts.contextRevision) {
+            return;
+        }
+        auto bundle = config::AtomicConfigReloader::GetSingleton().GetActiveBundleSnapshot();
+        if (!bundle) {
+            return;
+        }
+        const auto configGeneration = bundle->manifestEpoch;
+        prompt::PromptRuntimeOwner::GetSingleton().PrefetchResolvedContext(
+            *resolved,
+            frame.facts.sourceEvidence.deviceFamilyEvidence.family,
+            prompt::PromptRuntimeBaseline{
+                .manifestEpoch = frame.facts.manifestEpoch,
+                .configGeneration = configGeneration,
+                .bundle = std::move(bundle),
+                .graph = actions::CompiledActionGraphPublisher::GetRuntimeOwner().GetActiveSnapshot() });
+    }
+
     void DualPadRuntime::PublishStablePresentationSurface(
         const FrameRuntimeEnvelope& envelope,
         const DualPadRuntimeResult& result)
     {
-        const auto& frame = envelope.frame;
+        const auto& frame = *envelope.frame;
         if (frame.kind != ingress::AssembledFrameKind::Stable || !result.output.outputApplySucceeded) {
             return;
         }
 
         const auto published = _presentationProjection.Project(
             frame.facts.sourceEvidence,
-            envelope.config.context,
+            *envelope.config.context,
             result.gameplayPresentation);
-        presentation::SkyrimCompatibilitySurface::GetSingleton().Commit(published);
         if (result.RuntimeHealthDegraded()) {
-            return;
-        }
-        prompt::PromptRuntimeOwner::GetSingleton().PublishPresentationState(
-            published,
-            prompt::PromptRuntimeBaseline{
+            _presentationPublication.Stage(published, nullptr);
+        } else {
+            const prompt::PromptRuntimeBaseline baseline{
                 .manifestEpoch = envelope.config.manifestEpoch,
                 .configGeneration = envelope.config.configGeneration,
                 .bundle = envelope.config.bundle,
                 .graph = envelope.config.graph
-            });
+            };
+            _presentationPublication.Stage(published, &baseline);
+        }
+        if (_presentationBatchDepth == 0) {
+            FlushPresentationPublication();
+        }
+    }
+
+    void DualPadRuntime::FlushPresentationPublication()
+    {
+        if (!_presentationPublication.HasPending()) {
+            return;
+        }
+        auto publication = _presentationPublication.Flush();
+        if (publication.surface) {
+            presentation::SkyrimCompatibilitySurface::GetSingleton().Commit(*publication.surface);
+        }
+        if (publication.prompt) {
+            prompt::PromptRuntimeOwner::GetSingleton().PublishPresentationState(
+                publication.prompt->state,
+                std::move(publication.prompt->baseline));
+        }
+    }
+
+    DualPadRuntime::ScopedPresentationBatch::ScopedPresentationBatch(DualPadRuntime& runtime) :
+        _runtime(runtime)
+    {
+        ++_runtime._presentationBatchDepth;
+    }
+
+    DualPadRuntime::ScopedPresentationBatch::~ScopedPresentationBatch()
+    {
+        if (--_runtime._presentationBatchDepth == 0) {
+            _runtime.FlushPresentationPublication();
+        }
     }
 
     void DualPadRuntime::PublishRuntimeDebugSnapshot(
@@ -292,6 +415,18 @@ namespace dualpad::input_v2::gameplay
         LogRuntimeDebugSnapshotTransition(_diagnosticsLogState, _lastDebugSnapshot);
     }
 
+    void DualPadRuntime::PublishDeadlineTickDebugSnapshot(const DualPadRuntimeResult& result)
+    {
+        // A tick has no ingress frame of its own; it is reported against the
+        // stable frame whose baseline it resolved.
+        ingress::AssembledFactFrame tickFrame{};
+        tickFrame.kind = ingress::AssembledFrameKind::Stable;
+        tickFrame.firstSeq = _deadlineBaseline->lastSeq;
+        tickFrame.lastSeq = _deadlineBaseline->lastSeq;
+        PublishRuntimeDebugSnapshot(tickFrame, result);
+        _lastDebugSnapshot.frameKind = "deadline_tick";
+    }
+
     DualPadRuntimeResult DualPadRuntime::ProcessGameplayFrameWithExecutor(
         const DualPadRuntimeInput& input,
         IPollOutputExecutor& executor)
@@ -345,6 +480,51 @@ namespace dualpad::input_v2::gameplay
         };
     }
 
+    bool DualPadRuntime::HasDeadlineTickWork() const
+    {
+        return _deadlineBaseline.has_value() &&
+            _deadlineBaseline->graph &&
+            _interactionState.Deadlines().PendingCount() != 0 &&
+            !HasRuntimeHealthReason(_deadlineBaseline->runtimeHealthReasons, RuntimeHealthReason::HookInstallFailed);
+    }
+
+    DualPadRuntimeResult DualPadRuntime::ProcessDeadlineTickWithExecutor(
+        std::uint64_t nowUs,
+        IPollOutputExecutor& executor)
+    {
+        auto result = DualPadRuntimeResult{
+            .projectionFrame = _lastProjectionFrame,
+            .output = PollOutputApplyResult{},
+            .gameplayPresentation = _presentationPublisher.GetPublished()
+        };
+        if (!HasDeadlineTickWork()) {
+            return result;
+        }
+
+        auto facts = _deadlineBaseline->facts;
+        facts.monotonicUs = nowUs;
+        const auto resolved = _interactionEngine.ResolveDeadlines(
+            *_deadlineBaseline->graph,
+            _deadlineBaseline->actionSetStack,
+            facts,
+            _interactionState);
+        if (resolved.changes.empty()) {
+            return result;
+        }
+
+        auto projection = ResolveDeadlineProjection(resolved, _deadlineBaseline->policy, _lastProjectionFrame);
+        result.output = _pollOutputAdapter.Apply(projection, executor);
+        if (result.output.outputApplySucceeded) {
+            result.gameplayPresentation = PublishGameplayPresentation(projection, nowUs, true);
+            _lastProjectionFrame = projection;
+        }
+        result.projectionFrame = std::move(projection);
+        result.runtimeHealthReasons = _deadlineBaseline->runtimeHealthReasons;
+        result.deadlineChanges = static_cast<std::uint32_t>(resolved.changes.size());
+        PublishDeadlineTickDebugSnapshot(result);
+        return result;
+    }
+
     presentation::PublishedGameplayPresentation DualPadRuntime::PublishGameplayPresentation(
         const GameplayProjectionFrame& frame,
         std::uint64_t tick,
@@ -368,15 +548,41 @@ namespace dualpad::input_v2::gameplay
         return _lastDebugSnapshot;
     }
 
+    presentation::PresentationProjection::Stats DualPadRuntime::GetPresentationProjectionStats() const
+    {
+        return _presentationProjection.GetStats();
+    }
+
+    dualpad::input::backend::FrameActionPlanDelta::Stats DualPadRuntime::GetOutputPlanDeltaStats() const
+    {
+        return _outputPlanDelta.GetStats();
+    }
+
+    PresentationPublicationCoalescer::Stats DualPadRuntime::GetPresentationPublicationStats() const
+    {
+        return _presentationPublication.GetStats();
+    }
+
     void DualPadRuntime::ResetForTests()
     {
         _lastProjectionFrame = GameplayProjectionFrame{};
+        _stableFrameInput = DualPadRuntimeInput{};
+        _stableFrameEnvelope = FrameRuntimeEnvelope{};
         _lastDebugSnapshot = RuntimeDebugSnapshot{};
         _diagnosticsLogState = RuntimeDiagnosticsLogState{};
         _pendingRecovery = GameplayRecoveryInput{};
         _hasPendingRecovery = false;
+        _deadlineBaseline.reset();
+        _interactionGraph.reset();
         _interactionState.Reset();
+        _passthroughGraph.reset();
+        _passthroughStack.reset();
+        _passthroughBindings.clear();
+        _passthroughChannels = AnalogPassthroughNone;
         _presentationPublisher.ResetForTests();
         _presentationProjection.ResetForTests();
+        _presentationPublication.Reset();
+        _outputPlanDelta.Reset();
+        _liveExecutor.reset();
     }
 }
@@ -1,16 +1,20 @@
 #pragma once
 
 #include "input_v2/compat/LegacyInputContextCompat.h"
+#include "input/backend/FrameActionPlanDelta.h"
 #include "input_v2/actions/InteractionEngine.h"
 #include "input_v2/gameplay/GameplayPresentationPublisher.h"
 #include "input_v2/gameplay/GameplayProjectionFrame.h"
 #include "input_v2/gameplay/PollOutputAdapter.h"
+#include "input_v2/gameplay/PresentationPublicationCoalescer.h"
 #include "input_v2/gameplay/RuntimeDiagnostics.h"
 #include "input_v2/gameplay/RuntimeFrameEnvelope.h"
 #include "input_v2/ingress/FrameAssembler.h"
 #include "input_v2/presentation/PresentationProjection.h"
 
 #include <cstdint>
+#include <memory>
+#include <optional>
 #include <string>
 
 namespace dualpad::input_v2::gameplay
@@ -34,6 +38,8 @@ namespace dualpad::input_v2::gameplay
         presentation::PublishedGameplayPresentation gameplayPresentation{};
         RuntimeHealthReasonMask runtimeHealthReasons{ RuntimeHealthMask(RuntimeHealthReason::None) };
         std::string runtimeHealthDebugReason;
+        // Hold/repeat phases a deadline tick fired; zero for frames.
+        std::uint32_t deadlineChanges{ 0 };
 
         [[nodiscard]] bool RuntimeHealthDegraded() const
         {
@@ -47,10 +53,30 @@ namespace dualpad::input_v2::gameplay
         static DualPadRuntime& GetSingleton();
         static bool LiveCoordinatorPresentationAuthorityReachable();
 
+        // Holds presentation publication for every stable frame processed in
+        // its scope and flushes the net change once when the outermost scope
+        // ends. Without an open scope each stable frame flushes by itself.
+        class ScopedPresentationBatch
+        {
+        public:
+            explicit ScopedPresentationBatch(DualPadRuntime& runtime);
+            ~ScopedPresentationBatch();
+
+            ScopedPresentationBatch(const ScopedPresentationBatch&) = delete;
+            ScopedPresentationBatch& operator=(const ScopedPresentationBatch&) = delete;
+
+        private:
+            DualPadRuntime& _runtime;
+        };
+
         DualPadRuntimeResult ProcessAssembledFrame(const ingress::AssembledFactFrame& frame);
         DualPadRuntimeResult ProcessAssembledFrameForTests(
             const ingress::AssembledFactFrame& frame,
             IPollOutputExecutor& executor);
+        DualPadRuntimeResult ProcessDeadlineTick(std::uint64_t nowUs);
+        DualPadRuntimeResult ProcessDeadlineTickForTests(
+            std::uint64_t nowUs,
+            IPollOutputExecutor& executor);
         DualPadRuntimeResult ProcessGameplayFrame(const DualPadRuntimeInput& input);
         DualPadRuntimeResult ProcessGameplayFrameForTests(
             const DualPadRuntimeInput& input,
@@ -64,31 +90,85 @@ namespace dualpad::input_v2::gameplay
         const presentation::PublishedGameplayPresentation& GetPublishedGameplayPresentation() const;
         const GameplayProjectionFrame& GetLastProjectionFrame() const;
         const RuntimeDebugSnapshot& GetLastDebugSnapshot() const;
+        presentation::PresentationProjection::Stats GetPresentationProjectionStats() const;
+        PresentationPublicationCoalescer::Stats GetPresentationPublicationStats() const;
+        dualpad::input::backend::FrameActionPlanDelta::Stats GetOutputPlanDeltaStats() const;
         void ResetForTests();
 
     private:
-        FrameRuntimeEnvelope BindRuntimeEnvelope(const ingress::AssembledFactFrame& frame) const;
-        DualPadRuntimeInput BuildStableRuntimeInput(const FrameRuntimeEnvelope& envelope);
+        // Graph and context of the last stable frame that reached the
+        // interaction engine. Deadline ticks resolve against it until the next
+        // frame arrives.
+        struct DeadlineTickBaseline
+        {
+            std::shared_ptr<const actions::CompiledActionGraph> graph;
+            std::uint64_t lastSeq{ 0 };
+            actions::ActionSetStack actionSetStack{};
+            actions::KernelFacts facts{};
+            GameplayPolicy policy{};
+            RuntimeHealthReasonMask runtimeHealthReasons{ RuntimeHealthMask(RuntimeHealthReason::None) };
+            dualpad::input::InputContext legacyContext{ dualpad::input::InputContext::Gameplay };
+        };
+
+        const FrameRuntimeEnvelope& BindRuntimeEnvelope(const ingress::AssembledFactFrame& frame);
+        void ReleaseRuntimeEnvelope();
+        const DualPadRuntimeInput& BuildStableRuntimeInput(const FrameRuntimeEnvelope& envelope);
         DualPadRuntimeResult ProcessTransitionFrame(const ingress::AssembledFactFrame& frame);
+        void PrefetchTransitionPromptScope(const ingress::AssembledFactFrame& frame);
         void PublishStablePresentationSurface(
             const FrameRuntimeEnvelope& envelope,
             const DualPadRuntimeResult& result);
+        void FlushPresentationPublication();
         void PublishRuntimeDebugSnapshot(
             const ingress::AssembledFactFrame& frame,
             const DualPadRuntimeResult& result);
+        void PublishDeadlineTickDebugSnapshot(const DualPadRuntimeResult& result);
 
         DualPadRuntimeResult ProcessGameplayFrameWithExecutor(
             const DualPadRuntimeInput& input,
             IPollOutputExecutor& executor);
+        DualPadRuntimeResult ProcessDeadlineTickWithExecutor(
+            std::uint64_t nowUs,
+            IPollOutputExecutor& executor);
+        bool HasDeadlineTickWork() const;
+        IPollOutputExecutor& BeginLiveOutputFrame(
+            dualpad::input::InputContext legacyContext,
+            std::uint32_t contextRevision,
+            std::uint64_t nowUs);
+        std::uint8_t AnalogPassthroughChannelsFor(
+            const std::shared_ptr<const actions::CompiledActionGraph>& graph,
+            const actions::SharedActionSetStack& actionSetStack);
 
         GameplayProjectionFrame _lastProjectionFrame{};
+        // Per-runtime frame arena: the stable-frame kernel and resolved buffers
+        // are refilled in place each frame so their capacity carries over.
+        DualPadRuntimeInput _stableFrameInput{};
+        FrameRuntimeEnvelope _stableFrameEnvelope{};
         GameplayRecoveryInput _pendingRecovery{};
         bool _hasPendingRecovery{ false };
+        std::optional<DeadlineTickBaseline> _deadlineBaseline{};
+        // Graph _interactionState was last resolved against; a different graph
+        // on the next stable frame means a preserving reload to migrate across.
+        std::shared_ptr<const actions::CompiledActionGraph> _interactionGraph{};
         actions::InteractionStateStore _interactionState{};
+        // Pass-through channels are a property of the graph and the active
+        // stack, so they are recomputed only when either pointer changes.
+        std::shared_ptr<const actions::CompiledActionGraph> _passthroughGraph{};
+        std::shared_ptr<const actions::ActionSetStack> _passthroughStack{};
+        std::vector<const actions::CompiledGraphBinding*> _passthroughBindings{};
+        std::uint8_t _passthroughChannels{ AnalogPassthroughNone };
         actions::InteractionEngine _interactionEngine{};
         GameplayPresentationPublisher _presentationPublisher{};
         presentation::PresentationProjection _presentationProjection{};
+        PresentationPublicationCoalescer _presentationPublication{};
+        std::uint32_t _presentationBatchDepth{ 0 };
         PollOutputAdapter _pollOutputAdapter{};
+        // Backend output already applied on the previous frame; the live
+        // executor forwards only what differs from it.
+        dualpad::input::backend::FrameActionPlanDelta _outputPlanDelta{};
+        // Live backend executor, created on the first live frame and rebound
+        // to each frame so its native batch is not rebuilt per frame.
+        std::unique_ptr<IPollOutputExecutor> _liveExecutor{};
         RuntimeDebugSnapshot _lastDebugSnapshot{};
         RuntimeDiagnosticsLogState _diagnosticsLogState{};
     };
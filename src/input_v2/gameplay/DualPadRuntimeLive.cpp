@@ -2,11 +2,14 @@
 
 #include "input_v2/gameplay/DualPadRuntime.h"
 
-#include "input/AuthoritativePollState.h"
 #include "input/backend/ActionBackendPolicy.h"
 #include "input/backend/KeyboardHelperBackend.h"
 #include "input/backend/ModEventKeyPool.h"
 #include "input/backend/NativeButtonCommitBackend.h"
+#include "input_v2/telemetry/FlightRecorder.h"
+#include "input_v2/telemetry/InputTraceRecorder.h"
+
+#include <array>
 
 namespace dualpad::input_v2::gameplay
 {
@@ -17,12 +20,21 @@ namespace dualpad::input_v2::gameplay
         using dualpad::input::backend::PlannedAction;
         using dualpad::input::backend::PlannedActionKind;
         using dualpad::input::backend::PlannedActionPhase;
+        using dualpad::input::backend::PlannedActionState;
         using dualpad::input::backend::PlannedBackend;
 
         constexpr std::uint32_t kDefaultPulseMinDownMs = 40;
         constexpr std::uint32_t kDefaultRepeatDelayMs = 350;
         constexpr std::uint32_t kDefaultRepeatIntervalMs = 75;
 
+        // The frame summary goes to the trace and the flight recorder; a
+        // newly raised health reason triggers a flight dump.
+        void ObserveRuntimeDebugSnapshot(const RuntimeDebugSnapshot& snapshot)
+        {
+            telemetry::InputTraceRecorder::GetSingleton().RecordRuntimeDebugSnapshot(snapshot);
+            telemetry::FlightRecorder::GetSingleton().ObserveRuntimeHealth(snapshot);
+        }
+
         PlannedActionPhase ToPlannedPhase(actions::ActionPhase phase)
         {
             switch (phase) {
@@ -97,45 +109,55 @@ namespace dualpad::input_v2::gameplay
             return action;
         }
 
-        PlannedAction BuildHelperAction(
-            std::string_view actionId,
-            HelperOutputKind kind,
-            actions::ActionPhase phase,
-            ActionOutputContract contract,
-            float heldSeconds,
-            dualpad::input::InputContext legacyContext,
-            std::uint32_t contextRevision)
+        // Helper commands go to the backend by id; the mod-event slot maps
+        // onto its helper key-pool action.
+        std::string_view ResolveHelperActionId(std::string_view actionId, HelperOutputKind kind)
         {
-            auto helperActionId = actionId;
             if (kind == HelperOutputKind::ModEvent) {
                 if (const auto* slot = dualpad::input::backend::FindModEventKeySlot(actionId)) {
-                    helperActionId = slot->helperActionId;
+                    return slot->helperActionId;
                 }
             }
+            return actionId;
+        }
 
-            PlannedAction action{};
-            action.backend = PlannedBackend::KeyboardHelper;
-            action.kind = PlannedActionKind::KeyboardKey;
-            action.phase = ToPlannedPhase(phase);
-            action.context = legacyContext;
-            action.actionId = std::string(helperActionId);
-            action.contract = contract;
-            action.heldSeconds = heldSeconds;
-            action.contextEpoch = contextRevision;
-            return action;
+        PlannedActionState NativeDeltaState(
+            std::string_view actionId,
+            dualpad::input::backend::NativeControlCode control,
+            PlannedActionPhase phase,
+            ActionOutputContract contract,
+            dualpad::input::InputContext legacyContext,
+            std::uint32_t contextRevision)
+        {
+            return PlannedActionState{
+                .backend = PlannedBackend::NativeButtonCommit,
+                .phase = phase,
+                .context = legacyContext,
+                .contract = contract,
+                .outputCode = static_cast<std::uint32_t>(control),
+                .contextEpoch = contextRevision,
+                .actionId = actionId
+            };
         }
 
         class RuntimePollOutputExecutor final : public IPollOutputExecutor
         {
         public:
-            RuntimePollOutputExecutor(
+            explicit RuntimePollOutputExecutor(dualpad::input::backend::FrameActionPlanDelta& delta) :
+                _delta(delta)
+            {}
+
+            // Rebinds the executor to the next frame; the native batch keeps
+            // its storage.
+            void BeginFrame(
                 dualpad::input::InputContext legacyContext,
                 std::uint32_t contextRevision,
-                std::uint64_t nowUs) :
-                _legacyContext(legacyContext),
-                _contextRevision(contextRevision),
-                _nowUs(nowUs)
+                std::uint64_t nowUs)
             {
+                _legacyContext = legacyContext;
+                _contextRevision = contextRevision;
+                _nowUs = nowUs;
+                _transientGateOpen = true;
                 dualpad::input::backend::NativeButtonCommitBackend::GetSingleton().BeginFrame(
                     _legacyContext,
                     _contextRevision,
@@ -147,12 +169,14 @@ namespace dualpad::input_v2::gameplay
                 auto& native = dualpad::input::backend::NativeButtonCommitBackend::GetSingleton();
                 native.Reset();
                 native.BeginFrame(_legacyContext, _contextRevision, _nowUs);
+                _delta.RequestFullResync();
                 return true;
             }
 
             bool ClearHelperOutput() override
             {
                 dualpad::input::backend::KeyboardHelperBackend::GetSingleton().Reset();
+                _delta.RequestFullResync();
                 return true;
             }
 
@@ -169,20 +193,64 @@ namespace dualpad::input_v2::gameplay
             bool ApplyGatePlan(const GatePlan& gatePlan) override
             {
                 auto& native = dualpad::input::backend::NativeButtonCommitBackend::GetSingleton();
-                native.SetGameplayDigitalGatePlan(gatePlan.transientDigitalGate != DigitalGateMode::Open);
+                _transientGateOpen = gatePlan.transientDigitalGate == DigitalGateMode::Open;
+                native.SetGameplayDigitalGatePlan(!_transientGateOpen);
                 if (gatePlan.transientDigitalGate == DigitalGateMode::CancelAndSuppressNewTransient) {
                     native.ForceCancelGateAwareGameplayTransientActions();
+                    _delta.RequestFullResync();
+                }
+                return true;
+            }
+
+            PollOutputBatchResult ApplyFrameCommands(const GameplayProjectionFrame& frame) override
+            {
+                // Native commands go in under one backend lock, so
+                // CommitPollState never commits half of a frame. Nothing is
+                // published to the poll state here: CommitPollState publishes
+                // while holding that lock, and the rest of the frame goes out
+                // in one PublishDrainedFrame from the drain.
+                //
+                // Every command is admitted to the delta, but only the ones a
+                // backend has not already applied reach it; the rest still
+                // count as applied steps.
+                _delta.BeginFrame();
+                const auto result = ApplyFrameDelta(frame);
+                if (!result.succeeded) {
+                    // A partly applied frame leaves the backends off the
+                    // baseline the delta just recorded.
+                    _delta.RequestFullResync();
                 }
+                _delta.EndFrame();
+                return result;
+            }
+
+            bool CommitCleanRecoveryBaseline() override
+            {
                 return true;
             }
 
-            bool ApplySustainedDigital(const NativeSustainedCommand& command) override
+        private:
+            PollOutputBatchResult ApplyFrameDelta(const GameplayProjectionFrame& frame)
             {
-                const auto phase = command.activeSourceMask == 0 ?
-                    PlannedActionPhase::Release :
-                    PlannedActionPhase::Hold;
-                return dualpad::input::backend::NativeButtonCommitBackend::GetSingleton().ApplyPlannedAction(
-                    BuildNativeAction(
+                PollOutputBatchResult result{};
+                const auto& sustained = frame.gamepadPlan.sustainedDigital;
+                const auto& transient = frame.gamepadPlan.transientDigital;
+                _nativeBatch.Clear();
+                std::size_t nativeSteps = 0;
+                for (std::size_t index = 0; index < sustained.count; ++index, ++nativeSteps) {
+                    const auto& command = sustained.items[index];
+                    const auto phase = command.activeSourceMask == 0 ? PlannedActionPhase::Release : PlannedActionPhase::Hold;
+                    if (!_delta.Admit(NativeDeltaState(
+                            command.actionId,
+                            command.control,
+                            phase,
+                            command.contract,
+                            _legacyContext,
+                            command.contextRevision))) {
+                        continue;
+                    }
+                    _nativeBatchSteps[_nativeBatch.Size()] = nativeSteps;
+                    _nativeBatch.Push(BuildNativeAction(
                         command.actionId,
                         command.control,
                         phase,
@@ -190,58 +258,98 @@ namespace dualpad::input_v2::gameplay
                         false,
                         _legacyContext,
                         command.contextRevision));
-            }
-
-            bool ApplyTransientDigital(const NativeTransientCommand& command) override
-            {
-                return dualpad::input::backend::NativeButtonCommitBackend::GetSingleton().ApplyPlannedAction(
-                    BuildNativeAction(
+                }
+                for (std::size_t index = 0; index < transient.count; ++index, ++nativeSteps) {
+                    const auto& command = transient.items[index];
+                    const auto phase = ToPlannedPhase(command.phase);
+                    // A gate-aware transient the closed gate suppresses never
+                    // reaches the backend, so it must not become baseline.
+                    const bool suppressible = command.gateAware && !_transientGateOpen;
+                    if (!suppressible &&
+                        !_delta.Admit(NativeDeltaState(
+                            command.actionId,
+                            command.control,
+                            phase,
+                            command.contract,
+                            _legacyContext,
+                            command.contextRevision))) {
+                        continue;
+                    }
+                    _nativeBatchSteps[_nativeBatch.Size()] = nativeSteps;
+                    _nativeBatch.Push(BuildNativeAction(
                         command.actionId,
                         command.control,
-                        ToPlannedPhase(command.phase),
+                        phase,
                         command.contract,
                         command.gateAware,
                         _legacyContext,
                         command.contextRevision));
+                }
+
+                const auto applied =
+                    dualpad::input::backend::NativeButtonCommitBackend::GetSingleton().ApplyPlannedActions(_nativeBatch);
+                if (applied != _nativeBatch.Size()) {
+                    result.appliedSteps = _nativeBatchSteps[applied];
+                    return result;
+                }
+                result.appliedSteps = nativeSteps;
+
+                for (std::size_t index = 0; index < frame.helperPlan.commands.count; ++index) {
+                    if (!ApplyHelperCommand(frame.helperPlan.commands.items[index])) {
+                        return result;
+                    }
+                    ++result.appliedSteps;
+                }
+
+                // The analog step lands in the drain's single poll-state
+                // publication (PublishDrainedFrame) once this apply succeeds.
+                ++result.appliedSteps;
+                result.succeeded = true;
+                return result;
             }
 
-            bool ApplyHelperCommand(const HelperOutputCommand& command) override
+            bool ApplyHelperCommand(const HelperOutputCommand& command)
             {
                 auto& helper = dualpad::input::backend::KeyboardHelperBackend::GetSingleton();
                 if (!helper.IsRouteActive()) {
                     return true;
                 }
 
-                const auto action = BuildHelperAction(
-                    command.actionId,
-                    command.kind,
-                    command.phase,
-                    command.contract,
-                    command.heldSeconds,
-                    _legacyContext,
-                    command.contextRevision);
-                if (!helper.CanHandleAction(action.actionId)) {
+                const auto phase = ToPlannedPhase(command.phase);
+                if (!_delta.Admit(PlannedActionState{
+                        .backend = PlannedBackend::KeyboardHelper,
+                        .phase = phase,
+                        .context = _legacyContext,
+                        .contract = command.contract,
+                        .outputCode = command.helperCode,
+                        .contextEpoch = command.contextRevision,
+                        .actionId = command.actionId })) {
+                    return true;
+                }
+
+                const auto actionId = ResolveHelperActionId(command.actionId, command.kind);
+                if (!helper.CanHandleAction(actionId)) {
                     return false;
                 }
 
-                switch (action.phase) {
+                switch (phase) {
                 case PlannedActionPhase::Pulse:
-                    return helper.TriggerAction(action.actionId, action.contract, action.context);
+                    return helper.TriggerAction(actionId, command.contract, _legacyContext);
                 case PlannedActionPhase::Press:
                 case PlannedActionPhase::Hold:
                     return helper.SubmitActionState(
-                        action.actionId,
-                        action.contract,
+                        actionId,
+                        command.contract,
                         true,
-                        action.heldSeconds,
-                        action.context);
+                        command.heldSeconds,
+                        _legacyContext);
                 case PlannedActionPhase::Release:
                     return helper.SubmitActionState(
-                        action.actionId,
-                        action.contract,
+                        actionId,
+                        command.contract,
                         false,
-                        action.heldSeconds,
-                        action.context);
+                        command.heldSeconds,
+                        _legacyContext);
                 case PlannedActionPhase::Value:
                 case PlannedActionPhase::None:
                 default:
@@ -249,30 +357,30 @@ namespace dualpad::input_v2::gameplay
                 }
             }
 
-            bool PublishAnalogState(const ProjectedAnalogState& analog) override
-            {
-                dualpad::input::AuthoritativePollState::GetSingleton().PublishAnalogState(
-                    analog.moveX,
-                    analog.moveY,
-                    analog.lookX,
-                    analog.lookY,
-                    analog.leftTrigger,
-                    analog.rightTrigger);
-                return true;
-            }
-
-            bool CommitCleanRecoveryBaseline() override
-            {
-                return true;
-            }
-
-        private:
+            dualpad::input::backend::FrameActionPlanDelta& _delta;
+            dualpad::input::backend::FrameActionPlan _nativeBatch{};
+            // Step index of each batched native command, for failure reporting.
+            std::array<std::size_t, dualpad::input::backend::FrameActionPlan::kMaxActions> _nativeBatchSteps{};
             dualpad::input::InputContext _legacyContext{ dualpad::input::InputContext::Gameplay };
             std::uint32_t _contextRevision{ 0 };
             std::uint64_t _nowUs{ 0 };
+            bool _transientGateOpen{ true };
         };
     }
 
+    IPollOutputExecutor& DualPadRuntime::BeginLiveOutputFrame(
+        dualpad::input::InputContext legacyContext,
+        std::uint32_t contextRevision,
+        std::uint64_t nowUs)
+    {
+        if (!_liveExecutor) {
+            _liveExecutor = std::make_unique<RuntimePollOutputExecutor>(_outputPlanDelta);
+        }
+        auto& executor = static_cast<RuntimePollOutputExecutor&>(*_liveExecutor);
+        executor.BeginFrame(legacyContext, contextRevision, nowUs);
+        return executor;
+    }
+
     DualPadRuntimeResult DualPadRuntime::ProcessGameplayFrame(const DualPadRuntimeInput& input)
     {
         if (HasRuntimeHealthReason(input.runtimeHealthReasons, RuntimeHealthReason::HookInstallFailed)) {
@@ -291,26 +399,50 @@ namespace dualpad::input_v2::gameplay
             };
         }
 
-        RuntimePollOutputExecutor executor(
+        auto& executor = BeginLiveOutputFrame(
             input.legacyContext,
             input.kernel.facts.contextRevision,
             input.kernel.facts.monotonicUs);
         return ProcessGameplayFrameWithExecutor(input, executor);
     }
 
+    DualPadRuntimeResult DualPadRuntime::ProcessDeadlineTick(std::uint64_t nowUs)
+    {
+        if (!HasDeadlineTickWork()) {
+            return DualPadRuntimeResult{
+                .projectionFrame = _lastProjectionFrame,
+                .output = PollOutputApplyResult{},
+                .gameplayPresentation = _presentationPublisher.GetPublished()
+            };
+        }
+
+        auto& executor = BeginLiveOutputFrame(
+            _deadlineBaseline->legacyContext,
+            _deadlineBaseline->facts.contextRevision,
+            nowUs);
+        auto result = ProcessDeadlineTickWithExecutor(nowUs, executor);
+        if (result.deadlineChanges != 0) {
+            ObserveRuntimeDebugSnapshot(_lastDebugSnapshot);
+        }
+        return result;
+    }
+
     DualPadRuntimeResult DualPadRuntime::ProcessAssembledFrame(const ingress::AssembledFactFrame& frame)
     {
         if (frame.kind == ingress::AssembledFrameKind::Transition) {
             auto result = ProcessTransitionFrame(frame);
             PublishRuntimeDebugSnapshot(frame, result);
+            ObserveRuntimeDebugSnapshot(_lastDebugSnapshot);
             return result;
         }
 
-        auto envelope = BindRuntimeEnvelope(frame);
-        auto input = BuildStableRuntimeInput(envelope);
+        const auto& envelope = BindRuntimeEnvelope(frame);
+        const auto& input = BuildStableRuntimeInput(envelope);
         auto result = ProcessGameplayFrame(input);
         PublishStablePresentationSurface(envelope, result);
+        ReleaseRuntimeEnvelope();
         PublishRuntimeDebugSnapshot(frame, result);
+        ObserveRuntimeDebugSnapshot(_lastDebugSnapshot);
         return result;
     }
 }
@@ -2,9 +2,12 @@
 
 #include "input_v2/gameplay/GameplayProjectionFrame.h"
 
+#include "input_v2/gameplay/AnalogGateKernel.h"
+
 #include "input/backend/ActionBackendPolicy.h"
 #include "input/backend/ModEventKeyPool.h"
 #include "input/backend/NativeActionDescriptor.h"
+#include "input/PadEvent.h"
 
 #include <algorithm>
 #include <cmath>
@@ -20,6 +23,51 @@ namespace dualpad::input_v2::gameplay
         using dualpad::input::backend::NativeControlCode;
         using dualpad::input::backend::PlannedBackend;
 
+        std::uint8_t PassthroughChannelFor(NativeAxisTarget target)
+        {
+            switch (target) {
+            case NativeAxisTarget::MoveStick:
+                return AnalogPassthroughMove;
+            case NativeAxisTarget::LookStick:
+                return AnalogPassthroughLook;
+            case NativeAxisTarget::LeftTrigger:
+                return AnalogPassthroughLeftTrigger;
+            case NativeAxisTarget::RightTrigger:
+                return AnalogPassthroughRightTrigger;
+            case NativeAxisTarget::None:
+            default:
+                return AnalogPassthroughNone;
+            }
+        }
+
+        // Channel the binding's single axis path physically is; None for any
+        // binding that reshapes, gates or combines its input.
+        std::uint8_t ForwardedPhysicalChannel(const actions::CompiledGraphBinding& binding)
+        {
+            if (binding.interaction.kind != actions::InteractionKind::Value ||
+                !binding.modifiers.empty() ||
+                binding.paths.size() != 1 ||
+                binding.paths.front().kind != actions::ControlPathKind::AnalogAxis1D) {
+                return AnalogPassthroughNone;
+            }
+
+            using dualpad::input::PadAxisId;
+            switch (static_cast<PadAxisId>(binding.paths.front().code)) {
+            case PadAxisId::LeftStickX:
+            case PadAxisId::LeftStickY:
+                return AnalogPassthroughMove;
+            case PadAxisId::RightStickX:
+            case PadAxisId::RightStickY:
+                return AnalogPassthroughLook;
+            case PadAxisId::LeftTrigger:
+                return AnalogPassthroughLeftTrigger;
+            case PadAxisId::RightTrigger:
+                return AnalogPassthroughRightTrigger;
+            default:
+                return AnalogPassthroughNone;
+            }
+        }
+
         bool IsTransientContract(ActionOutputContract contract)
         {
             return contract == ActionOutputContract::Pulse || contract == ActionOutputContract::Toggle;
@@ -106,19 +154,77 @@ namespace dualpad::input_v2::gameplay
             return found == resolved.values.end() ? nullptr : &*found;
         }
 
-        float AxisMagnitudeForTarget(const actions::ResolvedActionFrame& resolved, NativeAxisTarget target)
+        // Per-channel gamepad magnitude: stick length for look/move, the larger
+        // trigger for combat. The first value per target wins.
+        PackedChannelMagnitudes ChannelMagnitudes(const actions::ResolvedActionFrame& resolved)
         {
+            PackedChannelMagnitudes magnitudes{};
+            std::uint8_t seen = 0;
+            float leftTrigger = 0.0f;
+            float rightTrigger = 0.0f;
             for (const auto& value : resolved.values) {
                 const auto* descriptor = dualpad::input::backend::FindNativeActionDescriptor(value.actionId);
-                if (!descriptor || descriptor->axisTarget != target) {
+                if (!descriptor) {
                     continue;
                 }
-                if (value.kind == actions::ActionValueKind::Axis2D) {
-                    return Magnitude(value.x, value.y);
-                }
-                return std::abs(value.scalar);
+                const auto magnitude = value.kind == actions::ActionValueKind::Axis2D ?
+                    Magnitude(value.x, value.y) :
+                    std::abs(value.scalar);
+                const auto claim = [&](NativeAxisTarget target, std::uint8_t bit, float& slot) {
+                    if (descriptor->axisTarget == target && (seen & bit) == 0) {
+                        seen |= bit;
+                        slot = magnitude;
+                    }
+                };
+                claim(NativeAxisTarget::LookStick, 1u << 0, magnitudes.values[0]);
+                claim(NativeAxisTarget::MoveStick, 1u << 1, magnitudes.values[1]);
+                claim(NativeAxisTarget::LeftTrigger, 1u << 2, leftTrigger);
+                claim(NativeAxisTarget::RightTrigger, 1u << 3, rightTrigger);
+            }
+            magnitudes.values[2] = std::max(leftTrigger, rightTrigger);
+            return magnitudes;
+        }
+
+        std::uint8_t ChannelBits(bool look, bool move, bool combat)
+        {
+            return static_cast<std::uint8_t>(
+                (look ? AnalogChannelLook : 0) |
+                (move ? AnalogChannelMove : 0) |
+                (combat ? AnalogChannelCombat : 0));
+        }
+
+        ChannelOwner OwnerForChannel(const AnalogOwnershipResult& analog, AnalogChannelMask channel)
+        {
+            return (analog.gamepadOwnerMask & channel) != 0 ? ChannelOwner::Gamepad : ChannelOwner::KeyboardMouse;
+        }
+
+        GameplayReasonCode ReasonForChannel(
+            const AnalogOwnershipResult& analog,
+            AnalogChannelMask channel,
+            GameplayReasonCode keyboardMouseReason,
+            GameplayReasonCode gamepadReason)
+        {
+            if ((analog.keyboardMouseWonMask & channel) != 0) {
+                return keyboardMouseReason;
             }
-            return 0.0f;
+            return (analog.gamepadWonMask & channel) != 0 ? gamepadReason : GameplayReasonCode::CarryPreviousOwner;
+        }
+
+        PackedAnalogLanes PackAnalog(const ProjectedAnalogState& analog)
+        {
+            return PackedAnalogLanes{ { analog.lookX, analog.lookY, analog.moveX, analog.moveY, analog.leftTrigger, analog.rightTrigger, 0.0f, 0.0f } };
+        }
+
+        ProjectedAnalogState UnpackAnalog(const PackedAnalogLanes& lanes)
+        {
+            return ProjectedAnalogState{
+                .lookX = lanes.values[static_cast<std::size_t>(AnalogLane::LookX)],
+                .lookY = lanes.values[static_cast<std::size_t>(AnalogLane::LookY)],
+                .moveX = lanes.values[static_cast<std::size_t>(AnalogLane::MoveX)],
+                .moveY = lanes.values[static_cast<std::size_t>(AnalogLane::MoveY)],
+                .leftTrigger = lanes.values[static_cast<std::size_t>(AnalogLane::LeftTrigger)],
+                .rightTrigger = lanes.values[static_cast<std::size_t>(AnalogLane::RightTrigger)]
+            };
         }
 
         void ApplyAnalogValue(GameplayProjectionFrame& frame, const actions::ActionValueSnapshot& value)
@@ -148,6 +254,67 @@ namespace dualpad::input_v2::gameplay
                 break;
             }
         }
+
+        // Lowers resolved phase changes into backend command lists. Returns true
+        // when any fixed-size list overflowed.
+        bool AppendChangeCommands(
+            GameplayProjectionFrame& frame,
+            const actions::ResolvedActionFrame& resolved,
+            const GameplayPolicy& policy)
+        {
+            bool overflow = false;
+            for (const auto& change : resolved.changes) {
+                const auto decision = dualpad::input::backend::ActionBackendPolicy::Decide(change.actionId);
+                if (decision.backend == PlannedBackend::NativeButtonCommit) {
+                    if (IsTransientContract(decision.contract)) {
+                        if (frame.gatePlan.transientDigitalGate == DigitalGateMode::Open) {
+                            overflow = !TryAppend(
+                                frame.gamepadPlan.transientDigital,
+                                NativeTransientCommand{
+                                    .actionId = change.actionId,
+                                    .control = decision.nativeCode,
+                                    .phase = change.phase,
+                                    .contract = decision.contract,
+                                    .gateAware = true,
+                                    .contextRevision = frame.contextRevision
+                                }) || overflow;
+                        }
+                    } else if (IsSustainedContract(decision.contract)) {
+                        std::uint8_t mask = 0;
+                        if (change.phase != actions::ActionPhase::Release) {
+                            mask = static_cast<std::uint8_t>(SustainedSourceBit::GamepadResolved);
+                            if (policy.keyboardPhysicalSustainedActive) {
+                                mask |= static_cast<std::uint8_t>(SustainedSourceBit::KeyboardPhysical);
+                            }
+                            if (policy.mousePhysicalSustainedActive) {
+                                mask |= static_cast<std::uint8_t>(SustainedSourceBit::MousePhysical);
+                            }
+                        }
+                        overflow = !TryAppend(
+                            frame.gamepadPlan.sustainedDigital,
+                            NativeSustainedCommand{
+                                .actionId = change.actionId,
+                                .control = decision.nativeCode,
+                                .activeSourceMask = mask,
+                                .contract = decision.contract,
+                                .contextRevision = frame.contextRevision
+                            }) || overflow;
+                    }
+                } else if (decision.backend == PlannedBackend::KeyboardHelper || decision.backend == PlannedBackend::ModEvent) {
+                    overflow = !TryAppend(
+                        frame.helperPlan.commands,
+                        HelperOutputCommand{
+                            .actionId = change.actionId,
+                            .kind = decision.backend == PlannedBackend::ModEvent ? HelperOutputKind::ModEvent : HelperOutputKind::KeyboardKey,
+                            .helperCode = ResolveHelperCode(change.actionId),
+                            .phase = change.phase,
+                            .contract = decision.contract,
+                            .contextRevision = frame.contextRevision
+                        }) || overflow;
+                }
+            }
+            return overflow;
+        }
     }
 
     PrimaryPathArbitrationDecision ResolvePrimaryPathArbitration(const PrimaryPathArbitrationInput& input)
@@ -169,41 +336,36 @@ namespace dualpad::input_v2::gameplay
             return decision;
         }
 
-        decision.lookOwner = input.previousLookOwner;
-        decision.moveOwner = input.previousMoveOwner;
-        decision.combatOwner = input.previousCombatOwner;
-        decision.digitalOwner = input.previousDigitalOwner;
-
-        if (input.mouseLookActive) {
-            decision.lookOwner = ChannelOwner::KeyboardMouse;
-            decision.reasons.look = GameplayReasonCode::MouseLookActive;
-        } else if (input.gamepadLookActive || input.gamepadLookSustained) {
-            decision.lookOwner = ChannelOwner::Gamepad;
-            decision.reasons.look = GameplayReasonCode::MeaningfulRightStick;
-        } else {
-            decision.reasons.look = GameplayReasonCode::CarryPreviousOwner;
-        }
-
-        if (input.keyboardMoveActive) {
-            decision.moveOwner = ChannelOwner::KeyboardMouse;
-            decision.reasons.move = GameplayReasonCode::KeyboardMoveActive;
-        } else if (input.gamepadMoveActive || input.gamepadMoveSustained) {
-            decision.moveOwner = ChannelOwner::Gamepad;
-            decision.reasons.move = GameplayReasonCode::MeaningfulLeftStick;
-        } else {
-            decision.reasons.move = GameplayReasonCode::CarryPreviousOwner;
-        }
-
-        if (input.keyboardMouseCombatActive) {
-            decision.combatOwner = ChannelOwner::KeyboardMouse;
-            decision.reasons.combat = GameplayReasonCode::KeyboardMouseCombatActive;
-        } else if (input.gamepadCombatActive || input.gamepadCombatSustained) {
-            decision.combatOwner = ChannelOwner::Gamepad;
-            decision.reasons.combat = GameplayReasonCode::MeaningfulTrigger;
-        } else {
-            decision.reasons.combat = GameplayReasonCode::CarryPreviousOwner;
-        }
+        const auto analog = ResolveAnalogOwnership(AnalogOwnershipInput{
+            .gamepadActiveMask = ChannelBits(input.gamepadLookActive, input.gamepadMoveActive, input.gamepadCombatActive),
+            .gamepadSustainedMask = ChannelBits(input.gamepadLookSustained, input.gamepadMoveSustained, input.gamepadCombatSustained),
+            .previousGamepadMask = ChannelBits(
+                input.previousLookOwner == ChannelOwner::Gamepad,
+                input.previousMoveOwner == ChannelOwner::Gamepad,
+                input.previousCombatOwner == ChannelOwner::Gamepad),
+            .keyboardMouseActiveMask = ChannelBits(input.mouseLookActive, input.keyboardMoveActive, input.keyboardMouseCombatActive),
+            .gameplayContext = true
+        });
+        decision.lookOwner = OwnerForChannel(analog, AnalogChannelLook);
+        decision.moveOwner = OwnerForChannel(analog, AnalogChannelMove);
+        decision.combatOwner = OwnerForChannel(analog, AnalogChannelCombat);
+        decision.reasons.look = ReasonForChannel(
+            analog,
+            AnalogChannelLook,
+            GameplayReasonCode::MouseLookActive,
+            GameplayReasonCode::MeaningfulRightStick);
+        decision.reasons.move = ReasonForChannel(
+            analog,
+            AnalogChannelMove,
+            GameplayReasonCode::KeyboardMoveActive,
+            GameplayReasonCode::MeaningfulLeftStick);
+        decision.reasons.combat = ReasonForChannel(
+            analog,
+            AnalogChannelCombat,
+            GameplayReasonCode::KeyboardMouseCombatActive,
+            GameplayReasonCode::MeaningfulTrigger);
 
+        decision.digitalOwner = input.previousDigitalOwner;
         if (input.keyboardMouseDigitalActive) {
             decision.digitalOwner = ChannelOwner::KeyboardMouse;
             decision.reasons.digital = GameplayReasonCode::KeyboardMouseTransientDigitalActive;
@@ -216,13 +378,8 @@ namespace dualpad::input_v2::gameplay
 
         const bool keyboardMousePrimary =
             input.keyboardMouseDigitalActive ||
-            input.keyboardMouseCombatActive ||
-            input.keyboardMoveActive ||
-            input.mouseLookActive;
-        const bool gamepadAnalogPrimary =
-            decision.lookOwner == ChannelOwner::Gamepad ||
-            decision.moveOwner == ChannelOwner::Gamepad ||
-            decision.combatOwner == ChannelOwner::Gamepad;
+            analog.keyboardMouseWonMask != AnalogChannelNone;
+        const bool gamepadAnalogPrimary = analog.gamepadOwnerMask != AnalogChannelNone;
 
         decision.engineOwner = keyboardMousePrimary ?
             presentation::PresentationOwner::KeyboardMouse :
@@ -240,6 +397,7 @@ namespace dualpad::input_v2::gameplay
     {
         GameplayProjectionFrame frame{};
         frame.context = policy.gameplayContext ? LegacyInputContextCompat::Gameplay : LegacyInputContextCompat::Menu;
+        frame.gamepadPlan.passthroughChannels = policy.analogPassthroughChannels;
         frame.contextRevision = kernel.facts.contextRevision;
         frame.recoveryPlan = BuildRecoveryPlan(recoveryInput);
         if (frame.recoveryPlan.mode == RecoveryMode::SoftResyncOutputs) {
@@ -257,11 +415,17 @@ namespace dualpad::input_v2::gameplay
             }
         }
 
-        const auto lookMagnitude = AxisMagnitudeForTarget(resolved, NativeAxisTarget::LookStick);
-        const auto moveMagnitude = AxisMagnitudeForTarget(resolved, NativeAxisTarget::MoveStick);
-        const auto leftTriggerMagnitude = AxisMagnitudeForTarget(resolved, NativeAxisTarget::LeftTrigger);
-        const auto rightTriggerMagnitude = AxisMagnitudeForTarget(resolved, NativeAxisTarget::RightTrigger);
-        const auto triggerMagnitude = std::max(leftTriggerMagnitude, rightTriggerMagnitude);
+        const auto previousGamepadMask = ChannelBits(
+            previous.lookOwner == ChannelOwner::Gamepad,
+            previous.moveOwner == ChannelOwner::Gamepad,
+            previous.combatOwner == ChannelOwner::Gamepad);
+        const auto thresholds = EvaluateAnalogThresholds(
+            ChannelMagnitudes(resolved),
+            AnalogThresholds{
+                .enter = { { policy.lookEnterThreshold, policy.moveEnterThreshold, policy.triggerEnterThreshold, 0.0f } },
+                .sustain = { { policy.lookSustainThreshold, policy.moveSustainThreshold, policy.triggerSustainThreshold, 0.0f } }
+            },
+            previousGamepadMask);
 
         const auto recoveryReason = frame.reasons.recovery;
         const auto primaryPath = ResolvePrimaryPathArbitration(PrimaryPathArbitrationInput{
@@ -270,12 +434,12 @@ namespace dualpad::input_v2::gameplay
             .previousCombatOwner = previous.combatOwner,
             .previousDigitalOwner = previous.digitalOwner,
             .gameplayContext = policy.gameplayContext,
-            .gamepadLookActive = lookMagnitude >= policy.lookEnterThreshold,
-            .gamepadLookSustained = previous.lookOwner == ChannelOwner::Gamepad && lookMagnitude >= policy.lookSustainThreshold,
-            .gamepadMoveActive = moveMagnitude >= policy.moveEnterThreshold,
-            .gamepadMoveSustained = previous.moveOwner == ChannelOwner::Gamepad && moveMagnitude >= policy.moveSustainThreshold,
-            .gamepadCombatActive = triggerMagnitude >= policy.triggerEnterThreshold,
-            .gamepadCombatSustained = previous.combatOwner == ChannelOwner::Gamepad && triggerMagnitude >= policy.triggerSustainThreshold,
+            .gamepadLookActive = (thresholds.activeMask & AnalogChannelLook) != 0,
+            .gamepadLookSustained = (thresholds.sustainedMask & AnalogChannelLook) != 0,
+            .gamepadMoveActive = (thresholds.activeMask & AnalogChannelMove) != 0,
+            .gamepadMoveSustained = (thresholds.sustainedMask & AnalogChannelMove) != 0,
+            .gamepadCombatActive = (thresholds.activeMask & AnalogChannelCombat) != 0,
+            .gamepadCombatSustained = (thresholds.sustainedMask & AnalogChannelCombat) != 0,
             .gamepadTransientDigitalActive = hasTransientGamepadDigital,
             .mouseLookActive = policy.mouseLookActive,
             .keyboardMoveActive = policy.keyboardMoveActive,
@@ -304,72 +468,13 @@ namespace dualpad::input_v2::gameplay
         for (const auto& value : resolved.values) {
             ApplyAnalogValue(frame, value);
         }
-        if (frame.gatePlan.lookGate == AnalogGateMode::ZeroedByKeyboardMouse) {
-            frame.gamepadPlan.analog.lookX = 0.0f;
-            frame.gamepadPlan.analog.lookY = 0.0f;
-        }
-        if (frame.gatePlan.moveGate == AnalogGateMode::ZeroedByKeyboardMouse) {
-            frame.gamepadPlan.analog.moveX = 0.0f;
-            frame.gamepadPlan.analog.moveY = 0.0f;
-        }
-        if (frame.gatePlan.leftTriggerGate == AnalogGateMode::ZeroedByKeyboardMouse) {
-            frame.gamepadPlan.analog.leftTrigger = 0.0f;
-        }
-        if (frame.gatePlan.rightTriggerGate == AnalogGateMode::ZeroedByKeyboardMouse) {
-            frame.gamepadPlan.analog.rightTrigger = 0.0f;
-        }
+        const auto openChannels = ChannelBits(
+            frame.gatePlan.lookGate == AnalogGateMode::Open,
+            frame.gatePlan.moveGate == AnalogGateMode::Open,
+            frame.gatePlan.leftTriggerGate == AnalogGateMode::Open);
+        frame.gamepadPlan.analog = UnpackAnalog(GateAnalogLanes(PackAnalog(frame.gamepadPlan.analog), openChannels));
 
-        bool overflow = false;
-        for (const auto& change : resolved.changes) {
-            const auto decision = dualpad::input::backend::ActionBackendPolicy::Decide(change.actionId);
-            if (decision.backend == PlannedBackend::NativeButtonCommit) {
-                if (IsTransientContract(decision.contract)) {
-                    if (frame.gatePlan.transientDigitalGate == DigitalGateMode::Open) {
-                        overflow = !TryAppend(
-                            frame.gamepadPlan.transientDigital,
-                            NativeTransientCommand{
-                                .actionId = change.actionId,
-                                .control = decision.nativeCode,
-                                .phase = change.phase,
-                                .contract = decision.contract,
-                                .gateAware = true,
-                                .contextRevision = frame.contextRevision
-                            }) || overflow;
-                    }
-                } else if (IsSustainedContract(decision.contract)) {
-                    std::uint8_t mask = 0;
-                    if (change.phase != actions::ActionPhase::Release) {
-                        mask = static_cast<std::uint8_t>(SustainedSourceBit::GamepadResolved);
-                        if (policy.keyboardPhysicalSustainedActive) {
-                            mask |= static_cast<std::uint8_t>(SustainedSourceBit::KeyboardPhysical);
-                        }
-                        if (policy.mousePhysicalSustainedActive) {
-                            mask |= static_cast<std::uint8_t>(SustainedSourceBit::MousePhysical);
-                        }
-                    }
-                    overflow = !TryAppend(
-                        frame.gamepadPlan.sustainedDigital,
-                        NativeSustainedCommand{
-                            .actionId = change.actionId,
-                            .control = decision.nativeCode,
-                            .activeSourceMask = mask,
-                            .contract = decision.contract,
-                            .contextRevision = frame.contextRevision
-                        }) || overflow;
-                }
-            } else if (decision.backend == PlannedBackend::KeyboardHelper || decision.backend == PlannedBackend::ModEvent) {
-                overflow = !TryAppend(
-                    frame.helperPlan.commands,
-                    HelperOutputCommand{
-                        .actionId = change.actionId,
-                        .kind = decision.backend == PlannedBackend::ModEvent ? HelperOutputKind::ModEvent : HelperOutputKind::KeyboardKey,
-                        .helperCode = ResolveHelperCode(change.actionId),
-                        .phase = change.phase,
-                        .contract = decision.contract,
-                        .contextRevision = frame.contextRevision
-                    }) || overflow;
-            }
-        }
+        const auto overflow = AppendChangeCommands(frame, resolved, policy);
 
         frame.presentationPlan.engineOwner = primaryPath.engineOwner;
         frame.presentationPlan.menuEntryOwner = primaryPath.menuEntryOwner;
@@ -385,4 +490,72 @@ namespace dualpad::input_v2::gameplay
 
         return frame;
     }
+
+    GameplayProjectionFrame ResolveDeadlineProjection(
+        const actions::ResolvedActionFrame& resolved,
+        const GameplayPolicy& policy,
+        const GameplayProjectionFrame& previous)
+    {
+        GameplayProjectionFrame frame = previous;
+        frame.contextRevision = resolved.contextRevision;
+        frame.gamepadPlan.passthroughChannels = policy.analogPassthroughChannels;
+        frame.gamepadPlan.transientDigital.count = 0;
+        frame.gamepadPlan.sustainedDigital.count = 0;
+        frame.helperPlan.commands.count = 0;
+        frame.helperPlan.enqueueBridgeResetBeforeApply = false;
+        frame.recoveryPlan = RecoveryPlan{};
+        frame.reasons.recovery = GameplayReasonCode::None;
+        frame.presentationPlan.reason = presentation::GameplayPresentationReasonCode::CarryDigitalOwner;
+        if (frame.gatePlan.transientDigitalGate == DigitalGateMode::CancelAndSuppressNewTransient) {
+            frame.gatePlan.transientDigitalGate = DigitalGateMode::SuppressNewTransient;
+        }
+
+        if (AppendChangeCommands(frame, resolved, policy)) {
+            ForceOverflowHardReset(frame);
+        }
+        return frame;
+    }
+
+    std::uint8_t ResolveAnalogPassthroughChannels(
+        const std::vector<const actions::CompiledGraphBinding*>& activeBindings)
+    {
+        std::uint8_t driven = AnalogPassthroughNone;
+        std::uint8_t reshaped = AnalogPassthroughNone;
+        // Stick channels need both components forwarded; a missing Y binding
+        // publishes 0 where the physical stick may not be.
+        std::uint8_t forwardedX = AnalogPassthroughNone;
+        std::uint8_t forwardedY = AnalogPassthroughNone;
+        for (const auto* binding : activeBindings) {
+            const auto* descriptor = dualpad::input::backend::FindNativeActionDescriptor(binding->actionId);
+            if (!descriptor || descriptor->backend != PlannedBackend::NativeState) {
+                continue;
+            }
+            const auto channel = PassthroughChannelFor(descriptor->axisTarget);
+            if (channel == AnalogPassthroughNone) {
+                continue;
+            }
+
+            driven |= channel;
+            if (ForwardedPhysicalChannel(*binding) != channel) {
+                reshaped |= channel;
+                continue;
+            }
+            using dualpad::input::PadAxisId;
+            switch (static_cast<PadAxisId>(binding->paths.front().code)) {
+            case PadAxisId::LeftStickX:
+            case PadAxisId::RightStickX:
+                forwardedX |= channel;
+                break;
+            case PadAxisId::LeftStickY:
+            case PadAxisId::RightStickY:
+                forwardedY |= channel;
+                break;
+            default:
+                forwardedX |= channel;
+                forwardedY |= channel;
+                break;
+            }
+        }
+        return static_cast<std::uint8_t>(driven & ~reshaped & forwardedX & forwardedY);
+    }
 }
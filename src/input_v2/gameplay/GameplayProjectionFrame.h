@@ -9,6 +9,7 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <vector>
 
 namespace dualpad::input_v2::gameplay
 {
@@ -56,9 +57,22 @@ namespace dualpad::input_v2::gameplay
         HardReset
     };
 
+    // Analog outputs whose active bindings forward their own physical control
+    // unchanged, so a poll may read that control directly.
+    enum AnalogPassthroughChannel : std::uint8_t
+    {
+        AnalogPassthroughNone = 0,
+        AnalogPassthroughMove = 1u << 0,
+        AnalogPassthroughLook = 1u << 1,
+        AnalogPassthroughLeftTrigger = 1u << 2,
+        AnalogPassthroughRightTrigger = 1u << 3
+    };
+
     template <class T, std::size_t N>
     struct FixedCommandList
     {
+        static constexpr std::size_t kCapacity = N;
+
         std::array<T, N> items{};
         std::size_t count{ 0 };
     };
@@ -79,7 +93,7 @@ namespace dualpad::input_v2::gameplay
 
     struct NativeTransientCommand
     {
-        actions::ActionId actionId{};
+        actions::InternedActionId actionId{};
         dualpad::input::backend::NativeControlCode control{ dualpad::input::backend::NativeControlCode::None };
         actions::ActionPhase phase{ actions::ActionPhase::Press };
         dualpad::input::backend::ActionOutputContract contract{ dualpad::input::backend::ActionOutputContract::None };
@@ -89,7 +103,7 @@ namespace dualpad::input_v2::gameplay
 
     struct NativeSustainedCommand
     {
-        actions::ActionId actionId{};
+        actions::InternedActionId actionId{};
         dualpad::input::backend::NativeControlCode control{ dualpad::input::backend::NativeControlCode::None };
         std::uint8_t activeSourceMask{ 0 };
         dualpad::input::backend::ActionOutputContract contract{ dualpad::input::backend::ActionOutputContract::None };
@@ -98,7 +112,7 @@ namespace dualpad::input_v2::gameplay
 
     struct HelperOutputCommand
     {
-        actions::ActionId actionId{};
+        actions::InternedActionId actionId{};
         HelperOutputKind kind{ HelperOutputKind::KeyboardKey };
         std::uint16_t helperCode{ 0 };
         actions::ActionPhase phase{ actions::ActionPhase::Press };
@@ -120,6 +134,7 @@ namespace dualpad::input_v2::gameplay
     struct GamepadOutputPlan
     {
         ProjectedAnalogState analog{};
+        std::uint8_t passthroughChannels{ AnalogPassthroughNone };
         FixedCommandList<NativeTransientCommand, 32> transientDigital{};
         FixedCommandList<NativeSustainedCommand, 8> sustainedDigital{};
     };
@@ -220,6 +235,7 @@ namespace dualpad::input_v2::gameplay
         bool keyboardMouseDigitalActive{ false };
         bool keyboardPhysicalSustainedActive{ false };
         bool mousePhysicalSustainedActive{ false };
+        std::uint8_t analogPassthroughChannels{ AnalogPassthroughNone };
     };
 
     GameplayProjectionFrame ResolveGameplayProjection(
@@ -229,5 +245,19 @@ namespace dualpad::input_v2::gameplay
         const GameplayProjectionFrame& previous,
         const GameplayRecoveryInput& recoveryInput);
 
+    // Projection for a deadline-only runtime tick: owners, gates and analog
+    // carry over from the previous frame and only the fired hold/repeat
+    // changes are lowered into commands.
+    GameplayProjectionFrame ResolveDeadlineProjection(
+        const actions::ResolvedActionFrame& resolved,
+        const GameplayPolicy& policy,
+        const GameplayProjectionFrame& previous);
+
     PrimaryPathArbitrationDecision ResolvePrimaryPathArbitration(const PrimaryPathArbitrationInput& input);
+
+    // A channel passes through when every active binding of a native analog
+    // action targeting it is a modifier-free Value binding on that channel's
+    // own stick axes or trigger, and the bindings cover the whole channel.
+    std::uint8_t ResolveAnalogPassthroughChannels(
+        const std::vector<const actions::CompiledGraphBinding*>& activeBindings);
 }
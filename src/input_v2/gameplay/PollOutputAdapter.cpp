@@ -18,6 +18,32 @@ namespace dualpad::input_v2::gameplay
             }
             return true;
         }
+
+        // Expands a batch outcome into the same per-command step sequence the
+        // executor ran, including the failing step.
+        bool RecordBatchSteps(
+            PollOutputApplyResult& result,
+            const GameplayProjectionFrame& frame,
+            const PollOutputBatchResult& batch)
+        {
+            const std::size_t recorded = batch.succeeded ? batch.appliedSteps : batch.appliedSteps + 1;
+            std::size_t remaining = recorded;
+            const auto append = [&](PollOutputApplyStep step, std::size_t count) {
+                for (std::size_t index = 0; index < count && remaining != 0; ++index, --remaining) {
+                    result.steps.push_back(step);
+                }
+            };
+            append(PollOutputApplyStep::ApplySustainedDigital, frame.gamepadPlan.sustainedDigital.count);
+            append(PollOutputApplyStep::ApplyTransientDigital, frame.gamepadPlan.transientDigital.count);
+            append(PollOutputApplyStep::ApplyHelperCommand, frame.helperPlan.commands.count);
+            append(PollOutputApplyStep::PublishAnalogState, 1);
+
+            if (!batch.succeeded) {
+                result.outputApplySucceeded = false;
+                return false;
+            }
+            return true;
+        }
     }
 
     PollOutputApplyResult PollOutputAdapter::Apply(
@@ -60,34 +86,8 @@ namespace dualpad::input_v2::gameplay
             return result;
         }
 
-        for (std::size_t index = 0; index < frame.gamepadPlan.sustainedDigital.count; ++index) {
-            if (!RunStep(
-                    result,
-                    PollOutputApplyStep::ApplySustainedDigital,
-                    executor.ApplySustainedDigital(frame.gamepadPlan.sustainedDigital.items[index]))) {
-                return result;
-            }
-        }
-
-        for (std::size_t index = 0; index < frame.gamepadPlan.transientDigital.count; ++index) {
-            if (!RunStep(
-                    result,
-                    PollOutputApplyStep::ApplyTransientDigital,
-                    executor.ApplyTransientDigital(frame.gamepadPlan.transientDigital.items[index]))) {
-                return result;
-            }
-        }
-
-        for (std::size_t index = 0; index < frame.helperPlan.commands.count; ++index) {
-            if (!RunStep(
-                    result,
-                    PollOutputApplyStep::ApplyHelperCommand,
-                    executor.ApplyHelperCommand(frame.helperPlan.commands.items[index]))) {
-                return result;
-            }
-        }
-
-        if (!RunStep(result, PollOutputApplyStep::PublishAnalogState, executor.PublishAnalogState(frame.gamepadPlan.analog))) {
+        const auto batch = executor.ApplyFrameCommands(frame);
+        if (!RecordBatchSteps(result, frame, batch)) {
             return result;
         }
 
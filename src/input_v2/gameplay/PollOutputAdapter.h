@@ -2,8 +2,9 @@
 
 #include "input_v2/gameplay/GameplayProjectionFrame.h"
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
-#include <vector>
 
 namespace dualpad::input_v2::gameplay
 {
@@ -21,10 +22,52 @@ namespace dualpad::input_v2::gameplay
         CommitCleanRecoveryBaseline
     };
 
+    // Inline step record sized for the largest possible frame: four recovery
+    // clears, the gate plan, every command list at capacity, the analog
+    // publish and the clean-baseline commit.
+    class PollOutputStepList
+    {
+    public:
+        static constexpr std::size_t kCapacity =
+            4 + 1 +
+            decltype(GamepadOutputPlan::sustainedDigital)::kCapacity +
+            decltype(GamepadOutputPlan::transientDigital)::kCapacity +
+            decltype(KeyboardHelperOutputPlan::commands)::kCapacity +
+            1 + 1;
+
+        void push_back(PollOutputApplyStep step)
+        {
+            _items[_count++] = step;
+        }
+
+        [[nodiscard]] std::size_t size() const { return _count; }
+        [[nodiscard]] bool empty() const { return _count == 0; }
+        [[nodiscard]] PollOutputApplyStep front() const { return _items[0]; }
+        [[nodiscard]] PollOutputApplyStep back() const { return _items[_count - 1]; }
+        [[nodiscard]] PollOutputApplyStep operator[](std::size_t index) const { return _items[index]; }
+        [[nodiscard]] const PollOutputApplyStep* begin() const { return _items.data(); }
+        [[nodiscard]] const PollOutputApplyStep* end() const { return _items.data() + _count; }
+
+    private:
+        std::array<PollOutputApplyStep, kCapacity> _items{};
+        std::size_t _count{ 0 };
+    };
+
     struct PollOutputApplyResult
     {
         bool outputApplySucceeded{ false };
-        std::vector<PollOutputApplyStep> steps;
+        PollOutputStepList steps;
+    };
+
+    // Outcome of IPollOutputExecutor::ApplyFrameCommands. The batch runs as
+    // sustained, transient, helper, then the analog step, which the drain
+    // publishes with the rest of the frame; `appliedSteps` counts the ones
+    // that succeeded, so on failure the step at that position is the one
+    // that failed.
+    struct PollOutputBatchResult
+    {
+        bool succeeded{ false };
+        std::size_t appliedSteps{ 0 };
     };
 
     class IPollOutputExecutor
@@ -37,10 +80,11 @@ namespace dualpad::input_v2::gameplay
         virtual bool ClearSustainedDigitalAggregator() = 0;
         virtual bool ClearProjectionStickyOwners() = 0;
         virtual bool ApplyGatePlan(const GatePlan& gatePlan) = 0;
-        virtual bool ApplySustainedDigital(const NativeSustainedCommand& command) = 0;
-        virtual bool ApplyTransientDigital(const NativeTransientCommand& command) = 0;
-        virtual bool ApplyHelperCommand(const HelperOutputCommand& command) = 0;
-        virtual bool PublishAnalogState(const ProjectedAnalogState& analog) = 0;
+
+        // Applies every command list of `frame` plus its analog state in one
+        // call, stopping at the first failure.
+        virtual PollOutputBatchResult ApplyFrameCommands(const GameplayProjectionFrame& frame) = 0;
+
         virtual bool CommitCleanRecoveryBaseline() = 0;
     };
 
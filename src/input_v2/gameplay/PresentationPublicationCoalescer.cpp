@@ -0,0 +1,88 @@
+#include "pch.h"
+
+#include "input_v2/gameplay/PresentationPublicationCoalescer.h"
+
+#include <utility>
+
+namespace dualpad::input_v2::gameplay
+{
+    void PresentationPublicationCoalescer::Stage(
+        const presentation::PublishedPresentationState& state,
+        const prompt::PromptRuntimeBaseline* baseline)
+    {
+        ++_stats.stagedFrames;
+        if (HasPending()) {
+            ++_stats.coalescedFrames;
+        }
+
+        _pendingDirty |= state.dirty;
+        _pendingSurface = state;
+        if (baseline) {
+            _pendingPrompt = PromptPublication{
+                .state = state,
+                .baseline = *baseline
+            };
+        }
+    }
+
+    bool PresentationPublicationCoalescer::HasPending() const
+    {
+        return _pendingSurface.has_value();
+    }
+
+    PresentationPublicationCoalescer::Publication PresentationPublicationCoalescer::Flush()
+    {
+        Publication publication{};
+        if (!_pendingSurface) {
+            return publication;
+        }
+
+        if (_surfaceEpoch != _pendingSurface->epoch) {
+            _surfaceEpoch = _pendingSurface->epoch;
+            _pendingSurface->dirty = _pendingDirty;
+            publication.surface = std::move(_pendingSurface);
+            ++_stats.surfacePublished;
+        } else {
+            ++_stats.surfaceSkipped;
+        }
+
+        if (_pendingPrompt) {
+            if (_promptEpoch != _pendingPrompt->state.epoch ||
+                !_promptBaseline ||
+                !SameBaseline(*_promptBaseline, _pendingPrompt->baseline)) {
+                _promptEpoch = _pendingPrompt->state.epoch;
+                _promptBaseline = _pendingPrompt->baseline;
+                publication.prompt = std::move(_pendingPrompt);
+                ++_stats.promptPublished;
+            } else {
+                ++_stats.promptSkipped;
+            }
+        }
+
+        _pendingSurface.reset();
+        _pendingPrompt.reset();
+        _pendingDirty = presentation::PresentationDirtyFlags::None;
+        return publication;
+    }
+
+    PresentationPublicationCoalescer::Stats PresentationPublicationCoalescer::GetStats() const
+    {
+        return _stats;
+    }
+
+    void PresentationPublicationCoalescer::Reset()
+    {
+        *this = PresentationPublicationCoalescer{};
+    }
+
+    bool PresentationPublicationCoalescer::SameBaseline(
+        const prompt::PromptRuntimeBaseline& lhs,
+        const prompt::PromptRuntimeBaseline& rhs)
+    {
+        return lhs.manifestEpoch == rhs.manifestEpoch &&
+            lhs.configGeneration == rhs.configGeneration &&
+            lhs.bundle == rhs.bundle &&
+            lhs.graph.manifestEpoch == rhs.graph.manifestEpoch &&
+            lhs.graph.graph == rhs.graph.graph;
+    }
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "input_v2/presentation/PresentationProjection.h"
+#include "input_v2/prompt/PromptRuntimeOwner.h"
+
+#include <cstdint>
+#include <optional>
+
+namespace dualpad::input_v2::gameplay
+{
+    // Collapses the presentation states staged by every stable frame of one
+    // drain into at most one SkyrimCompatibilitySurface commit and one prompt
+    // publish. A stage is only forwarded when its epoch (or, for prompts, the
+    // baseline identity) differs from what was last forwarded; dirty flags of
+    // coalesced frames are OR-ed so ShouldRefreshMenus still sees them.
+    class PresentationPublicationCoalescer
+    {
+    public:
+        struct Stats
+        {
+            std::uint64_t stagedFrames{ 0 };
+            std::uint64_t coalescedFrames{ 0 };
+            std::uint64_t surfacePublished{ 0 };
+            std::uint64_t surfaceSkipped{ 0 };
+            std::uint64_t promptPublished{ 0 };
+            std::uint64_t promptSkipped{ 0 };
+        };
+
+        struct PromptPublication
+        {
+            presentation::PublishedPresentationState state{};
+            prompt::PromptRuntimeBaseline baseline{};
+        };
+
+        struct Publication
+        {
+            std::optional<presentation::PublishedPresentationState> surface;
+            std::optional<PromptPublication> prompt;
+        };
+
+        // `baseline` is null for runtime-health-degraded frames, which update
+        // the compatibility surface but must not move the prompt scope.
+        void Stage(
+            const presentation::PublishedPresentationState& state,
+            const prompt::PromptRuntimeBaseline* baseline);
+        [[nodiscard]] bool HasPending() const;
+        // Returns only the sinks whose inputs changed since their last flush.
+        [[nodiscard]] Publication Flush();
+
+        [[nodiscard]] Stats GetStats() const;
+        void Reset();
+
+    private:
+        static bool SameBaseline(const prompt::PromptRuntimeBaseline& lhs, const prompt::PromptRuntimeBaseline& rhs);
+
+        std::optional<presentation::PublishedPresentationState> _pendingSurface;
+        std::optional<PromptPublication> _pendingPrompt;
+        presentation::PresentationDirtyFlags _pendingDirty{ presentation::PresentationDirtyFlags::None };
+        std::optional<std::uint32_t> _surfaceEpoch;
+        std::optional<std::uint32_t> _promptEpoch;
+        std::optional<prompt::PromptRuntimeBaseline> _promptBaseline;
+        Stats _stats{};
+    };
+}
@@ -51,14 +51,17 @@ namespace dualpad::input_v2::gameplay
     {
         std::shared_ptr<const config::CompiledConfigBundle> bundle;
         actions::PublishedActionGraphSnapshot graph;
-        context::ResolvedContextSnapshot context;
+        // Pinned once per frame and released by ReleaseRuntimeEnvelope.
+        context::PinnedContextSnapshot context;
         std::uint64_t manifestEpoch{ 0 };
         std::uint64_t configGeneration{ 0 };
     };
 
+    // Rebound in place for every stable frame; `frame` points at the caller's
+    // frame and is only valid while that frame is processed.
     struct FrameRuntimeEnvelope
     {
-        ingress::AssembledFactFrame frame;
+        const ingress::AssembledFactFrame* frame{ nullptr };
         RuntimeConfigSnapshot config;
         RuntimeHealthReasonMask healthReasons{ RuntimeHealthMask(RuntimeHealthReason::None) };
         std::string debugReason;
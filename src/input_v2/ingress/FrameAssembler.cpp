@@ -321,9 +321,10 @@ namespace dualpad::input_v2::ingress
         const IngressBoundaryKey& from,
         const IngressBoundaryKey& to,
         TransitionReason reason,
-        FactHealth health)
+        FactHealth health,
+        bool preservesInteractionState)
     {
-        const bool hard = reason == TransitionReason::ManifestEpochChanged ||
+        const bool hard = (reason == TransitionReason::ManifestEpochChanged && !preservesInteractionState) ||
             reason == TransitionReason::QueueOverflow ||
             reason == TransitionReason::ExplicitReset;
         const bool soft = reason == TransitionReason::SequenceGap;
@@ -345,7 +346,8 @@ namespace dualpad::input_v2::ingress
                 .reason = reason,
                 .requestSoftResync = soft,
                 .requestHardResync = hard,
-                .flushPendingPulseEdges = hard || soft
+                .flushPendingPulseEdges = hard || soft,
+                .preservesInteractionState = preservesInteractionState
             }
         });
     }
@@ -357,7 +359,9 @@ namespace dualpad::input_v2::ingress
         TransitionReason reason)
     {
         FlushWindow(frames);
-        EmitTransition(frames, _currentKey, nextKey, reason);
+        const bool preservesInteractionState =
+            event.kind == IngressKind::ManifestEpochChanged && event.manifest.preservesInteractionState;
+        EmitTransition(frames, _currentKey, nextKey, reason, {}, preservesInteractionState);
         _currentKey = nextKey;
         if (event.kind != IngressKind::ManifestEpochChanged) {
             ApplyEventToWindow(event);
@@ -401,9 +405,20 @@ namespace dualpad::input_v2::ingress
     actions::KernelFrame BuildKernelFrame(const AssembledFactFrame& frame)
     {
         actions::KernelFrame kernel{};
+        BuildKernelFrame(frame, kernel);
+        return kernel;
+    }
+
+    void BuildKernelFrame(const AssembledFactFrame& frame, actions::KernelFrame& kernel)
+    {
+        kernel.facts = actions::KernelFacts{};
+        kernel.state.controlSamples.clear();
+        kernel.state.cleanBoundaryBaseline = true;
+        kernel.state.healthDegraded = false;
+        kernel.kernelRevision = 0;
         if (frame.kind != AssembledFrameKind::Stable) {
             kernel.state.healthDegraded = true;
-            return kernel;
+            return;
         }
 
         kernel.facts.manifestEpoch = frame.boundaryKey.manifestEpoch;
@@ -411,8 +426,7 @@ namespace dualpad::input_v2::ingress
         kernel.facts.menuStackRevision = frame.boundaryKey.menuStackRevision;
         kernel.facts.deviceFamilyRevision = frame.boundaryKey.deviceFamilyRevision;
         kernel.facts.monotonicUs = frame.facts.monotonicUs;
-        kernel.state.controlSamples = frame.facts.controlSamples;
-        kernel.state.cleanBoundaryBaseline = true;
+        kernel.state.controlSamples.assign(frame.facts.controlSamples.begin(), frame.facts.controlSamples.end());
         kernel.state.healthDegraded = frame.facts.health.boundaryMarkerMismatch ||
             frame.facts.health.pendingBoundaryMarkerPair ||
             frame.facts.health.queueOverflow ||
@@ -420,6 +434,5 @@ namespace dualpad::input_v2::ingress
             frame.facts.health.coalescedSnapshot ||
             frame.facts.health.crossContextMismatch;
         kernel.kernelRevision = frame.lastSeq;
-        return kernel;
     }
 }
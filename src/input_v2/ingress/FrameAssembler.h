@@ -66,6 +66,7 @@ namespace dualpad::input_v2::ingress
         bool requestSoftResync{ false };
         bool requestHardResync{ false };
         bool flushPendingPulseEdges{ false };
+        bool preservesInteractionState{ false };
     };
 
     struct AssembledFactFrame
@@ -112,7 +113,8 @@ namespace dualpad::input_v2::ingress
             const IngressBoundaryKey& from,
             const IngressBoundaryKey& to,
             TransitionReason reason,
-            FactHealth health = {});
+            FactHealth health = {},
+            bool preservesInteractionState = false);
         void StartWindow(const IngressEvent& event);
         void HandleBoundaryChange(std::vector<AssembledFactFrame>& frames, const IngressEvent& event, IngressBoundaryKey nextKey, TransitionReason reason);
         bool HandleOrderingViolation(std::vector<AssembledFactFrame>& frames, const IngressEvent& event);
@@ -121,4 +123,6 @@ namespace dualpad::input_v2::ingress
 
     bool ShouldDispatchToInteractionEngine(const AssembledFactFrame& frame);
     actions::KernelFrame BuildKernelFrame(const AssembledFactFrame& frame);
+    // Refills a caller-owned kernel frame, reusing its control sample storage.
+    void BuildKernelFrame(const AssembledFactFrame& frame, actions::KernelFrame& kernel);
 }
@@ -172,12 +172,13 @@ namespace dualpad::input_v2::ingress
         return true;
     }
 
-    void IngressHub::PushManifestEpochChanged(std::uint64_t manifestEpoch)
+    void IngressHub::PushManifestEpochChanged(std::uint64_t manifestEpoch, bool preservesInteractionState)
     {
         IngressEvent event{};
         event.kind = IngressKind::ManifestEpochChanged;
         event.source = IngressSource::ManifestPublisher;
         event.manifest.manifestEpoch = static_cast<std::uint32_t>(manifestEpoch);
+        event.manifest.preservesInteractionState = preservesInteractionState;
         (void)PushEvent(std::move(event));
     }
 
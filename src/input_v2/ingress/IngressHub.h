@@ -19,7 +19,7 @@ namespace dualpad::input_v2::ingress
 
         bool PushEvent(IngressEvent event);
         bool PushPadSnapshot(const dualpad::input::PadEventSnapshot& snapshot);
-        void PushManifestEpochChanged(std::uint64_t manifestEpoch);
+        void PushManifestEpochChanged(std::uint64_t manifestEpoch, bool preservesInteractionState = false);
         void PushSequenceGap();
         void PushExplicitReset();
         std::vector<IngressEvent> Drain();
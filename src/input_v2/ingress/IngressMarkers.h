@@ -59,6 +59,10 @@ namespace dualpad::input_v2::ingress
     struct ManifestEpochChangedPayload
     {
         std::uint32_t manifestEpoch{ 0 };
+        // Set when a reload compiled against the live graph: surviving
+        // bindings keep their ids, so the runtime migrates interaction state
+        // instead of resetting.
+        bool preservesInteractionState{ false };
     };
 
     struct DeviceFamilyChangedPayload
@@ -16,7 +16,8 @@ namespace dualpad::input_v2::ingress
         input.hardResetRequested = frame.transition.requestHardResync;
         input.sequenceGapObserved = frame.transition.reason == TransitionReason::SequenceGap;
         input.explicitResetRequested = frame.transition.reason == TransitionReason::ExplicitReset ||
-            frame.transition.reason == TransitionReason::ManifestEpochChanged ||
+            (frame.transition.reason == TransitionReason::ManifestEpochChanged &&
+                !frame.transition.preservesInteractionState) ||
             frame.transition.reason == TransitionReason::QueueOverflow;
         return input;
     }
@@ -2,8 +2,8 @@
 #include "input_v2/menu/MenuInstanceRegistry.h"
 
 #include <algorithm>
-#include <unordered_map>
-#include <unordered_set>
+#include <bit>
+#include <string_view>
 
 namespace dualpad::input_v2::menu
 {
@@ -61,6 +61,48 @@ namespace dualpad::input_v2::menu
                 sameInstances(lhs.passthroughOverlays, rhs.passthroughOverlays);
         }
 
+        constexpr std::size_t kMinIndexCapacity = 16;
+
+        // Same identity fields MatchFingerprint compares. Menu flags are left
+        // out on purpose: a menu whose flags change must still rebind.
+        std::uint64_t HashFingerprint(std::string_view menuName, std::uintptr_t delegatePtr, std::uintptr_t moviePtr)
+        {
+            constexpr std::uint64_t kFnvOffset = 14695981039346656037ull;
+            constexpr std::uint64_t kFnvPrime = 1099511628211ull;
+
+            std::uint64_t hash = kFnvOffset;
+            const auto mix = [&](std::uint64_t value) {
+                for (auto i = 0; i < 8; ++i) {
+                    hash ^= (value >> (i * 8)) & 0xFFu;
+                    hash *= kFnvPrime;
+                }
+            };
+            for (const char c : menuName) {
+                hash ^= static_cast<unsigned char>(c);
+                hash *= kFnvPrime;
+            }
+            mix(delegatePtr);
+            mix(moviePtr);
+            return hash;
+        }
+
+        std::uint64_t HashPointer(std::uintptr_t ptr)
+        {
+            // Menu objects are aligned, so mix before masking to the slot bits.
+            auto value = static_cast<std::uint64_t>(ptr);
+            value ^= value >> 33;
+            value *= 0xff51afd7ed558ccdull;
+            value ^= value >> 33;
+            return value;
+        }
+
+        bool SameFingerprint(const TrackedMenuInstance& item, const ObservedMenuNode& node)
+        {
+            return item.delegatePtr == node.delegatePtr &&
+                item.moviePtr == node.moviePtr &&
+                item.menuName == node.menuName;
+        }
+
         void SortInstances(std::vector<TrackedMenuInstance>& instances)
         {
             std::sort(instances.begin(), instances.end(), [](const auto& lhs, const auto& rhs) {
@@ -86,46 +128,88 @@ namespace dualpad::input_v2::menu
         return _published;
     }
 
+    MenuInstanceRegistry::Stats MenuInstanceRegistry::GetStats() const
+    {
+        return _stats;
+    }
+
     std::optional<MenuInstanceId> MenuInstanceRegistry::MatchStablePointer(const ObservedMenuNode& node) const
     {
-        if (node.menuPtr == 0) {
+        if (node.menuPtr == 0 || _pointerIndex.empty()) {
             return std::nullopt;
         }
-        const auto find = [&](const auto& items) -> std::optional<MenuInstanceId> {
-            for (const auto& item : items) {
-                if (item.menuPtr == node.menuPtr) {
-                    return item.instanceId;
-                }
+        const auto key = static_cast<std::uint64_t>(node.menuPtr);
+        for (auto slot = HashPointer(node.menuPtr) & _indexMask;; slot = (slot + 1) & _indexMask) {
+            const auto& entry = _pointerIndex[slot];
+            if (!entry.instance) {
+                return std::nullopt;
+            }
+            if (entry.key == key) {
+                return entry.instance->instanceId;
             }
-            return std::nullopt;
-        };
-        if (auto id = find(_published.trackedMenus)) {
-            return id;
         }
-        return find(_published.passthroughOverlays);
     }
 
     std::optional<MenuInstanceId> MenuInstanceRegistry::MatchFingerprint(const ObservedMenuNode& node) const
     {
-        if (node.delegatePtr == 0 && node.moviePtr == 0) {
+        if ((node.delegatePtr == 0 && node.moviePtr == 0) || _fingerprintIndex.empty()) {
             return std::nullopt;
         }
 
+        // A fingerprint shared by several live instances is ambiguous and
+        // must not rebind, so keep probing past the first match.
+        const auto key = HashFingerprint(node.menuName, node.delegatePtr, node.moviePtr);
         std::optional<MenuInstanceId> match;
         auto count = 0u;
-        const auto scan = [&](const auto& items) {
-            for (const auto& item : items) {
-                if (item.menuName == node.menuName &&
-                    item.delegatePtr == node.delegatePtr &&
-                    item.moviePtr == node.moviePtr) {
-                    match = item.instanceId;
-                    ++count;
+        for (auto slot = key & _indexMask;; slot = (slot + 1) & _indexMask) {
+            const auto& entry = _fingerprintIndex[slot];
+            if (!entry.instance) {
+                break;
+            }
+            if (entry.key == key && SameFingerprint(*entry.instance, node)) {
+                match = entry.instance->instanceId;
+                ++count;
+            }
+        }
+        return count == 1 ? match : std::nullopt;
+    }
+
+    void MenuInstanceRegistry::RebuildIdentityIndex()
+    {
+        ++_stats.indexRebuilds;
+        const auto count = _published.trackedMenus.size() + _published.passthroughOverlays.size();
+        const auto capacity = (std::max)(kMinIndexCapacity, std::bit_ceil(count * 2));
+        _indexMask = capacity - 1;
+        _pointerIndex.assign(capacity, IdentitySlot{});
+        _fingerprintIndex.assign(capacity, IdentitySlot{});
+
+        const auto insert = [&](const TrackedMenuInstance& item) {
+            if (item.menuPtr != 0) {
+                const auto key = static_cast<std::uint64_t>(item.menuPtr);
+                auto slot = HashPointer(item.menuPtr) & _indexMask;
+                // Tracked menus are inserted first and win a shared pointer.
+                while (_pointerIndex[slot].instance && _pointerIndex[slot].key != key) {
+                    slot = (slot + 1) & _indexMask;
                 }
+                if (!_pointerIndex[slot].instance) {
+                    _pointerIndex[slot] = IdentitySlot{ .key = key, .instance = &item };
+                }
+            }
+            if (item.delegatePtr != 0 || item.moviePtr != 0) {
+                const auto key = HashFingerprint(item.menuName, item.delegatePtr, item.moviePtr);
+                auto slot = key & _indexMask;
+                while (_fingerprintIndex[slot].instance) {
+                    slot = (slot + 1) & _indexMask;
+                }
+                _fingerprintIndex[slot] = IdentitySlot{ .key = key, .instance = &item };
             }
         };
-        scan(_published.trackedMenus);
-        scan(_published.passthroughOverlays);
-        return count == 1 ? match : std::nullopt;
+        for (const auto& item : _published.trackedMenus) {
+            insert(item);
+        }
+        for (const auto& item : _published.passthroughOverlays) {
+            insert(item);
+        }
     }
 
     MenuInstanceId MenuInstanceRegistry::AllocateId()
@@ -150,21 +234,26 @@ namespace dualpad::input_v2::menu
             item.observedInLastSnapshot = false;
         }
 
-        std::unordered_set<MenuInstanceId> seenIds;
         const auto candidateRevision = _published.menuStackRevision + 1;
         auto upsert = [&](std::vector<TrackedMenuInstance>& items, const ObservedMenuNode& node, bool overlay) {
             MenuIdentityQuality quality = MenuIdentityQuality::DegradedIdentity;
             auto id = MatchStablePointer(node);
             if (id) {
                 quality = MenuIdentityQuality::StablePointer;
-            }
-            else if ((id = MatchFingerprint(node))) {
-                quality = MenuIdentityQuality::FingerprintRebound;
+                ++_stats.stablePointerHits;
             }
             else {
-                id = AllocateId();
-                if (node.menuPtr != 0) {
-                    quality = MenuIdentityQuality::StablePointer;
+                ++_stats.fingerprintFallbacks;
+                if ((id = MatchFingerprint(node))) {
+                    quality = MenuIdentityQuality::FingerprintRebound;
+                    ++_stats.fingerprintRebinds;
+                }
+                else {
+                    id = AllocateId();
+                    ++_stats.newInstances;
+                    if (node.menuPtr != 0) {
+                        quality = MenuIdentityQuality::StablePointer;
+                    }
                 }
             }
 
@@ -201,7 +290,6 @@ namespace dualpad::input_v2::menu
                 found->lastSeenRevision = candidateRevision;
                 found->observedInLastSnapshot = true;
             }
-            seenIds.insert(*id);
 
             if (overlay) {
                 std::erase_if(next.trackedMenus, [&](const auto& item) { return item.instanceId == *id; });
@@ -231,6 +319,7 @@ namespace dualpad::input_v2::menu
         if (!SamePublishedShape(_published, next)) {
             next.menuStackRevision = candidateRevision;
             _published = std::move(next);
+            RebuildIdentityIndex();
         }
         return _published;
     }
@@ -239,5 +328,9 @@ namespace dualpad::input_v2::menu
     {
         _published = ReconciledMenuStack{};
         _nextId = 1;
+        _pointerIndex.clear();
+        _fingerprintIndex.clear();
+        _indexMask = 0;
+        _stats = {};
     }
 }
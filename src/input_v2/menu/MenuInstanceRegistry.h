@@ -47,20 +47,46 @@ namespace dualpad::input_v2::menu
     class MenuInstanceRegistry
     {
     public:
+        struct Stats
+        {
+            std::uint64_t stablePointerHits{ 0 };
+            std::uint64_t fingerprintFallbacks{ 0 };
+            std::uint64_t fingerprintRebinds{ 0 };
+            std::uint64_t newInstances{ 0 };
+            std::uint64_t indexRebuilds{ 0 };
+        };
+
         static MenuInstanceRegistry& GetSingleton();
 
         const ReconciledMenuStack& GetPublishedStack() const;
+        Stats GetStats() const;
         ReconciledMenuStack ReconcileAndPublish(
             const ObservedMenuSnapshot& snapshot,
             const context::CompiledContextCatalog& catalog);
         void ResetForTests();
 
     private:
+        // Open-addressed slot over an instance in _published. An empty slot
+        // has no instance; the key is menuPtr or the identity fingerprint.
+        struct IdentitySlot
+        {
+            std::uint64_t key{ 0 };
+            const TrackedMenuInstance* instance{ nullptr };
+        };
+
         std::optional<MenuInstanceId> MatchStablePointer(const ObservedMenuNode& node) const;
         std::optional<MenuInstanceId> MatchFingerprint(const ObservedMenuNode& node) const;
         MenuInstanceId AllocateId();
+        void RebuildIdentityIndex();
 
         ReconciledMenuStack _published{};
         MenuInstanceId _nextId{ 1 };
+
+        // Rebuilt whenever _published changes; sized to at least twice the
+        // instance count so probes stay short.
+        std::vector<IdentitySlot> _pointerIndex;
+        std::vector<IdentitySlot> _fingerprintIndex;
+        std::uint64_t _indexMask{ 0 };
+        Stats _stats{};
     };
 }
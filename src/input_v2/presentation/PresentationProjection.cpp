@@ -56,11 +56,46 @@ namespace dualpad::input_v2::presentation
         return (static_cast<std::uint8_t>(flags) & static_cast<std::uint8_t>(flag)) != 0;
     }
 
+    PresentationInputFingerprint MakePresentationInputFingerprint(
+        const SourceEvidenceSnapshot& evidence,
+        const context::ResolvedContextSnapshot& contextSnapshot,
+        const PublishedGameplayPresentation& gameplay)
+    {
+        const auto evidenceBits = static_cast<std::uint8_t>(
+            (evidence.keyboardEvidence ? 1u << 0 : 0u) |
+            (evidence.mouseButtonEvidence ? 1u << 1 : 0u) |
+            (evidence.mouseMoveEvidence ? 1u << 2 : 0u) |
+            (evidence.gamepadEvidence ? 1u << 3 : 0u) |
+            (evidence.gamepadLease ? 1u << 4 : 0u));
+        return PresentationInputFingerprint{
+            .family = evidence.deviceFamilyEvidence.family,
+            .deviceFamilyRevision = evidence.deviceFamilyEvidence.deviceFamilyRevision,
+            .evidenceBits = evidenceBits,
+            .pointerSignal = evidence.pointerSignal,
+            .hostMode = contextSnapshot.hostMode,
+            .uiContextId = contextSnapshot.uiContextId,
+            .contextRevision = contextSnapshot.contextRevision,
+            .engineOwner = gameplay.engineOwner,
+            .menuEntryOwner = gameplay.menuEntryOwner,
+            .gameplayPresentationRevision = gameplay.gameplayPresentationRevision
+        };
+    }
+
     PublishedPresentationState PresentationProjection::Project(
         const SourceEvidenceSnapshot& evidence,
         const context::ResolvedContextSnapshot& contextSnapshot,
         const PublishedGameplayPresentation& gameplay)
     {
+        // Projection is a fixed point once a call changes nothing: the same
+        // inputs against the same published state project the same state.
+        const auto input = MakePresentationInputFingerprint(evidence, contextSnapshot, gameplay);
+        if (_lastInput == input && _published.dirty == PresentationDirtyFlags::None) {
+            ++_stats.skipped;
+            return _published;
+        }
+        _lastInput = input;
+        ++_stats.projected;
+
         PublishedPresentationState next = _published;
         next.family = evidence.deviceFamilyEvidence.family;
         next.deviceFamilyRevision = evidence.deviceFamilyEvidence.deviceFamilyRevision;
@@ -118,6 +153,7 @@ namespace dualpad::input_v2::presentation
         next.dirty = dirty;
         if (dirty != PresentationDirtyFlags::None) {
             next.epoch = _published.epoch + 1;
+            ++_stats.changed;
         }
 
         _published = next;
@@ -129,8 +165,15 @@ namespace dualpad::input_v2::presentation
         return _published;
     }
 
+    PresentationProjection::Stats PresentationProjection::GetStats() const
+    {
+        return _stats;
+    }
+
     void PresentationProjection::ResetForTests()
     {
         _published = {};
+        _lastInput.reset();
+        _stats = {};
     }
 }
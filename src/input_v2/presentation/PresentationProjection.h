@@ -5,6 +5,7 @@
 #include "input_v2/presentation/SourceEvidenceCollector.h"
 
 #include <cstdint>
+#include <optional>
 
 namespace dualpad::input_v2::presentation
 {
@@ -98,17 +99,53 @@ namespace dualpad::input_v2::presentation
     PresentationDirtyFlags& operator|=(PresentationDirtyFlags& lhs, PresentationDirtyFlags rhs);
     bool HasDirtyFlag(PresentationDirtyFlags flags, PresentationDirtyFlags flag);
 
+    // Scalar identity of everything Project reads. The context snapshot is
+    // represented by its revision: ContextResolver advances contextRevision
+    // whenever the action set stack or presentation policy changes.
+    struct PresentationInputFingerprint
+    {
+        DeviceFamily family{ DeviceFamily::KeyboardMouse };
+        std::uint32_t deviceFamilyRevision{ 0 };
+        std::uint8_t evidenceBits{ 0 };
+        PointerSignal pointerSignal{ PointerSignal::None };
+        context::HostMode hostMode{ context::HostMode::Gameplay };
+        context::UiContextId uiContextId{ context::UiContextId::None };
+        std::uint32_t contextRevision{ 0 };
+        PresentationOwner engineOwner{ PresentationOwner::KeyboardMouse };
+        PresentationOwner menuEntryOwner{ PresentationOwner::KeyboardMouse };
+        std::uint32_t gameplayPresentationRevision{ 0 };
+
+        friend bool operator==(const PresentationInputFingerprint&, const PresentationInputFingerprint&) = default;
+    };
+
+    PresentationInputFingerprint MakePresentationInputFingerprint(
+        const SourceEvidenceSnapshot& evidence,
+        const context::ResolvedContextSnapshot& contextSnapshot,
+        const PublishedGameplayPresentation& gameplay);
+
     class PresentationProjection
     {
     public:
+        struct Stats
+        {
+            std::uint64_t projected{ 0 };
+            std::uint64_t skipped{ 0 };
+            std::uint64_t changed{ 0 };
+        };
+
+        // Returns the published state unchanged, without re-projecting, when
+        // the inputs match the previous call and that call changed nothing.
         PublishedPresentationState Project(
             const SourceEvidenceSnapshot& evidence,
             const context::ResolvedContextSnapshot& contextSnapshot,
             const PublishedGameplayPresentation& gameplay);
         const PublishedPresentationState& GetPublished() const;
+        Stats GetStats() const;
         void ResetForTests();
 
     private:
         PublishedPresentationState _published{};
+        std::optional<PresentationInputFingerprint> _lastInput;
+        Stats _stats{};
     };
 }
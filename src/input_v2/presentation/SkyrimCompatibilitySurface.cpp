@@ -5,6 +5,8 @@
 #include <REL/Pattern.h>
 #include <SKSE/Version.h>
 
+#include <algorithm>
+
 namespace logger = SKSE::log;
 
 namespace dualpad::input_v2::presentation
@@ -277,6 +279,56 @@ namespace dualpad::input_v2::presentation
     {
         std::scoped_lock lock(_mutex);
         _committed = state;
+        _hookView.store(PackHookView(state), std::memory_order_release);
+    }
+
+    std::uint64_t SkyrimCompatibilitySurface::PackHookView(const PublishedPresentationState& state)
+    {
+        std::uint64_t packed = static_cast<std::uint64_t>(state.epoch) << 32;
+        if (state.owner == PresentationOwner::Gamepad) {
+            packed |= 1u << 0;
+        }
+        if (state.cursorOwner == CursorOwner::Gamepad) {
+            packed |= 1u << 1;
+        }
+        return packed;
+    }
+
+    CompatibilityHookView SkyrimCompatibilitySurface::UnpackHookView(std::uint64_t packed)
+    {
+        return CompatibilityHookView{
+            .epoch = static_cast<std::uint32_t>(packed >> 32),
+            .isUsingGamepad = (packed & (1u << 0)) != 0,
+            .gamepadControlsCursor = (packed & (1u << 1)) != 0
+        };
+    }
+
+    CompatibilityHookView SkyrimCompatibilitySurface::GetHookView() const
+    {
+        return UnpackHookView(_hookView.load(std::memory_order_acquire));
+    }
+
+    void SkyrimCompatibilitySurface::SampleHookReadsForFrame()
+    {
+        const auto reads =
+            _isUsingGamepadReads.load(std::memory_order_relaxed) +
+            _gamepadCursorReads.load(std::memory_order_relaxed) +
+            _deviceEnabledReads.load(std::memory_order_relaxed);
+        std::scoped_lock lock(_mutex);
+        ++_hookReadStats.frames;
+        _hookReadStats.lastFrameReads = reads - _readsAtLastFrame;
+        _hookReadStats.maxFrameReads = (std::max)(_hookReadStats.maxFrameReads, _hookReadStats.lastFrameReads);
+        _readsAtLastFrame = reads;
+    }
+
+    SkyrimCompatibilitySurface::HookReadStats SkyrimCompatibilitySurface::GetHookReadStats() const
+    {
+        std::scoped_lock lock(_mutex);
+        auto stats = _hookReadStats;
+        stats.isUsingGamepadReads = _isUsingGamepadReads.load(std::memory_order_relaxed);
+        stats.gamepadCursorReads = _gamepadCursorReads.load(std::memory_order_relaxed);
+        stats.deviceEnabledReads = _deviceEnabledReads.load(std::memory_order_relaxed);
+        return stats;
     }
 
     void SkyrimCompatibilitySurface::EnableRollback(const LegacyCompatibilitySurface& legacy)
@@ -290,12 +342,14 @@ namespace dualpad::input_v2::presentation
 
     bool SkyrimCompatibilitySurface::IsUsingGamepadHook() const
     {
-        return GetCommittedState().owner == PresentationOwner::Gamepad;
+        _isUsingGamepadReads.fetch_add(1, std::memory_order_relaxed);
+        return GetHookView().isUsingGamepad;
     }
 
     bool SkyrimCompatibilitySurface::GamepadControlsCursorHook() const
     {
-        return GetCommittedState().cursorOwner == CursorOwner::Gamepad;
+        _gamepadCursorReads.fetch_add(1, std::memory_order_relaxed);
+        return GetHookView().gamepadControlsCursor;
     }
 
     bool SkyrimCompatibilitySurface::IsGamepadDeviceEnabledHook(bool remapMode) const
@@ -303,7 +357,8 @@ namespace dualpad::input_v2::presentation
         if (!remapMode) {
             return true;
         }
-        return GetCommittedState().owner == PresentationOwner::Gamepad;
+        _deviceEnabledReads.fetch_add(1, std::memory_order_relaxed);
+        return GetHookView().isUsingGamepad;
     }
 
     bool SkyrimCompatibilitySurface::ShouldRefreshMenus()
@@ -384,6 +439,16 @@ namespace dualpad::input_v2::presentation
         _installResult = HookInstallResult{};
     }
 
+    void SkyrimCompatibilitySurface::ResetHookReadStatsForTests()
+    {
+        std::scoped_lock lock(_mutex);
+        _isUsingGamepadReads.store(0, std::memory_order_relaxed);
+        _gamepadCursorReads.store(0, std::memory_order_relaxed);
+        _deviceEnabledReads.store(0, std::memory_order_relaxed);
+        _readsAtLastFrame = 0;
+        _hookReadStats = {};
+    }
+
     bool SkyrimCompatibilitySurface::TryBeginInstall()
     {
         std::scoped_lock lock(_mutex);
@@ -4,6 +4,7 @@
 
 #include "input_v2/presentation/PresentationProjection.h"
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <mutex>
@@ -123,9 +124,28 @@ namespace dualpad::input_v2::presentation
         std::vector<std::string> diffs;
     };
 
+    // The slice of the committed state the game-thread hooks read, tagged
+    // with the presentation epoch it was committed at.
+    struct CompatibilityHookView
+    {
+        std::uint32_t epoch{ 0 };
+        bool isUsingGamepad{ false };
+        bool gamepadControlsCursor{ false };
+    };
+
     class SkyrimCompatibilitySurface
     {
     public:
+        struct HookReadStats
+        {
+            std::uint64_t frames{ 0 };
+            std::uint64_t isUsingGamepadReads{ 0 };
+            std::uint64_t gamepadCursorReads{ 0 };
+            std::uint64_t deviceEnabledReads{ 0 };
+            std::uint64_t lastFrameReads{ 0 };
+            std::uint64_t maxFrameReads{ 0 };
+        };
+
         static SkyrimCompatibilitySurface& GetSingleton();
 
         HookInstallResult Install();
@@ -141,12 +161,22 @@ namespace dualpad::input_v2::presentation
             const LegacyCompatibilitySurface& legacy,
             bool remapMode) const;
 
+        // One acquire load; never blocks on a concurrent Commit.
+        CompatibilityHookView GetHookView() const;
+        // Closes one game frame of hook-read accounting.
+        void SampleHookReadsForFrame();
+        HookReadStats GetHookReadStats() const;
+
         PublishedPresentationState GetCommittedState() const;
         HookInstallResult GetInstallResult() const;
         void ForceInstallResultForTests(const HookInstallResult& result);
         void ResetInstallStateForTests();
+        void ResetHookReadStatsForTests();
 
     private:
+        static std::uint64_t PackHookView(const PublishedPresentationState& state);
+        static CompatibilityHookView UnpackHookView(std::uint64_t packed);
+
         static bool StaticIsUsingGamepadHook();
         static bool StaticIsGamepadCursorHook();
         static bool StaticIsGamepadDeviceEnabledHook(RE::BSPCGamepadDeviceHandler* device);
@@ -159,6 +189,14 @@ namespace dualpad::input_v2::presentation
 
         mutable std::mutex _mutex;
         PublishedPresentationState _committed{};
+        // CompatibilityHookView of _committed packed into one word, stored
+        // after _committed so hooks never take _mutex.
+        std::atomic<std::uint64_t> _hookView{ 0 };
+        mutable std::atomic<std::uint64_t> _isUsingGamepadReads{ 0 };
+        mutable std::atomic<std::uint64_t> _gamepadCursorReads{ 0 };
+        mutable std::atomic<std::uint64_t> _deviceEnabledReads{ 0 };
+        std::uint64_t _readsAtLastFrame{ 0 };
+        HookReadStats _hookReadStats{};
         std::uint32_t _lastRefreshEpoch{ 0 };
         detail::InstallState _installState{ detail::InstallState::NotInstalled };
         HookInstallResult _installResult{};
@@ -0,0 +1,364 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+// Shared between DualPadGlyphAtlasGen (offline, no plugin headers) and the
+// runtime GlyphAtlasIndex. Standard library only.
+namespace dualpad::input_v2::prompt
+{
+    // Root PromptService uses for per-glyph asset lookup paths; the atlas
+    // image and its index live directly under it.
+    inline constexpr std::string_view kGlyphAssetRoot = "Interface/Exported/DualPad/Glyphs/";
+    inline constexpr std::string_view kGlyphAssetExtension = ".svg";
+    inline constexpr std::string_view kGlyphAtlasImageName = "GlyphAtlas.dds";
+    inline constexpr std::string_view kGlyphAtlasIndexName = "GlyphAtlas.idx";
+
+    inline constexpr std::array<char, 4> kGlyphAtlasMagic{ 'D', 'P', 'G', 'A' };
+    // 2: the packed image is a raster DDS instead of a composite SVG.
+    inline constexpr std::uint32_t kGlyphAtlasVersion = 2;
+
+    // On-disk layout, little-endian: header, entries sorted by
+    // (platformId, glyphId), then a string table the entries point into.
+    struct GlyphAtlasIndexHeader
+    {
+        std::array<char, 4> magic{ kGlyphAtlasMagic };
+        std::uint32_t version{ kGlyphAtlasVersion };
+        std::uint32_t atlasWidth{ 0 };
+        std::uint32_t atlasHeight{ 0 };
+        std::uint32_t entryCount{ 0 };
+        std::uint32_t entriesOffset{ 0 };
+        std::uint32_t stringsOffset{ 0 };
+        std::uint32_t stringsSize{ 0 };
+        std::uint32_t imageNameOffset{ 0 };
+        std::uint32_t imageNameLength{ 0 };
+    };
+
+    struct GlyphAtlasIndexEntry
+    {
+        std::uint32_t platformOffset{ 0 };
+        std::uint32_t platformLength{ 0 };
+        std::uint32_t glyphOffset{ 0 };
+        std::uint32_t glyphLength{ 0 };
+        std::uint16_t x{ 0 };
+        std::uint16_t y{ 0 };
+        std::uint16_t width{ 0 };
+        std::uint16_t height{ 0 };
+        float u0{ 0.0f };
+        float v0{ 0.0f };
+        float u1{ 0.0f };
+        float v1{ 0.0f };
+    };
+
+    static_assert(sizeof(GlyphAtlasIndexHeader) == 40);
+    static_assert(sizeof(GlyphAtlasIndexEntry) == 40);
+
+    struct GlyphAtlasRect
+    {
+        std::uint16_t x{ 0 };
+        std::uint16_t y{ 0 };
+        std::uint16_t width{ 0 };
+        std::uint16_t height{ 0 };
+        float u0{ 0.0f };
+        float v0{ 0.0f };
+        float u1{ 0.0f };
+        float v1{ 0.0f };
+    };
+
+    struct GlyphAtlasPlacement
+    {
+        std::string platformId;
+        std::string glyphId;
+        std::uint16_t x{ 0 };
+        std::uint16_t y{ 0 };
+        std::uint16_t width{ 0 };
+        std::uint16_t height{ 0 };
+    };
+
+    struct GlyphAtlasLayout
+    {
+        std::uint32_t width{ 0 };
+        std::uint32_t height{ 0 };
+        std::vector<GlyphAtlasPlacement> placements;
+    };
+
+    // Splits "<root><platform>/<glyph>.svg" into its platform and glyph ids.
+    [[nodiscard]] inline std::optional<std::pair<std::string_view, std::string_view>> SplitGlyphAssetLookupPath(
+        std::string_view path)
+    {
+        if (!path.starts_with(kGlyphAssetRoot) || !path.ends_with(kGlyphAssetExtension)) {
+            return std::nullopt;
+        }
+        path.remove_prefix(kGlyphAssetRoot.size());
+        path.remove_suffix(kGlyphAssetExtension.size());
+        const auto slash = path.find('/');
+        if (slash == std::string_view::npos || slash == 0 || slash + 1 == path.size() ||
+            path.find('/', slash + 1) != std::string_view::npos) {
+            return std::nullopt;
+        }
+        return std::pair{ path.substr(0, slash), path.substr(slash + 1) };
+    }
+
+    // Shelf packer: tallest glyphs first, left to right, `padding` pixels
+    // between glyphs and around the edge. The height is rounded up to a power
+    // of two. Placements come back in input order; sizes of 0 are kept as
+    // zero-area entries. Returns nullopt if a glyph is wider than maxWidth.
+    [[nodiscard]] inline std::optional<GlyphAtlasLayout> PackGlyphAtlas(
+        std::vector<GlyphAtlasPlacement> glyphs,
+        std::uint32_t maxWidth,
+        std::uint32_t padding)
+    {
+        std::vector<std::size_t> order(glyphs.size());
+        for (std::size_t i = 0; i < order.size(); ++i) {
+            order[i] = i;
+        }
+        std::stable_sort(order.begin(), order.end(), [&](std::size_t lhs, std::size_t rhs) {
+            const auto& l = glyphs[lhs];
+            const auto& r = glyphs[rhs];
+            return std::tie(r.height, r.width, l.platformId, l.glyphId) < std::tie(l.height, l.width, r.platformId, r.glyphId);
+        });
+
+        std::uint32_t cursorX = padding;
+        std::uint32_t cursorY = padding;
+        std::uint32_t shelfHeight = 0;
+        std::uint32_t usedWidth = 0;
+        for (const auto index : order) {
+            auto& glyph = glyphs[index];
+            if (glyph.width + 2 * padding > maxWidth) {
+                return std::nullopt;
+            }
+            if (cursorX + glyph.width + padding > maxWidth) {
+                cursorX = padding;
+                cursorY += shelfHeight + padding;
+                shelfHeight = 0;
+            }
+            glyph.x = static_cast<std::uint16_t>(cursorX);
+            glyph.y = static_cast<std::uint16_t>(cursorY);
+            cursorX += glyph.width + padding;
+            shelfHeight = (std::max)(shelfHeight, static_cast<std::uint32_t>(glyph.height));
+            usedWidth = (std::max)(usedWidth, cursorX);
+        }
+
+        const auto usedHeight = cursorY + shelfHeight + padding;
+        std::uint32_t height = 1;
+        while (height < usedHeight) {
+            height <<= 1;
+        }
+        std::uint32_t width = 1;
+        while (width < usedWidth) {
+            width <<= 1;
+        }
+        if (width > 0xFFFFu || height > 0xFFFFu) {
+            return std::nullopt;
+        }
+        return GlyphAtlasLayout{ .width = width, .height = height, .placements = std::move(glyphs) };
+    }
+
+    [[nodiscard]] inline std::vector<std::byte> SerializeGlyphAtlasIndex(const GlyphAtlasLayout& layout)
+    {
+        auto placements = layout.placements;
+        std::sort(placements.begin(), placements.end(), [](const GlyphAtlasPlacement& lhs, const GlyphAtlasPlacement& rhs) {
+            return std::tie(lhs.platformId, lhs.glyphId) < std::tie(rhs.platformId, rhs.glyphId);
+        });
+
+        std::string strings;
+        const auto intern = [&](std::string_view text) {
+            const auto offset = static_cast<std::uint32_t>(strings.size());
+            strings.append(text);
+            return offset;
+        };
+
+        GlyphAtlasIndexHeader header{};
+        header.atlasWidth = layout.width;
+        header.atlasHeight = layout.height;
+        header.entryCount = static_cast<std::uint32_t>(placements.size());
+        header.entriesOffset = sizeof(GlyphAtlasIndexHeader);
+        header.imageNameOffset = intern(kGlyphAtlasImageName);
+        header.imageNameLength = static_cast<std::uint32_t>(kGlyphAtlasImageName.size());
+
+        const auto width = static_cast<float>((std::max)(layout.width, 1u));
+        const auto height = static_cast<float>((std::max)(layout.height, 1u));
+        std::vector<GlyphAtlasIndexEntry> entries;
+        entries.reserve(placements.size());
+        for (const auto& placement : placements) {
+            GlyphAtlasIndexEntry entry{};
+            entry.platformOffset = intern(placement.platformId);
+            entry.platformLength = static_cast<std::uint32_t>(placement.platformId.size());
+            entry.glyphOffset = intern(placement.glyphId);
+            entry.glyphLength = static_cast<std::uint32_t>(placement.glyphId.size());
+            entry.x = placement.x;
+            entry.y = placement.y;
+            entry.width = placement.width;
+            entry.height = placement.height;
+            entry.u0 = static_cast<float>(placement.x) / width;
+            entry.v0 = static_cast<float>(placement.y) / height;
+            entry.u1 = static_cast<float>(placement.x + placement.width) / width;
+            entry.v1 = static_cast<float>(placement.y + placement.height) / height;
+            entries.push_back(entry);
+        }
+
+        header.stringsOffset = header.entriesOffset + static_cast<std::uint32_t>(entries.size() * sizeof(GlyphAtlasIndexEntry));
+        header.stringsSize = static_cast<std::uint32_t>(strings.size());
+
+        std::vector<std::byte> bytes(header.stringsOffset + strings.size());
+        std::memcpy(bytes.data(), &header, sizeof(header));
+        if (!entries.empty()) {
+            std::memcpy(bytes.data() + header.entriesOffset, entries.data(), entries.size() * sizeof(GlyphAtlasIndexEntry));
+        }
+        if (!strings.empty()) {
+            std::memcpy(bytes.data() + header.stringsOffset, strings.data(), strings.size());
+        }
+        return bytes;
+    }
+
+    // Uncompressed 32-bit DDS the game's Scaleform loads directly. `bgra` is
+    // width * height straight-alpha pixels, top row first.
+    [[nodiscard]] inline std::vector<std::byte> SerializeGlyphAtlasDds(
+        std::uint32_t width,
+        std::uint32_t height,
+        std::span<const std::uint8_t> bgra)
+    {
+        constexpr std::uint32_t kHeaderSize = 124;
+        constexpr std::uint32_t kPixelFormatSize = 32;
+        // DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PITCH | DDSD_PIXELFORMAT
+        constexpr std::uint32_t kHeaderFlags = 0x1 | 0x2 | 0x4 | 0x8 | 0x1000;
+        // DDPF_ALPHAPIXELS | DDPF_RGB
+        constexpr std::uint32_t kPixelFormatFlags = 0x1 | 0x40;
+        constexpr std::uint32_t kCapsTexture = 0x1000;
+
+        std::array<std::uint32_t, 1 + kHeaderSize / 4> header{};
+        std::memcpy(header.data(), "DDS ", 4);
+        header[1] = kHeaderSize;
+        header[2] = kHeaderFlags;
+        header[3] = height;
+        header[4] = width;
+        header[5] = width * 4;
+        // header[6..18]: depth, mip count and reserved stay zero.
+        header[19] = kPixelFormatSize;
+        header[20] = kPixelFormatFlags;
+        header[22] = 32;
+        header[23] = 0x00FF0000u;
+        header[24] = 0x0000FF00u;
+        header[25] = 0x000000FFu;
+        header[26] = 0xFF000000u;
+        header[27] = kCapsTexture;
+
+        const auto pixelBytes = static_cast<std::size_t>(width) * height * 4;
+        std::vector<std::byte> bytes(sizeof(header) + pixelBytes);
+        std::memcpy(bytes.data(), header.data(), sizeof(header));
+        std::memcpy(bytes.data() + sizeof(header), bgra.data(), (std::min)(pixelBytes, bgra.size()));
+        return bytes;
+    }
+
+    // Non-owning, allocation-free reader over a serialized index, e.g. a
+    // mapped file view. Valid only while the bytes are.
+    class GlyphAtlasIndexView
+    {
+    public:
+        GlyphAtlasIndexView() = default;
+
+        // Rejects truncated or foreign data rather than reading past it.
+        [[nodiscard]] static std::optional<GlyphAtlasIndexView> Parse(std::span<const std::byte> bytes)
+        {
+            GlyphAtlasIndexHeader header{};
+            if (bytes.size() < sizeof(header)) {
+                return std::nullopt;
+            }
+            std::memcpy(&header, bytes.data(), sizeof(header));
+            const auto entriesEnd = static_cast<std::uint64_t>(header.entriesOffset) +
+                                    static_cast<std::uint64_t>(header.entryCount) * sizeof(GlyphAtlasIndexEntry);
+            const auto stringsEnd = static_cast<std::uint64_t>(header.stringsOffset) + header.stringsSize;
+            if (header.magic != kGlyphAtlasMagic || header.version != kGlyphAtlasVersion ||
+                header.entriesOffset < sizeof(header) || header.entriesOffset % alignof(GlyphAtlasIndexEntry) != 0 ||
+                entriesEnd > header.stringsOffset || stringsEnd > bytes.size() ||
+                static_cast<std::uint64_t>(header.imageNameOffset) + header.imageNameLength > header.stringsSize) {
+                return std::nullopt;
+            }
+
+            GlyphAtlasIndexView view;
+            view._header = header;
+            view._entries = std::span<const GlyphAtlasIndexEntry>(
+                reinterpret_cast<const GlyphAtlasIndexEntry*>(bytes.data() + header.entriesOffset),
+                header.entryCount);
+            view._strings = std::string_view(
+                reinterpret_cast<const char*>(bytes.data() + header.stringsOffset),
+                header.stringsSize);
+            // Find binary-searches the entries, so they must be strictly
+            // ascending: an unsorted or duplicated key would resolve wrongly.
+            for (std::size_t i = 0; i < view._entries.size(); ++i) {
+                const auto& entry = view._entries[i];
+                if (static_cast<std::uint64_t>(entry.platformOffset) + entry.platformLength > header.stringsSize ||
+                    static_cast<std::uint64_t>(entry.glyphOffset) + entry.glyphLength > header.stringsSize) {
+                    return std::nullopt;
+                }
+                if (i > 0) {
+                    const auto& previous = view._entries[i - 1];
+                    if (!(std::pair{ view.Platform(previous), view.Glyph(previous) } <
+                          std::pair{ view.Platform(entry), view.Glyph(entry) })) {
+                        return std::nullopt;
+                    }
+                }
+            }
+            return view;
+        }
+
+        [[nodiscard]] std::uint32_t AtlasWidth() const { return _header.atlasWidth; }
+        [[nodiscard]] std::uint32_t AtlasHeight() const { return _header.atlasHeight; }
+        [[nodiscard]] std::size_t Size() const { return _entries.size(); }
+        [[nodiscard]] std::string_view ImageName() const
+        {
+            return _strings.substr(_header.imageNameOffset, _header.imageNameLength);
+        }
+
+        [[nodiscard]] std::optional<GlyphAtlasRect> Find(std::string_view platformId, std::string_view glyphId) const
+        {
+            const auto key = std::pair{ platformId, glyphId };
+            const auto it = std::lower_bound(_entries.begin(), _entries.end(), key, [&](const GlyphAtlasIndexEntry& entry, const auto& probe) {
+                return std::pair{ Platform(entry), Glyph(entry) } < probe;
+            });
+            if (it == _entries.end() || Platform(*it) != platformId || Glyph(*it) != glyphId) {
+                return std::nullopt;
+            }
+            return GlyphAtlasRect{
+                .x = it->x,
+                .y = it->y,
+                .width = it->width,
+                .height = it->height,
+                .u0 = it->u0,
+                .v0 = it->v0,
+                .u1 = it->u1,
+                .v1 = it->v1
+            };
+        }
+
+        [[nodiscard]] std::optional<GlyphAtlasRect> FindByAssetLookupPath(std::string_view assetLookupPath) const
+        {
+            const auto ids = SplitGlyphAssetLookupPath(assetLookupPath);
+            return ids ? Find(ids->first, ids->second) : std::nullopt;
+        }
+
+    private:
+        [[nodiscard]] std::string_view Platform(const GlyphAtlasIndexEntry& entry) const
+        {
+            return _strings.substr(entry.platformOffset, entry.platformLength);
+        }
+
+        [[nodiscard]] std::string_view Glyph(const GlyphAtlasIndexEntry& entry) const
+        {
+            return _strings.substr(entry.glyphOffset, entry.glyphLength);
+        }
+
+        GlyphAtlasIndexHeader _header{};
+        std::span<const GlyphAtlasIndexEntry> _entries;
+        std::string_view _strings;
+    };
+}
@@ -0,0 +1,131 @@
+#include "pch.h"
+
+#include "input_v2/prompt/GlyphAtlasIndex.h"
+
+#include <Windows.h>
+
+namespace logger = SKSE::log;
+
+namespace dualpad::input_v2::prompt
+{
+    GlyphAtlasIndex& GlyphAtlasIndex::GetSingleton()
+    {
+        static GlyphAtlasIndex index;
+        return index;
+    }
+
+    GlyphAtlasIndex::~GlyphAtlasIndex()
+    {
+        Close();
+    }
+
+    std::filesystem::path GlyphAtlasIndex::DefaultIndexPath()
+    {
+        return std::filesystem::path("Data") / kGlyphAssetRoot / kGlyphAtlasIndexName;
+    }
+
+    bool GlyphAtlasIndex::Open(const std::filesystem::path& path)
+    {
+        Close();
+
+        const auto indexPath = path.empty() ? DefaultIndexPath() : path;
+        const auto file = ::CreateFileW(
+            indexPath.c_str(),
+            GENERIC_READ,
+            FILE_SHARE_READ,
+            nullptr,
+            OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL,
+            nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            logger::info("[DualPad][GlyphAtlas] No atlas index at {}; using per-glyph assets", indexPath.string());
+            return false;
+        }
+        _file = file;
+
+        LARGE_INTEGER size{};
+        if (!::GetFileSizeEx(file, &size) || size.QuadPart < static_cast<LONGLONG>(sizeof(GlyphAtlasIndexHeader))) {
+            logger::warn("[DualPad][GlyphAtlas] Atlas index {} is truncated", indexPath.string());
+            Close();
+            return false;
+        }
+
+        _mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (_mapping) {
+            _view = ::MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0);
+        }
+        if (!_view) {
+            logger::warn("[DualPad][GlyphAtlas] Failed to map atlas index {}", indexPath.string());
+            Close();
+            return false;
+        }
+
+        const auto parsed = GlyphAtlasIndexView::Parse(std::span<const std::byte>(
+            static_cast<const std::byte*>(_view),
+            static_cast<std::size_t>(size.QuadPart)));
+        if (!parsed) {
+            logger::warn("[DualPad][GlyphAtlas] Atlas index {} failed validation", indexPath.string());
+            Close();
+            return false;
+        }
+
+        _index = *parsed;
+        _open.store(true, std::memory_order_release);
+        logger::info(
+            "[DualPad][GlyphAtlas] Mapped {} glyphs from {} ({}x{})",
+            _index.Size(),
+            indexPath.string(),
+            _index.AtlasWidth(),
+            _index.AtlasHeight());
+        return true;
+    }
+
+    void GlyphAtlasIndex::Close()
+    {
+        _open.store(false, std::memory_order_release);
+        _index = {};
+        if (_view) {
+            ::UnmapViewOfFile(_view);
+            _view = nullptr;
+        }
+        if (_mapping) {
+            ::CloseHandle(_mapping);
+            _mapping = nullptr;
+        }
+        if (_file) {
+            ::CloseHandle(_file);
+            _file = nullptr;
+        }
+    }
+
+    bool GlyphAtlasIndex::IsOpen() const
+    {
+        return _open.load(std::memory_order_acquire);
+    }
+
+    std::optional<GlyphAtlasRect> GlyphAtlasIndex::Resolve(std::string_view assetLookupPath) const
+    {
+        if (!IsOpen()) {
+            return std::nullopt;
+        }
+        return _index.FindByAssetLookupPath(assetLookupPath);
+    }
+
+    std::string GlyphAtlasIndex::AtlasImagePath() const
+    {
+        if (!IsOpen()) {
+            return {};
+        }
+        return std::string(kGlyphAssetRoot) + std::string(_index.ImageName());
+    }
+
+    std::uint32_t GlyphAtlasIndex::AtlasWidth() const
+    {
+        return IsOpen() ? _index.AtlasWidth() : 0;
+    }
+
+    std::uint32_t GlyphAtlasIndex::AtlasHeight() const
+    {
+        return IsOpen() ? _index.AtlasHeight() : 0;
+    }
+}
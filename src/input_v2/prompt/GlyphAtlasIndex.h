@@ -0,0 +1,48 @@
+#pragma once
+
+#include "input_v2/prompt/GlyphAtlasFormat.h"
+
+#include <atomic>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace dualpad::input_v2::prompt
+{
+    // Read-only memory map of the GlyphAtlas.idx written by
+    // DualPadGlyphAtlasGen. Resolving an asset lookup path is a binary search
+    // over the mapped entries; no file I/O after Open. Opened once at data
+    // load, before any menu asks for glyphs; lookups take no lock.
+    class GlyphAtlasIndex
+    {
+    public:
+        static GlyphAtlasIndex& GetSingleton();
+
+        GlyphAtlasIndex() = default;
+        ~GlyphAtlasIndex();
+        GlyphAtlasIndex(const GlyphAtlasIndex&) = delete;
+        GlyphAtlasIndex& operator=(const GlyphAtlasIndex&) = delete;
+
+        static std::filesystem::path DefaultIndexPath();
+
+        // Maps `path` and validates it. A missing or malformed index leaves
+        // the atlas unavailable; callers fall back to per-glyph files.
+        bool Open(const std::filesystem::path& path = {});
+        void Close();
+
+        [[nodiscard]] bool IsOpen() const;
+        [[nodiscard]] std::optional<GlyphAtlasRect> Resolve(std::string_view assetLookupPath) const;
+        // Asset path of the packed atlas image, under kGlyphAssetRoot.
+        [[nodiscard]] std::string AtlasImagePath() const;
+        [[nodiscard]] std::uint32_t AtlasWidth() const;
+        [[nodiscard]] std::uint32_t AtlasHeight() const;
+
+    private:
+        void* _file{ nullptr };
+        void* _mapping{ nullptr };
+        const void* _view{ nullptr };
+        GlyphAtlasIndexView _index{};
+        std::atomic<bool> _open{ false };
+    };
+}
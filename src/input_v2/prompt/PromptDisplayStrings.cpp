@@ -0,0 +1,51 @@
+#include "pch.h"
+
+#include "input_v2/prompt/PromptDisplayStrings.h"
+
+#include "input_v2/prompt/GlyphAtlasFormat.h"
+
+#include <sstream>
+#include <utility>
+
+namespace dualpad::input_v2::prompt
+{
+    namespace
+    {
+        std::string CandidateSource(const actions::CompiledGraphBinding& binding)
+        {
+            std::ostringstream out;
+            out << binding.actionSetId << ':' << binding.bindingId << ':' << binding.legacyOrigin;
+            return out.str();
+        }
+
+        std::string GlyphAssetLookupPath(std::string_view platformId, std::string_view glyphId)
+        {
+            std::ostringstream out;
+            out << kGlyphAssetRoot << platformId << '/' << glyphId << kGlyphAssetExtension;
+            return out.str();
+        }
+    }
+
+    std::shared_ptr<const PromptDisplayStrings> PromptDisplayStrings::Build(
+        const actions::CompiledActionGraph& graph,
+        std::shared_ptr<const actions::CompiledActionGraph> pin)
+    {
+        auto strings = std::shared_ptr<PromptDisplayStrings>(new PromptDisplayStrings());
+        strings->_graph = &graph;
+        strings->_pin = std::move(pin);
+        strings->_entries.reserve(graph.displayBindings.size());
+        for (const auto& display : graph.displayBindings) {
+            const auto* binding = graph.FindBinding(display.bindingId);
+            strings->_entries.push_back(Entry{
+                .source = binding ? strings->Intern(CandidateSource(*binding)) : std::string_view{},
+                .assetLookupPath = strings->Intern(GlyphAssetLookupPath(display.deviceProfile, display.token))
+            });
+        }
+        return strings;
+    }
+
+    std::string_view PromptDisplayStrings::Intern(std::string value)
+    {
+        return *_pool.insert(std::move(value)).first;
+    }
+}
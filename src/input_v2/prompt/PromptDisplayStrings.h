@@ -0,0 +1,48 @@
+#pragma once
+
+#include "input_v2/actions/CompiledActionGraph.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace dualpad::input_v2::prompt
+{
+    // Prompt strings derived from one compiled graph's display bindings,
+    // interned once per graph so PromptCandidate can hold string_views.
+    // Candidate views also point into the graph itself; a table built with
+    // `pin` keeps that graph alive, one built from a bare reference relies on
+    // the caller doing so, as PromptService already does.
+    class PromptDisplayStrings
+    {
+    public:
+        struct Entry
+        {
+            std::string_view source;
+            std::string_view assetLookupPath;
+        };
+
+        static std::shared_ptr<const PromptDisplayStrings> Build(
+            const actions::CompiledActionGraph& graph,
+            std::shared_ptr<const actions::CompiledActionGraph> pin = nullptr);
+
+        [[nodiscard]] const actions::CompiledActionGraph* Graph() const { return _graph; }
+        // Aligned with CompiledActionGraph::displayBindings.
+        [[nodiscard]] const Entry& At(std::size_t displayIndex) const { return _entries[displayIndex]; }
+        [[nodiscard]] std::size_t InternedCount() const { return _pool.size(); }
+
+    private:
+        PromptDisplayStrings() = default;
+
+        std::string_view Intern(std::string value);
+
+        const actions::CompiledActionGraph* _graph{ nullptr };
+        std::shared_ptr<const actions::CompiledActionGraph> _pin;
+        // Node-based so interned views survive rehashing.
+        std::unordered_set<std::string> _pool;
+        std::vector<Entry> _entries;
+    };
+}
@@ -27,10 +27,27 @@ namespace dualpad::input_v2::prompt
             return _published;
         }
 
+        _published = PreviewReadyScope(
+            presentation.family,
+            presentation.uiContextId,
+            presentation.actionSetStack,
+            manifestEpoch);
+        return _published;
+    }
+
+    PublishedPromptScope PromptProjection::PreviewReadyScope(
+        presentation::DeviceFamily family,
+        context::UiContextId uiContextId,
+        const actions::ActionSetStack& actionSetStack,
+        std::uint64_t manifestEpoch) const
+    {
+        PublishedPromptScope next{};
         next.state = PromptScopeState::Ready;
-        next.family = presentation.family;
-        next.uiContextId = presentation.uiContextId;
-        next.actionSetStack = presentation.actionSetStack;
+        next.family = family;
+        next.uiContextId = uiContextId;
+        next.actionSetStack = actionSetStack;
+        next.promptScopeRevision = _published.promptScopeRevision;
+        next.manifestEpoch = manifestEpoch;
 
         const bool changed =
             _published.state != PromptScopeState::Ready ||
@@ -42,9 +59,7 @@ namespace dualpad::input_v2::prompt
         if (changed) {
             next.promptScopeRevision = _published.promptScopeRevision + 1;
         }
-
-        _published = next;
-        return _published;
+        return next;
     }
 
     const PublishedPromptScope& PromptProjection::GetPublishedPromptScope() const
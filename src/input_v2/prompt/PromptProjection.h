@@ -11,6 +11,13 @@ namespace dualpad::input_v2::prompt
         PublishedPromptScope BuildPromptScope(
             const presentation::PublishedPresentationState& presentation,
             std::uint64_t manifestEpoch);
+        // The Ready scope BuildPromptScope would publish for a presentation
+        // with these fields, without publishing it.
+        [[nodiscard]] PublishedPromptScope PreviewReadyScope(
+            presentation::DeviceFamily family,
+            context::UiContextId uiContextId,
+            const actions::ActionSetStack& actionSetStack,
+            std::uint64_t manifestEpoch) const;
 
         const PublishedPromptScope& GetPublishedPromptScope() const;
         void ResetForTests();
@@ -0,0 +1,196 @@
+#include "pch.h"
+
+#include "input_v2/prompt/PromptResolutionTable.h"
+
+#include <utility>
+
+namespace dualpad::input_v2::prompt
+{
+    std::size_t PromptResolutionTable::EntryKeyHash::operator()(const EntryKeyView& key) const
+    {
+        const std::hash<std::string_view> hash;
+        auto seed = hash(key.actionId);
+        seed ^= hash(key.contextName) + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+        seed ^= static_cast<std::size_t>(key.selectorKind) + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+        return seed;
+    }
+
+    std::size_t PromptResolutionTable::EntryKeyHash::operator()(const EntryKey& key) const
+    {
+        return (*this)(EntryKeyEqual::View(key));
+    }
+
+    PromptResolutionTable::EntryKeyView PromptResolutionTable::EntryKeyEqual::View(const EntryKey& key)
+    {
+        return EntryKeyView{
+            .actionId = key.actionId,
+            .selectorKind = key.selectorKind,
+            .contextName = key.contextName
+        };
+    }
+
+    PromptResolutionTable::EntryKeyView PromptResolutionTable::ViewOf(const PromptQuery& query)
+    {
+        // The current-published selector ignores contextName; keep it out of
+        // the key so callers passing stale names share one entry.
+        return EntryKeyView{
+            .actionId = query.actionId,
+            .selectorKind = query.selectorKind,
+            .contextName = query.selectorKind == PromptScopeSelectorKind::ExplicitContextName
+                ? query.contextName
+                : std::string_view{}
+        };
+    }
+
+    void PromptResolutionTable::Bind(const PromptResolutionTableKey& key)
+    {
+        if (_bound == key) {
+            return;
+        }
+        if (!_entries.empty() || !_contextTokens.empty()) {
+            ++_stats.invalidations;
+        }
+        _entries.clear();
+        _contextTokens.clear();
+        _bound = key;
+    }
+
+    void PromptResolutionTable::Rebind(const PromptResolutionTableKey& key)
+    {
+        _bound = key;
+    }
+
+    void PromptResolutionTable::SwapEntries(PromptResolutionTable& other)
+    {
+        _entries.swap(other._entries);
+        _contextTokens.swap(other._contextTokens);
+        std::swap(_bound, other._bound);
+    }
+
+    bool PromptResolutionTable::IsBoundTo(const PromptResolutionTableKey& key) const
+    {
+        return _bound == key;
+    }
+
+    std::shared_ptr<const PromptDescriptor> PromptResolutionTable::Find(const PromptQuery& query)
+    {
+        const auto it = _entries.find(ViewOf(query));
+        if (it == _entries.end()) {
+            ++_stats.misses;
+            return nullptr;
+        }
+        ++_stats.hits;
+        if (it->second->promptScopeRevision != _bound.promptScopeRevision) {
+            auto restamped = std::make_shared<PromptDescriptor>(*it->second);
+            restamped->promptScopeRevision = _bound.promptScopeRevision;
+            it->second = std::move(restamped);
+            ++_stats.restamps;
+        }
+        return it->second;
+    }
+
+    std::shared_ptr<const PromptDescriptor> PromptResolutionTable::Insert(
+        const PromptResolutionTableKey& key,
+        const PromptQuery& query,
+        std::shared_ptr<const PromptDescriptor> descriptor)
+    {
+        if (!descriptor || _bound != key) {
+            return descriptor;
+        }
+
+        const auto view = ViewOf(query);
+        if (const auto it = _entries.find(view); it != _entries.end()) {
+            return it->second;
+        }
+        if (_entries.size() >= kMaxEntries) {
+            ++_stats.overflowMisses;
+            return descriptor;
+        }
+
+        _entries.emplace(
+            EntryKey{
+                .actionId = std::string(view.actionId),
+                .selectorKind = view.selectorKind,
+                .contextName = std::string(view.contextName) },
+            descriptor);
+        return descriptor;
+    }
+
+    std::shared_ptr<const PromptContextGlyphTokens> PromptResolutionTable::FindContextTokens(std::string_view contextName)
+    {
+        const auto it = _contextTokens.find(contextName);
+        if (it == _contextTokens.end()) {
+            return nullptr;
+        }
+        ++_stats.contextTableHits;
+        if (it->second->promptScopeRevision != _bound.promptScopeRevision) {
+            auto restamped = std::make_shared<PromptContextGlyphTokens>(*it->second);
+            restamped->promptScopeRevision = _bound.promptScopeRevision;
+            it->second = std::move(restamped);
+            ++_stats.restamps;
+        }
+        return it->second;
+    }
+
+    std::shared_ptr<const PromptContextGlyphTokens> PromptResolutionTable::InsertContextTokens(
+        const PromptResolutionTableKey& key,
+        std::shared_ptr<const PromptContextGlyphTokens> table)
+    {
+        if (!table || _bound != key) {
+            return table;
+        }
+        if (const auto it = _contextTokens.find(table->contextName); it != _contextTokens.end()) {
+            return it->second;
+        }
+        // Unknown context names are not stored, so the map stays bounded by
+        // the catalog's aliases.
+        if (table->status == PromptQueryStatus::UnknownContext) {
+            return table;
+        }
+        ++_stats.contextTableBuilds;
+        _contextTokens.emplace(table->contextName, table);
+        return table;
+    }
+
+    std::size_t PromptResolutionTable::Merge(const PromptResolutionTable& staged)
+    {
+        if (_bound != staged._bound) {
+            return 0;
+        }
+
+        std::size_t adopted = 0;
+        for (const auto& [key, descriptor] : staged._entries) {
+            if (_entries.size() >= kMaxEntries) {
+                break;
+            }
+            if (_entries.emplace(key, descriptor).second) {
+                ++adopted;
+            }
+        }
+        for (const auto& [name, table] : staged._contextTokens) {
+            if (_contextTokens.emplace(name, table).second) {
+                ++adopted;
+            }
+        }
+
+        ++_stats.prefetchMerges;
+        _stats.prefetchedEntries += adopted;
+        return adopted;
+    }
+
+    void PromptResolutionTable::Clear()
+    {
+        _entries.clear();
+        _contextTokens.clear();
+        _bound = {};
+        _stats = {};
+    }
+
+    PromptResolutionTable::Stats PromptResolutionTable::GetStats() const
+    {
+        auto stats = _stats;
+        stats.entries = _entries.size();
+        stats.contextTables = _contextTokens.size();
+        return stats;
+    }
+}
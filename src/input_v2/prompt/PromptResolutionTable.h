@@ -0,0 +1,137 @@
+#pragma once
+
+#include "input_v2/prompt/PromptService.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace dualpad::input_v2::prompt
+{
+    // Identity of the inputs a PromptService resolves against. Any change
+    // invalidates every memoized descriptor; device family, UI context and
+    // action-set stack are covered by promptScopeRevision.
+    struct PromptResolutionTableKey
+    {
+        const void* catalog{ nullptr };
+        const void* graph{ nullptr };
+        std::uint64_t manifestEpoch{ 0 };
+        std::uint32_t promptScopeRevision{ 0 };
+
+        bool operator==(const PromptResolutionTableKey&) const = default;
+    };
+
+    // Memo of resolved prompt descriptors for one published prompt scope.
+    // Menus query the same few actions on every refresh; after the first
+    // resolve those become a hash probe returning a shared immutable
+    // descriptor. Not thread-safe; the owner serializes access.
+    class PromptResolutionTable
+    {
+    public:
+        // Bounds the table against arbitrary Scaleform action strings; past
+        // this, misses are resolved without being stored.
+        static constexpr std::size_t kMaxEntries = 256;
+
+        struct Stats
+        {
+            std::uint64_t hits{ 0 };
+            std::uint64_t misses{ 0 };
+            std::uint64_t invalidations{ 0 };
+            std::uint64_t overflowMisses{ 0 };
+            std::uint64_t contextTableHits{ 0 };
+            std::uint64_t contextTableBuilds{ 0 };
+            std::uint64_t prefetchMerges{ 0 };
+            std::uint64_t prefetchedEntries{ 0 };
+            std::uint64_t restamps{ 0 };
+            std::size_t entries{ 0 };
+            std::size_t contextTables{ 0 };
+        };
+
+        // Drops every entry when `key` differs from the bound identity.
+        void Bind(const PromptResolutionTableKey& key);
+        // Adopts `key` keeping every entry. Only valid when the entries were
+        // resolved against an identical scope under another revision (a
+        // device family flip back); hits are restamped with the new revision.
+        void Rebind(const PromptResolutionTableKey& key);
+        // Exchanges entries and binding with `other`; stats stay put.
+        void SwapEntries(PromptResolutionTable& other);
+        [[nodiscard]] bool IsBoundTo(const PromptResolutionTableKey& key) const;
+
+        [[nodiscard]] std::shared_ptr<const PromptDescriptor> Find(const PromptQuery& query);
+        // Stores `descriptor` if the table is still bound to `key`; returns
+        // the stored entry, or `descriptor` itself when it was not stored.
+        std::shared_ptr<const PromptDescriptor> Insert(
+            const PromptResolutionTableKey& key,
+            const PromptQuery& query,
+            std::shared_ptr<const PromptDescriptor> descriptor);
+
+        // Per-context glyph token tables share the binding above, so a
+        // manifest epoch or device family change rebuilds them on demand.
+        [[nodiscard]] std::shared_ptr<const PromptContextGlyphTokens> FindContextTokens(std::string_view contextName);
+        std::shared_ptr<const PromptContextGlyphTokens> InsertContextTokens(
+            const PromptResolutionTableKey& key,
+            std::shared_ptr<const PromptContextGlyphTokens> table);
+
+        // Adopts the entries of a table warmed off-thread. Only applies when
+        // both tables are bound to the same key; entries already present
+        // win. Returns the number of descriptors and token tables adopted.
+        std::size_t Merge(const PromptResolutionTable& staged);
+
+        void Clear();
+        [[nodiscard]] Stats GetStats() const;
+
+    private:
+        struct EntryKey
+        {
+            std::string actionId;
+            PromptScopeSelectorKind selectorKind{ PromptScopeSelectorKind::CurrentPublished };
+            std::string contextName;
+        };
+
+        struct EntryKeyView
+        {
+            std::string_view actionId;
+            PromptScopeSelectorKind selectorKind{ PromptScopeSelectorKind::CurrentPublished };
+            std::string_view contextName;
+        };
+
+        struct EntryKeyHash
+        {
+            using is_transparent = void;
+            std::size_t operator()(const EntryKeyView& key) const;
+            std::size_t operator()(const EntryKey& key) const;
+        };
+
+        struct EntryKeyEqual
+        {
+            using is_transparent = void;
+            static EntryKeyView View(const EntryKey& key);
+            static EntryKeyView View(const EntryKeyView& key) { return key; }
+            template <class Lhs, class Rhs>
+            bool operator()(const Lhs& lhs, const Rhs& rhs) const
+            {
+                const auto l = View(lhs);
+                const auto r = View(rhs);
+                return l.selectorKind == r.selectorKind && l.actionId == r.actionId && l.contextName == r.contextName;
+            }
+        };
+
+        static EntryKeyView ViewOf(const PromptQuery& query);
+
+        struct ContextNameHash
+        {
+            using is_transparent = void;
+            std::size_t operator()(std::string_view name) const { return std::hash<std::string_view>{}(name); }
+        };
+
+        std::unordered_map<EntryKey, std::shared_ptr<const PromptDescriptor>, EntryKeyHash, EntryKeyEqual> _entries;
+        std::unordered_map<std::string, std::shared_ptr<const PromptContextGlyphTokens>, ContextNameHash, std::equal_to<>>
+            _contextTokens;
+        PromptResolutionTableKey _bound{};
+        Stats _stats{};
+    };
+}
@@ -5,6 +5,8 @@
 #include "input_v2/actions/CompiledActionGraphPublisher.h"
 #include "input_v2/config/AtomicConfigReloader.h"
 
+#include <algorithm>
+#include <chrono>
 #include <utility>
 
 namespace dualpad::input_v2::prompt
@@ -23,6 +25,59 @@ namespace dualpad::input_v2::prompt
                 .manifestEpoch = scope.manifestEpoch
             };
         }
+
+        bool BaselineMatchesScope(const PromptRuntimeBaseline& baseline, const PublishedPromptScope& scope)
+        {
+            const auto& graph = baseline.graph.graph;
+            return baseline.bundle && graph &&
+                   baseline.bundle->manifestEpoch == baseline.manifestEpoch &&
+                   baseline.configGeneration == baseline.bundle->manifestEpoch &&
+                   baseline.graph.manifestEpoch == baseline.manifestEpoch &&
+                   graph->manifestEpoch == baseline.manifestEpoch &&
+                   scope.manifestEpoch == baseline.manifestEpoch;
+        }
+
+        bool SameBaselineIdentity(const PromptResolutionTableKey& lhs, const PromptResolutionTableKey& rhs)
+        {
+            return lhs.catalog == rhs.catalog && lhs.graph == rhs.graph && lhs.manifestEpoch == rhs.manifestEpoch;
+        }
+
+        // Scopes that resolve identically apart from the revision stamp.
+        bool SameResolvedScope(const PublishedPromptScope& lhs, const PublishedPromptScope& rhs)
+        {
+            return lhs.state == rhs.state &&
+                   lhs.family == rhs.family &&
+                   lhs.uiContextId == rhs.uiContextId &&
+                   lhs.actionSetStack == rhs.actionSetStack &&
+                   lhs.manifestEpoch == rhs.manifestEpoch;
+        }
+
+        presentation::DeviceFamily OtherFamily(presentation::DeviceFamily family)
+        {
+            return family == presentation::DeviceFamily::Gamepad
+                ? presentation::DeviceFamily::KeyboardMouse
+                : presentation::DeviceFamily::Gamepad;
+        }
+
+        double ElapsedUs(std::chrono::steady_clock::time_point start)
+        {
+            return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        std::optional<PromptResolutionTableKey> ResolutionTableKey(
+            const PromptRuntimeBaseline& baseline,
+            const PublishedPromptScope& scope)
+        {
+            if (!BaselineMatchesScope(baseline, scope)) {
+                return std::nullopt;
+            }
+            return PromptResolutionTableKey{
+                .catalog = &baseline.bundle->catalog,
+                .graph = baseline.graph.graph.get(),
+                .manifestEpoch = baseline.manifestEpoch,
+                .promptScopeRevision = scope.promptScopeRevision
+            };
+        }
     }
 
     PromptRuntimeOwner& PromptRuntimeOwner::GetSingleton()
@@ -38,7 +93,171 @@ namespace dualpad::input_v2::prompt
         std::scoped_lock lock(_mutex);
         _lastPresentation = presentation;
         _baseline = std::move(baseline);
-        (void)RefreshScopeForManifestEpochLocked(_baseline->manifestEpoch);
+        const auto scope = RefreshScopeForManifestEpochLocked(_baseline->manifestEpoch);
+        BindResolutionTableLocked(scope);
+        SchedulePrefetchLocked(scope);
+    }
+
+    void PromptRuntimeOwner::PrefetchResolvedContext(
+        const context::ResolvedContextSnapshot& resolved,
+        presentation::DeviceFamily family,
+        PromptRuntimeBaseline baseline)
+    {
+        std::scoped_lock lock(_mutex);
+        if (!_prefetchEnabled || resolved.actionSetStack->scopeAnchorIds.empty()) {
+            return;
+        }
+
+        const auto scope = _projection.PreviewReadyScope(
+            family,
+            resolved.uiContextId,
+            resolved.actionSetStack,
+            baseline.manifestEpoch);
+        const auto key = ResolutionTableKey(baseline, scope);
+        if (!key || key == _resolutionKey || key == _prefetchKey) {
+            return;
+        }
+        ScheduleWarmLocked(*key, scope, baseline);
+    }
+
+    void PromptRuntimeOwner::SchedulePrefetchLocked(const PublishedPromptScope& scope)
+    {
+        if (!_prefetchEnabled || !_resolutionKey || _prefetchKey == _resolutionKey ||
+            scope.state != PromptScopeState::Ready) {
+            return;
+        }
+        ScheduleWarmLocked(*_resolutionKey, scope, *_baseline);
+    }
+
+    void PromptRuntimeOwner::ScheduleWarmLocked(
+        const PromptResolutionTableKey& key,
+        const PublishedPromptScope& scope,
+        const PromptRuntimeBaseline& baseline)
+    {
+        // Once the player has flipped device family, keep the other family's
+        // table for this scope prebuilt too.
+        std::optional<PublishedPromptScope> standbyScope;
+        if (_familySwitch.switches != 0) {
+            auto alternate = scope;
+            alternate.family = OtherFamily(scope.family);
+            // Ahead of a publish, the scope still bound becomes the standby.
+            const bool boundServes = _boundScope && _resolutionKey != key &&
+                SameBaselineIdentity(*_resolutionKey, key) && SameResolvedScope(*_boundScope, alternate);
+            if (!StandbyServesLocked(key, alternate) && !boundServes) {
+                standbyScope = std::move(alternate);
+            }
+        }
+
+        _prefetchKey = key;
+        _warmedAhead.reset();
+        _prefetcher.Schedule(PromptScopePrefetcher::Request{
+            .key = key,
+            .scope = scope,
+            .bundle = baseline.bundle,
+            .graph = baseline.graph.graph,
+            .strings = DisplayStringsLocked(baseline),
+            .standbyScope = std::move(standbyScope)
+        });
+    }
+
+    void PromptRuntimeOwner::AdoptPrefetched(PromptScopePrefetcher::Warmed&& warmed)
+    {
+        std::scoped_lock lock(_mutex);
+        if (_resolutionKey && warmed.table.IsBoundTo(*_resolutionKey)) {
+            AdoptWarmedLocked(warmed);
+        } else if (_prefetchKey && warmed.table.IsBoundTo(*_prefetchKey)) {
+            // Warmed from a transition frame ahead of its publish.
+            _warmedAhead = std::move(warmed);
+        }
+        // Otherwise a scope published after the request was queued has
+        // already rebound the table and the warm-up is stale.
+    }
+
+    void PromptRuntimeOwner::AdoptWarmedLocked(PromptScopePrefetcher::Warmed& warmed)
+    {
+        (void)_resolutionTable.Merge(warmed.table);
+        if (warmed.standbyScope && _resolutionKey && warmed.standbyTable.IsBoundTo(*_resolutionKey) &&
+            !StandbyServesLocked(*_resolutionKey, *warmed.standbyScope)) {
+            _standbyTable.SwapEntries(warmed.standbyTable);
+            _standby = StandbyResolution{ .key = *_resolutionKey, .scope = std::move(*warmed.standbyScope) };
+        }
+    }
+
+    bool PromptRuntimeOwner::StandbyServesLocked(
+        const PromptResolutionTableKey& key,
+        const PublishedPromptScope& scope) const
+    {
+        return _standby && SameBaselineIdentity(_standby->key, key) && SameResolvedScope(_standby->scope, scope);
+    }
+
+    void PromptRuntimeOwner::BindResolutionTableLocked(const PublishedPromptScope& scope)
+    {
+        const auto key = _baseline ? ResolutionTableKey(*_baseline, scope) : std::nullopt;
+        if (key && key == _resolutionKey && _resolutionTable.IsBoundTo(*key)) {
+            return;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        const bool familySwitch = key && _boundScope && _boundScope->family != scope.family;
+        const bool sameBaseline = key && _resolutionKey && SameBaselineIdentity(*key, *_resolutionKey);
+        std::optional<StandbyResolution> outgoing;
+        if (sameBaseline && _boundScope && _boundScope->state == PromptScopeState::Ready) {
+            outgoing = StandbyResolution{ .key = *_resolutionKey, .scope = *_boundScope };
+        }
+
+        if (key && StandbyServesLocked(*key, scope)) {
+            // Flip back to a scope resolved before: swap the tables and
+            // restamp, instead of re-resolving every glyph.
+            _resolutionTable.SwapEntries(_standbyTable);
+            _resolutionTable.Rebind(*key);
+            _standby = std::move(outgoing);
+            _prefetchKey = key;
+            ++_familySwitch.standbyRestores;
+        } else {
+            if (outgoing) {
+                _resolutionTable.SwapEntries(_standbyTable);
+                _standby = std::move(outgoing);
+            } else if (!sameBaseline) {
+                _standbyTable.Clear();
+                _standby.reset();
+            }
+            // An inconsistent baseline still drops the old entries so a later
+            // graph allocated at the same address cannot hit them.
+            _resolutionTable.Bind(key.value_or(PromptResolutionTableKey{}));
+        }
+        _resolutionKey = key;
+        _boundScope = key ? std::optional(scope) : std::nullopt;
+        if (key && _warmedAhead && _warmedAhead->table.IsBoundTo(*key)) {
+            AdoptWarmedLocked(*_warmedAhead);
+            _warmedAhead.reset();
+        }
+
+        if (familySwitch) {
+            RecordFamilySwitchLocked(scope.promptScopeRevision, ElapsedUs(start));
+        }
+    }
+
+    void PromptRuntimeOwner::RecordFamilySwitchLocked(std::uint32_t promptScopeRevision, double costUs)
+    {
+        const auto now = std::chrono::steady_clock::now();
+        if (_familySwitch.switches != 0 && now - _lastFamilySwitchAt < kRapidFamilySwitchWindow) {
+            ++_familySwitch.rapidSwitches;
+        }
+        ++_familySwitch.switches;
+        _lastFamilySwitchAt = now;
+        _familySwitchRevision = promptScopeRevision;
+        _familySwitch.lastSwitchUs = 0.0;
+        AddFamilySwitchCostLocked(promptScopeRevision, costUs);
+    }
+
+    void PromptRuntimeOwner::AddFamilySwitchCostLocked(std::uint32_t promptScopeRevision, double costUs)
+    {
+        if (_familySwitchRevision != promptScopeRevision) {
+            return;
+        }
+        _familySwitch.lastSwitchUs += costUs;
+        _familySwitch.totalSwitchUs += costUs;
+        _familySwitch.maxSwitchUs = (std::max)(_familySwitch.maxSwitchUs, _familySwitch.lastSwitchUs);
     }
 
     PublishedPromptScope PromptRuntimeOwner::RefreshScopeForManifestEpochLocked(std::uint64_t manifestEpoch)
@@ -49,50 +268,77 @@ namespace dualpad::input_v2::prompt
         return _projection.BuildPromptScope(*_lastPresentation, manifestEpoch);
     }
 
+    std::shared_ptr<const PromptDisplayStrings> PromptRuntimeOwner::DisplayStringsLocked(const PromptRuntimeBaseline& baseline)
+    {
+        if (!_displayStrings || _displayStrings->Graph() != baseline.graph.graph.get()) {
+            _displayStrings = PromptDisplayStrings::Build(*baseline.graph.graph, baseline.graph.graph);
+        }
+        return _displayStrings;
+    }
+
     PromptDescriptor PromptRuntimeOwner::Resolve(const PromptQuery& query)
+    {
+        return *ResolveShared(query);
+    }
+
+    std::shared_ptr<const PromptDescriptor> PromptRuntimeOwner::ResolveShared(const PromptQuery& query)
     {
         PromptRuntimeBaseline baseline{};
         PublishedPromptScope scope{};
+        std::optional<PromptResolutionTableKey> key;
+        std::shared_ptr<const PromptDisplayStrings> strings;
         {
             std::scoped_lock lock(_mutex);
             if (!_baseline) {
                 scope = _projection.GetPublishedPromptScope();
-                return ScopeUnavailableDescriptor(query, scope);
+                return std::make_shared<const PromptDescriptor>(ScopeUnavailableDescriptor(query, scope));
+            }
+            if (_resolutionKey) {
+                if (auto memo = _resolutionTable.Find(query)) {
+                    return memo;
+                }
             }
             baseline = *_baseline;
             scope = RefreshScopeForManifestEpochLocked(baseline.manifestEpoch);
+            BindResolutionTableLocked(scope);
+            key = _resolutionKey;
+            if (key) {
+                strings = DisplayStringsLocked(baseline);
+            }
         }
 
-        const auto graph = baseline.graph.graph;
-        if (!baseline.bundle || !graph ||
-            baseline.bundle->manifestEpoch != baseline.manifestEpoch ||
-            baseline.configGeneration != baseline.bundle->manifestEpoch ||
-            baseline.graph.manifestEpoch != baseline.manifestEpoch ||
-            graph->manifestEpoch != baseline.manifestEpoch ||
-            scope.manifestEpoch != baseline.manifestEpoch) {
-            return ScopeUnavailableDescriptor(query, scope);
+        if (!key) {
+            return std::make_shared<const PromptDescriptor>(ScopeUnavailableDescriptor(query, scope));
         }
 
-        PromptService service(baseline.bundle->catalog, *graph, scope);
-        return service.Resolve(query);
+        const auto start = std::chrono::steady_clock::now();
+        PromptService service(baseline.bundle->catalog, *baseline.graph.graph, scope, std::move(strings));
+        auto descriptor = std::make_shared<const PromptDescriptor>(service.Resolve(query));
+        const auto costUs = ElapsedUs(start);
+
+        // A publish that landed while resolving rebinds the table; the
+        // descriptor is still correct for this call but is not stored.
+        std::scoped_lock lock(_mutex);
+        AddFamilySwitchCostLocked(key->promptScopeRevision, costUs);
+        return _resolutionTable.Insert(*key, query, std::move(descriptor));
     }
 
     PromptSnapshotRecord PromptRuntimeOwner::Snapshot(const PromptQuery& query)
     {
-        return MakePromptSnapshotRecord(query, Resolve(query));
+        return MakePromptSnapshotRecord(query, *ResolveShared(query));
     }
 
     std::string PromptRuntimeOwner::ResolveLegacyGlyphToken(
         std::string_view actionId,
         std::string_view contextName)
     {
-        const auto descriptor = Resolve(PromptQuery{
+        const auto descriptor = ResolveShared(PromptQuery{
             .actionId = actionId,
             .selectorKind = PromptScopeSelectorKind::ExplicitContextName,
             .contextName = contextName
         });
-        if (descriptor.ok && descriptor.primary) {
-            return descriptor.primary->token;
+        if (descriptor->ok && descriptor->primary) {
+            return std::string(descriptor->primary->token);
         }
         return {};
     }
@@ -106,7 +352,70 @@ namespace dualpad::input_v2::prompt
             .selectorKind = PromptScopeSelectorKind::ExplicitContextName,
             .contextName = contextName
         };
-        return MakePromptLegacyGlyphDescriptor(query, Resolve(query));
+        return MakePromptLegacyGlyphDescriptor(query, *ResolveShared(query));
+    }
+
+    std::shared_ptr<const PromptContextGlyphTokens> PromptRuntimeOwner::ResolveContextGlyphTokens(
+        std::string_view contextName)
+    {
+        PromptRuntimeBaseline baseline{};
+        PublishedPromptScope scope{};
+        std::optional<PromptResolutionTableKey> key;
+        std::shared_ptr<const PromptDisplayStrings> strings;
+        {
+            std::scoped_lock lock(_mutex);
+            if (_baseline && _resolutionKey) {
+                if (auto memo = _resolutionTable.FindContextTokens(contextName)) {
+                    return memo;
+                }
+            }
+            if (_baseline) {
+                baseline = *_baseline;
+                scope = RefreshScopeForManifestEpochLocked(baseline.manifestEpoch);
+                BindResolutionTableLocked(scope);
+                key = _resolutionKey;
+                if (key) {
+                    strings = DisplayStringsLocked(baseline);
+                }
+            } else {
+                scope = _projection.GetPublishedPromptScope();
+            }
+        }
+
+        if (!key) {
+            return std::make_shared<const PromptContextGlyphTokens>(PromptContextGlyphTokens{
+                .status = PromptQueryStatus::ScopeUnavailable,
+                .contextName = std::string(contextName),
+                .promptScopeRevision = scope.promptScopeRevision,
+                .manifestEpoch = scope.manifestEpoch
+            });
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        PromptService service(baseline.bundle->catalog, *baseline.graph.graph, scope, std::move(strings));
+        auto table = std::make_shared<const PromptContextGlyphTokens>(service.ResolveContextGlyphTokens(contextName));
+        const auto costUs = ElapsedUs(start);
+
+        std::scoped_lock lock(_mutex);
+        AddFamilySwitchCostLocked(key->promptScopeRevision, costUs);
+        return _resolutionTable.InsertContextTokens(*key, std::move(table));
+    }
+
+    PromptResolutionTable::Stats PromptRuntimeOwner::GetResolutionStats() const
+    {
+        std::scoped_lock lock(_mutex);
+        return _resolutionTable.GetStats();
+    }
+
+    PromptRuntimeOwner::FamilySwitchStats PromptRuntimeOwner::GetFamilySwitchStats() const
+    {
+        std::scoped_lock lock(_mutex);
+        return _familySwitch;
+    }
+
+    PromptScopePrefetcher::Stats PromptRuntimeOwner::GetPrefetchStats() const
+    {
+        return _prefetcher.GetStats();
     }
 
     PublishedPromptScope PromptRuntimeOwner::GetPublishedPromptScopeForTests()
@@ -115,11 +424,41 @@ namespace dualpad::input_v2::prompt
         return _projection.GetPublishedPromptScope();
     }
 
+    void PromptRuntimeOwner::WaitForPrefetchForTests()
+    {
+        _prefetcher.WaitIdle();
+    }
+
+    bool PromptRuntimeOwner::WaitForPrefetchForTests(std::chrono::microseconds timeout)
+    {
+        return _prefetcher.WaitIdleFor(timeout);
+    }
+
+    void PromptRuntimeOwner::SetScopePrefetchEnabledForTests(bool enabled)
+    {
+        std::scoped_lock lock(_mutex);
+        _prefetchEnabled = enabled;
+    }
+
     void PromptRuntimeOwner::ResetForTests()
     {
+        // Outside _mutex: an in-flight warm-up delivers through it.
+        _prefetcher.CancelAndWait();
         std::scoped_lock lock(_mutex);
         _lastPresentation.reset();
         _baseline.reset();
         _projection.ResetForTests();
+        _resolutionTable.Clear();
+        _resolutionKey.reset();
+        _displayStrings.reset();
+        _prefetchKey.reset();
+        _warmedAhead.reset();
+        _prefetchEnabled = true;
+        _standbyTable.Clear();
+        _standby.reset();
+        _boundScope.reset();
+        _familySwitch = {};
+        _familySwitchRevision.reset();
+        _lastFamilySwitchAt = {};
     }
 }
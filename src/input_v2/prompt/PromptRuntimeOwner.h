@@ -3,8 +3,11 @@
 #include "input_v2/actions/CompiledActionGraphPublisher.h"
 #include "input_v2/presentation/PresentationProjection.h"
 #include "input_v2/prompt/PromptProjection.h"
+#include "input_v2/prompt/PromptResolutionTable.h"
+#include "input_v2/prompt/PromptScopePrefetcher.h"
 #include "input_v2/prompt/PromptService.h"
 
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <mutex>
@@ -28,13 +31,40 @@ namespace dualpad::input_v2::prompt
     class PromptRuntimeOwner
     {
     public:
+        // Flips closer together than this count as rapid; players who
+        // alternate keyboard/mouse and pad land here.
+        static constexpr std::chrono::milliseconds kRapidFamilySwitchWindow{ 5000 };
+
+        struct FamilySwitchStats
+        {
+            std::uint64_t switches{ 0 };
+            // Flips served by swapping in the other family's prebuilt table.
+            std::uint64_t standbyRestores{ 0 };
+            std::uint64_t rapidSwitches{ 0 };
+            // Calling-thread cost of a flip: the rebind plus every resolve
+            // that missed under the new revision until the next scope change.
+            double lastSwitchUs{ 0.0 };
+            double maxSwitchUs{ 0.0 };
+            double totalSwitchUs{ 0.0 };
+        };
+
         static PromptRuntimeOwner& GetSingleton();
 
         void PublishPresentationState(
             const presentation::PublishedPresentationState& presentation,
             PromptRuntimeBaseline baseline);
+        // Starts warming the scope a context being entered will publish,
+        // from its resolved snapshot, before the stable frame that publishes
+        // it. The warmed table is held until that scope binds.
+        void PrefetchResolvedContext(
+            const context::ResolvedContextSnapshot& resolved,
+            presentation::DeviceFamily family,
+            PromptRuntimeBaseline baseline);
 
         [[nodiscard]] PromptDescriptor Resolve(const PromptQuery& query);
+        // Memoized per published prompt scope; repeat queries share one
+        // immutable descriptor until the scope revision or baseline changes.
+        [[nodiscard]] std::shared_ptr<const PromptDescriptor> ResolveShared(const PromptQuery& query);
         [[nodiscard]] PromptSnapshotRecord Snapshot(const PromptQuery& query);
         [[nodiscard]] std::string ResolveLegacyGlyphToken(
             std::string_view actionId,
@@ -43,17 +73,73 @@ namespace dualpad::input_v2::prompt
             std::string_view actionId,
             std::string_view contextName);
 
+        // All renderable legacy tokens for `contextName`, built once per
+        // published prompt scope and shared until the scope changes.
+        [[nodiscard]] std::shared_ptr<const PromptContextGlyphTokens> ResolveContextGlyphTokens(
+            std::string_view contextName);
+
+        [[nodiscard]] PromptResolutionTable::Stats GetResolutionStats() const;
+        [[nodiscard]] PromptScopePrefetcher::Stats GetPrefetchStats() const;
+        [[nodiscard]] FamilySwitchStats GetFamilySwitchStats() const;
         [[nodiscard]] PublishedPromptScope GetPublishedPromptScopeForTests();
+        // Blocks until the scope warmed for the last publish has been merged.
+        void WaitForPrefetchForTests();
+        // Same, giving up after `timeout`; false if the warm-up is still running.
+        bool WaitForPrefetchForTests(std::chrono::microseconds timeout);
+        // Keeps memo-table counters deterministic; ResetForTests re-enables.
+        void SetScopePrefetchEnabledForTests(bool enabled);
         void ResetForTests();
 
     private:
         PromptRuntimeOwner() = default;
 
         [[nodiscard]] PublishedPromptScope RefreshScopeForManifestEpochLocked(std::uint64_t manifestEpoch);
+        void BindResolutionTableLocked(const PublishedPromptScope& scope);
+        [[nodiscard]] std::shared_ptr<const PromptDisplayStrings> DisplayStringsLocked(const PromptRuntimeBaseline& baseline);
+        void SchedulePrefetchLocked(const PublishedPromptScope& scope);
+        void ScheduleWarmLocked(
+            const PromptResolutionTableKey& key,
+            const PublishedPromptScope& scope,
+            const PromptRuntimeBaseline& baseline);
+        void AdoptPrefetched(PromptScopePrefetcher::Warmed&& warmed);
+        void AdoptWarmedLocked(PromptScopePrefetcher::Warmed& warmed);
+        [[nodiscard]] bool StandbyServesLocked(const PromptResolutionTableKey& key, const PublishedPromptScope& scope) const;
+        void RecordFamilySwitchLocked(std::uint32_t promptScopeRevision, double costUs);
+        void AddFamilySwitchCostLocked(std::uint32_t promptScopeRevision, double costUs);
+
+        // Identity of the table parked in _standbyTable.
+        struct StandbyResolution
+        {
+            PromptResolutionTableKey key{};
+            PublishedPromptScope scope{};
+        };
 
         mutable std::mutex _mutex;
         PromptProjection _projection;
         std::optional<presentation::PublishedPresentationState> _lastPresentation;
         std::optional<PromptRuntimeBaseline> _baseline;
+        PromptResolutionTable _resolutionTable;
+        std::optional<PromptResolutionTableKey> _resolutionKey;
+        std::optional<PublishedPromptScope> _boundScope;
+        // The previously bound scope of the same baseline, or the other
+        // device family's prebuilt table; a flip back swaps it in.
+        PromptResolutionTable _standbyTable;
+        std::optional<StandbyResolution> _standby;
+        FamilySwitchStats _familySwitch{};
+        std::optional<std::uint32_t> _familySwitchRevision;
+        std::chrono::steady_clock::time_point _lastFamilySwitchAt{};
+        // Interned candidate strings for the baseline graph; rebuilt when a
+        // new graph is published and pins the graph for every descriptor.
+        std::shared_ptr<const PromptDisplayStrings> _displayStrings;
+        // Key of the last scope handed to the prefetcher, so republishing an
+        // unchanged scope every frame does not requeue it.
+        std::optional<PromptResolutionTableKey> _prefetchKey;
+        // A scope warmed from a transition frame that finished before the
+        // scope was published.
+        std::optional<PromptScopePrefetcher::Warmed> _warmedAhead;
+        bool _prefetchEnabled{ true };
+        // Declared last: its worker calls back into this owner and must be
+        // joined before the members above are destroyed.
+        PromptScopePrefetcher _prefetcher{ [this](PromptScopePrefetcher::Warmed&& warmed) { AdoptPrefetched(std::move(warmed)); } };
     };
 }
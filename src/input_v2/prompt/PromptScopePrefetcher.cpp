@@ -0,0 +1,169 @@
+#include "pch.h"
+
+#include "input_v2/prompt/PromptScopePrefetcher.h"
+
+#include "input_v2/config/AtomicConfigReloader.h"
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace dualpad::input_v2::prompt
+{
+    namespace
+    {
+        // Every name a menu may pass for the scope's own context: the
+        // canonical name first, then its legacy aliases.
+        std::vector<std::string_view> WarmContextNames(
+            const context::CompiledContextCatalog& catalog,
+            context::UiContextId uiContextId)
+        {
+            std::vector<std::string_view> names;
+            const auto* entry = context::ContextCatalog::FindById(catalog, uiContextId);
+            if (!entry) {
+                return names;
+            }
+            names.push_back(entry->canonicalContextName);
+            for (const auto& alias : entry->aliases) {
+                if ((std::find)(names.begin(), names.end(), alias) == names.end()) {
+                    names.push_back(alias);
+                }
+            }
+            return names;
+        }
+
+        void WarmDescriptors(
+            PromptResolutionTable& table,
+            const PromptService& service,
+            const PromptResolutionTableKey& key,
+            PromptScopeSelectorKind selectorKind,
+            std::string_view contextName)
+        {
+            for (const auto actionId : service.DisplayableActionIds(selectorKind, contextName)) {
+                if (table.GetStats().entries >= PromptScopePrefetcher::kMaxWarmEntries) {
+                    return;
+                }
+                const PromptQuery query{
+                    .actionId = actionId,
+                    .selectorKind = selectorKind,
+                    .contextName = contextName
+                };
+                (void)table.Insert(key, query, std::make_shared<const PromptDescriptor>(service.Resolve(query)));
+            }
+        }
+    }
+
+    void PromptScopePrefetcher::WarmScope(
+        PromptResolutionTable& table,
+        const Request& request,
+        const PublishedPromptScope& scope)
+    {
+        table.Bind(request.key);
+        if (!request.bundle || !request.graph || scope.state != PromptScopeState::Ready) {
+            return;
+        }
+
+        const auto& catalog = request.bundle->catalog;
+        const PromptService service(catalog, *request.graph, scope, request.strings);
+        WarmDescriptors(table, service, request.key, PromptScopeSelectorKind::CurrentPublished, {});
+        for (const auto name : WarmContextNames(catalog, scope.uiContextId)) {
+            WarmDescriptors(table, service, request.key, PromptScopeSelectorKind::ExplicitContextName, name);
+            (void)table.InsertContextTokens(
+                request.key,
+                std::make_shared<const PromptContextGlyphTokens>(service.ResolveContextGlyphTokens(name)));
+        }
+    }
+
+    PromptScopePrefetcher::PromptScopePrefetcher(Sink sink) :
+        _sink(std::move(sink))
+    {}
+
+    PromptScopePrefetcher::~PromptScopePrefetcher()
+    {
+        if (_thread.joinable()) {
+            _thread.request_stop();
+            _thread.join();
+        }
+    }
+
+    void PromptScopePrefetcher::Schedule(Request request)
+    {
+        {
+            std::scoped_lock lock(_mutex);
+            ++_stats.scheduled;
+            if (_pending) {
+                ++_stats.superseded;
+            }
+            _pending = std::move(request);
+            if (!_thread.joinable()) {
+                _thread = std::jthread([this](std::stop_token stop) { WorkerLoop(stop); });
+            }
+        }
+        _wake.notify_one();
+    }
+
+    void PromptScopePrefetcher::CancelAndWait()
+    {
+        std::unique_lock lock(_mutex);
+        _pending.reset();
+        _idle.wait(lock, [this] { return !_busy; });
+    }
+
+    void PromptScopePrefetcher::WaitIdle()
+    {
+        std::unique_lock lock(_mutex);
+        _idle.wait(lock, [this] { return !_busy && !_pending; });
+    }
+
+    bool PromptScopePrefetcher::WaitIdleFor(std::chrono::microseconds timeout)
+    {
+        std::unique_lock lock(_mutex);
+        return _idle.wait_for(lock, timeout, [this] { return !_busy && !_pending; });
+    }
+
+    PromptScopePrefetcher::Stats PromptScopePrefetcher::GetStats() const
+    {
+        std::scoped_lock lock(_mutex);
+        return _stats;
+    }
+
+    PromptScopePrefetcher::Warmed PromptScopePrefetcher::Warm(const Request& request)
+    {
+        Warmed warmed{};
+        WarmScope(warmed.table, request, request.scope);
+        if (request.standbyScope) {
+            warmed.standbyScope = request.standbyScope;
+            WarmScope(warmed.standbyTable, request, *request.standbyScope);
+        }
+        return warmed;
+    }
+
+    void PromptScopePrefetcher::WorkerLoop(std::stop_token stop)
+    {
+        while (true) {
+            std::optional<Request> request;
+            {
+                std::unique_lock lock(_mutex);
+                if (!_wake.wait(lock, stop, [this] { return _pending.has_value(); })) {
+                    return;
+                }
+                request = std::move(_pending);
+                _pending.reset();
+                _busy = true;
+            }
+
+            // Delivered outside _mutex; the sink takes the owner's lock. The
+            // request's pins are released before reporting idle.
+            _sink(Warm(*request));
+            request.reset();
+
+            {
+                std::scoped_lock lock(_mutex);
+                ++_stats.completed;
+                _busy = false;
+            }
+            _idle.notify_all();
+        }
+    }
+}
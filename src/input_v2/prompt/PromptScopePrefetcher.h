@@ -0,0 +1,99 @@
+#pragma once
+
+#include "input_v2/prompt/PromptResolutionTable.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+namespace dualpad::input_v2::config
+{
+    struct CompiledConfigBundle;
+}
+
+namespace dualpad::input_v2::prompt
+{
+    // Warms a PromptResolutionTable for a freshly published prompt scope on
+    // a background worker, so a menu's first rendered frame finds its
+    // descriptors and context token tables already memoized instead of
+    // resolving them on the main thread. Requests are latest-wins: a scope
+    // published before the worker picks up the previous one replaces it.
+    class PromptScopePrefetcher
+    {
+    public:
+        // Warming stops at this many descriptors so prefetch never crowds
+        // out entries the menu itself asks for.
+        static constexpr std::size_t kMaxWarmEntries = PromptResolutionTable::kMaxEntries / 2;
+
+        struct Request
+        {
+            PromptResolutionTableKey key{};
+            PublishedPromptScope scope{};
+            // Pin the catalog and graph the key points at.
+            std::shared_ptr<const config::CompiledConfigBundle> bundle;
+            std::shared_ptr<const actions::CompiledActionGraph> graph;
+            std::shared_ptr<const PromptDisplayStrings> strings;
+            // Same scope under the other device family, warmed into a
+            // separate table so a later family flip is a table swap.
+            std::optional<PublishedPromptScope> standbyScope;
+        };
+
+        struct Warmed
+        {
+            PromptResolutionTable table;
+            std::optional<PublishedPromptScope> standbyScope;
+            PromptResolutionTable standbyTable;
+        };
+
+        struct Stats
+        {
+            std::uint64_t scheduled{ 0 };
+            std::uint64_t superseded{ 0 };
+            std::uint64_t completed{ 0 };
+        };
+
+        // Receives each warmed result on the worker thread.
+        using Sink = std::function<void(Warmed&&)>;
+
+        explicit PromptScopePrefetcher(Sink sink);
+        ~PromptScopePrefetcher();
+
+        PromptScopePrefetcher(const PromptScopePrefetcher&) = delete;
+        PromptScopePrefetcher& operator=(const PromptScopePrefetcher&) = delete;
+
+        void Schedule(Request request);
+        // Drops any pending request and blocks until the in-flight one, if
+        // any, has been delivered. Must not be called while holding a lock
+        // the sink takes.
+        void CancelAndWait();
+        // Blocks until every scheduled request has been delivered.
+        void WaitIdle();
+        // WaitIdle bounded by `timeout`; false if the worker is still busy.
+        bool WaitIdleFor(std::chrono::microseconds timeout);
+        [[nodiscard]] Stats GetStats() const;
+
+        // Builds the warmed tables for `request` on the calling thread.
+        [[nodiscard]] static Warmed Warm(const Request& request);
+
+    private:
+        static void WarmScope(PromptResolutionTable& table, const Request& request, const PublishedPromptScope& scope);
+        void WorkerLoop(std::stop_token stop);
+
+        Sink _sink;
+        mutable std::mutex _mutex;
+        std::condition_variable_any _wake;
+        std::condition_variable _idle;
+        std::optional<Request> _pending;
+        bool _busy{ false };
+        Stats _stats{};
+        // Started on the first request; declared last so it is joined before
+        // the state above is destroyed.
+        std::jthread _thread;
+    };
+}
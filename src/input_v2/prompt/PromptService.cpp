@@ -3,17 +3,17 @@
 #include "input_v2/prompt/PromptService.h"
 
 #include <algorithm>
-#include <sstream>
 
 namespace dualpad::input_v2::prompt
 {
     namespace
     {
-        bool IsKnownAction(const actions::CompiledActionGraph& graph, std::string_view actionId)
+        const actions::ActionDefinition* FindAction(const actions::CompiledActionGraph& graph, std::string_view actionId)
         {
-            return std::find_if(graph.actions.begin(), graph.actions.end(), [&](const actions::ActionDefinition& action) {
+            const auto it = std::find_if(graph.actions.begin(), graph.actions.end(), [&](const actions::ActionDefinition& action) {
                 return action.id == actionId;
-            }) != graph.actions.end();
+            });
+            return it == graph.actions.end() ? nullptr : &*it;
         }
 
         bool IsPrefixOf(const std::vector<std::string>& requested, const std::vector<std::string>& current)
@@ -50,6 +50,38 @@ namespace dualpad::input_v2::prompt
             return it == graph.displayBindings.end() ? nullptr : &*it;
         }
 
+        std::vector<std::string> ExplicitScopeAnchorIds(
+            std::string_view contextName,
+            const context::CompiledContextEntry& entry)
+        {
+            if (contextName == "Menu") {
+                return { "MenuBase" };
+            }
+            return entry.scopeAnchorIds;
+        }
+
+        std::vector<std::string_view> CollectDisplayableActionIds(
+            const actions::CompiledActionGraph& graph,
+            const std::vector<std::string>& scopeAnchorIds)
+        {
+            std::vector<std::string_view> actionIds;
+            for (const auto& anchorId : scopeAnchorIds) {
+                const auto bindingIt = graph.lookups.bindingIdsByActionSetId.find(anchorId);
+                if (bindingIt == graph.lookups.bindingIdsByActionSetId.end()) {
+                    continue;
+                }
+                for (const auto bindingId : bindingIt->second) {
+                    const auto* binding = graph.FindBinding(bindingId);
+                    if (binding && FindDisplayBinding(graph, bindingId)) {
+                        actionIds.push_back(binding->actionId);
+                    }
+                }
+            }
+            (std::sort)(actionIds.begin(), actionIds.end());
+            actionIds.erase(std::unique(actionIds.begin(), actionIds.end()), actionIds.end());
+            return actionIds;
+        }
+
         std::string ContextIdString(context::UiContextId id)
         {
             return std::to_string(static_cast<std::uint16_t>(id));
@@ -73,38 +105,22 @@ namespace dualpad::input_v2::prompt
             };
         }
 
-        std::string CandidateSource(const actions::CompiledGraphBinding& binding)
-        {
-            std::ostringstream out;
-            out << binding.actionSetId << ':' << binding.bindingId << ':' << binding.legacyOrigin;
-            return out.str();
-        }
-
-        std::string GlyphAssetLookupPath(std::string_view platformId, std::string_view glyphId)
-        {
-            std::ostringstream out;
-            out << "Interface/Exported/DualPad/Glyphs/" << platformId << '/' << glyphId << ".svg";
-            return out.str();
-        }
-
         PromptCandidate MakePromptCandidate(
-            const actions::CompiledGraphBinding& binding,
-            const actions::DisplayBindingRecord& display)
+            const actions::DisplayBindingRecord& display,
+            const PromptDisplayStrings::Entry& strings)
         {
-            const auto glyphId = display.token;
-            const auto platformId = display.deviceProfile;
-            const auto fallbackText = display.localizedLabel.empty() ? display.token : display.localizedLabel;
+            const std::string_view fallbackText = display.localizedLabel.empty() ? display.token : display.localizedLabel;
             return PromptCandidate{
                 .bindingId = display.bindingId,
-                .source = CandidateSource(binding),
+                .source = strings.source,
                 .token = display.token,
                 .localizedLabel = display.localizedLabel,
                 .deviceProfile = display.deviceProfile,
-                .glyphId = glyphId,
-                .platformId = platformId,
+                .glyphId = display.token,
+                .platformId = display.deviceProfile,
                 .buttonSemanticName = fallbackText,
                 .fallbackText = fallbackText,
-                .assetLookupPath = GlyphAssetLookupPath(platformId, glyphId),
+                .assetLookupPath = strings.assetLookupPath,
                 .missingIconBehavior = "fallback_text",
                 .debugReason = "Ok",
                 .priority = display.priority
@@ -115,12 +131,29 @@ namespace dualpad::input_v2::prompt
     PromptService::PromptService(
         const context::CompiledContextCatalog& catalog,
         const actions::CompiledActionGraph& graph,
-        const PublishedPromptScope& scope) :
+        const PublishedPromptScope& scope,
+        std::shared_ptr<const PromptDisplayStrings> strings) :
         _catalog(catalog),
         _graph(graph),
-        _scope(scope)
+        _scope(scope),
+        _strings(strings && strings->Graph() == &graph ? std::move(strings) : PromptDisplayStrings::Build(graph))
     {}
 
+    std::string_view PromptContextGlyphTokens::FindToken(std::string_view actionId) const
+    {
+        const auto it = std::lower_bound(
+            tokens.begin(),
+            tokens.end(),
+            actionId,
+            [](const PromptContextGlyphToken& entry, std::string_view id) {
+                return entry.actionId < id;
+            });
+        if (it == tokens.end() || it->actionId != actionId) {
+            return {};
+        }
+        return it->token;
+    }
+
     PromptLegacyGlyphDescriptor MakePromptLegacyGlyphDescriptor(
         const PromptQuery& query,
         const PromptDescriptor& descriptor)
@@ -172,7 +205,7 @@ namespace dualpad::input_v2::prompt
             return Failure(PromptQueryStatus::ScopeUnavailable, _scope);
         }
 
-        if (!IsKnownAction(_graph, query.actionId)) {
+        if (!FindAction(_graph, query.actionId)) {
             return Failure(PromptQueryStatus::UnknownAction, _scope);
         }
 
@@ -200,11 +233,7 @@ namespace dualpad::input_v2::prompt
                     actions::ActionId(query.actionId));
             }
 
-            if (query.contextName == "Menu") {
-                requestedScopeAnchorIds = { "MenuBase" };
-            } else {
-                requestedScopeAnchorIds = entry->scopeAnchorIds;
-            }
+            requestedScopeAnchorIds = ExplicitScopeAnchorIds(query.contextName, *entry);
 
             if (requestedScopeAnchorIds.empty()) {
                 return Failure(
@@ -233,7 +262,7 @@ namespace dualpad::input_v2::prompt
         bool sawFamilyCompatible = false;
         bool sawHiddenOnly = false;
         std::vector<PromptCandidate> candidates;
-        std::optional<actions::ActionSetId> matchedSet;
+        std::optional<std::string_view> matchedSet;
 
         for (auto anchorIt = requestedScopeAnchorIds.rbegin(); anchorIt != requestedScopeAnchorIds.rend(); ++anchorIt) {
             bool sawDisplayAtAnchor = false;
@@ -272,11 +301,14 @@ namespace dualpad::input_v2::prompt
                     continue;
                 }
 
-                anchorCandidates.push_back(MakePromptCandidate(*binding, *display));
+                anchorCandidates.push_back(MakePromptCandidate(
+                    *display,
+                    _strings->At(static_cast<std::size_t>(display - _graph.displayBindings.data()))));
             }
 
             if (!anchorCandidates.empty()) {
-                matchedSet = *anchorIt;
+                // The graph's lookup key, so the view outlives this call.
+                matchedSet = std::string_view(bindingIt->first);
                 candidates = std::move(anchorCandidates);
                 break;
             }
@@ -337,6 +369,7 @@ namespace dualpad::input_v2::prompt
         descriptor.deviceProfile = descriptor.primary->deviceProfile;
         descriptor.promptScopeRevision = _scope.promptScopeRevision;
         descriptor.manifestEpoch = _scope.manifestEpoch;
+        descriptor.strings = _strings;
         return descriptor;
     }
 
@@ -353,7 +386,7 @@ namespace dualpad::input_v2::prompt
             .contextName = contextName
         });
         if (descriptor.ok && descriptor.primary) {
-            return descriptor.primary->token;
+            return std::string(descriptor.primary->token);
         }
         return {};
     }
@@ -369,4 +402,65 @@ namespace dualpad::input_v2::prompt
         };
         return MakePromptLegacyGlyphDescriptor(query, Resolve(query));
     }
+
+    std::vector<std::string_view> PromptService::DisplayableActionIds(
+        PromptScopeSelectorKind selectorKind,
+        std::string_view contextName) const
+    {
+        if (selectorKind == PromptScopeSelectorKind::CurrentPublished) {
+            return CollectDisplayableActionIds(_graph, _scope.actionSetStack.scopeAnchorIds);
+        }
+
+        const auto resolved = context::ContextCatalog::ResolveAlias(_catalog, contextName);
+        const auto* entry = resolved ? context::ContextCatalog::FindById(_catalog, *resolved) : nullptr;
+        if (!entry) {
+            return {};
+        }
+        return CollectDisplayableActionIds(_graph, ExplicitScopeAnchorIds(contextName, *entry));
+    }
+
+    PromptContextGlyphTokens PromptService::ResolveContextGlyphTokens(std::string_view contextName) const
+    {
+        PromptContextGlyphTokens table{
+            .status = PromptQueryStatus::ScopeUnavailable,
+            .contextName = std::string(contextName),
+            .promptScopeRevision = _scope.promptScopeRevision,
+            .manifestEpoch = _scope.manifestEpoch
+        };
+        if (_scope.state != PromptScopeState::Ready || !_graph.manifestEpoch || _graph.manifestEpoch != _scope.manifestEpoch) {
+            return table;
+        }
+
+        const auto resolved = context::ContextCatalog::ResolveAlias(_catalog, contextName);
+        const auto* entry = resolved ? context::ContextCatalog::FindById(_catalog, *resolved) : nullptr;
+        if (!entry) {
+            table.status = PromptQueryStatus::UnknownContext;
+            return table;
+        }
+
+        // Only actions with a display binding somewhere in the requested
+        // scope can resolve; everything else would fail closed anyway.
+        const auto actionIds = CollectDisplayableActionIds(_graph, ExplicitScopeAnchorIds(contextName, *entry));
+
+        table.status = PromptQueryStatus::NoVisibleBinding;
+        bool sawFailure = false;
+        for (const auto actionId : actionIds) {
+            const auto descriptor = Resolve(PromptQuery{
+                .actionId = actionId,
+                .selectorKind = PromptScopeSelectorKind::ExplicitContextName,
+                .contextName = contextName
+            });
+            if (descriptor.ok && descriptor.primary) {
+                table.tokens.push_back(PromptContextGlyphToken{
+                    .actionId = std::string(actionId),
+                    .token = std::string(descriptor.primary->token)
+                });
+                table.status = PromptQueryStatus::Ok;
+            } else if (!sawFailure && table.status != PromptQueryStatus::Ok) {
+                table.status = descriptor.status;
+                sawFailure = true;
+            }
+        }
+        return table;
+    }
 }
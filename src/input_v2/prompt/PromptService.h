@@ -2,6 +2,7 @@
 
 #include "input_v2/actions/CompiledActionGraph.h"
 #include "input_v2/context/ContextCatalog.h"
+#include "input_v2/prompt/PromptDisplayStrings.h"
 #include "input_v2/prompt/PromptSnapshotRecord.h"
 
 namespace dualpad::input_v2::prompt
@@ -29,6 +30,27 @@ namespace dualpad::input_v2::prompt
         std::uint32_t promptScopeRevision{ 0 };
     };
 
+    struct PromptContextGlyphToken
+    {
+        std::string actionId;
+        std::string token;
+    };
+
+    // Every renderable legacy token for one explicit context, built in one
+    // pass so a menu can fetch its whole glyph set in a single Scaleform
+    // call. Actions that fail closed are absent rather than empty.
+    struct PromptContextGlyphTokens
+    {
+        PromptQueryStatus status{ PromptQueryStatus::ScopeUnavailable };
+        std::string contextName;
+        // Sorted by actionId.
+        std::vector<PromptContextGlyphToken> tokens;
+        std::uint32_t promptScopeRevision{ 0 };
+        std::uint64_t manifestEpoch{ 0 };
+
+        [[nodiscard]] std::string_view FindToken(std::string_view actionId) const;
+    };
+
     [[nodiscard]] PromptLegacyGlyphDescriptor MakePromptLegacyGlyphDescriptor(
         const PromptQuery& query,
         const PromptDescriptor& descriptor);
@@ -36,10 +58,13 @@ namespace dualpad::input_v2::prompt
     class PromptService
     {
     public:
+        // `strings` must be built from `graph`; without it the service
+        // builds an unpinned table of its own.
         PromptService(
             const context::CompiledContextCatalog& catalog,
             const actions::CompiledActionGraph& graph,
-            const PublishedPromptScope& scope);
+            const PublishedPromptScope& scope,
+            std::shared_ptr<const PromptDisplayStrings> strings = nullptr);
 
         [[nodiscard]] PromptDescriptor Resolve(const PromptQuery& query) const;
         [[nodiscard]] PromptSnapshotRecord Snapshot(const PromptQuery& query) const;
@@ -48,10 +73,18 @@ namespace dualpad::input_v2::prompt
         [[nodiscard]] PromptLegacyGlyphDescriptor ResolveLegacyGlyph(
             std::string_view actionId,
             std::string_view contextName) const;
+        [[nodiscard]] PromptContextGlyphTokens ResolveContextGlyphTokens(std::string_view contextName) const;
+        // Sorted ids of the actions with a display binding under the given
+        // selector; every other action fails closed in Resolve. Views point
+        // into the graph.
+        [[nodiscard]] std::vector<std::string_view> DisplayableActionIds(
+            PromptScopeSelectorKind selectorKind,
+            std::string_view contextName = {}) const;
 
     private:
         const context::CompiledContextCatalog& _catalog;
         const actions::CompiledActionGraph& _graph;
         const PublishedPromptScope& _scope;
+        std::shared_ptr<const PromptDisplayStrings> _strings;
     };
 }
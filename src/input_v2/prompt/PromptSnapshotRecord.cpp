@@ -17,7 +17,8 @@ namespace dualpad::input_v2::prompt
             .fallback = descriptor.fallback,
             .deviceProfile = descriptor.deviceProfile,
             .promptScopeRevision = descriptor.promptScopeRevision,
-            .manifestEpoch = descriptor.manifestEpoch
+            .manifestEpoch = descriptor.manifestEpoch,
+            .strings = descriptor.strings
         };
     }
 
@@ -5,6 +5,7 @@
 #include "input_v2/prompt/PromptScope.h"
 
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -36,20 +37,25 @@ namespace dualpad::input_v2::prompt
         AncestorScope
     };
 
+    class PromptDisplayStrings;
+
+    // Every view points into the compiled graph, its PromptDisplayStrings
+    // table or a literal; the descriptor or record holding the candidate pins
+    // that storage through `strings`.
     struct PromptCandidate
     {
         actions::BindingId bindingId{ 0 };
-        std::string source;
-        std::string token;
-        std::string localizedLabel;
-        std::string deviceProfile;
-        std::string glyphId;
-        std::string platformId;
-        std::string buttonSemanticName;
-        std::string fallbackText;
-        std::string assetLookupPath;
-        std::string missingIconBehavior;
-        std::string debugReason;
+        std::string_view source;
+        std::string_view token;
+        std::string_view localizedLabel;
+        std::string_view deviceProfile;
+        std::string_view glyphId;
+        std::string_view platformId;
+        std::string_view buttonSemanticName;
+        std::string_view fallbackText;
+        std::string_view assetLookupPath;
+        std::string_view missingIconBehavior;
+        std::string_view debugReason;
         std::uint16_t priority{ 0 };
     };
 
@@ -58,30 +64,32 @@ namespace dualpad::input_v2::prompt
         bool ok{ false };
         PromptQueryStatus status{ PromptQueryStatus::ScopeUnavailable };
         std::optional<actions::ActionId> action;
-        std::optional<actions::ActionSetId> resolvedSet;
+        std::optional<std::string_view> resolvedSet;
         std::optional<context::UiContextId> resolvedContext;
         std::optional<PromptCandidate> primary;
         std::vector<PromptCandidate> alternates;
         PromptResolutionSource resolutionSource{ PromptResolutionSource::ExactScope };
         PromptFallbackKind fallback{ PromptFallbackKind::None };
-        std::optional<std::string> deviceProfile;
+        std::optional<std::string_view> deviceProfile;
         std::uint32_t promptScopeRevision{ 0 };
         std::uint64_t manifestEpoch{ 0 };
+        std::shared_ptr<const PromptDisplayStrings> strings;
     };
 
     struct PromptSnapshotRecord
     {
         std::string actionId;
         PromptQueryStatus status{ PromptQueryStatus::ScopeUnavailable };
-        std::optional<actions::ActionSetId> resolvedSet;
+        std::optional<std::string_view> resolvedSet;
         std::optional<context::UiContextId> resolvedContext;
         std::optional<PromptCandidate> primary;
         std::vector<PromptCandidate> alternates;
         PromptResolutionSource resolutionSource{ PromptResolutionSource::ExactScope };
         PromptFallbackKind fallback{ PromptFallbackKind::None };
-        std::optional<std::string> deviceProfile;
+        std::optional<std::string_view> deviceProfile;
         std::uint32_t promptScopeRevision{ 0 };
         std::uint64_t manifestEpoch{ 0 };
+        std::shared_ptr<const PromptDisplayStrings> strings;
     };
 
     PromptSnapshotRecord MakePromptSnapshotRecord(const PromptQuery& query, const PromptDescriptor& descriptor);
@@ -3,6 +3,7 @@
 #include "input_v2/prompt/ScaleformPromptAdapter.h"
 
 #include "input/glyph/GlyphResolutionCompat.h"
+#include "input_v2/prompt/GlyphAtlasIndex.h"
 
 #include <RE/F/FxDelegateArgs.h>
 #include <RE/F/FxResponseArgs.h>
@@ -107,6 +108,12 @@ namespace dualpad::input_v2::prompt
         return PromptRuntimeOwner::GetSingleton().ResolveLegacyGlyph(actionId, contextName);
     }
 
+    std::shared_ptr<const PromptContextGlyphTokens> ScaleformPromptAdapter::ResolveContextGlyphTokensForRuntime(
+        std::string_view contextName)
+    {
+        return PromptRuntimeOwner::GetSingleton().ResolveContextGlyphTokens(contextName);
+    }
+
     input::glyph::GlyphResolutionCompatResult ScaleformPromptAdapter::ResolveCompatForReplay(
         std::string_view actionId,
         std::string_view contextName)
@@ -130,6 +137,7 @@ namespace dualpad::input_v2::prompt
 
         processor->Process("DualPad_GetActionGlyphToken", HandleGetActionGlyphToken);
         processor->Process("DualPad_GetActionGlyph", HandleGetActionGlyph);
+        processor->Process("DualPad_GetContextGlyphTokens", HandleGetContextGlyphTokens);
     }
 
     void ScaleformPromptAdapter::HandleGetActionGlyphToken(const RE::FxDelegateArgs& args)
@@ -203,6 +211,26 @@ namespace dualpad::input_v2::prompt
         result.SetMember("deviceProfile", RE::GFxValue(descriptor.deviceProfile.c_str()));
         result.SetMember("manifestEpoch", RE::GFxValue(static_cast<double>(descriptor.manifestEpoch)));
         result.SetMember("promptScopeRevision", RE::GFxValue(static_cast<double>(descriptor.promptScopeRevision)));
+        result.SetMember("assetLookupPath", RE::GFxValue(descriptor.assetLookupPath.c_str()));
+
+        // With a packed atlas the SWF draws from one image instead of
+        // loading the per-glyph file at assetLookupPath.
+        const auto& atlas = GlyphAtlasIndex::GetSingleton();
+        if (const auto rect = descriptor.ok ? atlas.Resolve(descriptor.assetLookupPath) : std::nullopt) {
+            const auto atlasPath = atlas.AtlasImagePath();
+            RE::GFxValue atlasRect;
+            movie->CreateObject(&atlasRect);
+            atlasRect.SetMember("path", RE::GFxValue(atlasPath.c_str()));
+            atlasRect.SetMember("x", RE::GFxValue(static_cast<double>(rect->x)));
+            atlasRect.SetMember("y", RE::GFxValue(static_cast<double>(rect->y)));
+            atlasRect.SetMember("width", RE::GFxValue(static_cast<double>(rect->width)));
+            atlasRect.SetMember("height", RE::GFxValue(static_cast<double>(rect->height)));
+            atlasRect.SetMember("u0", RE::GFxValue(static_cast<double>(rect->u0)));
+            atlasRect.SetMember("v0", RE::GFxValue(static_cast<double>(rect->v0)));
+            atlasRect.SetMember("u1", RE::GFxValue(static_cast<double>(rect->u1)));
+            atlasRect.SetMember("v1", RE::GFxValue(static_cast<double>(rect->v1)));
+            result.SetMember("atlas", atlasRect);
+        }
 
         logger::info(
             "[DualPad][PromptAdapter] GameDelegate descriptor action={} requestedContext={} ok={} token={} status={} resolvedContext={} resolvedSet={} scopeRevision={} manifestEpoch={}",
@@ -219,6 +247,56 @@ namespace dualpad::input_v2::prompt
         args.Respond(result);
     }
 
+    // Batch form of DualPad_GetActionGlyphToken: one round-trip returns
+    // { ok, contextName, failureReason, tokenCount, promptScopeRevision,
+    // manifestEpoch, tokens: { <actionId>: <token> } } for every renderable
+    // action in the context. Actions missing from `tokens` fail closed.
+    void ScaleformPromptAdapter::HandleGetContextGlyphTokens(const RE::FxDelegateArgs& args)
+    {
+        RE::GFxValue emptyResult;
+        emptyResult.SetNull();
+
+        if (args.GetArgCount() < 1 || !args[0].IsString()) {
+            args.Respond(emptyResult);
+            return;
+        }
+
+        const char* contextName = args[0].GetString();
+        auto* movie = args.GetMovie();
+        if (!contextName || !movie) {
+            args.Respond(emptyResult);
+            return;
+        }
+
+        const auto table = PromptRuntimeOwner::GetSingleton().ResolveContextGlyphTokens(contextName);
+
+        RE::GFxValue tokens;
+        movie->CreateObject(&tokens);
+        for (const auto& entry : table->tokens) {
+            tokens.SetMember(entry.actionId.c_str(), RE::GFxValue(entry.token.c_str()));
+        }
+
+        RE::GFxValue result;
+        movie->CreateObject(&result);
+        result.SetMember("ok", RE::GFxValue(table->status == PromptQueryStatus::Ok));
+        result.SetMember("contextName", RE::GFxValue(table->contextName.c_str()));
+        result.SetMember("failureReason", RE::GFxValue(ToString(table->status).data()));
+        result.SetMember("tokenCount", RE::GFxValue(static_cast<double>(table->tokens.size())));
+        result.SetMember("promptScopeRevision", RE::GFxValue(static_cast<double>(table->promptScopeRevision)));
+        result.SetMember("manifestEpoch", RE::GFxValue(static_cast<double>(table->manifestEpoch)));
+        result.SetMember("tokens", tokens);
+
+        logger::info(
+            "[DualPad][PromptAdapter] GameDelegate context tokens requestedContext={} status={} tokens={} scopeRevision={} manifestEpoch={}",
+            contextName,
+            ToString(table->status),
+            table->tokens.size(),
+            table->promptScopeRevision,
+            table->manifestEpoch);
+
+        args.Respond(result);
+    }
+
     bool ScaleformPromptAdapter::AttachToMenu(std::string_view menuName)
     {
         auto* ui = RE::UI::GetSingleton();
@@ -4,6 +4,7 @@
 
 #include <RE/F/FxDelegateHandler.h>
 
+#include <memory>
 #include <mutex>
 #include <string>
 #include <string_view>
@@ -31,6 +32,8 @@ namespace dualpad::input_v2::prompt
         [[nodiscard]] PromptLegacyGlyphDescriptor ResolveLegacyGlyphForRuntime(
             std::string_view actionId,
             std::string_view contextName);
+        [[nodiscard]] std::shared_ptr<const PromptContextGlyphTokens> ResolveContextGlyphTokensForRuntime(
+            std::string_view contextName);
         [[nodiscard]] input::glyph::GlyphResolutionCompatResult ResolveCompatForReplay(
             std::string_view actionId,
             std::string_view contextName);
@@ -42,6 +45,7 @@ namespace dualpad::input_v2::prompt
 
         static void HandleGetActionGlyphToken(const RE::FxDelegateArgs& args);
         static void HandleGetActionGlyph(const RE::FxDelegateArgs& args);
+        static void HandleGetContextGlyphTokens(const RE::FxDelegateArgs& args);
 
         bool AttachToMenu(std::string_view menuName);
 
@@ -0,0 +1,672 @@
+#include "pch.h"
+#include "input_v2/telemetry/FlightRecorder.h"
+
+#include "input_v2/gameplay/RuntimeDiagnostics.h"
+#include "input_v2/telemetry/TraceCsvConverter.h"
+#include "input_v2/telemetry/TraceRecordFormat.h"
+#include "input_v2/telemetry/TraceSchema.h"
+
+#include <SKSE/Logger.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace logger = SKSE::log;
+
+namespace dualpad::input_v2::telemetry
+{
+    enum class FlightRecordKind : std::uint32_t
+    {
+        Submit,
+        SubmitEvents,
+        Drain,
+        PollFrame,
+        DeadlineTick,
+        ManifestTransition
+    };
+
+    namespace
+    {
+        constexpr std::size_t kFlightPayloadWords = ((std::max)({
+                                                         sizeof(TraceDispatcherSubmit),
+                                                         sizeof(TraceDispatcherDrain),
+                                                         sizeof(TracePollFrame),
+                                                         sizeof(TraceDeadlineTick),
+                                                         sizeof(TraceManifestTransition) }) +
+                                                        sizeof(std::uint64_t) - 1) /
+                                                    sizeof(std::uint64_t);
+        // A submit's ingress events follow it packed this many per slot.
+        constexpr std::uint32_t kEventsPerFlightRecord =
+            kFlightPayloadWords * sizeof(std::uint64_t) / sizeof(input::PadEvent);
+        static_assert(kEventsPerFlightRecord > 0);
+
+        // One ring slot. The payload is the trace struct of `kind` in host
+        // layout, or consecutive ingress events; a dump encodes it into
+        // trace records off the hot path.
+        struct FlightRecord
+        {
+            std::uint64_t capturedAtUs{ 0 };
+            std::uint64_t order{ 0 };
+            FlightRecordKind kind{ FlightRecordKind::Submit };
+            // Index of the first event a SubmitEvents slot holds.
+            std::uint32_t eventIndex{ 0 };
+            std::array<std::uint64_t, kFlightPayloadWords> payload{};
+
+            template <class T>
+            [[nodiscard]] T As(std::size_t offset = 0) const
+            {
+                T value{};
+                std::memcpy(&value, reinterpret_cast<const std::byte*>(payload.data()) + offset, sizeof(T));
+                return value;
+            }
+
+            // Events a SubmitEvents slot of a submit with `eventCount` holds.
+            [[nodiscard]] std::uint32_t EventsHeld(std::uint32_t eventCount) const
+            {
+                return eventIndex < eventCount ? (std::min)(kEventsPerFlightRecord, eventCount - eventIndex) : 0;
+            }
+        };
+        static_assert(std::is_trivially_copyable_v<FlightRecord>);
+        static_assert(offsetof(FlightRecord, payload) == 3 * sizeof(std::uint64_t));
+    }
+
+    // Overwrite-oldest ring of FlightRecord slots with one producer, stored
+    // as 8-byte words so a concurrent reader never races on plain memory.
+    // The producer publishes which slot it is about to write before
+    // touching it, so a reader copying concurrently can tell afterwards
+    // whether the slot survived.
+    class FlightRecordRing
+    {
+    public:
+        static constexpr std::size_t kSlotWords = sizeof(FlightRecord) / sizeof(std::uint64_t);
+        static constexpr std::uint64_t kSlots = FlightRecorder::kRingCapacityBytes / sizeof(FlightRecord);
+
+        FlightRecordRing() :
+            _words(std::make_unique<std::uint64_t[]>(kSlots * kSlotWords))
+        {}
+
+        // Writes the three header words and as many payload words as
+        // `payload` needs; the rest of the slot keeps older bytes.
+        void Push(
+            FlightRecordKind kind,
+            std::uint64_t capturedAtUs,
+            std::uint64_t order,
+            std::uint32_t eventIndex,
+            std::span<const std::byte> payload)
+        {
+            const auto head = _head.load(std::memory_order_relaxed);
+            _reserve.store(head + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+
+            auto position = (head % kSlots) * kSlotWords;
+            StoreWord(position++, capturedAtUs);
+            StoreWord(position++, order);
+            StoreWord(position++, std::bit_cast<std::uint64_t>(std::array<std::uint32_t, 2>{
+                                      static_cast<std::uint32_t>(kind), eventIndex }));
+            std::size_t offset = 0;
+            for (; offset + sizeof(std::uint64_t) <= payload.size(); offset += sizeof(std::uint64_t)) {
+                std::uint64_t word;
+                std::memcpy(&word, payload.data() + offset, sizeof(word));
+                StoreWord(position++, word);
+            }
+            if (offset < payload.size()) {
+                std::uint64_t word = 0;
+                std::memcpy(&word, payload.data() + offset, payload.size() - offset);
+                StoreWord(position, word);
+            }
+            _newestCapturedAtUs.store(capturedAtUs, std::memory_order_relaxed);
+            _head.store(head + 1, std::memory_order_release);
+        }
+
+        // Appends every intact record captured at or after `cutoffUs`.
+        void CollectSince(std::uint64_t cutoffUs, std::vector<FlightRecord>& out) const
+        {
+            const auto head = _head.load(std::memory_order_acquire);
+            for (auto position = head; position > 0 && head - position < kSlots; --position) {
+                const auto index = position - 1;
+                std::array<std::uint64_t, kSlotWords> words{};
+                const auto first = (index % kSlots) * kSlotWords;
+                for (std::size_t i = 0; i < kSlotWords; ++i) {
+                    words[i] = LoadWord(first + i);
+                }
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (_reserve.load(std::memory_order_relaxed) - index > kSlots) {
+                    return;
+                }
+
+                const auto record = std::bit_cast<FlightRecord>(words);
+                if (record.capturedAtUs < cutoffUs) {
+                    return;
+                }
+                out.push_back(record);
+            }
+        }
+
+        // Records pushed since the ring was created.
+        [[nodiscard]] std::uint64_t Pushed() const
+        {
+            return _head.load(std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] std::uint64_t NewestCapturedAtUs() const
+        {
+            return _newestCapturedAtUs.load(std::memory_order_relaxed);
+        }
+
+        void Retire()
+        {
+            _retired.store(true, std::memory_order_release);
+        }
+
+        [[nodiscard]] bool Retired() const
+        {
+            return _retired.load(std::memory_order_acquire);
+        }
+
+    private:
+        void StoreWord(std::uint64_t index, std::uint64_t value)
+        {
+            std::atomic_ref<std::uint64_t>(_words[index]).store(value, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] std::uint64_t LoadWord(std::uint64_t index) const
+        {
+            return std::atomic_ref<std::uint64_t>(_words[index]).load(std::memory_order_relaxed);
+        }
+
+        std::unique_ptr<std::uint64_t[]> _words;
+        alignas(64) std::atomic<std::uint64_t> _head{ 0 };
+        std::atomic<std::uint64_t> _reserve{ 0 };
+        std::atomic<std::uint64_t> _newestCapturedAtUs{ 0 };
+        std::atomic<bool> _retired{ false };
+    };
+
+    namespace
+    {
+        struct ThreadFlightRing
+        {
+            std::shared_ptr<FlightRecordRing> ring;
+            std::uint64_t generation{ 0 };
+
+            ~ThreadFlightRing()
+            {
+                if (ring) {
+                    ring->Retire();
+                }
+            }
+        };
+
+        thread_local ThreadFlightRing tThreadFlightRing;
+        // Bumped by ResetForTests so threads re-register a fresh ring.
+        std::atomic<std::uint64_t> gRingGeneration{ 1 };
+
+        std::uint64_t NowUs()
+        {
+            return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+
+        constexpr std::uint64_t kWindowUs =
+            std::chrono::duration_cast<std::chrono::microseconds>(FlightRecorder::kWindow).count();
+
+        // Orders the window, drops submits that lost an event to the
+        // overwrite, and cuts it at the first submit that found the
+        // dispatcher queue empty, so a dispatcher replay starts from the
+        // same queue state the game had. Poll frames, deadline ticks and
+        // manifest publications of snapshots submitted before the cut are
+        // dropped with it.
+        std::vector<FlightRecord> ReplayableWindow(std::vector<FlightRecord> records)
+        {
+            std::ranges::sort(records, [](const FlightRecord& lhs, const FlightRecord& rhs) {
+                return std::tie(lhs.order, lhs.kind, lhs.eventIndex) < std::tie(rhs.order, rhs.kind, rhs.eventIndex);
+            });
+
+            std::vector<FlightRecord> complete;
+            complete.reserve(records.size());
+            for (std::size_t i = 0; i < records.size();) {
+                const auto& record = records[i];
+                if (record.kind == FlightRecordKind::SubmitEvents) {
+                    // Its submit was overwritten.
+                    ++i;
+                    continue;
+                }
+                if (record.kind != FlightRecordKind::Submit) {
+                    complete.push_back(record);
+                    ++i;
+                    continue;
+                }
+
+                const auto eventCount = record.As<TraceDispatcherSubmit>().frame.eventCount;
+                std::uint32_t held = 0;
+                auto end = i + 1;
+                for (; end < records.size() && records[end].kind == FlightRecordKind::SubmitEvents &&
+                       records[end].order == record.order;
+                     ++end) {
+                    held = records[end].eventIndex == held ? held + records[end].EventsHeld(eventCount) : eventCount + 1;
+                }
+                if (held == eventCount) {
+                    complete.insert(complete.end(), records.begin() + i, records.begin() + end);
+                }
+                i = end;
+            }
+
+            const auto cut = std::ranges::find_if(complete, [](const FlightRecord& record) {
+                return record.kind == FlightRecordKind::Submit &&
+                       record.As<TraceDispatcherSubmit>().pendingBefore == 0;
+            });
+            if (cut == complete.end()) {
+                return complete;
+            }
+
+            const auto firstSequence = cut->As<TraceDispatcherSubmit>().frame.sequence;
+            complete.erase(complete.begin(), cut);
+            std::erase_if(complete, [firstSequence](const FlightRecord& record) {
+                switch (record.kind) {
+                case FlightRecordKind::PollFrame:
+                    return record.As<TracePollFrame>().sequence < firstSequence;
+                case FlightRecordKind::DeadlineTick:
+                    return record.As<TraceDeadlineTick>().sequence < firstSequence;
+                case FlightRecordKind::ManifestTransition:
+                    return record.As<TraceManifestTransition>().sequence < firstSequence;
+                default:
+                    return false;
+                }
+            });
+            return complete;
+        }
+
+        template <class T>
+        void EncodeFixed(std::string& bytes, TraceRecordKind kind, const FlightRecord& record)
+        {
+            TraceRecordEncoder encoder(bytes, kind, record.order);
+            encoder.Put(record.As<T>());
+            encoder.Finish();
+        }
+
+        // Encodes an ordered window as trace records; each submit is
+        // followed by its events.
+        std::string EncodeWindow(std::span<const FlightRecord> records)
+        {
+            std::string bytes;
+            std::vector<input::PadEvent> events;
+            for (std::size_t i = 0; i < records.size(); ++i) {
+                const auto& record = records[i];
+                switch (record.kind) {
+                case FlightRecordKind::Submit:
+                    {
+                        events.clear();
+                        const auto submit = record.As<TraceDispatcherSubmit>();
+                        for (; i + 1 < records.size() && records[i + 1].kind == FlightRecordKind::SubmitEvents &&
+                               records[i + 1].order == record.order;
+                             ++i) {
+                            const auto& slot = records[i + 1];
+                            for (std::uint32_t e = 0; e < slot.EventsHeld(submit.frame.eventCount); ++e) {
+                                events.push_back(slot.As<input::PadEvent>(e * sizeof(input::PadEvent)));
+                            }
+                        }
+                        TraceRecordEncoder encoder(bytes, TraceRecordKind::DispatcherSubmit, record.order);
+                        encoder.Put(submit);
+                        encoder.PutSpan(std::span<const input::PadEvent>(events));
+                        encoder.Finish();
+                        break;
+                    }
+                case FlightRecordKind::Drain:
+                    EncodeFixed<TraceDispatcherDrain>(bytes, TraceRecordKind::DispatcherDrain, record);
+                    break;
+                case FlightRecordKind::PollFrame:
+                    EncodeFixed<TracePollFrame>(bytes, TraceRecordKind::PollFrame, record);
+                    break;
+                case FlightRecordKind::DeadlineTick:
+                    EncodeFixed<TraceDeadlineTick>(bytes, TraceRecordKind::DeadlineTick, record);
+                    break;
+                case FlightRecordKind::ManifestTransition:
+                    EncodeFixed<TraceManifestTransition>(bytes, TraceRecordKind::ManifestTransition, record);
+                    break;
+                case FlightRecordKind::SubmitEvents:
+                default:
+                    break;
+                }
+            }
+            return bytes;
+        }
+
+        // The files a dump's records fill; replaying the dump compares only
+        // these. Processed snapshots, keyboard commands, presentation
+        // surfaces and glyph results are not captured.
+        constexpr std::array<std::string_view, 5> kCapturedOutputs = {
+            "dispatcher_schedule.csv",
+            "ingress_snapshot_frames.csv",
+            "ingress_snapshot_events.csv",
+            "expected_authoritative_poll.csv",
+            kDeadlineTickFileName
+        };
+
+        std::string DumpDirectoryName(FlightDumpTrigger trigger, std::uint64_t index)
+        {
+            const auto epochMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count();
+            return "flight-" + std::to_string(epochMs) + "-" + std::to_string(index) + "-" + std::string(ToString(trigger));
+        }
+    }
+
+    std::string_view ToString(FlightDumpTrigger trigger)
+    {
+        switch (trigger) {
+        case FlightDumpTrigger::RuntimeHealthDegraded:
+            return "runtime_health_degraded";
+        case FlightDumpTrigger::QueueOverflow:
+            return "queue_overflow";
+        case FlightDumpTrigger::Hotkey:
+        default:
+            return "hotkey";
+        }
+    }
+
+    FlightRecorder& FlightRecorder::GetSingleton()
+    {
+        static FlightRecorder instance;
+        return instance;
+    }
+
+    void FlightRecorder::Start(Options options)
+    {
+        std::scoped_lock lock(_mutex);
+        _options = std::move(options);
+        _lastHealthReasons = 0;
+        _lastSubmitUs.store(NowUs(), std::memory_order_relaxed);
+        if (!_worker.joinable()) {
+            _worker = std::jthread([this](std::stop_token stop) { WorkerLoop(stop); });
+        }
+        _armed.store(true, std::memory_order_release);
+    }
+
+    void FlightRecorder::Stop()
+    {
+        _armed.store(false, std::memory_order_release);
+        std::jthread worker;
+        {
+            std::scoped_lock lock(_mutex);
+            _pending.reset();
+            worker = std::move(_worker);
+        }
+        if (worker.joinable()) {
+            worker.request_stop();
+            worker.join();
+        }
+    }
+
+    bool FlightRecorder::IsArmed() const
+    {
+        return _armed.load(std::memory_order_relaxed);
+    }
+
+    std::shared_ptr<FlightRecordRing> FlightRecorder::RegisterThreadRing()
+    {
+        auto ring = std::make_shared<FlightRecordRing>();
+        const auto cutoffUs = NowUs() - (std::min)(NowUs(), kWindowUs);
+        std::scoped_lock lock(_mutex);
+        // Rings of exited threads are kept while they still hold part of
+        // the window.
+        std::erase_if(_rings, [this, cutoffUs](const std::shared_ptr<FlightRecordRing>& existing) {
+            if (!existing->Retired() || existing->NewestCapturedAtUs() >= cutoffUs) {
+                return false;
+            }
+            _releasedCaptured += existing->Pushed();
+            return true;
+        });
+        _rings.push_back(ring);
+        return ring;
+    }
+
+    FlightRecordRing& FlightRecorder::ThreadRing()
+    {
+        auto& slot = tThreadFlightRing;
+        const auto generation = gRingGeneration.load(std::memory_order_relaxed);
+        if (!slot.ring || slot.generation != generation) {
+            slot.ring = RegisterThreadRing();
+            slot.generation = generation;
+        }
+        return *slot.ring;
+    }
+
+    void FlightRecorder::Capture(const TraceDispatcherSubmit& submit, std::span<const input::PadEvent> events)
+    {
+        if (!IsArmed()) {
+            return;
+        }
+
+        auto& ring = ThreadRing();
+        const auto capturedAtUs = NowUs();
+        _lastSubmitUs.store(capturedAtUs, std::memory_order_relaxed);
+        const auto order = _nextOrder.fetch_add(1, std::memory_order_relaxed);
+        ring.Push(FlightRecordKind::Submit, capturedAtUs, order, 0, std::as_bytes(std::span(&submit, 1)));
+        for (std::size_t first = 0; first < events.size(); first += kEventsPerFlightRecord) {
+            ring.Push(
+                FlightRecordKind::SubmitEvents,
+                capturedAtUs,
+                order,
+                static_cast<std::uint32_t>(first),
+                std::as_bytes(events.subspan(first, (std::min)(std::size_t{ kEventsPerFlightRecord }, events.size() - first))));
+        }
+    }
+
+    void FlightRecorder::CaptureFixed(FlightRecordKind kind, std::span<const std::byte> payload)
+    {
+        if (!IsArmed()) {
+            return;
+        }
+
+        // Only submits read the clock; everything else belongs to the
+        // newest one, and the window is cut at a submit anyway.
+        ThreadRing().Push(
+            kind,
+            _lastSubmitUs.load(std::memory_order_relaxed),
+            _nextOrder.fetch_add(1, std::memory_order_relaxed),
+            0,
+            payload);
+    }
+
+    void FlightRecorder::Capture(const TraceDispatcherDrain& drain)
+    {
+        CaptureFixed(FlightRecordKind::Drain, std::as_bytes(std::span(&drain, 1)));
+    }
+
+    void FlightRecorder::Capture(const TracePollFrame& pollFrame)
+    {
+        CaptureFixed(FlightRecordKind::PollFrame, std::as_bytes(std::span(&pollFrame, 1)));
+    }
+
+    void FlightRecorder::Capture(const TraceDeadlineTick& tick)
+    {
+        CaptureFixed(FlightRecordKind::DeadlineTick, std::as_bytes(std::span(&tick, 1)));
+    }
+
+    void FlightRecorder::Capture(const TraceManifestTransition& transition)
+    {
+        CaptureFixed(FlightRecordKind::ManifestTransition, std::as_bytes(std::span(&transition, 1)));
+    }
+
+    void FlightRecorder::ObserveRuntimeHealth(const gameplay::RuntimeDebugSnapshot& snapshot)
+    {
+        if (!IsArmed()) {
+            return;
+        }
+
+        const auto added = snapshot.runtimeHealthReasons & ~_lastHealthReasons;
+        _lastHealthReasons = snapshot.runtimeHealthReasons;
+        if (added == 0) {
+            return;
+        }
+
+        const auto trigger =
+            gameplay::HasRuntimeHealthReason(added, gameplay::RuntimeHealthReason::QueueOverflow) ?
+                FlightDumpTrigger::QueueOverflow :
+                FlightDumpTrigger::RuntimeHealthDegraded;
+        RequestDump(trigger, snapshot.runtimeHealthReasonSummary);
+    }
+
+    void FlightRecorder::RequestDump(FlightDumpTrigger trigger, std::string_view detail)
+    {
+        {
+            std::scoped_lock lock(_mutex);
+            if (!_armed.load(std::memory_order_relaxed) || !_worker.joinable()) {
+                return;
+            }
+            if (trigger != FlightDumpTrigger::Hotkey) {
+                const auto now = std::chrono::steady_clock::now();
+                if (!_options.autoDump || (_lastAutoDumpAt && now - *_lastAutoDumpAt < kAutoDumpCooldown)) {
+                    ++_stats.suppressedDumps;
+                    return;
+                }
+                _lastAutoDumpAt = now;
+            }
+            if (_pending) {
+                ++_stats.suppressedDumps;
+                return;
+            }
+            _pending = PendingDump{ .trigger = trigger, .detail = std::string(detail) };
+        }
+        _wake.notify_one();
+    }
+
+    std::optional<std::filesystem::path> FlightRecorder::DumpNow(FlightDumpTrigger trigger, std::string_view detail)
+    {
+        std::vector<std::shared_ptr<FlightRecordRing>> rings;
+        std::filesystem::path outputRoot;
+        std::uint64_t index = 0;
+        {
+            std::scoped_lock lock(_mutex);
+            rings = _rings;
+            outputRoot = _options.outputRoot;
+            index = _dumpIndex++;
+        }
+        if (outputRoot.empty()) {
+            return std::nullopt;
+        }
+
+        const auto nowUs = NowUs();
+        const auto cutoffUs = nowUs - (std::min)(nowUs, kWindowUs);
+        std::vector<FlightRecord> records;
+        for (const auto& ring : rings) {
+            ring->CollectSince(cutoffUs, records);
+        }
+        records = ReplayableWindow(std::move(records));
+        if (records.empty()) {
+            return std::nullopt;
+        }
+
+        const auto directory = outputRoot / DumpDirectoryName(trigger, index);
+        try {
+            std::filesystem::create_directories(directory);
+            {
+                std::ofstream trace(directory / kTraceRecordFileName, std::ios::binary | std::ios::trunc);
+                if (!trace) {
+                    throw std::runtime_error("cannot write " + (directory / kTraceRecordFileName).string());
+                }
+                const TraceSegmentHeader header{
+                    .schemaVersion = kTraceSchemaVersion,
+                    .layoutFingerprint = TraceLayoutFingerprint()
+                };
+                trace.write(reinterpret_cast<const char*>(&header), sizeof(header));
+                const auto bytes = EncodeWindow(records);
+                trace.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+            }
+            (void)ConvertTraceToPhase0Csv(directory / kTraceRecordFileName, directory);
+            {
+                std::ofstream captured(directory / kCapturedOutputsFileName, std::ios::trunc);
+                captured << kCapturedOutputsHeader << '\n';
+                for (const auto name : kCapturedOutputs) {
+                    captured << name << '\n';
+                }
+            }
+
+            std::ofstream info(directory / "flight_dump.txt", std::ios::trunc);
+            info << "trigger=" << ToString(trigger) << '\n'
+                 << "detail=" << detail << '\n'
+                 << "window_ms=" << std::chrono::duration_cast<std::chrono::milliseconds>(kWindow).count() << '\n'
+                 << "records=" << records.size() << '\n'
+                 << "replay=DualPadReplayHarness --scenario <this directory> --mode dispatcher --output <dir>\n";
+        } catch (const std::exception& e) {
+            logger::warn("[DualPad][FlightRecorder] {} dump failed: {}", ToString(trigger), e.what());
+            std::scoped_lock lock(_mutex);
+            ++_stats.failedDumps;
+            return std::nullopt;
+        }
+
+        logger::warn(
+            "[DualPad][FlightRecorder] {} dump of {} records written to {} ({})",
+            ToString(trigger),
+            records.size(),
+            directory.string(),
+            detail);
+        std::scoped_lock lock(_mutex);
+        ++_stats.dumps;
+        _stats.lastDumpDirectory = directory;
+        return directory;
+    }
+
+    void FlightRecorder::WaitIdle()
+    {
+        std::unique_lock lock(_mutex);
+        _idle.wait(lock, [this] { return !_busy && !_pending; });
+    }
+
+    FlightRecorder::Stats FlightRecorder::GetStats() const
+    {
+        std::scoped_lock lock(_mutex);
+        auto stats = _stats;
+        stats.captured = _releasedCaptured;
+        for (const auto& ring : _rings) {
+            stats.captured += ring->Pushed();
+        }
+        return stats;
+    }
+
+    void FlightRecorder::ResetForTests()
+    {
+        Stop();
+        std::scoped_lock lock(_mutex);
+        gRingGeneration.fetch_add(1, std::memory_order_relaxed);
+        _rings.clear();
+        _options = Options{};
+        _lastAutoDumpAt.reset();
+        _lastHealthReasons = 0;
+        _dumpIndex = 0;
+        _stats = Stats{};
+        _releasedCaptured = 0;
+        _nextOrder.store(0, std::memory_order_relaxed);
+        _lastSubmitUs.store(0, std::memory_order_relaxed);
+    }
+
+    void FlightRecorder::WorkerLoop(std::stop_token stop)
+    {
+        while (true) {
+            PendingDump dump;
+            {
+                std::unique_lock lock(_mutex);
+                if (!_wake.wait(lock, stop, [this] { return _pending.has_value(); })) {
+                    return;
+                }
+                dump = std::move(*_pending);
+                _pending.reset();
+                _busy = true;
+            }
+
+            (void)DumpNow(dump.trigger, dump.detail);
+
+            {
+                std::scoped_lock lock(_mutex);
+                _busy = false;
+            }
+            _idle.notify_all();
+        }
+    }
+}
@@ -0,0 +1,143 @@
+#pragma once
+
+#include "input/PadEvent.h"
+#include "input_v2/telemetry/TraceRecordFormat.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace dualpad::input_v2::gameplay
+{
+    struct RuntimeDebugSnapshot;
+}
+
+namespace dualpad::input_v2::telemetry
+{
+    class FlightRecordRing;
+    enum class FlightRecordKind : std::uint32_t;
+
+    enum class FlightDumpTrigger : std::uint8_t
+    {
+        RuntimeHealthDegraded,
+        // A newly raised RuntimeHealthReason::QueueOverflow; the dispatcher
+        // queue has no trigger of its own.
+        QueueOverflow,
+        Hotkey
+    };
+
+    std::string_view ToString(FlightDumpTrigger trigger);
+
+    // Always-on black box. Each recording thread copies fixed-size
+    // summaries of what it sees (dispatcher submits and their ingress
+    // events, drains, the poll frame of every stable frame, deadline ticks
+    // and manifest publications) into an overwrite-oldest ring it owns, so
+    // the last kWindow is on hand whether or not trace recording is
+    // enabled. Capturing never encodes a trace record, builds a string or
+    // allocates once the thread's ring exists. A dump turns that window into
+    // a replay scenario directory that DualPadReplayHarness reads directly.
+    class FlightRecorder
+    {
+    public:
+        // Per recording thread; about kWindow of HID-rate submits carrying
+        // a few events each.
+        static constexpr std::size_t kRingCapacityBytes = std::size_t{ 4 } << 20;
+        static constexpr std::chrono::seconds kWindow{ 10 };
+        // Automatic dumps closer together than this are suppressed; the
+        // hotkey always dumps.
+        static constexpr std::chrono::seconds kAutoDumpCooldown{ 30 };
+
+        struct Options
+        {
+            std::filesystem::path outputRoot;
+            bool autoDump{ true };
+        };
+
+        struct Stats
+        {
+            // Fixed-size records written to the rings since the last reset.
+            std::uint64_t captured{ 0 };
+            std::uint64_t dumps{ 0 };
+            std::uint64_t suppressedDumps{ 0 };
+            std::uint64_t failedDumps{ 0 };
+            std::filesystem::path lastDumpDirectory;
+        };
+
+        static FlightRecorder& GetSingleton();
+
+        // Arms capture. Until then every Capture() is a single relaxed load.
+        void Start(Options options);
+        void Stop();
+        [[nodiscard]] bool IsArmed() const;
+
+        // A submit takes one record plus one per ingress event.
+        void Capture(const TraceDispatcherSubmit& submit, std::span<const input::PadEvent> events);
+        void Capture(const TraceDispatcherDrain& drain);
+        void Capture(const TracePollFrame& pollFrame);
+        void Capture(const TraceDeadlineTick& tick);
+        void Capture(const TraceManifestTransition& transition);
+        // Main thread, once per assembled frame. Dumps when a runtime
+        // health reason appears that the previous frame did not have.
+        void ObserveRuntimeHealth(const gameplay::RuntimeDebugSnapshot& snapshot);
+        // Queues a dump on the worker thread.
+        void RequestDump(FlightDumpTrigger trigger, std::string_view detail = {});
+        // Writes the current window on the calling thread and returns the
+        // scenario directory, or nullopt when there was nothing to write.
+        std::optional<std::filesystem::path> DumpNow(FlightDumpTrigger trigger, std::string_view detail = {});
+        // Blocks until every requested dump has been written.
+        void WaitIdle();
+
+        [[nodiscard]] Stats GetStats() const;
+        void ResetForTests();
+
+    private:
+        struct PendingDump
+        {
+            FlightDumpTrigger trigger{ FlightDumpTrigger::Hotkey };
+            std::string detail;
+        };
+
+        FlightRecorder() = default;
+
+        [[nodiscard]] FlightRecordRing& ThreadRing();
+        void CaptureFixed(FlightRecordKind kind, std::span<const std::byte> payload);
+        [[nodiscard]] std::shared_ptr<FlightRecordRing> RegisterThreadRing();
+        void WorkerLoop(std::stop_token stop);
+
+        std::atomic<bool> _armed{ false };
+        // Restores the cross-thread order of a window; the records of one
+        // submit share a value.
+        std::atomic<std::uint64_t> _nextOrder{ 0 };
+        // Capture time of the newest submit, stamped on the records after it.
+        std::atomic<std::uint64_t> _lastSubmitUs{ 0 };
+        // Health reasons of the previous frame; main thread only.
+        std::uint32_t _lastHealthReasons{ 0 };
+
+        mutable std::mutex _mutex;
+        std::condition_variable_any _wake;
+        std::condition_variable _idle;
+        Options _options{};
+        std::vector<std::shared_ptr<FlightRecordRing>> _rings;
+        // Records of rings released since the last reset.
+        std::uint64_t _releasedCaptured{ 0 };
+        std::optional<PendingDump> _pending;
+        bool _busy{ false };
+        std::optional<std::chrono::steady_clock::time_point> _lastAutoDumpAt;
+        std::uint64_t _dumpIndex{ 0 };
+        Stats _stats{};
+        // Started by Start(); declared last so it is joined before the
+        // state above is destroyed.
+        std::jthread _worker;
+    };
+}
@@ -3,153 +3,40 @@
 
 #include "input/RuntimeConfig.h"
 #include "input_v2/gameplay/RuntimeDiagnostics.h"
+#include "input_v2/telemetry/FlightRecorder.h"
+#include "input_v2/telemetry/TraceCsvConverter.h"
+#include "input_v2/telemetry/TraceRecordFormat.h"
+#include "input_v2/telemetry/TraceRecordRing.h"
 #include "input_v2/telemetry/TraceSchema.h"
 
-#include <fstream>
-#include <sstream>
+#include <span>
 
 namespace dualpad::input_v2::telemetry
 {
     namespace
     {
-        std::string BoolString(bool value)
+        // The calling thread's ring; retired when the thread exits so the
+        // writer can release it once drained.
+        struct ThreadRing
         {
-            return value ? "true" : "false";
-        }
-
-        template <class T>
-        std::string ToScalarString(T value)
-        {
-            std::ostringstream stream;
-            stream << value;
-            return stream.str();
-        }
+            std::shared_ptr<TraceRecordRing> ring;
 
-        std::string EscapeCsv(std::string_view value)
-        {
-            bool needsQuotes = false;
-            for (const char ch : value) {
-                if (ch == ',' || ch == '"' || ch == '\n' || ch == '\r') {
-                    needsQuotes = true;
-                    break;
+            ~ThreadRing()
+            {
+                if (ring) {
+                    ring->Retire();
                 }
             }
+        };
 
-            if (!needsQuotes) {
-                return std::string(value);
-            }
-
-            std::string escaped;
-            escaped.reserve(value.size() + 2);
-            escaped.push_back('"');
-            for (const char ch : value) {
-                if (ch == '"') {
-                    escaped.push_back('"');
-                }
-                escaped.push_back(ch);
-            }
-            escaped.push_back('"');
-            return escaped;
-        }
-
-        std::string LastPollAgeString(const input::DrainTelemetryContext& telemetry)
-        {
-            return telemetry.lastPollAgeMs ? std::to_string(*telemetry.lastPollAgeMs) : "none";
-        }
+        thread_local ThreadRing tThreadRing;
+        // Reused per thread so encoding a record does not allocate once
+        // its capacity has grown to the largest record.
+        thread_local std::string tRecordScratch;
 
-        std::string SnapshotFrameLine(const input::PadEventSnapshot& snapshot)
+        std::span<const input::PadEvent> SnapshotEvents(const input::PadEventSnapshot& snapshot)
         {
-            std::ostringstream line;
-            line << snapshot.sequence << ','
-                 << snapshot.firstSequence << ','
-                 << snapshot.sourceTimestampUs << ','
-                 << input::ToString(snapshot.context) << ','
-                 << snapshot.contextEpoch << ','
-                 << BoolString(snapshot.overflowed) << ','
-                 << BoolString(snapshot.coalesced) << ','
-                 << BoolString(snapshot.crossContextMismatch) << ','
-                 << snapshot.state.buttons.digitalMask << ','
-                 << snapshot.state.leftStick.x << ','
-                 << snapshot.state.leftStick.y << ','
-                 << snapshot.state.rightStick.x << ','
-                 << snapshot.state.rightStick.y << ','
-                 << snapshot.state.leftTrigger.normalized << ','
-                 << snapshot.state.rightTrigger.normalized;
-            return line.str();
-        }
-
-        std::string SnapshotEventLine(
-            std::uint64_t sequence,
-            std::size_t eventIndex,
-            const input::PadEvent& event)
-        {
-            std::ostringstream line;
-            line << sequence << ','
-                 << eventIndex << ','
-                 << input::ToString(event.type) << ','
-                 << input::ToString(event.triggerType) << ','
-                 << event.code << ','
-                 << event.modifierMask << ','
-                 << input::ToString(event.axis) << ','
-                 << event.previousValue << ','
-                 << event.value << ','
-                 << event.timestampUs << ','
-                 << static_cast<unsigned int>(event.touchId) << ','
-                 << event.touchX << ','
-                 << event.touchY << ','
-                 << input::ToString(event.touchpadMode) << ','
-                 << input::ToString(event.touchRegion) << ','
-                 << input::ToString(event.slideDirection);
-            return line.str();
-        }
-
-        std::string PollFrameLine(const input::AuthoritativePollFrame& frame)
-        {
-            std::ostringstream line;
-            line << frame.pollSequence << ','
-                 << input::ToString(frame.context) << ','
-                 << frame.contextEpoch << ','
-                 << frame.sourceTimestampUs << ','
-                 << frame.downMask << ','
-                 << frame.pressedMask << ','
-                 << frame.releasedMask << ','
-                 << frame.pulseMask << ','
-                 << frame.unmanagedDownMask << ','
-                 << frame.unmanagedPressedMask << ','
-                 << frame.unmanagedReleasedMask << ','
-                 << frame.unmanagedPulseMask << ','
-                 << frame.managedMask << ','
-                 << frame.committedDownMask << ','
-                 << frame.committedPressedMask << ','
-                 << frame.committedReleasedMask << ','
-                 << frame.moveX << ','
-                 << frame.moveY << ','
-                 << frame.lookX << ','
-                 << frame.lookY << ','
-                 << frame.leftTrigger << ','
-                 << frame.rightTrigger << ','
-                 << BoolString(frame.hasDigital) << ','
-                 << BoolString(frame.hasAnalog) << ','
-                 << BoolString(frame.overflowed) << ','
-                 << BoolString(frame.coalesced);
-            return line.str();
-        }
-
-        const char* ToString(input::backend::KeyboardBridgeCommandType type)
-        {
-            switch (type) {
-            case input::backend::KeyboardBridgeCommandType::Press:
-                return "press";
-            case input::backend::KeyboardBridgeCommandType::Release:
-                return "release";
-            case input::backend::KeyboardBridgeCommandType::Pulse:
-                return "pulse";
-            case input::backend::KeyboardBridgeCommandType::Reset:
-                return "reset";
-            case input::backend::KeyboardBridgeCommandType::None:
-            default:
-                return "none";
-            }
+            return std::span<const input::PadEvent>(snapshot.events.events.data(), snapshot.events.count);
         }
     }
 
@@ -162,115 +49,201 @@ namespace dualpad::input_v2::telemetry
     void InputTraceRecorder::ResetSession()
     {
         std::scoped_lock lock(_mutex);
-        _activeRoot.clear();
-        _activeSession.clear();
-        _headersReady = false;
-        _replaySessionActive = false;
-        _activeSnapshotSequence = 0;
-        _keyboardCommandSequence = 0;
-        _scheduleStepIndex = 0;
-        _keyboardCommandIndex = 0;
-        _glyphQueryId = 0;
+        DrainLocked();
+        CloseLocked();
+        _replayRoot.clear();
+        _replaySession.clear();
+        _replaySessionActive.store(false, std::memory_order_release);
+        _activeSnapshotSequence.store(0, std::memory_order_relaxed);
     }
 
     void InputTraceRecorder::BeginReplaySession(const std::filesystem::path& root, std::string_view session)
     {
         std::scoped_lock lock(_mutex);
-        _activeRoot = root;
-        _activeSession = std::string(session);
-        _headersReady = false;
-        _replaySessionActive = true;
-        _activeSnapshotSequence = 0;
-        _keyboardCommandSequence = 0;
-        _scheduleStepIndex = 0;
-        _keyboardCommandIndex = 0;
-        _glyphQueryId = 0;
-        EnsureHeadersLocked();
+        DrainLocked();
+        CloseLocked();
+        _replayRoot = root;
+        _replaySession = std::string(session);
+        _replaySessionActive.store(true, std::memory_order_release);
+        _activeSnapshotSequence.store(0, std::memory_order_relaxed);
+        OpenLocked(ResolveSessionDirectoryLocked());
     }
 
     void InputTraceRecorder::EndReplaySession()
     {
         std::scoped_lock lock(_mutex);
-        _replaySessionActive = false;
+        if (!_replaySessionActive.load(std::memory_order_acquire)) {
+            return;
+        }
+
+        DrainLocked();
+        const auto directory = ResolveSessionDirectoryLocked();
+        CloseLocked();
+        _replaySessionActive.store(false, std::memory_order_release);
+        try {
+            (void)ConvertTraceToPhase0Csv(directory / kTraceRecordFileName, directory);
+        } catch (const std::exception&) {
+            ++_conversionFailures;
+        }
     }
 
     void InputTraceRecorder::SetActiveSnapshotSequence(std::uint64_t sequence)
+    {
+        _activeSnapshotSequence.store(sequence, std::memory_order_relaxed);
+    }
+
+    void InputTraceRecorder::Flush()
     {
         std::scoped_lock lock(_mutex);
-        _activeSnapshotSequence = sequence;
+        DrainLocked();
+    }
+
+    InputTraceRecorder::Stats InputTraceRecorder::GetStats() const
+    {
+        std::scoped_lock lock(_mutex);
+        return Stats{
+            .records = _records.load(std::memory_order_relaxed),
+            .droppedRecords = _droppedRecords.load(std::memory_order_relaxed),
+            .bytesWritten = _bytesWritten,
+            .segments = _segments,
+            .conversionFailures = _conversionFailures
+        };
+    }
+
+    bool InputTraceRecorder::IsCapturing() const
+    {
+        return _replaySessionActive.load(std::memory_order_acquire) ||
+               input::RuntimeConfig::GetSingleton().EnableTraceRecording();
+    }
+
+    std::uint64_t InputTraceRecorder::NextOrder()
+    {
+        return _nextOrder.fetch_add(1, std::memory_order_relaxed);
     }
 
-    bool InputTraceRecorder::EnsureSessionLocked()
+    std::shared_ptr<TraceRecordRing> InputTraceRecorder::RegisterThreadRing()
     {
-        if (_replaySessionActive) {
-            EnsureHeadersLocked();
-            return true;
+        auto ring = std::make_shared<TraceRecordRing>();
+        std::scoped_lock lock(_mutex);
+        _rings.push_back(ring);
+        if (!_writer.joinable()) {
+            _writer = std::jthread([this](std::stop_token stop) { WriterLoop(stop); });
         }
+        return ring;
+    }
 
-        const auto& config = input::RuntimeConfig::GetSingleton();
-        if (!config.EnableTraceRecording()) {
-            return false;
+    void InputTraceRecorder::PushRecord(std::string_view record)
+    {
+        auto& slot = tThreadRing;
+        if (!slot.ring) {
+            slot.ring = RegisterThreadRing();
         }
 
-        const auto root = config.TraceOutputDir();
-        const auto session = config.TraceSession();
-        if (_activeRoot != root || _activeSession != session) {
-            _activeRoot = root;
-            _activeSession = std::string(session);
-            _headersReady = false;
-            _activeSnapshotSequence = 0;
-            _keyboardCommandSequence = 0;
-            _scheduleStepIndex = 0;
-            _keyboardCommandIndex = 0;
-            _glyphQueryId = 0;
+        if (!slot.ring->TryPush(record)) {
+            // A replay session must keep every record: write the ring out
+            // on this thread and retry rather than drop.
+            if (_replaySessionActive.load(std::memory_order_acquire)) {
+                std::scoped_lock lock(_mutex);
+                DrainLocked();
+                if (slot.ring->TryPush(record)) {
+                    _records.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+            }
+            _droppedRecords.fetch_add(1, std::memory_order_relaxed);
+            _drainRequested.store(true, std::memory_order_release);
+            _wake.notify_one();
+            return;
         }
 
-        EnsureHeadersLocked();
-        return true;
+        _records.fetch_add(1, std::memory_order_relaxed);
+        if (slot.ring->Pending() >= TraceRecordRing::kCapacity / 2) {
+            _drainRequested.store(true, std::memory_order_release);
+            _wake.notify_one();
+        }
     }
 
-    void InputTraceRecorder::EnsureHeadersLocked()
+    void InputTraceRecorder::WriterLoop(std::stop_token stop)
     {
-        if (_headersReady) {
+        std::unique_lock lock(_mutex);
+        while (!stop.stop_requested()) {
+            (void)_wake.wait_for(lock, stop, kFlushInterval, [this] {
+                return _drainRequested.exchange(false, std::memory_order_acq_rel);
+            });
+            DrainLocked(!stop.stop_requested());
+        }
+        CloseLocked();
+    }
+
+    void InputTraceRecorder::DrainLocked(bool retarget)
+    {
+        _drainBuffer.clear();
+        for (const auto& ring : _rings) {
+            (void)ring->DrainTo(_drainBuffer);
+        }
+        std::erase_if(_rings, [](const std::shared_ptr<TraceRecordRing>& ring) {
+            return ring->Retired() && ring->Pending() == 0;
+        });
+        if (_drainBuffer.empty()) {
             return;
         }
 
-        const auto directory = ResolveSessionDirectoryLocked();
-        std::filesystem::create_directories(directory);
-        for (const auto& spec : Phase0TraceFiles()) {
-            const auto filePath = directory / spec.name;
-            if (std::filesystem::exists(filePath) && std::filesystem::file_size(filePath) != 0) {
-                continue;
+        if (retarget) {
+            const auto directory = ResolveSessionDirectoryLocked();
+            if (!_out.is_open() || directory != _openDirectory) {
+                CloseLocked();
+                OpenLocked(directory);
             }
-
-            std::ofstream out(filePath, std::ios::trunc);
-            out << spec.header << '\n';
+        }
+        if (!_out.is_open()) {
+            return;
         }
 
-        _headersReady = true;
+        _out.write(_drainBuffer.data(), static_cast<std::streamsize>(_drainBuffer.size()));
+        _out.flush();
+        _bytesWritten += _drainBuffer.size();
     }
 
-    void InputTraceRecorder::EnsureOptionalHeaderLocked(std::string_view fileName, std::string_view header)
+    void InputTraceRecorder::OpenLocked(const std::filesystem::path& directory)
     {
-        const auto filePath = ResolveSessionDirectoryLocked() / fileName;
-        if (std::filesystem::exists(filePath) && std::filesystem::file_size(filePath) != 0) {
+        std::error_code error;
+        std::filesystem::create_directories(directory, error);
+        _out.open(directory / kTraceRecordFileName, std::ios::binary | std::ios::app);
+        if (!_out) {
+            _out.close();
             return;
         }
 
-        std::ofstream out(filePath, std::ios::trunc);
-        out << header << '\n';
+        // Each open starts a segment, so a reopened session restarts its
+        // step and query indices exactly as the CSV writer used to.
+        const TraceSegmentHeader header{
+            .schemaVersion = kTraceSchemaVersion,
+            .layoutFingerprint = TraceLayoutFingerprint()
+        };
+        _out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        _out.flush();
+        _openDirectory = directory;
+        _bytesWritten += sizeof(header);
+        ++_segments;
     }
 
-    std::filesystem::path InputTraceRecorder::ResolveSessionDirectoryLocked() const
+    void InputTraceRecorder::CloseLocked()
     {
-        return _activeRoot / _activeSession;
+        if (_out.is_open()) {
+            _out.close();
+        }
+        _out.clear();
+        _openDirectory.clear();
     }
 
-    void InputTraceRecorder::AppendLineLocked(std::string_view fileName, std::string_view line)
+    std::filesystem::path InputTraceRecorder::ResolveSessionDirectoryLocked() const
     {
-        const auto filePath = ResolveSessionDirectoryLocked() / fileName;
-        std::ofstream out(filePath, std::ios::app);
-        out << line << '\n';
+        if (_replaySessionActive.load(std::memory_order_acquire)) {
+            return _replayRoot / _replaySession;
+        }
+
+        const auto& config = input::RuntimeConfig::GetSingleton();
+        return config.TraceOutputDir() / config.TraceSession();
     }
 
     void InputTraceRecorder::RecordDispatcherSubmit(
@@ -278,23 +251,29 @@ namespace dualpad::input_v2::telemetry
         std::size_t pendingBefore,
         std::size_t pendingAfter)
     {
-        std::scoped_lock lock(_mutex);
-        if (!EnsureSessionLocked()) {
+        auto& flight = FlightRecorder::GetSingleton();
+        const bool capturing = IsCapturing();
+        if (!capturing && !flight.IsArmed()) {
             return;
         }
 
-        std::ostringstream schedule;
-        schedule << _scheduleStepIndex++ << ",submit,"
-                 << snapshot.sequence
-                 << ",0,frame_pump_disabled,disabled,none,false,"
-                 << pendingBefore << ','
-                 << pendingAfter
-                 << ",0";
-        AppendLineLocked("dispatcher_schedule.csv", schedule.str());
-        AppendLineLocked("ingress_snapshot_frames.csv", SnapshotFrameLine(snapshot));
-        for (std::size_t i = 0; i < snapshot.events.count; ++i) {
-            AppendLineLocked("ingress_snapshot_events.csv", SnapshotEventLine(snapshot.sequence, i, snapshot.events[i]));
+        const TraceDispatcherSubmit submit{
+            .frame = MakeTraceSnapshotFrame(snapshot),
+            .pendingBefore = pendingBefore,
+            .pendingAfter = pendingAfter
+        };
+        flight.Capture(submit, SnapshotEvents(snapshot));
+        if (!capturing) {
+            return;
         }
+
+        auto& buffer = tRecordScratch;
+        buffer.clear();
+        TraceRecordEncoder record(buffer, TraceRecordKind::DispatcherSubmit, NextOrder());
+        record.Put(submit);
+        record.PutSpan(SnapshotEvents(snapshot));
+        record.Finish();
+        PushRecord(buffer);
     }
 
     void InputTraceRecorder::RecordDispatcherDrain(
@@ -304,22 +283,34 @@ namespace dualpad::input_v2::telemetry
         std::size_t pendingBefore,
         std::size_t pendingAfter)
     {
-        std::scoped_lock lock(_mutex);
-        if (!EnsureSessionLocked()) {
+        auto& flight = FlightRecorder::GetSingleton();
+        const bool capturing = IsCapturing();
+        if (!capturing && !flight.IsArmed()) {
+            return;
+        }
+
+        const TraceDispatcherDrain drain{
+            .reason = telemetry.reason,
+            .routeState = telemetry.routeState,
+            .hasLastPollAge = telemetry.lastPollAgeMs.has_value(),
+            .hookInstalled = telemetry.hookInstalled,
+            .lastPollAgeMs = telemetry.lastPollAgeMs.value_or(0),
+            .budget = budget,
+            .drained = drained,
+            .pendingBefore = pendingBefore,
+            .pendingAfter = pendingAfter
+        };
+        flight.Capture(drain);
+        if (!capturing) {
             return;
         }
 
-        std::ostringstream schedule;
-        schedule << _scheduleStepIndex++ << ",drain,0,"
-                 << budget << ','
-                 << input::ToString(telemetry.reason) << ','
-                 << input::ToString(telemetry.routeState) << ','
-                 << LastPollAgeString(telemetry) << ','
-                 << BoolString(telemetry.hookInstalled) << ','
-                 << pendingBefore << ','
-                 << pendingAfter << ','
-                 << drained;
-        AppendLineLocked("dispatcher_schedule.csv", schedule.str());
+        auto& buffer = tRecordScratch;
+        buffer.clear();
+        TraceRecordEncoder record(buffer, TraceRecordKind::DispatcherDrain, NextOrder());
+        record.Put(drain);
+        record.Finish();
+        PushRecord(buffer);
     }
 
     void InputTraceRecorder::RecordProcessedSnapshot(
@@ -327,29 +318,29 @@ namespace dualpad::input_v2::telemetry
         const input::AuthoritativePollFrame& pollFrame,
         const ReplayCompatibilitySurface& presentationSurface)
     {
-        std::scoped_lock lock(_mutex);
-        if (!EnsureSessionLocked()) {
+        if (!IsCapturing()) {
             return;
         }
 
-        AppendLineLocked("processed_snapshot_frames.csv", SnapshotFrameLine(snapshot));
-        for (std::size_t i = 0; i < snapshot.events.count; ++i) {
-            AppendLineLocked("processed_snapshot_events.csv", SnapshotEventLine(snapshot.sequence, i, snapshot.events[i]));
-        }
-        AppendLineLocked("expected_authoritative_poll.csv", PollFrameLine(pollFrame));
-
-        std::ostringstream presentation;
-        presentation << snapshot.sequence << ','
-                     << input::ToString(presentationSurface.context) << ','
-                     << presentationSurface.contextEpoch << ','
-                     << BoolString(presentationSurface.isUsingGamepad) << ','
-                     << BoolString(presentationSurface.gamepadControlsCursor) << ','
-                     << BoolString(presentationSurface.gamepadDeviceEnabled) << ','
-                     << presentationSurface.presentationOwner << ','
-                     << presentationSurface.cursorOwner << ','
-                     << presentationSurface.gameplayEngineOwner << ','
-                     << presentationSurface.gameplayMenuEntryOwner;
-        AppendLineLocked("expected_presentation_surface.csv", presentation.str());
+        auto& buffer = tRecordScratch;
+        buffer.clear();
+        TraceRecordEncoder record(buffer, TraceRecordKind::ProcessedSnapshot, NextOrder());
+        record.Put(TraceProcessedSnapshot{
+            .frame = MakeTraceSnapshotFrame(snapshot),
+            .poll = pollFrame,
+            .surfaceContext = presentationSurface.context,
+            .surfaceContextEpoch = presentationSurface.contextEpoch,
+            .isUsingGamepad = presentationSurface.isUsingGamepad,
+            .gamepadControlsCursor = presentationSurface.gamepadControlsCursor,
+            .gamepadDeviceEnabled = presentationSurface.gamepadDeviceEnabled,
+            .presentationOwner = presentationSurface.presentationOwner,
+            .cursorOwner = presentationSurface.cursorOwner,
+            .gameplayEngineOwner = presentationSurface.gameplayEngineOwner,
+            .gameplayMenuEntryOwner = presentationSurface.gameplayMenuEntryOwner
+        });
+        record.PutSpan(SnapshotEvents(snapshot));
+        record.Finish();
+        PushRecord(buffer);
     }
 
     void InputTraceRecorder::RecordKeyboardCommand(
@@ -359,25 +350,23 @@ namespace dualpad::input_v2::telemetry
         input::backend::ActionOutputContract contract,
         input::InputContext context)
     {
-        std::scoped_lock lock(_mutex);
-        if (!EnsureSessionLocked()) {
+        if (!IsCapturing()) {
             return;
         }
 
-        std::ostringstream command;
-        if (_keyboardCommandSequence != _activeSnapshotSequence) {
-            _keyboardCommandSequence = _activeSnapshotSequence;
-            _keyboardCommandIndex = 0;
-        }
-
-        command << _activeSnapshotSequence << ','
-                << _keyboardCommandIndex++ << ','
-                << ToString(type) << ','
-                << static_cast<unsigned int>(scancode) << ','
-                << EscapeCsv(actionId) << ','
-                << input::backend::ToString(contract) << ','
-                << input::ToString(context);
-        AppendLineLocked("expected_keyboard_bridge.csv", command.str());
+        auto& buffer = tRecordScratch;
+        buffer.clear();
+        TraceRecordEncoder record(buffer, TraceRecordKind::KeyboardCommand, NextOrder());
+        record.Put(TraceKeyboardCommand{
+            .sequence = _activeSnapshotSequence.load(std::memory_order_relaxed),
+            .type = type,
+            .scancode = scancode,
+            .contract = contract,
+            .context = context
+        });
+        record.PutString(actionId);
+        record.Finish();
+        PushRecord(buffer);
     }
 
     void InputTraceRecorder::RecordGlyphResult(
@@ -385,55 +374,115 @@ namespace dualpad::input_v2::telemetry
         std::string_view requestedContextName,
         const input::glyph::GlyphResolutionCompatResult& resolution)
     {
-        std::scoped_lock lock(_mutex);
-        if (!EnsureSessionLocked()) {
+        if (!IsCapturing()) {
             return;
         }
 
-        const auto queryId = _glyphQueryId++;
-        std::ostringstream query;
-        query << queryId << ','
-              << _activeSnapshotSequence << ','
-              << EscapeCsv(actionId) << ','
-              << EscapeCsv(requestedContextName);
-        AppendLineLocked("glyph_queries.csv", query.str());
-
-        std::ostringstream result;
-        result << queryId << ','
-               << BoolString(resolution.ok) << ','
-               << EscapeCsv(resolution.ok ? std::string_view(resolution.token) : std::string_view("")) << ','
-               << EscapeCsv(actionId) << ','
-               << EscapeCsv(requestedContextName);
-        AppendLineLocked("expected_glyph_results.csv", result.str());
+        auto& buffer = tRecordScratch;
+        buffer.clear();
+        TraceRecordEncoder record(buffer, TraceRecordKind::GlyphResult, NextOrder());
+        record.Put(TraceGlyphResult{
+            .sequence = _activeSnapshotSequence.load(std::memory_order_relaxed),
+            .ok = resolution.ok
+        });
+        record.PutString(actionId);
+        record.PutString(requestedContextName);
+        record.PutString(resolution.ok ? std::string_view(resolution.token) : std::string_view{});
+        record.Finish();
+        PushRecord(buffer);
     }
 
     void InputTraceRecorder::RecordRuntimeDebugSnapshot(const gameplay::RuntimeDebugSnapshot& snapshot)
     {
-        std::scoped_lock lock(_mutex);
-        if (!EnsureSessionLocked()) {
+        if (!IsCapturing()) {
+            return;
+        }
+
+        auto& buffer = tRecordScratch;
+        buffer.clear();
+        TraceRecordEncoder record(buffer, TraceRecordKind::RuntimeDebugSnapshot, NextOrder());
+        record.Put(TraceRuntimeDebugSnapshot{
+            .firstSeq = snapshot.firstSeq,
+            .lastSeq = snapshot.lastSeq,
+            .runtimeHealthReasons = snapshot.runtimeHealthReasons,
+            .runtimeHealthDegraded = snapshot.runtimeHealthDegraded,
+            .overflowTransition = snapshot.overflowTransition,
+            .overflowTypedCompaction = snapshot.overflowTypedCompaction
+        });
+        record.PutString(snapshot.frameKind);
+        record.PutString(snapshot.transitionReason);
+        record.PutString(snapshot.runtimeHealthReasonSummary);
+        record.PutString(snapshot.runtimeHealthDebugReason);
+        record.PutString(snapshot.hookInstallStatusName);
+        record.PutString(snapshot.hookInstallDebugReason);
+        record.PutString(snapshot.promptStateName);
+        record.PutString(snapshot.promptDebugReason);
+        record.PutString(snapshot.overflowCompactionSummary);
+        record.Finish();
+        PushRecord(buffer);
+    }
+
+    void InputTraceRecorder::RecordDeadlineTick(
+        std::uint64_t sequence,
+        std::uint64_t nowUs,
+        const input::AuthoritativePollFrame& pollFrame,
+        std::uint32_t firedChanges,
+        std::uint32_t runtimeHealthReasons,
+        bool outputApplySucceeded)
+    {
+        auto& flight = FlightRecorder::GetSingleton();
+        const bool capturing = IsCapturing();
+        if (!capturing && !flight.IsArmed()) {
+            return;
+        }
+
+        const TraceDeadlineTick tick{
+            .sequence = sequence,
+            .nowUs = nowUs,
+            .poll = pollFrame,
+            .firedChanges = firedChanges,
+            .runtimeHealthReasons = runtimeHealthReasons,
+            .outputApplySucceeded = outputApplySucceeded
+        };
+        flight.Capture(tick);
+        if (!capturing) {
+            return;
+        }
+
+        auto& buffer = tRecordScratch;
+        buffer.clear();
+        TraceRecordEncoder record(buffer, TraceRecordKind::DeadlineTick, NextOrder());
+        record.Put(tick);
+        record.Finish();
+        PushRecord(buffer);
+    }
+
+    void InputTraceRecorder::RecordManifestTransition(
+        std::uint64_t sequence,
+        std::uint32_t manifestEpoch,
+        bool preservesInteractionState)
+    {
+        auto& flight = FlightRecorder::GetSingleton();
+        const bool capturing = IsCapturing();
+        if (!capturing && !flight.IsArmed()) {
+            return;
+        }
+
+        const TraceManifestTransition transition{
+            .sequence = sequence,
+            .manifestEpoch = manifestEpoch,
+            .preservesInteractionState = preservesInteractionState
+        };
+        flight.Capture(transition);
+        if (!capturing) {
             return;
         }
 
-        EnsureOptionalHeaderLocked(
-            "runtime_debug_snapshot.csv",
-            "first_seq,last_seq,frame_kind,transition_reason,degraded,reason_mask,reason_names,debug_reason,hook_status,hook_debug_reason,prompt_state,prompt_reason,overflow_transition,overflow_typed_compaction,overflow_compaction_summary");
-
-        std::ostringstream line;
-        line << snapshot.firstSeq << ','
-             << snapshot.lastSeq << ','
-             << snapshot.frameKind << ','
-             << snapshot.transitionReason << ','
-             << BoolString(snapshot.runtimeHealthDegraded) << ','
-             << snapshot.runtimeHealthReasons << ','
-             << EscapeCsv(snapshot.runtimeHealthReasonSummary) << ','
-             << EscapeCsv(snapshot.runtimeHealthDebugReason) << ','
-             << snapshot.hookInstallStatusName << ','
-             << EscapeCsv(snapshot.hookInstallDebugReason) << ','
-             << snapshot.promptStateName << ','
-             << EscapeCsv(snapshot.promptDebugReason) << ','
-             << BoolString(snapshot.overflowTransition) << ','
-             << BoolString(snapshot.overflowTypedCompaction) << ','
-             << EscapeCsv(snapshot.overflowCompactionSummary);
-        AppendLineLocked("runtime_debug_snapshot.csv", line.str());
+        auto& buffer = tRecordScratch;
+        buffer.clear();
+        TraceRecordEncoder record(buffer, TraceRecordKind::ManifestTransition, NextOrder());
+        record.Put(transition);
+        record.Finish();
+        PushRecord(buffer);
     }
 }
@@ -6,11 +6,20 @@
 #include "input/glyph/GlyphResolutionCompat.h"
 #include "input/injection/PadEventSnapshot.h"
 #include "input/injection/RouteHealthContract.h"
+#include "input_v2/presentation/PresentationProjection.h"
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdint>
 #include <filesystem>
+#include <fstream>
+#include <memory>
 #include <mutex>
+#include <string>
 #include <string_view>
+#include <thread>
+#include <vector>
 
 namespace dualpad::input_v2::gameplay
 {
@@ -19,6 +28,8 @@ namespace dualpad::input_v2::gameplay
 
 namespace dualpad::input_v2::telemetry
 {
+    class TraceRecordRing;
+
     struct ReplayCompatibilitySurface
     {
         input::InputContext context{ input::InputContext::Gameplay };
@@ -26,21 +37,47 @@ namespace dualpad::input_v2::telemetry
         bool isUsingGamepad{ false };
         bool gamepadControlsCursor{ false };
         bool gamepadDeviceEnabled{ false };
-        std::string presentationOwner;
-        std::string cursorOwner;
-        std::string gameplayEngineOwner;
-        std::string gameplayMenuEntryOwner;
+        presentation::PresentationOwner presentationOwner{ presentation::PresentationOwner::KeyboardMouse };
+        presentation::PresentationOwner cursorOwner{ presentation::PresentationOwner::KeyboardMouse };
+        presentation::PresentationOwner gameplayEngineOwner{ presentation::PresentationOwner::KeyboardMouse };
+        presentation::PresentationOwner gameplayMenuEntryOwner{ presentation::PresentationOwner::KeyboardMouse };
     };
 
+    // Records trace events as binary records (TraceRecordFormat.h) into a
+    // lock-free ring owned by the calling thread; a background writer
+    // appends them to <session>/trace.dptrace. The phase0 CSV bundle is
+    // produced from that file by ConvertTraceToPhase0Csv, offline through
+    // DualPadTraceCsv or in-process when a replay session ends.
     class InputTraceRecorder
     {
     public:
+        static constexpr std::chrono::milliseconds kFlushInterval{ 50 };
+
+        struct Stats
+        {
+            std::uint64_t records{ 0 };
+            // Records that did not fit their thread's ring. Outside a replay
+            // session the recording thread never waits for the writer; in
+            // one it drains inline, so a drop there fails the replay.
+            std::uint64_t droppedRecords{ 0 };
+            std::uint64_t bytesWritten{ 0 };
+            std::uint64_t segments{ 0 };
+            std::uint64_t conversionFailures{ 0 };
+        };
+
         static InputTraceRecorder& GetSingleton();
 
         void ResetSession();
         void BeginReplaySession(const std::filesystem::path& root, std::string_view session);
+        // Flushes the replay session and rewrites its CSV bundle.
         void EndReplaySession();
         void SetActiveSnapshotSequence(std::uint64_t sequence);
+        // Full trace recording, live or in a replay session. Callers check
+        // it before building anything only a full trace record consumes.
+        // Submits, drains, deadline ticks and manifest transitions also
+        // hand their fixed part to an armed FlightRecorder, whether or not
+        // this is on.
+        [[nodiscard]] bool IsCapturing() const;
         void RecordDispatcherSubmit(
             const input::PadEventSnapshot& snapshot,
             std::size_t pendingBefore,
@@ -66,25 +103,58 @@ namespace dualpad::input_v2::telemetry
             std::string_view requestedContextName,
             const input::glyph::GlyphResolutionCompatResult& resolution);
         void RecordRuntimeDebugSnapshot(const gameplay::RuntimeDebugSnapshot& snapshot);
+        void RecordDeadlineTick(
+            std::uint64_t sequence,
+            std::uint64_t nowUs,
+            const input::AuthoritativePollFrame& pollFrame,
+            std::uint32_t firedChanges,
+            std::uint32_t runtimeHealthReasons,
+            bool outputApplySucceeded);
+        void RecordManifestTransition(
+            std::uint64_t sequence,
+            std::uint32_t manifestEpoch,
+            bool preservesInteractionState);
+
+        // Writes every record pushed before the call to the trace file.
+        void Flush();
+        [[nodiscard]] Stats GetStats() const;
 
     private:
         InputTraceRecorder() = default;
 
-        bool EnsureSessionLocked();
-        void EnsureHeadersLocked();
-        void EnsureOptionalHeaderLocked(std::string_view fileName, std::string_view header);
-        void AppendLineLocked(std::string_view fileName, std::string_view line);
+        [[nodiscard]] std::uint64_t NextOrder();
+        void PushRecord(std::string_view record);
+        [[nodiscard]] std::shared_ptr<TraceRecordRing> RegisterThreadRing();
+        // `retarget` follows a session change; the exiting writer only
+        // finishes the file it already has open.
+        void DrainLocked(bool retarget = true);
+        void OpenLocked(const std::filesystem::path& directory);
+        void CloseLocked();
         std::filesystem::path ResolveSessionDirectoryLocked() const;
+        void WriterLoop(std::stop_token stop);
+
+        // Read and written by recording threads without _mutex.
+        std::atomic<bool> _replaySessionActive{ false };
+        std::atomic<bool> _drainRequested{ false };
+        std::atomic<std::uint64_t> _activeSnapshotSequence{ 0 };
+        std::atomic<std::uint64_t> _nextOrder{ 0 };
+        std::atomic<std::uint64_t> _records{ 0 };
+        std::atomic<std::uint64_t> _droppedRecords{ 0 };
 
-        std::mutex _mutex;
-        std::filesystem::path _activeRoot;
-        std::string _activeSession;
-        bool _headersReady{ false };
-        bool _replaySessionActive{ false };
-        std::uint64_t _activeSnapshotSequence{ 0 };
-        std::uint64_t _keyboardCommandSequence{ 0 };
-        std::uint64_t _scheduleStepIndex{ 0 };
-        std::uint64_t _keyboardCommandIndex{ 0 };
-        std::uint64_t _glyphQueryId{ 0 };
+        // Writer side: the registered rings and the open trace file.
+        mutable std::mutex _mutex;
+        std::condition_variable_any _wake;
+        std::vector<std::shared_ptr<TraceRecordRing>> _rings;
+        std::filesystem::path _replayRoot;
+        std::string _replaySession;
+        std::filesystem::path _openDirectory;
+        std::ofstream _out;
+        std::string _drainBuffer;
+        std::uint64_t _bytesWritten{ 0 };
+        std::uint64_t _segments{ 0 };
+        std::uint64_t _conversionFailures{ 0 };
+        // Started with the first recording thread; declared last so it is
+        // joined before the state above is destroyed.
+        std::jthread _writer;
     };
 }
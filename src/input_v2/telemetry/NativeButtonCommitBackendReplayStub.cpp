@@ -51,6 +51,11 @@ namespace dualpad::input::backend
         return true;
     }
 
+    std::size_t NativeButtonCommitBackend::ApplyPlannedActions(const FrameActionPlan& plan)
+    {
+        return plan.Size();
+    }
+
     void NativeButtonCommitBackend::ForceCancelGateAwareGameplayTransientActions()
     {
     }
@@ -16,10 +16,15 @@
 #include "input_v2/menu/MenuInstanceRegistry.h"
 #include "input_v2/prompt/PromptRuntimeOwner.h"
 #include "input_v2/telemetry/InputTraceRecorder.h"
+#include "input_v2/telemetry/TraceCsvConverter.h"
 #include "input_v2/telemetry/TraceSchema.h"
 
+#include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <fstream>
+#include <iomanip>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <unordered_map>
@@ -46,6 +51,32 @@ namespace dualpad::input_v2::telemetry
 
         bool gReplayManifestSeeded = false;
 
+        // First per-action glyph query after each UI context the prompt
+        // scope enters. Not part of the golden bundle: latency is wall-clock.
+        // Written to the scenario output directory only.
+        struct PromptFirstQuerySample
+        {
+            std::uint64_t sequence{ 0 };
+            std::string contextName;
+            std::string actionId;
+            std::uint32_t promptScopeRevision{ 0 };
+            bool warm{ false };
+            // Time the menu's first frame spent inside its display-frame
+            // lead waiting for the warm-up to land.
+            double prefetchWaitUs{ 0.0 };
+            double firstQueryUs{ 0.0 };
+        };
+
+        constexpr std::string_view kPromptFirstQueryLatencyFile = "prompt_first_frame_latency.csv";
+        std::vector<PromptFirstQuerySample> gPromptFirstQuerySamples;
+        // Family flips between the replay publish and the runtime's are
+        // not menu opens; FamilySwitchStats times those.
+        std::optional<input_v2::context::UiContextId> gPromptFirstQueryContext;
+        // Replay runs a transition frame and the stable frame behind it back
+        // to back; live, the menu that caused them renders its first frame
+        // no sooner than one display frame after opening.
+        constexpr std::chrono::microseconds kPromptFirstFrameLead{ 16'667 };
+
         std::vector<std::string> SplitCsvLine(std::string_view line)
         {
             std::vector<std::string> values;
@@ -499,21 +530,79 @@ namespace dualpad::input_v2::telemetry
             return std::filesystem::current_path();
         }
 
+        // A scenario may carry its own DualPadBindings.ini for interactions
+        // the shipped bindings do not use (e.g. Hold:).
         void LoadReplayRuntimeConfig(const std::filesystem::path& scenarioPath)
         {
             const auto projectRoot = FindProjectRoot(scenarioPath);
+            const auto scenarioBindings = scenarioPath / "DualPadBindings.ini";
             input::RuntimeConfig::GetSingleton().Load(projectRoot / "config" / "DualPadDebug.ini");
             (void)input_v2::config::AtomicConfigReloader::GetSingleton().LoadOrRecover(
-                projectRoot / "config" / "DualPadBindings.ini",
+                std::filesystem::is_regular_file(scenarioBindings) ?
+                    scenarioBindings :
+                    projectRoot / "config" / "DualPadBindings.ini",
                 projectRoot / "config" / "DualPadMenuPolicy.ini");
         }
 
+        struct ReplayDeadlineTick
+        {
+            std::uint64_t stepIndex{ 0 };
+            std::uint64_t sequence{ 0 };
+            std::uint64_t nowUs{ 0 };
+        };
+
+        // Deadline ticks the live runtime fired between frames, in trace order.
+        std::vector<ReplayDeadlineTick> ReadDeadlineTicks(const std::filesystem::path& scenarioPath)
+        {
+            std::vector<ReplayDeadlineTick> ticks;
+            for (const auto& row : ReadScenarioRows(scenarioPath, kDeadlineTickFileName)) {
+                if (row.size() < 3) {
+                    throw std::runtime_error("deadline tick row has too few columns");
+                }
+                ticks.push_back(ReplayDeadlineTick{
+                    .stepIndex = ParseU64(row[0], "step_index"),
+                    .sequence = ParseU64(row[1], "deadline tick sequence"),
+                    .nowUs = ParseU64(row[2], "now_us")
+                });
+            }
+            return ticks;
+        }
+
+        struct ReplayManifestTransition
+        {
+            std::uint64_t stepIndex{ 0 };
+            std::uint64_t sequence{ 0 };
+            bool preservesInteractionState{ false };
+        };
+
+        // Publications after the first frame; the startup one is seeded.
+        std::vector<ReplayManifestTransition> ReadManifestTransitions(const std::filesystem::path& scenarioPath)
+        {
+            std::vector<ReplayManifestTransition> transitions;
+            for (const auto& row : ReadScenarioRows(scenarioPath, kManifestTransitionFileName)) {
+                if (row.size() < 4) {
+                    throw std::runtime_error("manifest transition row has too few columns");
+                }
+                const auto sequence = ParseU64(row[1], "manifest transition sequence");
+                if (sequence == 0) {
+                    continue;
+                }
+                transitions.push_back(ReplayManifestTransition{
+                    .stepIndex = ParseU64(row[0], "step_index"),
+                    .sequence = sequence,
+                    .preservesInteractionState = ParseBool(row[3], "preserves_interaction_state")
+                });
+            }
+            return transitions;
+        }
+
         struct ReplayRuntimeSession
         {
             explicit ReplayRuntimeSession(std::filesystem::path outputPath) :
                 output(std::move(outputPath))
             {
                 std::filesystem::remove_all(output);
+                droppedAtStart = input_v2::telemetry::InputTraceRecorder::GetSingleton().GetStats().droppedRecords;
                 input_v2::telemetry::InputTraceRecorder::GetSingleton().BeginReplaySession(
                     output.parent_path(),
                     output.filename().string());
@@ -522,20 +611,31 @@ namespace dualpad::input_v2::telemetry
 
             ~ReplayRuntimeSession()
             {
-                Finish();
+                if (active) {
+                    input::backend::KeyboardHelperBackend::GetSingleton().SetReplayRouteActive(false);
+                    input_v2::telemetry::InputTraceRecorder::GetSingleton().EndReplaySession();
+                }
             }
 
+            // Throws when the trace lost a record: the converted bundle
+            // would silently miss rows.
             void Finish()
             {
                 if (!active) {
                     return;
                 }
-                input::backend::KeyboardHelperBackend::GetSingleton().SetReplayRouteActive(false);
-                input_v2::telemetry::InputTraceRecorder::GetSingleton().EndReplaySession();
                 active = false;
+                input::backend::KeyboardHelperBackend::GetSingleton().SetReplayRouteActive(false);
+                auto& recorder = input_v2::telemetry::InputTraceRecorder::GetSingleton();
+                recorder.EndReplaySession();
+                const auto dropped = recorder.GetStats().droppedRecords - droppedAtStart;
+                if (dropped > 0) {
+                    throw std::runtime_error("replay trace dropped " + std::to_string(dropped) + " records");
+                }
             }
 
             std::filesystem::path output;
+            std::uint64_t droppedAtStart{ 0 };
             bool active{ true };
         };
 
@@ -546,6 +646,8 @@ namespace dualpad::input_v2::telemetry
             input_v2::context::ContextResolver::GetSingleton().ResetForTests();
             input_v2::prompt::PromptRuntimeOwner::GetSingleton().ResetForTests();
             gReplayManifestSeeded = false;
+            gPromptFirstQuerySamples.clear();
+            gPromptFirstQueryContext.reset();
             input::backend::KeyboardHelperBackend::GetSingleton().SetReplayRouteActive(true);
         }
 
@@ -555,12 +657,8 @@ namespace dualpad::input_v2::telemetry
             gReplayManifestSeeded = false;
         }
 
-        void SeedReplayManifestForSnapshot(const input::PadEventSnapshot& snapshot)
+        void PushReplayManifestMarker(std::uint64_t monotonicUs, bool preservesInteractionState)
         {
-            if (gReplayManifestSeeded) {
-                return;
-            }
-
             const auto bundle = input_v2::config::AtomicConfigReloader::GetSingleton().GetActiveBundleSnapshot();
             if (!bundle) {
                 return;
@@ -569,18 +667,130 @@ namespace dualpad::input_v2::telemetry
             input_v2::ingress::IngressEvent marker{};
             marker.kind = input_v2::ingress::IngressKind::ManifestEpochChanged;
             marker.source = input_v2::ingress::IngressSource::ManifestPublisher;
-            marker.monotonicUs = snapshot.sourceTimestampUs;
+            marker.monotonicUs = monotonicUs;
             marker.manifest.manifestEpoch = static_cast<std::uint32_t>(bundle->manifestEpoch);
+            marker.manifest.preservesInteractionState = preservesInteractionState;
             (void)input_v2::ingress::IngressHub::GetSingleton().PushEvent(std::move(marker));
+        }
+
+        void SeedReplayManifestForSnapshot(const input::PadEventSnapshot& snapshot)
+        {
+            if (gReplayManifestSeeded ||
+                !input_v2::config::AtomicConfigReloader::GetSingleton().GetActiveBundleSnapshot()) {
+                return;
+            }
+
+            PushReplayManifestMarker(snapshot.sourceTimestampUs, false);
             gReplayManifestSeeded = true;
         }
 
+        // Re-issues the recorded mid-session publications against the
+        // replay bundle. The config content of a live reload is not traced,
+        // so only its interaction-state handling is reproduced.
+        void ReplayManifestTransitions(
+            const std::vector<ReplayManifestTransition>& transitions,
+            std::uint64_t key,
+            std::uint64_t ReplayManifestTransition::*field,
+            std::uint64_t monotonicUs)
+        {
+            for (const auto& transition : transitions) {
+                if (transition.*field == key) {
+                    PushReplayManifestMarker(monotonicUs, transition.preservesInteractionState);
+                }
+            }
+        }
+
+        // First action of the published scope with a display binding, found
+        // straight from the graph so picking it costs the menu nothing the
+        // resolver would not also pay.
+        std::optional<std::string_view> FirstDisplayedAction(
+            const input_v2::actions::CompiledActionGraph& graph,
+            const input_v2::prompt::PublishedPromptScope& scope)
+        {
+            for (const auto& anchorId : scope.actionSetStack.scopeAnchorIds) {
+                const auto bindingIt = graph.lookups.bindingIdsByActionSetId.find(anchorId);
+                if (bindingIt == graph.lookups.bindingIdsByActionSetId.end()) {
+                    continue;
+                }
+                for (const auto bindingId : bindingIt->second) {
+                    const auto* binding = graph.FindBinding(bindingId);
+                    const bool displayed = binding && (std::ranges::any_of)(
+                        graph.displayBindings,
+                        [&](const auto& display) { return display.bindingId == bindingId; });
+                    if (displayed) {
+                        return std::string_view(binding->actionId);
+                    }
+                }
+            }
+            return std::nullopt;
+        }
+
+        // Times the per-action glyph query a menu issues on its first
+        // rendered frame, sampled after the runtime processed the frame that
+        // published the scope. The prefetch worker gets one display frame at
+        // most: a cold sample is a menu that beat the warm-up.
+        void MeasurePromptFirstQuery(std::uint64_t sequence)
+        {
+            auto& owner = input_v2::prompt::PromptRuntimeOwner::GetSingleton();
+            const auto scope = owner.GetPublishedPromptScopeForTests();
+            if (scope.state != input_v2::prompt::PromptScopeState::Ready ||
+                scope.uiContextId == gPromptFirstQueryContext) {
+                return;
+            }
+
+            const auto bundle = input_v2::config::AtomicConfigReloader::GetSingleton().GetActiveBundleSnapshot();
+            const auto& catalog = bundle ? bundle->catalog : input_v2::context::ContextCatalog::BuiltInCatalog();
+            const auto* entry = input_v2::context::ContextCatalog::FindById(catalog, scope.uiContextId);
+            const auto graph = input_v2::actions::CompiledActionGraphPublisher::GetRuntimeOwner().GetActiveGraph();
+            if (!entry || !graph) {
+                return;
+            }
+            const auto actionId = FirstDisplayedAction(*graph, scope);
+            if (!actionId) {
+                return;
+            }
+            gPromptFirstQueryContext = scope.uiContextId;
+
+            const auto waitStart = std::chrono::steady_clock::now();
+            (void)owner.WaitForPrefetchForTests(kPromptFirstFrameLead);
+            const auto waited = std::chrono::steady_clock::now() - waitStart;
+            const auto hitsBefore = owner.GetResolutionStats().hits;
+            const auto start = std::chrono::steady_clock::now();
+            (void)owner.ResolveLegacyGlyph(*actionId, entry->canonicalContextName);
+            const auto elapsed = std::chrono::steady_clock::now() - start;
+
+            gPromptFirstQuerySamples.push_back(PromptFirstQuerySample{
+                .sequence = sequence,
+                .contextName = entry->canonicalContextName,
+                .actionId = std::string(*actionId),
+                .promptScopeRevision = scope.promptScopeRevision,
+                .warm = owner.GetResolutionStats().hits > hitsBefore,
+                .prefetchWaitUs = std::chrono::duration<double, std::micro>(waited).count(),
+                .firstQueryUs = std::chrono::duration<double, std::micro>(elapsed).count()
+            });
+        }
+
+        void WritePromptFirstQueryLatency(const std::filesystem::path& outputPath)
+        {
+            std::filesystem::create_directories(outputPath);
+            std::ofstream out(outputPath / std::string(kPromptFirstQueryLatencyFile), std::ios::trunc);
+            out << std::fixed << std::setprecision(3);
+            out << "sequence,context,action_id,prompt_scope_revision,warm,prefetch_wait_us,first_query_us\n";
+            for (const auto& sample : gPromptFirstQuerySamples) {
+                out << sample.sequence << ',' << sample.contextName << ',' << sample.actionId << ','
+                    << sample.promptScopeRevision << ','
+                    << (sample.warm ? "true" : "false") << ',' << sample.prefetchWaitUs << ','
+                    << sample.firstQueryUs << '\n';
+            }
+        }
+
         void ProcessSnapshotThroughRuntime(const input::PadEventSnapshot& snapshot)
         {
             PublishReplayContext(snapshot.context, snapshot.contextEpoch);
             SeedReplayManifestForSnapshot(snapshot);
             input_v2::telemetry::InputTraceRecorder::GetSingleton().SetActiveSnapshotSequence(snapshot.sequence);
             input::PadEventSnapshotProcessor::GetSingleton().Process(snapshot);
+            MeasurePromptFirstQuery(snapshot.sequence);
         }
 
         void ProcessSnapshotThroughRuntimeSink(const input::PadEventSnapshot& snapshot, void*)
@@ -619,6 +829,28 @@ namespace dualpad::input_v2::telemetry
             }
         }
 
+        // Processor replay has no drains, so its ticks cannot number their
+        // schedule step; they take the step of the recorded tick they match.
+        void CarryDeadlineTickSteps(
+            const std::filesystem::path& scenarioPath,
+            const std::filesystem::path& outputPath)
+        {
+            const auto expected = ReadScenarioRows(scenarioPath, kDeadlineTickFileName);
+            auto actual = ReadCsvRows(outputPath / std::string(kDeadlineTickFileName));
+            if (actual.empty() || actual.size() != expected.size()) {
+                return;
+            }
+            for (std::size_t i = 0; i < actual.size(); ++i) {
+                if (!actual[i].empty() && !expected[i].empty()) {
+                    actual[i][0] = expected[i][0];
+                }
+            }
+            WriteCsvRows(
+                outputPath,
+                TraceFileSpec{ .name = kDeadlineTickFileName, .header = kDeadlineTickHeader },
+                actual);
+        }
+
         // Legacy CSV simulator retained as a fixture-test helper only. Dispatcher
         // and processor replay modes must use the runtime seams below.
         [[maybe_unused]] CsvRows GenerateSyntheticPollRowsForFixtureTests(
@@ -721,19 +953,34 @@ namespace dualpad::input_v2::telemetry
             const std::filesystem::path& scenarioPath,
             const std::filesystem::path& outputPath)
         {
+            // deadline_ticks.csv is optional; a missing file expects no ticks.
+            // A partial capture names the files it recorded instead.
+            std::vector<std::string> compared;
             for (const auto& spec : Phase0TraceFiles()) {
-                const auto expected = ReadCsvRows(scenarioPath / std::string(spec.name));
-                const auto actual = ReadCsvRows(outputPath / std::string(spec.name));
+                compared.emplace_back(spec.name);
+            }
+            compared.emplace_back(kDeadlineTickFileName);
+            if (std::filesystem::is_regular_file(scenarioPath / std::string(kCapturedOutputsFileName))) {
+                compared.clear();
+                for (const auto& row : ReadScenarioRows(scenarioPath, kCapturedOutputsFileName)) {
+                    if (!row.empty()) {
+                        compared.push_back(row[0]);
+                    }
+                }
+            }
+            for (const auto& name : compared) {
+                const auto expected = ReadCsvRows(scenarioPath / name);
+                const auto actual = ReadCsvRows(outputPath / name);
                 if (expected.size() != actual.size()) {
                     return Fail(
-                        std::string(spec.name) +
+                        name +
                         ": runtime row count mismatch expected=" + std::to_string(expected.size()) +
                         " actual=" + std::to_string(actual.size()));
                 }
                 for (std::size_t i = 0; i < expected.size(); ++i) {
                     if (expected[i] != actual[i]) {
                         return Fail(
-                            std::string(spec.name) +
+                            name +
                             ": runtime row mismatch at data row " + std::to_string(i + 1) +
                             " expected=" + JoinCsvRow(expected[i]) +
                             " actual=" + JoinCsvRow(actual[i]));
@@ -795,13 +1042,27 @@ namespace dualpad::input_v2::telemetry
                 const auto processedFrames = ReadScenarioRows(scenarioPath, "processed_snapshot_frames.csv");
                 const auto processedEvents = ReadScenarioRows(scenarioPath, "processed_snapshot_events.csv");
                 const auto eventsBySequence = EventsBySequence(processedEvents);
+                const auto deadlineTicks = ReadDeadlineTicks(scenarioPath);
+                const auto manifestTransitions = ReadManifestTransitions(scenarioPath);
+                auto nextTick = deadlineTicks.begin();
                 for (const auto& frame : processedFrames) {
-                    ProcessSnapshotThroughRuntime(BuildSnapshot(frame, eventsBySequence));
+                    const auto snapshot = BuildSnapshot(frame, eventsBySequence);
+                    ProcessSnapshotThroughRuntime(snapshot);
+                    ReplayManifestTransitions(
+                        manifestTransitions,
+                        snapshot.sequence,
+                        &ReplayManifestTransition::sequence,
+                        snapshot.sourceTimestampUs);
+                    for (; nextTick != deadlineTicks.end() && nextTick->sequence == snapshot.sequence; ++nextTick) {
+                        input::PadEventSnapshotProcessor::GetSingleton().ProcessDeadlineTickAt(nextTick->nowUs);
+                    }
                 }
 
                 ReplayGlyphQueries(scenarioPath);
                 session.Finish();
+                WritePromptFirstQueryLatency(outputPath);
                 CarryProcessorInputRows(scenarioPath, outputPath);
+                CarryDeadlineTickSteps(scenarioPath, outputPath);
 
                 const auto comparison = CompareGeneratedBundle(scenarioPath, outputPath);
                 if (!comparison.ok) {
@@ -829,6 +1090,12 @@ namespace dualpad::input_v2::telemetry
                 const auto ingressEvents = ReadScenarioRows(scenarioPath, "ingress_snapshot_events.csv");
                 const auto framesBySequence = FramesBySequence(ingressFrames);
                 const auto eventsBySequence = EventsBySequence(ingressEvents);
+                const auto deadlineTicks = ReadDeadlineTicks(scenarioPath);
+                const auto manifestTransitions = ReadManifestTransitions(scenarioPath);
+                // Drains without a recorded tick tick at the newest submitted
+                // frame, which fires nothing the frames did not already.
+                std::uint64_t latestSubmittedUs = 0;
+                std::uint64_t latestSubmittedSequence = 0;
                 for (const auto& row : schedule) {
                     if (row.size() < 11) {
                         throw std::runtime_error("dispatcher schedule row has too few columns");
@@ -841,15 +1108,32 @@ namespace dualpad::input_v2::telemetry
                         if (frame == framesBySequence.end()) {
                             throw std::runtime_error("missing ingress frame for submitted sequence " + row[2]);
                         }
-                        input::PadEventSnapshotDispatcher::GetSingleton().SubmitSnapshot(
-                            BuildSnapshot(frame->second, eventsBySequence));
+                        const auto snapshot = BuildSnapshot(frame->second, eventsBySequence);
+                        latestSubmittedUs = (std::max)(latestSubmittedUs, snapshot.sourceTimestampUs);
+                        latestSubmittedSequence = sequence;
+                        // The live drain runs after the main thread resolved
+                        // the context the pad frame was captured in.
+                        PublishReplayContext(snapshot.context, snapshot.contextEpoch);
+                        SeedReplayManifestForSnapshot(snapshot);
+                        input::PadEventSnapshotDispatcher::GetSingleton().SubmitSnapshot(snapshot);
                     } else if (op == "drain") {
+                        const auto stepIndex = ParseU64(row[0], "step_index");
+                        const auto tick = std::ranges::find(deadlineTicks, stepIndex, &ReplayDeadlineTick::stepIndex);
                         const auto telemetry = BuildDrainTelemetry(row);
+                        ReplayManifestTransitions(
+                            manifestTransitions,
+                            stepIndex,
+                            &ReplayManifestTransition::stepIndex,
+                            latestSubmittedUs);
                         (void)input::PadEventSnapshotDispatcher::GetSingleton().DrainForReplay(
                             ParseSize(row[3], "budget"),
                             &telemetry,
                             ProcessSnapshotThroughRuntimeSink,
-                            nullptr);
+                            nullptr,
+                            tick != deadlineTicks.end() ? tick->nowUs : latestSubmittedUs);
+                        // The drain ignores the replay sink, so sample the
+                        // scope it published once it returns.
+                        MeasurePromptFirstQuery(latestSubmittedSequence);
                     } else {
                         throw std::runtime_error("unknown dispatcher schedule op: " + op);
                     }
@@ -857,6 +1141,7 @@ namespace dualpad::input_v2::telemetry
 
                 ReplayGlyphQueries(scenarioPath);
                 session.Finish();
+                WritePromptFirstQueryLatency(outputPath);
 
                 const auto comparison = CompareGeneratedBundle(scenarioPath, outputPath);
                 if (!comparison.ok) {
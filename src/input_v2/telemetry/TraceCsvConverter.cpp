@@ -0,0 +1,467 @@
+#include "pch.h"
+#include "input_v2/telemetry/TraceCsvConverter.h"
+
+#include "input_v2/telemetry/TraceRecordFormat.h"
+#include "input_v2/telemetry/TraceSchema.h"
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace dualpad::input_v2::telemetry
+{
+    namespace
+    {
+        // Far above any record the recorder emits; a larger size means the
+        // bytes are not a record header.
+        constexpr std::uint32_t kMaxRecordPayloadBytes = 1u << 20;
+
+        struct PendingRecord
+        {
+            std::uint64_t order{ 0 };
+            TraceRecordKind kind{ TraceRecordKind::DispatcherSubmit };
+            std::string_view payload;
+        };
+
+        const char* BoolString(bool value)
+        {
+            return value ? "true" : "false";
+        }
+
+        const char* OwnerName(presentation::PresentationOwner owner)
+        {
+            return owner == presentation::PresentationOwner::Gamepad ? "Gamepad" : "KeyboardMouse";
+        }
+
+        std::string EscapeCsv(std::string_view value)
+        {
+            bool needsQuotes = false;
+            for (const char ch : value) {
+                if (ch == ',' || ch == '"' || ch == '\n' || ch == '\r') {
+                    needsQuotes = true;
+                    break;
+                }
+            }
+
+            if (!needsQuotes) {
+                return std::string(value);
+            }
+
+            std::string escaped;
+            escaped.reserve(value.size() + 2);
+            escaped.push_back('"');
+            for (const char ch : value) {
+                if (ch == '"') {
+                    escaped.push_back('"');
+                }
+                escaped.push_back(ch);
+            }
+            escaped.push_back('"');
+            return escaped;
+        }
+
+        const char* ToString(input::backend::KeyboardBridgeCommandType type)
+        {
+            switch (type) {
+            case input::backend::KeyboardBridgeCommandType::Press:
+                return "press";
+            case input::backend::KeyboardBridgeCommandType::Release:
+                return "release";
+            case input::backend::KeyboardBridgeCommandType::Pulse:
+                return "pulse";
+            case input::backend::KeyboardBridgeCommandType::Reset:
+                return "reset";
+            case input::backend::KeyboardBridgeCommandType::None:
+            default:
+                return "none";
+            }
+        }
+
+        void WriteSnapshotFrame(std::ostream& line, const TraceSnapshotFrame& frame)
+        {
+            line << frame.sequence << ','
+                 << frame.firstSequence << ','
+                 << frame.sourceTimestampUs << ','
+                 << input::ToString(frame.context) << ','
+                 << frame.contextEpoch << ','
+                 << BoolString(frame.overflowed) << ','
+                 << BoolString(frame.coalesced) << ','
+                 << BoolString(frame.crossContextMismatch) << ','
+                 << frame.digitalMask << ','
+                 << frame.leftStickX << ','
+                 << frame.leftStickY << ','
+                 << frame.rightStickX << ','
+                 << frame.rightStickY << ','
+                 << frame.leftTrigger << ','
+                 << frame.rightTrigger << '\n';
+        }
+
+        void WriteSnapshotEvents(std::ostream& out, TraceRecordReader& reader, const TraceSnapshotFrame& frame)
+        {
+            for (std::uint32_t i = 0; i < frame.eventCount; ++i) {
+                const auto event = reader.Get<input::PadEvent>();
+                out << frame.sequence << ','
+                    << i << ','
+                    << input::ToString(event.type) << ','
+                    << input::ToString(event.triggerType) << ','
+                    << event.code << ','
+                    << event.modifierMask << ','
+                    << input::ToString(event.axis) << ','
+                    << event.previousValue << ','
+                    << event.value << ','
+                    << event.timestampUs << ','
+                    << static_cast<unsigned int>(event.touchId) << ','
+                    << event.touchX << ','
+                    << event.touchY << ','
+                    << input::ToString(event.touchpadMode) << ','
+                    << input::ToString(event.touchRegion) << ','
+                    << input::ToString(event.slideDirection) << '\n';
+            }
+        }
+
+        void WritePollFrame(std::ostream& line, const input::AuthoritativePollFrame& frame)
+        {
+            line << frame.pollSequence << ','
+                 << input::ToString(frame.context) << ','
+                 << frame.contextEpoch << ','
+                 << frame.sourceTimestampUs << ','
+                 << frame.downMask << ','
+                 << frame.pressedMask << ','
+                 << frame.releasedMask << ','
+                 << frame.pulseMask << ','
+                 << frame.unmanagedDownMask << ','
+                 << frame.unmanagedPressedMask << ','
+                 << frame.unmanagedReleasedMask << ','
+                 << frame.unmanagedPulseMask << ','
+                 << frame.managedMask << ','
+                 << frame.committedDownMask << ','
+                 << frame.committedPressedMask << ','
+                 << frame.committedReleasedMask << ','
+                 << frame.moveX << ','
+                 << frame.moveY << ','
+                 << frame.lookX << ','
+                 << frame.lookY << ','
+                 << frame.leftTrigger << ','
+                 << frame.rightTrigger << ','
+                 << BoolString(frame.hasDigital) << ','
+                 << BoolString(frame.hasAnalog) << ','
+                 << BoolString(frame.overflowed) << ','
+                 << BoolString(frame.coalesced) << '\n';
+        }
+
+        // One output stream per CSV, opened on first use; the phase0 files
+        // are all opened up front so an empty trace still yields headers.
+        class CsvBundleWriter
+        {
+        public:
+            explicit CsvBundleWriter(std::filesystem::path directory) :
+                _directory(std::move(directory))
+            {
+                std::filesystem::create_directories(_directory);
+                for (const auto& spec : Phase0TraceFiles()) {
+                    (void)Open(spec.name, spec.header);
+                }
+            }
+
+            std::ostream& Stream(std::string_view name)
+            {
+                for (auto& file : _files) {
+                    if (file.name == name) {
+                        return *file.stream;
+                    }
+                }
+                throw std::runtime_error("trace conversion wrote an unknown csv: " + std::string(name));
+            }
+
+            std::ostream& Open(std::string_view name, std::string_view header)
+            {
+                for (auto& file : _files) {
+                    if (file.name == name) {
+                        return *file.stream;
+                    }
+                }
+                auto stream = std::make_unique<std::ofstream>(_directory / name, std::ios::trunc);
+                if (!*stream) {
+                    throw std::runtime_error("cannot write " + (_directory / name).string());
+                }
+                *stream << header << '\n';
+                _files.push_back(OpenCsv{ .name = name, .stream = std::move(stream) });
+                return *_files.back().stream;
+            }
+
+        private:
+            struct OpenCsv
+            {
+                std::string_view name;
+                std::unique_ptr<std::ofstream> stream;
+            };
+
+            std::filesystem::path _directory;
+            std::vector<OpenCsv> _files;
+        };
+
+        // Per-segment counters the CSV derives instead of the trace storing.
+        struct SegmentCounters
+        {
+            std::uint64_t scheduleStepIndex{ 0 };
+            std::uint64_t glyphQueryId{ 0 };
+            std::uint64_t keyboardCommandSequence{ 0 };
+            std::uint64_t keyboardCommandIndex{ 0 };
+        };
+
+        void ConvertRecord(CsvBundleWriter& csv, SegmentCounters& counters, const PendingRecord& record)
+        {
+            TraceRecordReader reader(record.payload);
+            switch (record.kind) {
+            case TraceRecordKind::DispatcherSubmit:
+                {
+                    const auto submit = reader.Get<TraceDispatcherSubmit>();
+                    csv.Stream("dispatcher_schedule.csv")
+                        << counters.scheduleStepIndex++ << ",submit,"
+                        << submit.frame.sequence
+                        << ",0,frame_pump_disabled,disabled,none,false,"
+                        << submit.pendingBefore << ','
+                        << submit.pendingAfter
+                        << ",0\n";
+                    WriteSnapshotFrame(csv.Stream("ingress_snapshot_frames.csv"), submit.frame);
+                    WriteSnapshotEvents(csv.Stream("ingress_snapshot_events.csv"), reader, submit.frame);
+                    break;
+                }
+            case TraceRecordKind::DispatcherDrain:
+                {
+                    const auto drain = reader.Get<TraceDispatcherDrain>();
+                    auto& schedule = csv.Stream("dispatcher_schedule.csv");
+                    schedule << counters.scheduleStepIndex++ << ",drain,0,"
+                             << drain.budget << ','
+                             << input::ToString(drain.reason) << ','
+                             << input::ToString(drain.routeState) << ',';
+                    if (drain.hasLastPollAge) {
+                        schedule << drain.lastPollAgeMs;
+                    } else {
+                        schedule << "none";
+                    }
+                    schedule << ','
+                             << BoolString(drain.hookInstalled) << ','
+                             << drain.pendingBefore << ','
+                             << drain.pendingAfter << ','
+                             << drain.drained << '\n';
+                    break;
+                }
+            case TraceRecordKind::ProcessedSnapshot:
+                {
+                    const auto processed = reader.Get<TraceProcessedSnapshot>();
+                    WriteSnapshotFrame(csv.Stream("processed_snapshot_frames.csv"), processed.frame);
+                    WriteSnapshotEvents(csv.Stream("processed_snapshot_events.csv"), reader, processed.frame);
+                    WritePollFrame(csv.Stream("expected_authoritative_poll.csv"), processed.poll);
+
+                    csv.Stream("expected_presentation_surface.csv")
+                        << processed.frame.sequence << ','
+                        << input::ToString(processed.surfaceContext) << ','
+                        << processed.surfaceContextEpoch << ','
+                        << BoolString(processed.isUsingGamepad) << ','
+                        << BoolString(processed.gamepadControlsCursor) << ','
+                        << BoolString(processed.gamepadDeviceEnabled) << ','
+                        << OwnerName(processed.presentationOwner) << ','
+                        << OwnerName(processed.cursorOwner) << ','
+                        << OwnerName(processed.gameplayEngineOwner) << ','
+                        << OwnerName(processed.gameplayMenuEntryOwner) << '\n';
+                    break;
+                }
+            case TraceRecordKind::PollFrame:
+                {
+                    const auto poll = reader.Get<TracePollFrame>();
+                    WritePollFrame(csv.Stream("expected_authoritative_poll.csv"), poll.poll);
+                    break;
+                }
+            case TraceRecordKind::KeyboardCommand:
+                {
+                    const auto command = reader.Get<TraceKeyboardCommand>();
+                    const auto actionId = reader.GetString();
+                    if (counters.keyboardCommandSequence != command.sequence) {
+                        counters.keyboardCommandSequence = command.sequence;
+                        counters.keyboardCommandIndex = 0;
+                    }
+                    csv.Stream("expected_keyboard_bridge.csv")
+                        << command.sequence << ','
+                        << counters.keyboardCommandIndex++ << ','
+                        << ToString(command.type) << ','
+                        << static_cast<unsigned int>(command.scancode) << ','
+                        << EscapeCsv(actionId) << ','
+                        << input::backend::ToString(command.contract) << ','
+                        << input::ToString(command.context) << '\n';
+                    break;
+                }
+            case TraceRecordKind::GlyphResult:
+                {
+                    const auto glyph = reader.Get<TraceGlyphResult>();
+                    const auto actionId = reader.GetString();
+                    const auto contextName = reader.GetString();
+                    const auto token = reader.GetString();
+                    const auto queryId = counters.glyphQueryId++;
+                    csv.Stream("glyph_queries.csv")
+                        << queryId << ','
+                        << glyph.sequence << ','
+                        << EscapeCsv(actionId) << ','
+                        << EscapeCsv(contextName) << '\n';
+                    csv.Stream("expected_glyph_results.csv")
+                        << queryId << ','
+                        << BoolString(glyph.ok) << ','
+                        << EscapeCsv(token) << ','
+                        << EscapeCsv(actionId) << ','
+                        << EscapeCsv(contextName) << '\n';
+                    break;
+                }
+            case TraceRecordKind::RuntimeDebugSnapshot:
+                {
+                    const auto debug = reader.Get<TraceRuntimeDebugSnapshot>();
+                    const auto frameKind = reader.GetString();
+                    const auto transitionReason = reader.GetString();
+                    const auto reasonSummary = reader.GetString();
+                    const auto debugReason = reader.GetString();
+                    const auto hookStatus = reader.GetString();
+                    const auto hookDebugReason = reader.GetString();
+                    const auto promptState = reader.GetString();
+                    const auto promptReason = reader.GetString();
+                    const auto overflowSummary = reader.GetString();
+                    csv.Open(kRuntimeDebugSnapshotFileName, kRuntimeDebugSnapshotHeader)
+                        << debug.firstSeq << ','
+                        << debug.lastSeq << ','
+                        << frameKind << ','
+                        << transitionReason << ','
+                        << BoolString(debug.runtimeHealthDegraded) << ','
+                        << debug.runtimeHealthReasons << ','
+                        << EscapeCsv(reasonSummary) << ','
+                        << EscapeCsv(debugReason) << ','
+                        << hookStatus << ','
+                        << EscapeCsv(hookDebugReason) << ','
+                        << promptState << ','
+                        << EscapeCsv(promptReason) << ','
+                        << BoolString(debug.overflowTransition) << ','
+                        << BoolString(debug.overflowTypedCompaction) << ','
+                        << EscapeCsv(overflowSummary) << '\n';
+                    break;
+                }
+            case TraceRecordKind::DeadlineTick:
+                {
+                    // The dispatcher ticks before logging its drain, so the
+                    // tick belongs to the next schedule step.
+                    const auto tick = reader.Get<TraceDeadlineTick>();
+                    csv.Open(kDeadlineTickFileName, kDeadlineTickHeader)
+                        << counters.scheduleStepIndex << ','
+                        << tick.sequence << ','
+                        << tick.nowUs << ','
+                        << tick.firedChanges << ','
+                        << BoolString(tick.outputApplySucceeded) << ','
+                        << tick.runtimeHealthReasons << ','
+                        << tick.poll.downMask << ','
+                        << tick.poll.pressedMask << ','
+                        << tick.poll.releasedMask << ','
+                        << tick.poll.pulseMask << ','
+                        << tick.poll.committedDownMask << ','
+                        << tick.poll.committedPressedMask << ','
+                        << tick.poll.committedReleasedMask << '\n';
+                    break;
+                }
+            case TraceRecordKind::ManifestTransition:
+                {
+                    const auto transition = reader.Get<TraceManifestTransition>();
+                    csv.Open(kManifestTransitionFileName, kManifestTransitionHeader)
+                        << counters.scheduleStepIndex << ','
+                        << transition.sequence << ','
+                        << transition.manifestEpoch << ','
+                        << BoolString(transition.preservesInteractionState) << '\n';
+                    break;
+                }
+            default:
+                throw std::runtime_error("unknown trace record kind " + std::to_string(static_cast<unsigned int>(record.kind)));
+            }
+        }
+
+        bool StartsSegment(std::string_view bytes)
+        {
+            return bytes.size() >= kTraceSegmentMagic.size() &&
+                   std::equal(kTraceSegmentMagic.begin(), kTraceSegmentMagic.end(), bytes.begin());
+        }
+    }
+
+    TraceConversionSummary ConvertTraceToPhase0Csv(
+        const std::filesystem::path& tracePath,
+        const std::filesystem::path& outputDirectory)
+    {
+        std::ifstream input(tracePath, std::ios::binary);
+        if (!input) {
+            throw std::runtime_error("cannot read " + tracePath.string());
+        }
+        std::ostringstream buffer;
+        buffer << input.rdbuf();
+        const auto contents = buffer.str();
+
+        std::string_view remaining(contents);
+        if (!remaining.empty() && !StartsSegment(remaining)) {
+            throw std::runtime_error("not a DualPad binary trace: " + tracePath.string());
+        }
+
+        TraceConversionSummary summary{};
+        CsvBundleWriter csv(outputDirectory);
+        std::vector<PendingRecord> segment;
+        const auto flushSegment = [&]() {
+            // Records are appended per recording thread; `order` restores
+            // the cross-thread sequence the old single-mutex writer had.
+            std::ranges::stable_sort(segment, {}, &PendingRecord::order);
+            SegmentCounters counters{};
+            for (const auto& record : segment) {
+                ConvertRecord(csv, counters, record);
+            }
+            summary.records += segment.size();
+            segment.clear();
+        };
+
+        while (!remaining.empty()) {
+            if (StartsSegment(remaining)) {
+                if (remaining.size() < sizeof(TraceSegmentHeader)) {
+                    summary.truncated = true;
+                    break;
+                }
+                TraceSegmentHeader header{};
+                std::memcpy(&header, remaining.data(), sizeof(header));
+                if (header.formatVersion != kTraceRecordFormatVersion || header.schemaVersion != kTraceSchemaVersion) {
+                    throw std::runtime_error("unsupported trace format version in " + tracePath.string());
+                }
+                if (header.layoutFingerprint != TraceLayoutFingerprint()) {
+                    throw std::runtime_error("trace record layout differs from this build in " + tracePath.string());
+                }
+                flushSegment();
+                ++summary.segments;
+                remaining.remove_prefix(sizeof(header));
+                continue;
+            }
+
+            if (remaining.size() < sizeof(TraceRecordHeader)) {
+                summary.truncated = true;
+                break;
+            }
+            TraceRecordHeader header{};
+            std::memcpy(&header, remaining.data(), sizeof(header));
+            if (header.payloadBytes > kMaxRecordPayloadBytes) {
+                throw std::runtime_error("corrupt trace record in " + tracePath.string());
+            }
+            if (remaining.size() < sizeof(header) + header.payloadBytes) {
+                summary.truncated = true;
+                break;
+            }
+            segment.push_back(PendingRecord{
+                .order = header.order,
+                .kind = header.kind,
+                .payload = remaining.substr(sizeof(header), header.payloadBytes)
+            });
+            remaining.remove_prefix(sizeof(header) + header.payloadBytes);
+        }
+        flushSegment();
+        return summary;
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string_view>
+
+namespace dualpad::input_v2::telemetry
+{
+    inline constexpr std::string_view kRuntimeDebugSnapshotFileName = "runtime_debug_snapshot.csv";
+    inline constexpr std::string_view kRuntimeDebugSnapshotHeader =
+        "first_seq,last_seq,frame_kind,transition_reason,degraded,reason_mask,reason_names,debug_reason,hook_status,hook_debug_reason,prompt_state,prompt_reason,overflow_transition,overflow_typed_compaction,overflow_compaction_summary";
+    // `step_index` is the dispatcher_schedule.csv drain the tick ran in;
+    // replay fires the tick at `now_us` during that drain.
+    inline constexpr std::string_view kDeadlineTickFileName = "deadline_ticks.csv";
+    inline constexpr std::string_view kDeadlineTickHeader =
+        "step_index,sequence,now_us,fired_changes,output_apply_succeeded,reason_mask,down_mask,pressed_mask,released_mask,pulse_mask,committed_down_mask,committed_pressed_mask,committed_released_mask";
+
+    // Manifest publications in the order the runtime consumed them. Replay
+    // re-issues rows after `sequence` with the recorded preservation flag;
+    // the file is a replay input and is not compared.
+    inline constexpr std::string_view kManifestTransitionFileName = "manifest_transitions.csv";
+    inline constexpr std::string_view kManifestTransitionHeader =
+        "step_index,sequence,manifest_epoch,preserves_interaction_state";
+
+    // Written by partial captures such as flight recorder dumps: the
+    // expected files the capture actually recorded, one per row. Replay
+    // compares only those; a scenario without it compares every file.
+    inline constexpr std::string_view kCapturedOutputsFileName = "captured_outputs.csv";
+    inline constexpr std::string_view kCapturedOutputsHeader = "file_name";
+
+    struct TraceConversionSummary
+    {
+        std::uint64_t segments{ 0 };
+        std::uint64_t records{ 0 };
+        // The file ended inside a record, e.g. the game exited mid-flush;
+        // everything before it was converted.
+        bool truncated{ false };
+    };
+
+    // Rewrites the phase0 CSV bundle from a binary trace written by
+    // InputTraceRecorder. Every phase0 file is emitted with its header;
+    // runtime_debug_snapshot.csv, deadline_ticks.csv and
+    // manifest_transitions.csv only when the trace holds such records.
+    // Step, query and keyboard command indices restart with each segment,
+    // as they did when a session was reopened. Throws std::runtime_error
+    // when the file is unreadable or was not written by this format.
+    TraceConversionSummary ConvertTraceToPhase0Csv(
+        const std::filesystem::path& tracePath,
+        const std::filesystem::path& outputDirectory);
+}
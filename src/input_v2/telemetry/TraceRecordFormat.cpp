@@ -0,0 +1,134 @@
+#include "pch.h"
+#include "input_v2/telemetry/TraceRecordFormat.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+
+namespace dualpad::input_v2::telemetry
+{
+    namespace
+    {
+        // FNV-1a over the layout description.
+        class LayoutHash
+        {
+        public:
+            void Mix(std::uint64_t value)
+            {
+                for (int shift = 0; shift < 64; shift += 8) {
+                    _hash ^= (value >> shift) & 0xFF;
+                    _hash *= 0x100000001B3ull;
+                }
+            }
+
+            [[nodiscard]] std::uint64_t Value() const { return _hash; }
+
+        private:
+            std::uint64_t _hash{ 0xCBF29CE484222325ull };
+        };
+
+        template <class T>
+        void MixLayout(LayoutHash& hash, const T& probe, std::size_t offset)
+        {
+            hash.Mix(offset);
+            hash.Mix(sizeof(T));
+            if constexpr (TraceFieldStruct<T>) {
+                std::apply(
+                    [&](auto... members) {
+                        (MixLayout(hash, probe.*members, offset + TraceMemberOffset(probe, members)), ...);
+                    },
+                    TraceFields<T>::kMembers);
+            }
+        }
+
+        template <class... T>
+        std::uint64_t ComputeLayoutFingerprint()
+        {
+            LayoutHash hash;
+            (MixLayout(hash, T{}, 0), ...);
+            return hash.Value();
+        }
+    }
+
+    std::uint64_t TraceLayoutFingerprint()
+    {
+        static const auto fingerprint = ComputeLayoutFingerprint<
+            TraceSegmentHeader,
+            TraceRecordHeader,
+            TraceDispatcherSubmit,
+            TraceDispatcherDrain,
+            TraceProcessedSnapshot,
+            TraceKeyboardCommand,
+            TraceGlyphResult,
+            TraceRuntimeDebugSnapshot,
+            TraceDeadlineTick,
+            TraceManifestTransition,
+            TracePollFrame,
+            input::PadEvent>();
+        return fingerprint;
+    }
+
+    TraceRecordEncoder::TraceRecordEncoder(std::string& buffer, TraceRecordKind kind, std::uint64_t order) :
+        _buffer(buffer),
+        _start(buffer.size())
+    {
+        Put(TraceRecordHeader{ .kind = kind, .order = order });
+    }
+
+    void TraceRecordEncoder::PutString(std::string_view value)
+    {
+        const auto size = static_cast<std::uint16_t>(
+            (std::min)(value.size(), static_cast<std::size_t>((std::numeric_limits<std::uint16_t>::max)())));
+        Put(size);
+        PutSpan(std::span<const char>(value.data(), size));
+    }
+
+    void TraceRecordEncoder::Finish()
+    {
+        const auto payloadBytes = static_cast<std::uint32_t>(_buffer.size() - _start - sizeof(TraceRecordHeader));
+        std::memcpy(_buffer.data() + _start + offsetof(TraceRecordHeader, payloadBytes), &payloadBytes, sizeof(payloadBytes));
+    }
+
+    TraceRecordReader::TraceRecordReader(std::string_view payload) :
+        _payload(payload)
+    {}
+
+    std::string_view TraceRecordReader::GetString()
+    {
+        const auto size = Get<std::uint16_t>();
+        return Take(size);
+    }
+
+    std::string_view TraceRecordReader::Take(std::size_t bytes)
+    {
+        if (_payload.size() < bytes) {
+            throw std::runtime_error("trace record payload is shorter than its layout");
+        }
+        const auto taken = _payload.substr(0, bytes);
+        _payload.remove_prefix(bytes);
+        return taken;
+    }
+
+    TraceSnapshotFrame MakeTraceSnapshotFrame(const input::PadEventSnapshot& snapshot)
+    {
+        return TraceSnapshotFrame{
+            .sequence = snapshot.sequence,
+            .firstSequence = snapshot.firstSequence,
+            .sourceTimestampUs = snapshot.sourceTimestampUs,
+            .context = snapshot.context,
+            .contextEpoch = snapshot.contextEpoch,
+            .digitalMask = snapshot.state.buttons.digitalMask,
+            .leftStickX = snapshot.state.leftStick.x,
+            .leftStickY = snapshot.state.leftStick.y,
+            .rightStickX = snapshot.state.rightStick.x,
+            .rightStickY = snapshot.state.rightStick.y,
+            .leftTrigger = snapshot.state.leftTrigger.normalized,
+            .rightTrigger = snapshot.state.rightTrigger.normalized,
+            .overflowed = snapshot.overflowed,
+            .coalesced = snapshot.coalesced,
+            .crossContextMismatch = snapshot.crossContextMismatch,
+            .eventCount = static_cast<std::uint32_t>(snapshot.events.count)
+        };
+    }
+}
@@ -0,0 +1,500 @@
+#pragma once
+
+#include "input/AuthoritativePollState.h"
+#include "input/PadEvent.h"
+#include "input/backend/ActionOutputContract.h"
+#include "input/backend/KeyboardNativeBridge.h"
+#include "input/injection/PadEventSnapshot.h"
+#include "input/injection/RouteHealthContract.h"
+#include "input_v2/presentation/PresentationProjection.h"
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+namespace dualpad::input_v2::telemetry
+{
+    // Binary trace layout written by InputTraceRecorder. A file is a run of
+    // segments; each segment starts with a TraceSegmentHeader and holds
+    // records whose `order` is globally increasing across recording
+    // threads but not necessarily in file order. Payloads are fixed structs
+    // in host layout with zeroed padding, followed by any length-prefixed
+    // strings; the segment header fingerprints that layout so only a build
+    // with identical structs reads the file back.
+    inline constexpr std::uint32_t kTraceRecordFormatVersion = 6;
+    inline constexpr std::string_view kTraceRecordFileName = "trace.dptrace";
+    inline constexpr std::array<char, 8> kTraceSegmentMagic = { 'D', 'P', 'T', 'R', 'A', 'C', 'E', '1' };
+
+    enum class TraceRecordKind : std::uint16_t
+    {
+        DispatcherSubmit = 1,
+        DispatcherDrain = 2,
+        ProcessedSnapshot = 3,
+        KeyboardCommand = 4,
+        GlyphResult = 5,
+        RuntimeDebugSnapshot = 6,
+        DeadlineTick = 7,
+        ManifestTransition = 8,
+        PollFrame = 9
+    };
+
+    struct TraceSegmentHeader
+    {
+        std::array<char, 8> magic{ kTraceSegmentMagic };
+        std::uint32_t formatVersion{ kTraceRecordFormatVersion };
+        std::uint32_t schemaVersion{ 0 };
+        // TraceLayoutFingerprint() of the writing build.
+        std::uint64_t layoutFingerprint{ 0 };
+    };
+    // Written as raw bytes by the recorder and flight recorder dumps.
+    static_assert(std::has_unique_object_representations_v<TraceSegmentHeader>);
+
+    struct TraceRecordHeader
+    {
+        std::uint32_t payloadBytes{ 0 };
+        TraceRecordKind kind{ TraceRecordKind::DispatcherSubmit };
+        std::uint16_t reserved{ 0 };
+        std::uint64_t order{ 0 };
+    };
+
+    struct TraceSnapshotFrame
+    {
+        std::uint64_t sequence{ 0 };
+        std::uint64_t firstSequence{ 0 };
+        std::uint64_t sourceTimestampUs{ 0 };
+        input::InputContext context{ input::InputContext::Gameplay };
+        std::uint32_t contextEpoch{ 0 };
+        std::uint32_t digitalMask{ 0 };
+        float leftStickX{ 0.0f };
+        float leftStickY{ 0.0f };
+        float rightStickX{ 0.0f };
+        float rightStickY{ 0.0f };
+        float leftTrigger{ 0.0f };
+        float rightTrigger{ 0.0f };
+        bool overflowed{ false };
+        bool coalesced{ false };
+        bool crossContextMismatch{ false };
+        std::uint32_t eventCount{ 0 };
+    };
+
+    // Followed by `frame.eventCount` input::PadEvent.
+    struct TraceDispatcherSubmit
+    {
+        TraceSnapshotFrame frame{};
+        std::uint64_t pendingBefore{ 0 };
+        std::uint64_t pendingAfter{ 0 };
+    };
+
+    struct TraceDispatcherDrain
+    {
+        input::DrainReason reason{ input::DrainReason::FramePumpDisabled };
+        input::UpstreamRouteState routeState{ input::UpstreamRouteState::Disabled };
+        bool hasLastPollAge{ false };
+        bool hookInstalled{ false };
+        std::uint64_t lastPollAgeMs{ 0 };
+        std::uint64_t budget{ 0 };
+        std::uint64_t drained{ 0 };
+        std::uint64_t pendingBefore{ 0 };
+        std::uint64_t pendingAfter{ 0 };
+    };
+
+    // Followed by `frame.eventCount` input::PadEvent.
+    struct TraceProcessedSnapshot
+    {
+        TraceSnapshotFrame frame{};
+        input::AuthoritativePollFrame poll{};
+        input::InputContext surfaceContext{ input::InputContext::Gameplay };
+        std::uint32_t surfaceContextEpoch{ 0 };
+        bool isUsingGamepad{ false };
+        bool gamepadControlsCursor{ false };
+        bool gamepadDeviceEnabled{ false };
+        presentation::PresentationOwner presentationOwner{ presentation::PresentationOwner::KeyboardMouse };
+        presentation::PresentationOwner cursorOwner{ presentation::PresentationOwner::KeyboardMouse };
+        presentation::PresentationOwner gameplayEngineOwner{ presentation::PresentationOwner::KeyboardMouse };
+        presentation::PresentationOwner gameplayMenuEntryOwner{ presentation::PresentationOwner::KeyboardMouse };
+    };
+
+    // Followed by the action id string.
+    struct TraceKeyboardCommand
+    {
+        std::uint64_t sequence{ 0 };
+        input::backend::KeyboardBridgeCommandType type{ input::backend::KeyboardBridgeCommandType::None };
+        std::uint8_t scancode{ 0 };
+        input::backend::ActionOutputContract contract{};
+        input::InputContext context{ input::InputContext::Gameplay };
+    };
+
+    // Followed by the action id, requested context name and token strings.
+    struct TraceGlyphResult
+    {
+        std::uint64_t sequence{ 0 };
+        bool ok{ false };
+    };
+
+    // Followed by frame kind, transition reason, reason summary, debug
+    // reason, hook status, hook debug reason, prompt state, prompt reason
+    // and overflow compaction summary strings.
+    struct TraceRuntimeDebugSnapshot
+    {
+        std::uint64_t firstSeq{ 0 };
+        std::uint64_t lastSeq{ 0 };
+        std::uint32_t runtimeHealthReasons{ 0 };
+        bool runtimeHealthDegraded{ false };
+        bool overflowTransition{ false };
+        bool overflowTypedCompaction{ false };
+    };
+
+    // A runtime tick that fired hold/repeat deadlines between frames.
+    // `sequence` is the stable frame the tick resolved against.
+    struct TraceDeadlineTick
+    {
+        std::uint64_t sequence{ 0 };
+        std::uint64_t nowUs{ 0 };
+        input::AuthoritativePollFrame poll{};
+        std::uint32_t firedChanges{ 0 };
+        std::uint32_t runtimeHealthReasons{ 0 };
+        bool outputApplySucceeded{ false };
+    };
+
+    // A manifest publication the runtime consumed. `sequence` is the last
+    // stable frame before it; zero for the startup publication.
+    struct TraceManifestTransition
+    {
+        std::uint64_t sequence{ 0 };
+        std::uint32_t manifestEpoch{ 0 };
+        bool preservesInteractionState{ false };
+    };
+
+    // The poll frame a stable frame published, without the processed
+    // snapshot and presentation surface. Only flight recorder dumps write
+    // it; trace recording keeps the poll inside TraceProcessedSnapshot.
+    struct TracePollFrame
+    {
+        std::uint64_t sequence{ 0 };
+        input::AuthoritativePollFrame poll{};
+    };
+
+    // Members written for each traced struct, in declaration order. The
+    // encoder copies only these into zeroed bytes, so padding never carries
+    // stack contents into a trace; a member missing here is not traced.
+    template <class T>
+    struct TraceFields;
+
+    template <class T>
+    concept TraceFieldStruct = requires { TraceFields<T>::kMembers; };
+
+    template <>
+    struct TraceFields<TraceSegmentHeader>
+    {
+        static constexpr auto kMembers = std::tuple{
+            &TraceSegmentHeader::magic,
+            &TraceSegmentHeader::formatVersion,
+            &TraceSegmentHeader::schemaVersion,
+            &TraceSegmentHeader::layoutFingerprint
+        };
+    };
+
+    template <>
+    struct TraceFields<TraceRecordHeader>
+    {
+        static constexpr auto kMembers = std::tuple{
+            &TraceRecordHeader::payloadBytes,
+            &TraceRecordHeader::kind,
+            &TraceRecordHeader::reserved,
+            &TraceRecordHeader::order
+        };
+    };
+
+    template <>
+    struct TraceFields<input::PadEvent>
+    {
+        static constexpr auto kMembers = std::tuple{
+            &input::PadEvent::type,
+            &input::PadEvent::triggerType,
+            &input::PadEvent::code,
+            &input::PadEvent::timestampUs,
+            &input::PadEvent::modifierMask,
+            &input::PadEvent::axis,
+            &input::PadEvent::value,
+            &input::PadEvent::previousValue,
+            &input::PadEvent::touchId,
+            &input::PadEvent::touchX,
+            &input::PadEvent::touchY,
+            &input::PadEvent::touchpadMode,
+            &input::PadEvent::touchRegion,
+            &input::PadEvent::slideDirection
+        };
+    };
+
+    template <>
+    struct TraceFields<input::AuthoritativePollFrame>
+    {
+        static constexpr auto kMembers = std::tuple{
+            &input::AuthoritativePollFrame::downMask,
+            &input::AuthoritativePollFrame::pressedMask,
+            &input::AuthoritativePollFrame::releasedMask,
+            &input::AuthoritativePollFrame::pulseMask,
+            &input::AuthoritativePollFrame::unmanagedDownMask,
+            &input::AuthoritativePollFrame::unmanagedPressedMask,
+            &input::AuthoritativePollFrame::unmanagedReleasedMask,
+            &input::AuthoritativePollFrame::unmanagedPulseMask,
+            &input::AuthoritativePollFrame::managedMask,
+            &input::AuthoritativePollFrame::committedDownMask,
+            &input::AuthoritativePollFrame::committedPressedMask,
+            &input::AuthoritativePollFrame::committedReleasedMask,
+            &input::AuthoritativePollFrame::context,
+            &input::AuthoritativePollFrame::contextEpoch,
+            &input::AuthoritativePollFrame::sourceTimestampUs,
+            &input::AuthoritativePollFrame::pollSequence,
+            &input::AuthoritativePollFrame::moveX,
+            &input::AuthoritativePollFrame::moveY,
+            &input::AuthoritativePollFrame::lookX,
+            &input::AuthoritativePollFrame::lookY,
+            &input::AuthoritativePollFrame::leftTrigger,
+            &input::AuthoritativePollFrame::rightTrigger,
+            &input::AuthoritativePollFrame::stateVersion,
+            &input::AuthoritativePollFrame::lateLatchedMask,
+            &input::AuthoritativePollFrame::hasDigital,
+            &input::AuthoritativePollFrame::hasAnalog,
+            &input::AuthoritativePollFrame::overflowed,
+            &input::AuthoritativePollFrame::coalesced
+        };
+    };
+
+    template <>
+    struct TraceFields<TraceSnapshotFrame>
+    {
+        static constexpr auto kMembers = std::tuple{
+            &TraceSnapshotFrame::sequence,
+            &TraceSnapshotFrame::firstSequence,
+            &TraceSnapshotFrame::sourceTimestampUs,
+            &TraceSnapshotFrame::context,
+            &TraceSnapshotFrame::contextEpoch,
+            &TraceSnapshotFrame::digitalMask,
+            &TraceSnapshotFrame::leftStickX,
+            &TraceSnapshotFrame::leftStickY,
+            &TraceSnapshotFrame::rightStickX,
+            &TraceSnapshotFrame::rightStickY,
+            &TraceSnapshotFrame::leftTrigger,
+            &TraceSnapshotFrame::rightTrigger,
+            &TraceSnapshotFrame::overflowed,
+            &TraceSnapshotFrame::coalesced,
+            &TraceSnapshotFrame::crossContextMismatch,
+            &TraceSnapshotFrame::eventCount
+        };
+    };
+
+    template <>
+    struct TraceFields<TraceDispatcherSubmit>
+    {
+        static constexpr auto kMembers = std::tuple{
+            &TraceDispatcherSubmit::frame,
+            &TraceDispatcherSubmit::pendingBefore,
+            &TraceDispatcherSubmit::pendingAfter
+        };
+    };
+
+    template <>
+    struct TraceFields<TraceDispatcherDrain>
+    {
+        static constexpr auto kMembers = std::tuple{
+            &TraceDispatcherDrain::reason,
+            &TraceDispatcherDrain::routeState,
+            &TraceDispatcherDrain::hasLastPollAge,
+            &TraceDispatcherDrain::hookInstalled,
+            &TraceDispatcherDrain::lastPollAgeMs,
+            &TraceDispatcherDrain::budget,
+            &TraceDispatcherDrain::drained,
+            &TraceDispatcherDrain::pendingBefore,
+            &TraceDispatcherDrain::pendingAfter
+        };
+    };
+
+    template <>
+    struct TraceFields<TraceProcessedSnapshot>
+    {
+        static constexpr auto kMembers = std::tuple{
+            &TraceProcessedSnapshot::frame,
+            &TraceProcessedSnapshot::poll,
+            &TraceProcessedSnapshot::surfaceContext,
+            &TraceProcessedSnapshot::surfaceContextEpoch,
+            &TraceProcessedSnapshot::isUsingGamepad,
+            &TraceProcessedSnapshot::gamepadControlsCursor,
+            &TraceProcessedSnapshot::gamepadDeviceEnabled,
+            &TraceProcessedSnapshot::presentationOwner,
+            &TraceProcessedSnapshot::cursorOwner,
+            &TraceProcessedSnapshot::gameplayEngineOwner,
+            &TraceProcessedSnapshot::gameplayMenuEntryOwner
+        };
+    };
+
+    template <>
+    struct TraceFields<TraceKeyboardCommand>
+    {
+        static constexpr auto kMembers = std::tuple{
+            &TraceKeyboardCommand::sequence,
+            &TraceKeyboardCommand::type,
+            &TraceKeyboardCommand::scancode,
+            &TraceKeyboardCommand::contract,
+            &TraceKeyboardCommand::context
+        };
+    };
+
+    template <>
+    struct TraceFields<TraceGlyphResult>
+    {
+        static constexpr auto kMembers = std::tuple{
+            &TraceGlyphResult::sequence,
+            &TraceGlyphResult::ok
+        };
+    };
+
+    template <>
+    struct TraceFields<TraceRuntimeDebugSnapshot>
+    {
+        static constexpr auto kMembers = std::tuple{
+            &TraceRuntimeDebugSnapshot::firstSeq,
+            &TraceRuntimeDebugSnapshot::lastSeq,
+            &TraceRuntimeDebugSnapshot::runtimeHealthReasons,
+            &TraceRuntimeDebugSnapshot::runtimeHealthDegraded,
+            &TraceRuntimeDebugSnapshot::overflowTransition,
+            &TraceRuntimeDebugSnapshot::overflowTypedCompaction
+        };
+    };
+
+    template <>
+    struct TraceFields<TraceDeadlineTick>
+    {
+        static constexpr auto kMembers = std::tuple{
+            &TraceDeadlineTick::sequence,
+            &TraceDeadlineTick::nowUs,
+            &TraceDeadlineTick::poll,
+            &TraceDeadlineTick::firedChanges,
+            &TraceDeadlineTick::runtimeHealthReasons,
+            &TraceDeadlineTick::outputApplySucceeded
+        };
+    };
+
+    template <>
+    struct TraceFields<TraceManifestTransition>
+    {
+        static constexpr auto kMembers = std::tuple{
+            &TraceManifestTransition::sequence,
+            &TraceManifestTransition::manifestEpoch,
+            &TraceManifestTransition::preservesInteractionState
+        };
+    };
+
+    template <>
+    struct TraceFields<TracePollFrame>
+    {
+        static constexpr auto kMembers = std::tuple{
+            &TracePollFrame::sequence,
+            &TracePollFrame::poll
+        };
+    };
+
+    template <class T, class Member>
+    std::size_t TraceMemberOffset(const T& object, Member T::*member)
+    {
+        return static_cast<std::size_t>(
+            reinterpret_cast<const char*>(&(object.*member)) - reinterpret_cast<const char*>(&object));
+    }
+
+    // Copies the listed members of `value` to their host offsets in `out`
+    // and leaves every other byte as it was.
+    template <class T>
+    void WriteTraceFields(char* out, const T& value)
+    {
+        if constexpr (TraceFieldStruct<T>) {
+            std::apply(
+                [&](auto... members) {
+                    (WriteTraceFields(out + TraceMemberOffset(value, members), value.*members), ...);
+                },
+                TraceFields<T>::kMembers);
+        } else {
+            static_assert(
+                std::is_floating_point_v<T> || std::has_unique_object_representations_v<T>,
+                "padded trace structs must list their members in TraceFields");
+            std::memcpy(out, &value, sizeof(T));
+        }
+    }
+
+    // Hash of the size and member offsets of the segment header, record
+    // header and every record payload struct.
+    [[nodiscard]] std::uint64_t TraceLayoutFingerprint();
+
+    // Appends one record to a caller-owned byte buffer.
+    class TraceRecordEncoder
+    {
+    public:
+        TraceRecordEncoder(std::string& buffer, TraceRecordKind kind, std::uint64_t order);
+
+        template <class T>
+        void Put(const T& value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            const auto offset = _buffer.size();
+            _buffer.resize(offset + sizeof(T), '\0');
+            WriteTraceFields(_buffer.data() + offset, value);
+        }
+
+        template <class T>
+        void PutSpan(std::span<const T> values)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            if constexpr (TraceFieldStruct<T>) {
+                for (const auto& value : values) {
+                    Put(value);
+                }
+            } else {
+                static_assert(std::has_unique_object_representations_v<T>);
+                const auto offset = _buffer.size();
+                _buffer.resize(offset + values.size_bytes());
+                if (!values.empty()) {
+                    std::memcpy(_buffer.data() + offset, values.data(), values.size_bytes());
+                }
+            }
+        }
+
+        // Strings longer than 64 KiB are truncated.
+        void PutString(std::string_view value);
+        // Patches the header's payload size; the record is complete after this.
+        void Finish();
+
+    private:
+        std::string& _buffer;
+        std::size_t _start{ 0 };
+    };
+
+    // Reads one record payload; every getter throws std::runtime_error when
+    // the payload is shorter than the layout it is asked for.
+    class TraceRecordReader
+    {
+    public:
+        explicit TraceRecordReader(std::string_view payload);
+
+        template <class T>
+        T Get()
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            T value{};
+            std::memcpy(&value, Take(sizeof(T)).data(), sizeof(T));
+            return value;
+        }
+
+        std::string_view GetString();
+
+    private:
+        std::string_view Take(std::size_t bytes);
+
+        std::string_view _payload;
+    };
+
+    TraceSnapshotFrame MakeTraceSnapshotFrame(const input::PadEventSnapshot& snapshot);
+}
@@ -0,0 +1,67 @@
+#include "pch.h"
+#include "input_v2/telemetry/TraceRecordRing.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace dualpad::input_v2::telemetry
+{
+    namespace
+    {
+        constexpr std::uint64_t kMask = TraceRecordRing::kCapacity - 1;
+        static_assert((TraceRecordRing::kCapacity & kMask) == 0);
+    }
+
+    TraceRecordRing::TraceRecordRing() :
+        _storage(std::make_unique<char[]>(kCapacity))
+    {}
+
+    bool TraceRecordRing::TryPush(std::string_view record)
+    {
+        const auto head = _head.load(std::memory_order_relaxed);
+        const auto tail = _tail.load(std::memory_order_acquire);
+        if (record.size() > kCapacity - (head - tail)) {
+            return false;
+        }
+
+        const auto offset = static_cast<std::size_t>(head & kMask);
+        const auto first = (std::min)(record.size(), kCapacity - offset);
+        std::memcpy(_storage.get() + offset, record.data(), first);
+        std::memcpy(_storage.get(), record.data() + first, record.size() - first);
+        _head.store(head + record.size(), std::memory_order_release);
+        return true;
+    }
+
+    std::size_t TraceRecordRing::DrainTo(std::string& out)
+    {
+        const auto tail = _tail.load(std::memory_order_relaxed);
+        const auto head = _head.load(std::memory_order_acquire);
+        const auto size = static_cast<std::size_t>(head - tail);
+        if (size == 0) {
+            return 0;
+        }
+
+        const auto offset = static_cast<std::size_t>(tail & kMask);
+        const auto first = (std::min)(size, kCapacity - offset);
+        out.append(_storage.get() + offset, first);
+        out.append(_storage.get(), size - first);
+        _tail.store(head, std::memory_order_release);
+        return size;
+    }
+
+    std::size_t TraceRecordRing::Pending() const
+    {
+        return static_cast<std::size_t>(
+            _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire));
+    }
+
+    void TraceRecordRing::Retire()
+    {
+        _retired.store(true, std::memory_order_release);
+    }
+
+    bool TraceRecordRing::Retired() const
+    {
+        return _retired.load(std::memory_order_acquire);
+    }
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace dualpad::input_v2::telemetry
+{
+    // Single-producer/single-consumer byte ring holding whole trace records.
+    // The recording thread pushes without locking and never blocks: a
+    // record that does not fit is dropped. The trace writer drains it.
+    class TraceRecordRing
+    {
+    public:
+        // Power of two. Roughly a second of HID-rate submits plus the
+        // processed snapshots they produce.
+        static constexpr std::size_t kCapacity = std::size_t{ 1 } << 18;
+
+        TraceRecordRing();
+
+        TraceRecordRing(const TraceRecordRing&) = delete;
+        TraceRecordRing& operator=(const TraceRecordRing&) = delete;
+
+        // Producer side. Publishes all of `record` or none of it.
+        bool TryPush(std::string_view record);
+        // Consumer side. Appends every published byte to `out`.
+        std::size_t DrainTo(std::string& out);
+        [[nodiscard]] std::size_t Pending() const;
+
+        // Set by the producer's thread on exit; the writer drops the ring
+        // once it is retired and empty.
+        void Retire();
+        [[nodiscard]] bool Retired() const;
+
+    private:
+        std::unique_ptr<char[]> _storage;
+        alignas(64) std::atomic<std::uint64_t> _head{ 0 };
+        alignas(64) std::atomic<std::uint64_t> _tail{ 0 };
+        std::atomic<bool> _retired{ false };
+    };
+}
@@ -17,7 +17,9 @@
 #include "input/backend/KeyboardHelperBackend.h"
 #include "input/injection/RouteHealthContract.h"
 #include "input_v2/config/AtomicConfigReloader.h"
+#include "input_v2/prompt/GlyphAtlasIndex.h"
 #include "input_v2/presentation/SkyrimCompatibilitySurface.h"
+#include "input_v2/telemetry/FlightRecorder.h"
 
 #include "input/injection/UpstreamGamepadHook.h"
 
@@ -33,6 +35,20 @@ namespace logger = SKSE::log;
 
 namespace
 {
+    // A relative flight recorder directory sits beside the SKSE log instead
+    // of under the game's working directory; empty disables dumps.
+    std::filesystem::path ResolveFlightRecorderOutputDir(const std::filesystem::path& configured)
+    {
+        if (configured.is_absolute()) {
+            return configured;
+        }
+        if (const auto logDirectory = logger::log_directory()) {
+            return *logDirectory / configured;
+        }
+        logger::warn("[DualPad][FlightRecorder] SKSE log directory unavailable; dumps disabled");
+        return {};
+    }
+
     void LogReverseProbeAddresses()
     {
 #ifdef DUALPAD_DIAGNOSTIC_BUILD
@@ -74,6 +90,12 @@ namespace
             LogReverseProbeAddresses();
 
             dualpad::input::RuntimeConfig::GetSingleton().Load();
+            if (const auto& runtimeConfig = dualpad::input::RuntimeConfig::GetSingleton();
+                runtimeConfig.EnableFlightRecorder()) {
+                dualpad::input_v2::telemetry::FlightRecorder::GetSingleton().Start({
+                    .outputRoot = ResolveFlightRecorderOutputDir(runtimeConfig.FlightRecorderOutputDir())
+                });
+            }
 
             const auto compiledConfig = dualpad::input_v2::config::AtomicConfigReloader::GetSingleton().LoadOrRecover();
             if (!compiledConfig.ok) {
@@ -86,6 +108,7 @@ namespace
 
             dualpad::input::ContextEventSink::GetSingleton().Register();
 
+            dualpad::input_v2::prompt::GlyphAtlasIndex::GetSingleton().Open();
             dualpad::input::glyph::ScaleformGlyphBridge::GetSingleton().RegisterInitialMenus();
 
             if (dualpad::input::RuntimeConfig::GetSingleton().UseUpstreamGamepadHook()) {
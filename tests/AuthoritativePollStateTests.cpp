@@ -0,0 +1,272 @@
+#include "pch.h"
+
+#include "input/AuthoritativePollState.h"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using dualpad::input::AnalogSample;
+    using dualpad::input::AuthoritativePollState;
+    using dualpad::input::InputContext;
+
+    void Require(bool condition, std::string_view message)
+    {
+        if (!condition) {
+            throw std::runtime_error(std::string(message));
+        }
+    }
+
+    constexpr std::uint8_t kAllChannels =
+        dualpad::input::LateLatchChannelMove |
+        dualpad::input::LateLatchChannelLook |
+        dualpad::input::LateLatchChannelLeftTrigger |
+        dualpad::input::LateLatchChannelRightTrigger;
+
+    const AnalogSample kPhysical{
+        .moveX = 0.25f,
+        .moveY = -0.5f,
+        .lookX = 0.75f,
+        .lookY = 0.125f,
+        .leftTrigger = 0.4f,
+        .rightTrigger = 0.9f
+    };
+
+    const AnalogSample kFresher{
+        .moveX = 0.3f,
+        .moveY = -0.6f,
+        .lookX = 0.8f,
+        .lookY = 0.2f,
+        .leftTrigger = 0.5f,
+        .rightTrigger = 1.0f
+    };
+
+    void PublishDrained(AuthoritativePollState& state, const AnalogSample& sample)
+    {
+        state.PublishDrainedFrame({ .analog = sample });
+    }
+
+    void TestRestingChannelLatchesOnset()
+    {
+        // Eligibility comes from the bindings, not from the drained value, so a
+        // stick at rest in the drained frame still picks up the fresh sample.
+        auto& state = AuthoritativePollState::GetSingleton();
+        state.Reset();
+        PublishDrained(state, AnalogSample{});
+        state.PublishLatestAnalogSample(kFresher);
+        state.PublishLateLatchChannels(kAllChannels);
+
+        const auto frame = state.ReadSnapshot();
+        Require(frame.lateLatchedMask == kAllChannels, "channels drained at rest should still latch");
+        Require(frame.moveX == kFresher.moveX && frame.lookY == kFresher.lookY, "onset from rest should read the freshest sample");
+        Require(frame.leftTrigger == kFresher.leftTrigger, "trigger onset from rest should read the freshest sample");
+        state.Reset();
+    }
+
+    void TestPollReadsFreshestSampleOnlyForEligibleChannels()
+    {
+        auto& state = AuthoritativePollState::GetSingleton();
+        state.Reset();
+        PublishDrained(state, kPhysical);
+        state.PublishLatestAnalogSample(kFresher);
+
+        auto frame = state.ReadSnapshot();
+        Require(frame.lateLatchedMask == dualpad::input::LateLatchChannelNone, "late latch must stay off until channels are published");
+        Require(frame.lookX == kPhysical.lookX, "without late latch the poll should read drained values");
+
+        const auto eligible = static_cast<std::uint8_t>(
+            dualpad::input::LateLatchChannelLook | dualpad::input::LateLatchChannelRightTrigger);
+        state.PublishLateLatchChannels(eligible);
+        frame = state.ReadSnapshot();
+        Require(frame.lateLatchedMask == eligible, "poll should report which channels were latched");
+        Require(frame.lookX == kFresher.lookX && frame.lookY == kFresher.lookY, "look should come from the freshest sample");
+        Require(frame.rightTrigger == kFresher.rightTrigger, "right trigger should come from the freshest sample");
+        Require(frame.moveX == kPhysical.moveX && frame.moveY == kPhysical.moveY, "ineligible move should keep the drained value");
+        Require(frame.leftTrigger == kPhysical.leftTrigger, "ineligible left trigger should keep the drained value");
+
+        state.Reset();
+        frame = state.ReadSnapshot();
+        Require(frame.lateLatchedMask == dualpad::input::LateLatchChannelNone, "reset should drop latch eligibility");
+        Require(!frame.hasAnalog && frame.lookX == 0.0f, "reset poll should not surface latched analog");
+    }
+
+    void TestScopedPublishIsOneVersion()
+    {
+        auto& state = AuthoritativePollState::GetSingleton();
+        state.Reset();
+        const auto before = state.ReadSnapshot().stateVersion;
+        {
+            const AuthoritativePollState::ScopedPublish publish(state);
+            state.PublishFrameMetadata(42, true, false);
+            state.PublishUnmanagedDigitalEdges(0x1, 0, 0);
+            state.SetUnmanagedButton(0x1, true);
+            Require(state.ReadSnapshot().stateVersion == before, "writes inside a scope must stay unpublished");
+        }
+
+        const auto frame = state.ReadSnapshot();
+        Require(frame.stateVersion == before + 1, "a scope should publish exactly once");
+        Require(frame.sourceTimestampUs == 42 && frame.overflowed, "scoped metadata should be published");
+        Require(frame.unmanagedPressedMask == 0x1 && frame.unmanagedDownMask == 0x1, "edge and held state should land together");
+    }
+
+    void TestDrainedFrameIsOneVersion()
+    {
+        auto& state = AuthoritativePollState::GetSingleton();
+        state.Reset();
+        state.PublishUnmanagedDigitalEdges(0x2, 0, 0);
+        const auto before = state.ReadSnapshot().stateVersion;
+        state.PublishDrainedFrame({
+            .analog = kPhysical,
+            .lateLatchChannels = dualpad::input::LateLatchChannelLook,
+            .sourceTimestampUs = 77,
+            .overflowed = false,
+            .coalesced = true });
+
+        auto frame = state.ReadSnapshot();
+        Require(frame.stateVersion == before + 1, "a drained frame should publish exactly once");
+        Require(frame.hasAnalog && frame.moveX == kPhysical.moveX, "drained analog should be published");
+        Require(frame.sourceTimestampUs == 77 && frame.coalesced, "drained metadata should land with the analog");
+        Require(frame.unmanagedPressedMask == 0, "a drained frame should clear the previous unmanaged edges");
+
+        state.PublishDrainedFrame({ .sourceTimestampUs = 78 });
+        frame = state.ReadSnapshot();
+        Require(frame.lookX == kPhysical.lookX, "a frame without analog should keep the last applied analog");
+        Require(frame.sourceTimestampUs == 78, "a frame without analog should still publish its metadata");
+    }
+
+    void TestUnmanagedPulseExpiresOnRead()
+    {
+        auto& state = AuthoritativePollState::GetSingleton();
+        state.Reset();
+        state.PulseUnmanagedButton(0x10);
+        Require((state.ReadSnapshot().unmanagedDownMask & 0x10) != 0, "a fresh pulse should read as down");
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(80));
+        Require(state.ReadSnapshot().unmanagedDownMask == 0, "an expired pulse should read as up");
+
+        state.PulseUnmanagedButton(0x20);
+        Require(state.ReadSnapshot().unmanagedDownMask == 0x20, "a new pulse must not revive an expired one");
+        state.Reset();
+    }
+
+    std::uint32_t DownMaskFor(std::uint64_t frame)
+    {
+        return static_cast<std::uint32_t>(frame * 2654435761u) & 0x00FF'FFFFu;
+    }
+
+    std::uint32_t ManagedMaskFor(std::uint64_t frame)
+    {
+        return (frame & 1u) != 0 ? 0x0000'FFFFu : 0x00FF'0000u;
+    }
+
+    void PublishConcurrencyFrame(AuthoritativePollState& state, std::uint64_t frame)
+    {
+        const auto down = DownMaskFor(frame);
+        const auto previous = DownMaskFor(frame - 1);
+        const auto managed = ManagedMaskFor(frame);
+
+        const AuthoritativePollState::ScopedPublish publish(state);
+        state.PublishCommittedButtons(
+            down & managed,
+            down & ~previous & managed,
+            previous & ~down & managed,
+            managed,
+            frame,
+            (frame & 1u) != 0 ? InputContext::Gameplay : InputContext::Menu,
+            static_cast<std::uint32_t>(frame));
+        state.SetUnmanagedButton(0x00FF'FFFFu, false);
+        state.SetUnmanagedButton(down & ~managed, true);
+        state.PublishUnmanagedDigitalEdges(down & ~previous & ~managed, previous & ~down & ~managed, 0);
+        state.PublishFrameMetadata(frame * 8, (frame % 3) == 0, (frame % 5) == 0);
+        const auto value = static_cast<float>(frame % 4096);
+        state.PublishAnalogState(value, -value, value, -value, value, value);
+    }
+
+    void TestConcurrentReadersNeverSeeTornFrames()
+    {
+        auto& state = AuthoritativePollState::GetSingleton();
+        state.Reset();
+
+        constexpr std::uint64_t kFrames = 200'000;
+        std::atomic_bool done{ false };
+        std::atomic<std::uint64_t> failures{ 0 };
+        std::atomic<std::uint64_t> observed{ 0 };
+
+        const auto reader = [&]() {
+            std::uint64_t lastVersion = 0;
+            std::uint64_t lastSequence = 0;
+            while (!done.load(std::memory_order_acquire)) {
+                const auto frame = state.ReadSnapshot();
+                observed.fetch_add(1, std::memory_order_relaxed);
+                if (frame.stateVersion < lastVersion || frame.pollSequence < lastSequence) {
+                    failures.fetch_add(1, std::memory_order_relaxed);
+                }
+                lastVersion = frame.stateVersion;
+                lastSequence = frame.pollSequence;
+                if (frame.pollSequence == 0) {
+                    continue;
+                }
+
+                const auto k = frame.pollSequence;
+                const auto down = DownMaskFor(k);
+                const auto previous = DownMaskFor(k - 1);
+                const auto managed = ManagedMaskFor(k);
+                const auto value = static_cast<float>(k % 4096);
+                const bool consistent =
+                    frame.managedMask == managed &&
+                    frame.downMask == down &&
+                    frame.pressedMask == (down & ~previous) &&
+                    frame.releasedMask == (previous & ~down) &&
+                    (frame.committedDownMask & ~frame.managedMask) == 0 &&
+                    (frame.pressedMask & ~frame.downMask) == 0 &&
+                    (frame.releasedMask & frame.downMask) == 0 &&
+                    frame.contextEpoch == static_cast<std::uint32_t>(k) &&
+                    frame.context == ((k & 1u) != 0 ? InputContext::Gameplay : InputContext::Menu) &&
+                    frame.sourceTimestampUs == k * 8 &&
+                    frame.overflowed == ((k % 3) == 0) &&
+                    frame.coalesced == ((k % 5) == 0) &&
+                    frame.moveX == value && frame.moveY == -value &&
+                    frame.lookX == value && frame.rightTrigger == value;
+                if (!consistent) {
+                    failures.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        };
+
+        std::vector<std::thread> readers;
+        for (int i = 0; i < 3; ++i) {
+            readers.emplace_back(reader);
+        }
+        for (std::uint64_t frame = 1; frame <= kFrames; ++frame) {
+            PublishConcurrencyFrame(state, frame);
+        }
+        done.store(true, std::memory_order_release);
+        for (auto& thread : readers) {
+            thread.join();
+        }
+
+        Require(observed.load() > 0, "readers should have polled while the writer ran");
+        Require(failures.load() == 0, "poll snapshots must never mix fields from different publications");
+
+        const auto last = state.ReadSnapshot();
+        Require(last.pollSequence == kFrames, "the last publication should be visible after the writer stops");
+        state.Reset();
+    }
+}
+
+int main()
+{
+    TestRestingChannelLatchesOnset();
+    TestPollReadsFreshestSampleOnlyForEligibleChannels();
+    TestScopedPublishIsOneVersion();
+    TestDrainedFrameIsOneVersion();
+    TestUnmanagedPulseExpiresOnRead();
+    TestConcurrentReadersNeverSeeTornFrames();
+    return 0;
+}
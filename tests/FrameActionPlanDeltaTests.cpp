@@ -0,0 +1,203 @@
+#include "pch.h"
+
+#include "input/backend/FrameActionPlanDelta.h"
+
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    using namespace dualpad::input::backend;
+    using dualpad::input::InputContext;
+
+    void Require(bool condition, std::string_view message)
+    {
+        if (!condition) {
+            throw std::runtime_error(std::string(message));
+        }
+    }
+
+    PlannedActionState MakeAction(
+        std::string_view actionId,
+        std::uint32_t outputCode,
+        PlannedActionPhase phase,
+        ActionOutputContract contract,
+        std::uint32_t contextEpoch = 1)
+    {
+        return PlannedActionState{
+            .backend = PlannedBackend::NativeButtonCommit,
+            .phase = phase,
+            .context = InputContext::Gameplay,
+            .contract = contract,
+            .outputCode = outputCode,
+            .contextEpoch = contextEpoch,
+            .actionId = actionId
+        };
+    }
+
+    // Runs one frame and returns the actions that were forwarded.
+    std::vector<PlannedActionState> RunFrame(
+        FrameActionPlanDelta& delta,
+        std::initializer_list<PlannedActionState> actions,
+        bool* fullResync = nullptr)
+    {
+        std::vector<PlannedActionState> forwarded;
+        const auto resync = delta.BeginFrame();
+        for (const auto& action : actions) {
+            if (delta.Admit(action)) {
+                forwarded.push_back(action);
+            }
+        }
+        delta.EndFrame();
+        if (fullResync) {
+            *fullResync = resync;
+        }
+        return forwarded;
+    }
+
+    // Drains the initial resync frame so the next frame is a real delta.
+    void Prime(FrameActionPlanDelta& delta, std::initializer_list<PlannedActionState> actions)
+    {
+        bool fullResync = false;
+        const auto forwarded = RunFrame(delta, actions, &fullResync);
+        Require(fullResync, "first frame should be a full resync");
+        Require(forwarded.size() == actions.size(), "full resync should forward the whole plan");
+    }
+
+    void TestSteadyHoldIsSkipped()
+    {
+        FrameActionPlanDelta delta;
+        Prime(delta, { MakeAction("Game.Sprint", 0x1, PlannedActionPhase::Press, ActionOutputContract::Hold) });
+
+        for (int frame = 0; frame < 10; ++frame) {
+            bool fullResync = true;
+            const auto forwarded = RunFrame(
+                delta,
+                { MakeAction("Game.Sprint", 0x1, PlannedActionPhase::Hold, ActionOutputContract::Hold) },
+                &fullResync);
+            Require(!fullResync, "steady frames should not resync");
+            Require(forwarded.empty(), "steady hold should not reach the backend");
+        }
+
+        const auto released = RunFrame(
+            delta,
+            { MakeAction("Game.Sprint", 0x1, PlannedActionPhase::Release, ActionOutputContract::Hold) });
+        Require(released.size() == 1 && released[0].phase == PlannedActionPhase::Release, "release should pass through");
+
+        const auto stats = delta.GetStats();
+        Require(stats.frames == 12 && stats.fullResyncFrames == 1, "frame counters should match");
+        Require(stats.emptyDeltaFrames == 10 && stats.skippedActions == 10, "skipped holds should be counted");
+        Require(stats.deltaActions == 2 && stats.lastDeltaSize == 1 && stats.maxDeltaSize == 1, "delta sizes should be counted");
+    }
+
+    void TestHoldAfterReleaseOrEpochChangePasses()
+    {
+        FrameActionPlanDelta delta;
+        Prime(delta, { MakeAction("Game.Sneak", 0x2, PlannedActionPhase::Release, ActionOutputContract::Hold) });
+
+        // A recovered owner resumes at Hold with no Press in between.
+        auto forwarded = RunFrame(delta, { MakeAction("Game.Sneak", 0x2, PlannedActionPhase::Hold, ActionOutputContract::Hold) });
+        Require(forwarded.size() == 1, "hold after release should pass through");
+
+        forwarded = RunFrame(delta, { MakeAction("Game.Sneak", 0x2, PlannedActionPhase::Hold, ActionOutputContract::Hold, 2) });
+        Require(forwarded.size() == 1, "hold under a new context epoch should pass through");
+
+        forwarded = RunFrame(delta, { MakeAction("Game.Sneak", 0x4, PlannedActionPhase::Hold, ActionOutputContract::Hold, 2) });
+        Require(forwarded.size() == 1, "hold on a different output should pass through");
+
+        // Skipping a frame drops the action from the baseline.
+        RunFrame(delta, {});
+        forwarded = RunFrame(delta, { MakeAction("Game.Sneak", 0x4, PlannedActionPhase::Hold, ActionOutputContract::Hold, 2) });
+        Require(forwarded.size() == 1, "hold absent from the previous frame should pass through");
+    }
+
+    void TestRepeatHoldAndChangedValuesPass()
+    {
+        FrameActionPlanDelta delta;
+        auto axis = MakeAction("Game.Move", 0x10, PlannedActionPhase::Value, ActionOutputContract::Axis);
+        axis.valueX = 0.5f;
+        Prime(delta, {
+            MakeAction("Menu.Down", 0x8, PlannedActionPhase::Press, ActionOutputContract::Repeat),
+            axis });
+
+        auto forwarded = RunFrame(delta, {
+            MakeAction("Menu.Down", 0x8, PlannedActionPhase::Hold, ActionOutputContract::Repeat),
+            axis });
+        Require(forwarded.size() == 1 && forwarded[0].actionId == "Menu.Down", "repeat hold should pass and an unchanged value should not");
+
+        axis.valueX = 0.75f;
+        forwarded = RunFrame(delta, { axis });
+        Require(forwarded.size() == 1 && forwarded[0].valueX == 0.75f, "changed value should pass through");
+    }
+
+    void TestLookupScalesToFullPlan()
+    {
+        FrameActionPlanDelta delta;
+        std::vector<std::string> ids;
+        for (std::size_t index = 0; index < FrameActionPlan::kMaxActions; ++index) {
+            ids.push_back("Game.Action" + std::to_string(index));
+        }
+
+        const auto runAll = [&](PlannedActionPhase phase) {
+            std::size_t forwarded = 0;
+            delta.BeginFrame();
+            for (std::size_t index = 0; index < ids.size(); ++index) {
+                forwarded += delta.Admit(MakeAction(
+                    ids[index],
+                    static_cast<std::uint32_t>(index + 1),
+                    phase,
+                    ActionOutputContract::Hold)) ? 1 : 0;
+            }
+            delta.EndFrame();
+            return forwarded;
+        };
+
+        Require(runAll(PlannedActionPhase::Press) == ids.size(), "the resync frame should forward every action");
+        Require(runAll(PlannedActionPhase::Hold) == 0, "every held action should be found in the baseline");
+
+        // One more than a plan holds leaves the baseline lossy.
+        delta.BeginFrame();
+        for (std::size_t index = 0; index < ids.size(); ++index) {
+            delta.Admit(MakeAction(ids[index], static_cast<std::uint32_t>(index + 1), PlannedActionPhase::Hold, ActionOutputContract::Hold));
+        }
+        delta.Admit(MakeAction("Game.Extra", 0x200, PlannedActionPhase::Press, ActionOutputContract::Hold));
+        delta.EndFrame();
+        Require(runAll(PlannedActionPhase::Hold) == ids.size(), "the frame after an overflow should resync");
+    }
+
+    void TestPeriodicAndRequestedResync()
+    {
+        FrameActionPlanDelta delta;
+        const auto hold = MakeAction("Game.Sprint", 0x1, PlannedActionPhase::Hold, ActionOutputContract::Hold);
+        Prime(delta, { MakeAction("Game.Sprint", 0x1, PlannedActionPhase::Press, ActionOutputContract::Hold) });
+
+        std::uint32_t forwarded = 0;
+        for (std::uint32_t frame = 1; frame <= FrameActionPlanDelta::kFullResyncIntervalFrames; ++frame) {
+            bool fullResync = false;
+            forwarded += static_cast<std::uint32_t>(RunFrame(delta, { hold }, &fullResync).size());
+            Require(fullResync == (frame == FrameActionPlanDelta::kFullResyncIntervalFrames), "resync should land on the interval");
+        }
+        Require(forwarded == 1, "only the resync frame should forward the steady hold");
+
+        delta.RequestFullResync();
+        bool fullResync = false;
+        Require(RunFrame(delta, { hold }, &fullResync).size() == 1 && fullResync, "requested resync should forward the whole plan");
+        Require(RunFrame(delta, { hold }, &fullResync).empty() && !fullResync, "delta should resume after a requested resync");
+
+        delta.Reset();
+        Require(RunFrame(delta, { hold }, &fullResync).size() == 1 && fullResync, "reset should resync the next frame");
+    }
+}
+
+int main()
+{
+    TestSteadyHoldIsSkipped();
+    TestHoldAfterReleaseOrEpochChangePasses();
+    TestRepeatHoldAndChangedValuesPass();
+    TestLookupScalesToFullPlan();
+    TestPeriodicAndRequestedResync();
+    return 0;
+}
@@ -0,0 +1,666 @@
+#include "pch.h"
+
+#include "input/backend/PollCommitCoordinator.h"
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    using namespace dualpad::input::backend;
+    using dualpad::input::InputContext;
+
+    constexpr std::string_view kSprintAction = "Game.Sprint";
+    constexpr std::string_view kJumpAction = "Game.Jump";
+
+    void Require(bool condition, std::string_view message)
+    {
+        if (!condition) {
+            throw std::runtime_error(std::string(message));
+        }
+    }
+
+    // The nested-conditional Tick the transition table replaced, kept verbatim
+    // minus logging so the table can be checked against it state by state.
+    struct LegacyTickReference
+    {
+        std::uint32_t _nextTokenId{ 1 };
+        std::uint32_t _currentEpoch{ 0 };
+
+        void TickSlot(PollCommitSlot& slot, std::uint64_t nowUs, bool gateOpen)
+        {
+            switch (slot.mode) {
+            case PollCommitMode::Pulse:
+                TickPulseSlot(slot, nowUs, gateOpen);
+                break;
+            case PollCommitMode::Toggle:
+                TickToggleSlot(slot, nowUs, gateOpen);
+                break;
+            case PollCommitMode::Hold:
+                TickHoldSlot(slot, nowUs, gateOpen);
+                break;
+            case PollCommitMode::Repeat:
+                TickRepeatSlot(slot, nowUs, gateOpen);
+                break;
+            case PollCommitMode::None:
+            default:
+                break;
+            }
+        }
+
+        void TickPulseSlot(PollCommitSlot& slot, std::uint64_t nowUs, bool gateOpen)
+        {
+            const auto canOpen = ShouldOpenGateForSlot(slot, gateOpen);
+
+            switch (slot.state) {
+            case ExecState::Idle:
+                if (slot.pending.kind == PendingKind::ForceCancel) {
+                    slot.pending = {};
+                    break;
+                }
+                if (slot.pending.kind == PendingKind::Pulse && CanStartNewTransaction(slot)) {
+                    if (canOpen) {
+                        StartPulseTransaction(slot, nowUs);
+                        slot.pending.kind = PendingKind::None;
+                    } else {
+                        TransitionState(slot, ExecState::WaitingForGate, nowUs);
+                    }
+                }
+                break;
+
+            case ExecState::WaitingForGate:
+                if (slot.pending.kind == PendingKind::ForceCancel) {
+                    slot.pending = {};
+                    TransitionState(slot, ExecState::Idle, nowUs);
+                    break;
+                }
+
+                if (slot.pending.kind != PendingKind::Pulse && !slot.pending.pendingNextPulse) {
+                    TransitionState(slot, ExecState::Idle, nowUs);
+                    break;
+                }
+
+                if (canOpen && CanStartNewTransaction(slot)) {
+                    if (slot.pending.kind != PendingKind::Pulse) {
+                        slot.pending.kind = PendingKind::Pulse;
+                        slot.pending.pendingNextPulse = false;
+                    }
+                    StartPulseTransaction(slot, nowUs);
+                    slot.pending.kind = PendingKind::None;
+                }
+                break;
+
+            case ExecState::PulseDownVisible:
+                if (slot.token.active &&
+                    slot.token.downSubmitted &&
+                    nowUs >= slot.token.earliestReleaseAtUs) {
+                    TransitionState(slot, ExecState::ReleaseGap, nowUs);
+                }
+                break;
+
+            case ExecState::ReleaseGap:
+            case ExecState::HoldDownVisible:
+            default:
+                break;
+            }
+        }
+
+        void TickToggleSlot(PollCommitSlot& slot, std::uint64_t nowUs, bool gateOpen)
+        {
+            const auto canOpen = ShouldOpenGateForSlot(slot, gateOpen);
+
+            switch (slot.state) {
+            case ExecState::Idle:
+                if (slot.pending.kind == PendingKind::ForceCancel) {
+                    slot.pending = {};
+                    break;
+                }
+                if (slot.pending.kind == PendingKind::Toggle && CanStartNewTransaction(slot)) {
+                    if (canOpen) {
+                        StartPulseTransaction(slot, nowUs);
+                        slot.pending.kind = PendingKind::None;
+                    } else {
+                        TransitionState(slot, ExecState::WaitingForGate, nowUs);
+                    }
+                }
+                break;
+
+            case ExecState::WaitingForGate:
+                if (slot.pending.kind == PendingKind::ForceCancel) {
+                    slot.pending = {};
+                    TransitionState(slot, ExecState::Idle, nowUs);
+                    break;
+                }
+                if (slot.pending.kind != PendingKind::Toggle) {
+                    TransitionState(slot, ExecState::Idle, nowUs);
+                    break;
+                }
+
+                if (canOpen && CanStartNewTransaction(slot)) {
+                    StartPulseTransaction(slot, nowUs);
+                    slot.pending.kind = PendingKind::None;
+                }
+                break;
+
+            case ExecState::PulseDownVisible:
+                if (slot.token.active &&
+                    slot.token.downSubmitted &&
+                    nowUs >= slot.token.earliestReleaseAtUs) {
+                    TransitionState(slot, ExecState::ReleaseGap, nowUs);
+                }
+                break;
+
+            case ExecState::ReleaseGap:
+            case ExecState::HoldDownVisible:
+            default:
+                break;
+            }
+        }
+
+        void TickHoldSlot(PollCommitSlot& slot, std::uint64_t nowUs, bool gateOpen)
+        {
+            const auto canOpen = ShouldOpenGateForSlot(slot, gateOpen);
+            const auto desiredEmitter = ResolveHeldEmitter(slot);
+            const bool syntheticHoldDemand = HasSyntheticHoldDemand(slot);
+
+            switch (slot.state) {
+            case ExecState::Idle:
+                if (slot.pending.kind == PendingKind::ForceCancel) {
+                    slot.pending = {};
+                    slot.activeHeldEmitter = HeldEmitterSource::None;
+                    slot.pendingGamepadHandoff = false;
+                    break;
+                }
+                if (syntheticHoldDemand) {
+                    if (slot.activeHeldEmitter == HeldEmitterSource::KeyboardMouse &&
+                        desiredEmitter == HeldEmitterSource::Gamepad) {
+                        if (!slot.pendingGamepadHandoff) {
+                            slot.pendingGamepadHandoff = true;
+                            slot.activeHeldEmitter = HeldEmitterSource::Gamepad;
+                            break;
+                        }
+
+                        slot.pendingGamepadHandoff = false;
+                    } else {
+                        slot.pendingGamepadHandoff = false;
+                    }
+
+                    if (canOpen) {
+                        StartHoldTransaction(slot, nowUs);
+                    } else {
+                        slot.activeHeldEmitter = HeldEmitterSource::Gamepad;
+                        TransitionState(slot, ExecState::WaitingForGate, nowUs);
+                    }
+                } else {
+                    slot.pendingGamepadHandoff = false;
+                    slot.activeHeldEmitter = desiredEmitter;
+                    if (slot.pending.kind != PendingKind::None) {
+                        slot.pending.kind = PendingKind::None;
+                    }
+                }
+                break;
+
+            case ExecState::WaitingForGate:
+                if (slot.pending.kind == PendingKind::ForceCancel) {
+                    slot.pending = {};
+                    slot.activeHeldEmitter = HeldEmitterSource::None;
+                    slot.pendingGamepadHandoff = false;
+                    TransitionState(slot, ExecState::Idle, nowUs);
+                    break;
+                }
+                if (!syntheticHoldDemand) {
+                    slot.pending.kind = PendingKind::None;
+                    slot.pendingGamepadHandoff = false;
+                    slot.activeHeldEmitter = desiredEmitter;
+                    TransitionState(slot, ExecState::Idle, nowUs);
+                    break;
+                }
+
+                if (canOpen) {
+                    StartHoldTransaction(slot, nowUs);
+                }
+                break;
+
+            case ExecState::HoldDownVisible:
+                if (slot.pending.kind == PendingKind::ForceCancel || !syntheticHoldDemand) {
+                    TransitionState(slot, ExecState::ReleaseGap, nowUs);
+                }
+                break;
+
+            case ExecState::PulseDownVisible:
+            case ExecState::ReleaseGap:
+            default:
+                break;
+            }
+        }
+
+        void TickRepeatSlot(PollCommitSlot& slot, std::uint64_t nowUs, bool gateOpen)
+        {
+            const auto canOpen = ShouldOpenGateForSlot(slot, gateOpen);
+
+            switch (slot.state) {
+            case ExecState::Idle:
+                if (slot.pending.kind == PendingKind::ForceCancel) {
+                    slot.pending = {};
+                    break;
+                }
+                if (slot.pending.kind == PendingKind::RepeatStart) {
+                    if (canOpen) {
+                        StartRepeatTransaction(slot, nowUs);
+                    } else {
+                        TransitionState(slot, ExecState::WaitingForGate, nowUs);
+                    }
+                } else if (slot.pending.kind != PendingKind::None) {
+                    slot.pending.kind = PendingKind::None;
+                }
+                break;
+
+            case ExecState::WaitingForGate:
+                if (slot.pending.kind == PendingKind::ForceCancel) {
+                    slot.pending = {};
+                    TransitionState(slot, ExecState::Idle, nowUs);
+                    break;
+                }
+                if (slot.pending.kind != PendingKind::RepeatStart) {
+                    TransitionState(slot, ExecState::Idle, nowUs);
+                    break;
+                }
+
+                if (canOpen) {
+                    StartRepeatTransaction(slot, nowUs);
+                }
+                break;
+
+            case ExecState::HoldDownVisible:
+                if (slot.pending.kind == PendingKind::ForceCancel) {
+                    TransitionState(slot, ExecState::ReleaseGap, nowUs);
+                    break;
+                }
+                if (!HasHeldContributors(slot) &&
+                    slot.token.active &&
+                    slot.token.downSubmitted) {
+                    TransitionState(slot, ExecState::ReleaseGap, nowUs);
+                }
+                break;
+
+            case ExecState::PulseDownVisible:
+            case ExecState::ReleaseGap:
+            default:
+                break;
+            }
+        }
+
+        [[nodiscard]] bool CanStartNewTransaction(const PollCommitSlot& slot) const
+        {
+            return !slot.token.active &&
+                slot.state != ExecState::PulseDownVisible &&
+                slot.state != ExecState::HoldDownVisible &&
+                slot.state != ExecState::ReleaseGap;
+        }
+
+        void StartPulseTransaction(PollCommitSlot& slot, std::uint64_t nowUs)
+        {
+            ClearToken(slot);
+            slot.token.active = true;
+            slot.token.tokenId = _nextTokenId++;
+            slot.token.epoch = slot.epoch != 0 ? slot.epoch : _currentEpoch;
+            slot.token.downAtUs = nowUs;
+            slot.token.earliestReleaseAtUs = nowUs + static_cast<std::uint64_t>(slot.minDownMs) * 1000ULL;
+            TransitionState(slot, ExecState::PulseDownVisible, nowUs);
+        }
+
+        void StartHoldTransaction(PollCommitSlot& slot, std::uint64_t nowUs)
+        {
+            ClearToken(slot);
+            slot.token.active = true;
+            slot.token.tokenId = _nextTokenId++;
+            slot.token.epoch = slot.epoch != 0 ? slot.epoch : _currentEpoch;
+            slot.token.downAtUs = nowUs;
+            slot.token.earliestReleaseAtUs = nowUs;
+            slot.pending.kind = PendingKind::None;
+            slot.activeHeldEmitter = HeldEmitterSource::Gamepad;
+            TransitionState(slot, ExecState::HoldDownVisible, nowUs);
+        }
+
+        void StartRepeatTransaction(PollCommitSlot& slot, std::uint64_t nowUs)
+        {
+            StartHoldTransaction(slot, nowUs);
+            // Repeat currently relies on sustained current-state down after the
+            // first visible edge so Skyrim's native producer generates subsequent
+            // repeat events.
+        }
+
+        void ClearToken(PollCommitSlot& slot)
+        {
+            slot.token = {};
+        }
+
+        void TransitionState(
+            PollCommitSlot& slot,
+            ExecState newState,
+            std::uint64_t nowUs)
+        {
+            if (slot.state == newState) {
+                return;
+            }
+
+            slot.state = newState;
+            slot.lastTransitionUs = nowUs;
+        }
+
+        [[nodiscard]] bool ShouldOpenGateForSlot(
+            const PollCommitSlot& slot,
+            [[nodiscard]] bool gameplayGateOpen) const
+        {
+            return !slot.gateAware || gameplayGateOpen;
+        }
+
+        [[nodiscard]] bool IsSingleEmitterHoldAction(RE::BSFixedString actionId) const
+        {
+            return actionId == RE::BSFixedString(kSprintAction.data());
+        }
+
+        [[nodiscard]] HeldEmitterSource ResolveHeldEmitter(const PollCommitSlot& slot) const
+        {
+            if (IsSingleEmitterHoldAction(slot.actionId)) {
+                const bool hasGamepad = HasHeldContributor(slot, HeldContributor::Gamepad);
+                const bool hasKeyboardMouse = HasHeldContributor(slot, HeldContributor::KeyboardMouse);
+
+                switch (slot.activeHeldEmitter) {
+                case HeldEmitterSource::Gamepad:
+                    if (hasGamepad) {
+                        return HeldEmitterSource::Gamepad;
+                    }
+                    if (hasKeyboardMouse) {
+                        return HeldEmitterSource::KeyboardMouse;
+                    }
+                    return HeldEmitterSource::None;
+
+                case HeldEmitterSource::KeyboardMouse:
+                    if (hasKeyboardMouse) {
+                        return HeldEmitterSource::KeyboardMouse;
+                    }
+                    if (hasGamepad) {
+                        return HeldEmitterSource::Gamepad;
+                    }
+                    return HeldEmitterSource::None;
+
+                case HeldEmitterSource::None:
+                default:
+                    if (hasKeyboardMouse) {
+                        return HeldEmitterSource::KeyboardMouse;
+                    }
+                    if (hasGamepad) {
+                        return HeldEmitterSource::Gamepad;
+                    }
+                    return HeldEmitterSource::None;
+                }
+            }
+
+            if (HasHeldContributor(slot, HeldContributor::Gamepad)) {
+                return HeldEmitterSource::Gamepad;
+            }
+            if (HasHeldContributor(slot, HeldContributor::KeyboardMouse)) {
+                return HeldEmitterSource::KeyboardMouse;
+            }
+            return HeldEmitterSource::None;
+        }
+
+        [[nodiscard]] bool HasSyntheticHoldDemand(const PollCommitSlot& slot) const
+        {
+            if (slot.mode != PollCommitMode::Hold && slot.mode != PollCommitMode::Repeat) {
+                return HasHeldContributors(slot);
+            }
+
+            if (!IsSingleEmitterHoldAction(slot.actionId)) {
+                return HasHeldContributors(slot);
+            }
+
+            return ResolveHeldEmitter(slot) == HeldEmitterSource::Gamepad;
+        }
+
+        [[nodiscard]] bool HasHeldContributors(const PollCommitSlot& slot) const
+        {
+            return slot.heldContributorMask != 0;
+        }
+
+        [[nodiscard]] bool HasHeldContributor(const PollCommitSlot& slot, HeldContributor contributor) const
+        {
+            const auto mask = static_cast<std::uint8_t>(contributor);
+            return mask != 0 && (slot.heldContributorMask & mask) != 0;
+        }
+    };
+
+    bool SameSlot(const PollCommitSlot& lhs, const PollCommitSlot& rhs)
+    {
+        return lhs.actionId == rhs.actionId &&
+            lhs.context == rhs.context &&
+            lhs.outputCode == rhs.outputCode &&
+            lhs.mode == rhs.mode &&
+            lhs.state == rhs.state &&
+            lhs.gateAware == rhs.gateAware &&
+            lhs.epoch == rhs.epoch &&
+            lhs.minDownMs == rhs.minDownMs &&
+            lhs.token.active == rhs.token.active &&
+            lhs.token.tokenId == rhs.token.tokenId &&
+            lhs.token.epoch == rhs.token.epoch &&
+            lhs.token.downAtUs == rhs.token.downAtUs &&
+            lhs.token.earliestReleaseAtUs == rhs.token.earliestReleaseAtUs &&
+            lhs.token.downSubmitted == rhs.token.downSubmitted &&
+            lhs.token.releaseSubmitted == rhs.token.releaseSubmitted &&
+            lhs.pending.kind == rhs.pending.kind &&
+            lhs.pending.epoch == rhs.pending.epoch &&
+            lhs.pending.queuedAtUs == rhs.pending.queuedAtUs &&
+            lhs.pending.pendingNextPulse == rhs.pending.pendingNextPulse &&
+            lhs.heldContributorMask == rhs.heldContributorMask &&
+            lhs.activeHeldEmitter == rhs.activeHeldEmitter &&
+            lhs.pendingGamepadHandoff == rhs.pendingGamepadHandoff &&
+            lhs.lastTransitionUs == rhs.lastTransitionUs;
+    }
+
+    std::string DescribeSlot(const PollCommitSlot& slot, bool gateOpen)
+    {
+        return std::string(slot.actionId.c_str()) +
+            " mode=" + std::string(ToString(slot.mode)) +
+            " state=" + std::string(ToString(slot.state)) +
+            " pending=" + std::string(ToString(slot.pending.kind)) +
+            " nextPulse=" + std::to_string(slot.pending.pendingNextPulse) +
+            " gateAware=" + std::to_string(slot.gateAware) +
+            " gateOpen=" + std::to_string(gateOpen) +
+            " token=" + std::to_string(slot.token.active) + "/" + std::to_string(slot.token.downSubmitted) +
+            " release@" + std::to_string(slot.token.earliestReleaseAtUs) +
+            " contributors=" + std::to_string(slot.heldContributorMask) +
+            " emitter=" + std::string(ToString(slot.activeHeldEmitter)) +
+            " handoff=" + std::to_string(slot.pendingGamepadHandoff);
+    }
+
+    // Walks every combination of the slot fields Tick reads and compares the
+    // table-driven coordinator with the legacy conditionals.
+    void TestTickTableMatchesLegacyTransitions()
+    {
+        constexpr std::uint64_t kNowUs = 10'000;
+        PollCommitCoordinator coordinator;
+        LegacyTickReference reference;
+        std::size_t checked = 0;
+
+        for (const auto sprint : { false, true }) {
+            coordinator.Reset();
+            reference = {};
+            for (std::uint8_t mode = 0; mode <= static_cast<std::uint8_t>(PollCommitMode::Repeat); ++mode) {
+                for (std::uint8_t state = 0; state <= static_cast<std::uint8_t>(ExecState::ReleaseGap); ++state) {
+                    for (std::uint8_t pending = 0; pending <= static_cast<std::uint8_t>(PendingKind::ForceCancel); ++pending) {
+                        for (std::uint32_t bits = 0; bits < (1u << 7); ++bits) {
+                            for (std::uint8_t contributors = 0; contributors < 4; ++contributors) {
+                                for (std::uint8_t emitter = 0; emitter <= static_cast<std::uint8_t>(HeldEmitterSource::KeyboardMouse); ++emitter) {
+                                    PollCommitSlot slot{};
+                                    slot.actionId = RE::BSFixedString((sprint ? kSprintAction : kJumpAction).data());
+                                    slot.outputCode = sprint ? NativeControlCode::Sprint : NativeControlCode::Jump;
+                                    slot.mode = static_cast<PollCommitMode>(mode);
+                                    slot.state = static_cast<ExecState>(state);
+                                    slot.epoch = 7;
+                                    slot.minDownMs = 2;
+                                    slot.pending.kind = static_cast<PendingKind>(pending);
+                                    slot.pending.pendingNextPulse = (bits & (1u << 0)) != 0;
+                                    slot.gateAware = (bits & (1u << 1)) != 0;
+                                    const bool gateOpen = (bits & (1u << 2)) != 0;
+                                    slot.token.active = (bits & (1u << 3)) != 0;
+                                    slot.token.downSubmitted = (bits & (1u << 4)) != 0;
+                                    slot.token.earliestReleaseAtUs = (bits & (1u << 5)) != 0 ? kNowUs : kNowUs + 1;
+                                    slot.pendingGamepadHandoff = (bits & (1u << 6)) != 0;
+                                    slot.heldContributorMask = contributors;
+                                    slot.activeHeldEmitter = static_cast<HeldEmitterSource>(emitter);
+
+                                    auto expected = slot;
+                                    reference.TickSlot(expected, kNowUs, gateOpen);
+
+                                    coordinator.RestoreSlotForTests(slot);
+                                    coordinator.Tick(kNowUs, gateOpen);
+                                    const auto* actual = coordinator.FindSlot(slot.outputCode);
+                                    Require(actual != nullptr, "restored slot should be indexed by its native code");
+                                    if (!SameSlot(*actual, expected)) {
+                                        throw std::runtime_error("tick table diverges from legacy transitions: " + DescribeSlot(slot, gateOpen));
+                                    }
+                                    ++checked;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        Require(checked == 2u * 5u * 5u * 7u * 128u * 4u * 3u, "exhaustive walk should cover every combination");
+    }
+
+    struct RecordingEmitter final : IPollCommitEmitter
+    {
+        std::vector<EmitEdge> edges;
+
+        EmitResult Emit(const EmitRequest& request) override
+        {
+            edges.push_back(request.edge);
+            return EmitResult{ .submitted = true };
+        }
+    };
+
+    PollCommitRequest MakeRequest(
+        std::string_view actionId,
+        NativeControlCode code,
+        PollCommitMode mode,
+        PollCommitRequestKind kind,
+        bool gateAware = false)
+    {
+        return PollCommitRequest{
+            .actionId = RE::BSFixedString(actionId.data()),
+            .outputCode = code,
+            .mode = mode,
+            .kind = kind,
+            .contributor = HeldContributor::Gamepad,
+            .gateAware = gateAware,
+            .epoch = 1
+        };
+    }
+
+    void Poll(PollCommitCoordinator& coordinator, RecordingEmitter& emitter, std::uint64_t nowUs, bool gateOpen)
+    {
+        coordinator.BeginFrame(InputContext::Gameplay, 1, nowUs);
+        coordinator.Tick(nowUs, gateOpen);
+        coordinator.Flush(emitter, nowUs);
+    }
+
+    void TestPulseWaitsForGateAndCoalesces()
+    {
+        PollCommitCoordinator coordinator;
+        RecordingEmitter emitter;
+        const auto jump = MakeRequest(kJumpAction, NativeControlCode::Jump, PollCommitMode::Pulse, PollCommitRequestKind::Pulse, true);
+
+        Require(coordinator.QueueRequest(jump), "pulse request should queue");
+        Require(coordinator.QueueRequest(jump), "second pulse should coalesce");
+        Poll(coordinator, emitter, 1'000, false);
+        Require(coordinator.FindSlot(NativeControlCode::Jump)->state == ExecState::WaitingForGate, "closed gate should park the pulse");
+        Require(emitter.edges.empty(), "nothing should emit while the gate is closed");
+
+        Poll(coordinator, emitter, 2'000, true);
+        Poll(coordinator, emitter, 3'000, true);
+        Poll(coordinator, emitter, 4'000, true);
+        Poll(coordinator, emitter, 5'000, true);
+        const std::vector<EmitEdge> expected{ EmitEdge::Down, EmitEdge::Up, EmitEdge::Down, EmitEdge::Up };
+        Require(emitter.edges == expected, "coalesced pulse should replay once after the first completes");
+        Require(coordinator.FindSlot(NativeControlCode::Jump)->coalescedPulseCount == 1, "coalesce counter should record the follow-up");
+    }
+
+    void TestHoldAndRepeatReleaseWithContributors()
+    {
+        PollCommitCoordinator coordinator;
+        RecordingEmitter emitter;
+
+        Require(coordinator.QueueRequest(MakeRequest("Game.Shout", NativeControlCode::Shout, PollCommitMode::Hold, PollCommitRequestKind::HoldSet)), "hold set should queue");
+        Require(coordinator.QueueRequest(MakeRequest("Menu.ScrollUp", NativeControlCode::MenuScrollUp, PollCommitMode::Repeat, PollCommitRequestKind::RepeatSet)), "repeat set should queue");
+        Poll(coordinator, emitter, 1'000, true);
+        Require(coordinator.FindSlot(NativeControlCode::Shout)->state == ExecState::HoldDownVisible, "hold should be visible");
+        Require(coordinator.FindSlot(NativeControlCode::MenuScrollUp)->state == ExecState::HoldDownVisible, "repeat should be visible");
+
+        Require(coordinator.QueueRequest(MakeRequest("Game.Shout", NativeControlCode::Shout, PollCommitMode::Hold, PollCommitRequestKind::HoldClear)), "hold clear should queue");
+        Require(coordinator.QueueRequest(MakeRequest("Menu.ScrollUp", NativeControlCode::MenuScrollUp, PollCommitMode::Repeat, PollCommitRequestKind::RepeatClear)), "repeat clear should queue");
+        Poll(coordinator, emitter, 2'000, true);
+        Require(coordinator.FindSlot(NativeControlCode::Shout)->state == ExecState::Idle, "hold should release back to idle");
+        Require(coordinator.FindSlot(NativeControlCode::MenuScrollUp)->state == ExecState::Idle, "repeat should release back to idle");
+        const std::vector<EmitEdge> expected{ EmitEdge::Down, EmitEdge::Down, EmitEdge::Up, EmitEdge::Up };
+        Require(emitter.edges == expected, "hold and repeat should each emit one down and one up");
+    }
+
+    void TestSprintHandoffAndSlotLookup()
+    {
+        PollCommitCoordinator coordinator;
+        RecordingEmitter emitter;
+
+        auto sprint = MakeRequest(kSprintAction, NativeControlCode::Sprint, PollCommitMode::Hold, PollCommitRequestKind::HoldSet);
+        sprint.contributor = HeldContributor::KeyboardMouse;
+        Require(coordinator.QueueRequest(sprint), "keyboard sprint should queue");
+        Poll(coordinator, emitter, 1'000, true);
+        Require(coordinator.FindSlot(NativeControlCode::Sprint)->activeHeldEmitter == HeldEmitterSource::KeyboardMouse, "keyboard should own sprint");
+        Require(coordinator.FindSlot(NativeControlCode::Sprint)->state == ExecState::Idle, "keyboard-owned sprint should not synthesize a hold");
+
+        coordinator.SyncHeldContributor(NativeControlCode::Sprint, HeldContributor::KeyboardMouse, false);
+        coordinator.SyncHeldContributor(NativeControlCode::Sprint, HeldContributor::Gamepad, true);
+        Poll(coordinator, emitter, 2'000, true);
+        Require(coordinator.FindSlot(NativeControlCode::Sprint)->pendingGamepadHandoff, "handoff should spend one poll released");
+        Poll(coordinator, emitter, 3'000, true);
+        Require(coordinator.FindSlot(NativeControlCode::Sprint)->state == ExecState::HoldDownVisible, "gamepad should take sprint after the gap");
+
+        Require(coordinator.FindSlot(NativeControlCode::Jump) == nullptr, "unbound codes should not resolve to a slot");
+        Require(
+            !coordinator.QueueRequest(MakeRequest("Game.Move", NativeControlCode::MoveStick, PollCommitMode::Hold, PollCommitRequestKind::HoldSet)),
+            "axis codes have no poll commit slot");
+        Require(
+            !coordinator.QueueRequest(MakeRequest("Game.Other", NativeControlCode::Sprint, PollCommitMode::Hold, PollCommitRequestKind::HoldSet)),
+            "a bound slot should not change owner");
+    }
+
+    void TestEpochChangeInvalidatesSlots()
+    {
+        PollCommitCoordinator coordinator;
+        RecordingEmitter emitter;
+        Require(coordinator.QueueRequest(MakeRequest("Game.Shout", NativeControlCode::Shout, PollCommitMode::Hold, PollCommitRequestKind::HoldSet)), "hold set should queue");
+        Poll(coordinator, emitter, 1'000, true);
+
+        coordinator.BeginFrame(InputContext::Gameplay, 2, 2'000);
+        const auto* shout = coordinator.FindSlot(NativeControlCode::Shout);
+        Require(shout->state == ExecState::ReleaseGap && shout->heldContributorMask == 0, "new epoch should cancel the visible hold");
+        coordinator.Tick(2'000, true);
+        coordinator.Flush(emitter, 2'000);
+        Require(shout->state == ExecState::Idle && shout->cancelledCount == 1, "cancelled hold should release and settle");
+    }
+}
+
+int main()
+{
+    TestTickTableMatchesLegacyTransitions();
+    TestPulseWaitsForGateAndCoalesces();
+    TestHoldAndRepeatReleaseWithContributors();
+    TestSprintHandoffAndSlotLookup();
+    TestEpochChangeInvalidatesSlots();
+    return 0;
+}
@@ -1,18 +1,28 @@
 #include "pch.h"
 
+#include "input_v2/telemetry/FlightRecorder.h"
+#include "input_v2/telemetry/InputTraceRecorder.h"
 #include "input_v2/telemetry/ReplayHarness.h"
+#include "input_v2/telemetry/TraceCsvConverter.h"
+#include "input_v2/telemetry/TraceRecordFormat.h"
 #include "input_v2/telemetry/TraceSchema.h"
 
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <iterator>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <vector>
 
 namespace
 {
+    namespace input = dualpad::input;
     namespace telemetry = dualpad::input_v2::telemetry;
 
     void Require(bool condition, std::string_view message)
@@ -43,6 +53,12 @@ namespace
         out << contents;
     }
 
+    std::string ReadFile(const std::filesystem::path& path)
+    {
+        std::ifstream in(path, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+
     void WriteHeaderOnlyBundle(const std::filesystem::path& scenario)
     {
         std::filesystem::create_directories(scenario);
@@ -426,6 +442,339 @@ namespace
         Require(configActual.size() > 1, "11_config_reload_success_failure must produce non-empty runtime poll rows");
     }
 
+    input::PadEventSnapshot MakeTraceSnapshot(std::uint64_t sequence, std::size_t eventCount)
+    {
+        input::PadEventSnapshot snapshot{};
+        snapshot.sequence = sequence;
+        snapshot.firstSequence = sequence;
+        snapshot.sourceTimestampUs = sequence * 1000;
+        snapshot.state.leftStick.x = 0.25f;
+        snapshot.state.buttons.digitalMask = 0x10;
+        for (std::size_t i = 0; i < eventCount; ++i) {
+            snapshot.events.events[i].type = input::PadEventType::ButtonPress;
+            snapshot.events.events[i].code = static_cast<std::uint32_t>(0x10 + i);
+            snapshot.events.events[i].timestampUs = snapshot.sourceTimestampUs;
+        }
+        snapshot.events.count = eventCount;
+        return snapshot;
+    }
+
+    void TestBinaryTraceRestoresCrossThreadOrder()
+    {
+        const auto root = TempRoot() / "binary-trace";
+        std::filesystem::remove_all(root);
+        auto& recorder = telemetry::InputTraceRecorder::GetSingleton();
+        const auto before = recorder.GetStats();
+
+        recorder.BeginReplaySession(root, "session");
+        // Submits come from an ingress thread and drains from the caller;
+        // each thread has its own ring, so file order differs from call order.
+        std::thread([&recorder] {
+            recorder.RecordDispatcherSubmit(MakeTraceSnapshot(1, 2), 0, 1);
+        }).join();
+        const input::DrainTelemetryContext drain{
+            .reason = input::DrainReason::UpstreamPoll,
+            .routeState = input::UpstreamRouteState::ActiveFresh,
+            .lastPollAgeMs = 4,
+            .hookInstalled = true
+        };
+        recorder.RecordDispatcherDrain(drain, 16, 1, 1, 0);
+        std::thread([&recorder] {
+            recorder.RecordDispatcherSubmit(MakeTraceSnapshot(2, 0), 0, 1);
+        }).join();
+
+        recorder.SetActiveSnapshotSequence(7);
+        recorder.RecordKeyboardCommand(
+            input::backend::KeyboardBridgeCommandType::Pulse,
+            0x1C,
+            "Menu.Confirm",
+            input::backend::ActionOutputContract::Pulse,
+            input::InputContext::Menu);
+        recorder.RecordKeyboardCommand(
+            input::backend::KeyboardBridgeCommandType::Release,
+            0x1C,
+            "Menu.Confirm",
+            input::backend::ActionOutputContract::Pulse,
+            input::InputContext::Menu);
+        recorder.SetActiveSnapshotSequence(8);
+        recorder.RecordKeyboardCommand(
+            input::backend::KeyboardBridgeCommandType::Press,
+            0x01,
+            "Menu, Cancel",
+            input::backend::ActionOutputContract::Hold,
+            input::InputContext::Menu);
+        recorder.EndReplaySession();
+
+        const auto directory = root / "session";
+        Require(std::filesystem::is_regular_file(directory / telemetry::kTraceRecordFileName), "replay session should keep its binary trace");
+        for (const auto& spec : telemetry::Phase0TraceFiles()) {
+            const auto lines = ReadLines(directory / spec.name);
+            Require(!lines.empty() && lines[0] == spec.header, "converted bundle should carry every phase0 header");
+        }
+
+        const auto schedule = ReadLines(directory / "dispatcher_schedule.csv");
+        Require(schedule.size() == 4, "converted schedule should hold both submits and the drain");
+        Require(schedule[1] == "0,submit,1,0,frame_pump_disabled,disabled,none,false,0,1,0", "first submit should keep step 0");
+        Require(schedule[2] == "1,drain,0,16,upstream_poll,active_fresh,4,true,1,0,1", "drain should sit between the submits");
+        Require(schedule[3].starts_with("2,submit,2,"), "second submit should follow the drain");
+
+        const auto frames = ReadLines(directory / "ingress_snapshot_frames.csv");
+        Require(frames.size() == 3 && frames[1] == "1,1,1000,Gameplay,0,false,false,false,16,0.25,0,0,0,0,0", "ingress frame row should match the CSV writer");
+        const auto events = ReadLines(directory / "ingress_snapshot_events.csv");
+        Require(events.size() == 3 && events[2].starts_with("1,1,"), "ingress events should follow their snapshot");
+
+        const auto keyboard = ReadLines(directory / "expected_keyboard_bridge.csv");
+        Require(keyboard.size() == 4, "converted keyboard bridge should hold every command");
+        Require(keyboard[1].starts_with("7,0,pulse,28,Menu.Confirm,"), "first command of a sequence should take index 0");
+        Require(keyboard[2].starts_with("7,1,release,"), "second command of a sequence should take index 1");
+        Require(keyboard[3].starts_with("8,0,press,1,\"Menu, Cancel\","), "a new sequence should restart the index and escape ids");
+
+        const auto after = recorder.GetStats();
+        Require(after.records - before.records == 6, "recorder should count every pushed record");
+        Require(after.droppedRecords == before.droppedRecords, "small sessions should not drop records");
+        Require(after.conversionFailures == before.conversionFailures, "replay conversion should succeed");
+    }
+
+    void TestBinaryTraceSegmentsAndTruncatedTail()
+    {
+        const auto root = TempRoot() / "binary-trace-segments";
+        std::filesystem::remove_all(root);
+        auto& recorder = telemetry::InputTraceRecorder::GetSingleton();
+        for (std::uint64_t sequence = 1; sequence <= 2; ++sequence) {
+            recorder.BeginReplaySession(root, "session");
+            recorder.RecordDispatcherSubmit(MakeTraceSnapshot(sequence, 1), 0, 1);
+            recorder.RecordDispatcherSubmit(MakeTraceSnapshot(sequence + 10, 1), 1, 2);
+            recorder.EndReplaySession();
+        }
+
+        const auto tracePath = root / "session" / telemetry::kTraceRecordFileName;
+        const auto converted = root / "converted";
+        const auto summary = telemetry::ConvertTraceToPhase0Csv(tracePath, converted);
+        Require(summary.segments == 2 && summary.records == 4 && !summary.truncated, "reopened session should append a second segment");
+        const auto schedule = ReadLines(converted / "dispatcher_schedule.csv");
+        Require(schedule.size() == 5, "both segments should convert");
+        Require(schedule[3].starts_with("0,submit,2,"), "step indices should restart with each segment");
+
+        std::filesystem::resize_file(tracePath, std::filesystem::file_size(tracePath) - 3);
+        const auto truncated = telemetry::ConvertTraceToPhase0Csv(tracePath, converted);
+        Require(truncated.truncated && truncated.records == 3, "a partial trailing record should be skipped");
+        Require(ReadLines(converted / "dispatcher_schedule.csv").size() == 4, "rows before the partial record should survive");
+
+        WriteFile(root / "foreign.dptrace", "step_index,op\n");
+        bool rejected = false;
+        try {
+            (void)telemetry::ConvertTraceToPhase0Csv(root / "foreign.dptrace", converted);
+        } catch (const std::runtime_error&) {
+            rejected = true;
+        }
+        Require(rejected, "files without a segment header should be rejected");
+
+        auto foreignLayout = ReadFile(tracePath);
+        foreignLayout[offsetof(telemetry::TraceSegmentHeader, layoutFingerprint)] ^= 0x01;
+        std::ofstream(root / "foreign-layout.dptrace", std::ios::binary | std::ios::trunc) << foreignLayout;
+        rejected = false;
+        try {
+            (void)telemetry::ConvertTraceToPhase0Csv(root / "foreign-layout.dptrace", converted);
+        } catch (const std::runtime_error&) {
+            rejected = true;
+        }
+        Require(rejected, "traces written with another record layout should be rejected");
+    }
+
+    void TestTraceEncoderZeroesPadding()
+    {
+        // Same members over a zeroed and a garbage-filled object: only the
+        // padding differs, and none of it may reach the record.
+        const auto encode = [](unsigned char fill) {
+            telemetry::TraceDeadlineTick tick;
+            std::memset(static_cast<void*>(&tick), fill, sizeof(tick));
+            tick.sequence = 120;
+            tick.nowUs = 1360000;
+            tick.poll.downMask = 0x20000;
+            tick.poll.context = input::InputContext::Gameplay;
+            tick.poll.contextEpoch = 1;
+            tick.poll.sourceTimestampUs = 1000000;
+            tick.poll.pollSequence = 3;
+            tick.poll.moveX = tick.poll.moveY = tick.poll.lookX = tick.poll.lookY = 0.0f;
+            tick.poll.leftTrigger = tick.poll.rightTrigger = 0.0f;
+            tick.poll.stateVersion = 4;
+            tick.poll.lateLatchedMask = 0;
+            tick.poll.hasDigital = true;
+            tick.poll.hasAnalog = tick.poll.overflowed = tick.poll.coalesced = false;
+            for (auto* mask : {
+                     &tick.poll.pressedMask, &tick.poll.releasedMask, &tick.poll.pulseMask,
+                     &tick.poll.unmanagedDownMask, &tick.poll.unmanagedPressedMask,
+                     &tick.poll.unmanagedReleasedMask, &tick.poll.unmanagedPulseMask,
+                     &tick.poll.managedMask, &tick.poll.committedDownMask,
+                     &tick.poll.committedPressedMask, &tick.poll.committedReleasedMask }) {
+                *mask = 0;
+            }
+            tick.firedChanges = 1;
+            tick.runtimeHealthReasons = 0;
+            tick.outputApplySucceeded = true;
+
+            std::string buffer;
+            telemetry::TraceRecordEncoder record(buffer, telemetry::TraceRecordKind::DeadlineTick, 9);
+            record.Put(tick);
+            record.Finish();
+            return buffer;
+        };
+
+        Require(encode(0x00) == encode(0xAB), "struct padding should be written as zeroes");
+    }
+
+    void TestReplaySessionDoesNotDropRecords()
+    {
+        const auto root = TempRoot() / "binary-trace-full-ring";
+        std::filesystem::remove_all(root);
+        auto& recorder = telemetry::InputTraceRecorder::GetSingleton();
+        const auto before = recorder.GetStats();
+
+        // Several ring capacities pushed faster than the writer interval.
+        constexpr std::uint64_t kSubmits = 2000;
+        recorder.BeginReplaySession(root, "session");
+        for (std::uint64_t sequence = 1; sequence <= kSubmits; ++sequence) {
+            recorder.RecordDispatcherSubmit(MakeTraceSnapshot(sequence, input::kMaxPadEventsPerFrame), 0, 1);
+        }
+        recorder.EndReplaySession();
+
+        const auto after = recorder.GetStats();
+        Require(after.droppedRecords == before.droppedRecords, "a replay session should drain a full ring instead of dropping");
+        Require(after.records - before.records == kSubmits, "every submit should be recorded");
+        Require(
+            ReadLines(root / "session" / "dispatcher_schedule.csv").size() == kSubmits + 1,
+            "the converted schedule should keep every submit");
+    }
+
+    void TestHoldDeadlineTickReplays()
+    {
+        const auto golden = ProjectRoot() / "tests" / "replay" / "golden" / "phase0" / "12_hold_deadline_tick";
+        for (const auto mode : { telemetry::ReplayMode::Dispatcher, telemetry::ReplayMode::Processor }) {
+            const auto actual = TempRoot() / "hold-deadline-tick";
+            const auto result = telemetry::ReplayScenario(golden, mode, actual);
+            Require(result.ok, result.message);
+
+            const auto ticks = ReadLines(actual / telemetry::kDeadlineTickFileName);
+            Require(
+                ticks.size() == 2 && ticks[1].starts_with("2,120,1360000,1,true,"),
+                "the hold should fire on the recorded tick between frames, not on the release frame");
+            const auto debug = ReadLines(actual / telemetry::kRuntimeDebugSnapshotFileName);
+            Require(
+                std::ranges::any_of(debug, [](const std::string& line) {
+                    return line.find(",deadline_tick,") != std::string::npos;
+                }),
+                "a fired tick should publish its own runtime debug snapshot");
+        }
+
+        // Without the recorded tick the hold waits for the release frame,
+        // which the golden rejects.
+        const auto scenario = TempRoot() / "hold-deadline-tick-untimed";
+        std::filesystem::remove_all(scenario);
+        std::filesystem::copy(golden, scenario);
+        WriteFile(scenario / telemetry::kDeadlineTickFileName, std::string(telemetry::kDeadlineTickHeader) + "\n");
+        const auto untimed = telemetry::ReplayScenario(scenario, telemetry::ReplayMode::Dispatcher, TempRoot() / "hold-untimed-out");
+        Require(untimed.ok, untimed.message);
+        Require(
+            ReadLines(TempRoot() / "hold-untimed-out" / telemetry::kDeadlineTickFileName).size() <= 1,
+            "drains without a recorded tick should not fire the hold early");
+    }
+
+    void TestManifestTransitionReplaysPreservation()
+    {
+        const auto golden = ProjectRoot() / "tests" / "replay" / "golden" / "phase0" / "12_hold_deadline_tick";
+        const auto scenario = TempRoot() / "hold-manifest-transition";
+        const auto actual = TempRoot() / "hold-manifest-transition-out";
+        const auto replayWith = [&](std::string_view preserves) {
+            std::filesystem::remove_all(scenario);
+            std::filesystem::copy(golden, scenario);
+            WriteFile(
+                scenario / telemetry::kManifestTransitionFileName,
+                std::string(telemetry::kManifestTransitionHeader) + "\n" +
+                    "1,0,1,false\n" +
+                    "2,120,2," + std::string(preserves) + "\n");
+            return telemetry::ReplayScenario(scenario, telemetry::ReplayMode::Dispatcher, actual);
+        };
+
+        const auto preserved = replayWith("true");
+        Require(preserved.ok, preserved.message);
+        const auto transitions = ReadLines(actual / telemetry::kManifestTransitionFileName);
+        Require(
+            transitions.size() == 3 && transitions[1].starts_with("1,0,") && transitions[2].starts_with("2,120,") &&
+                transitions[2].ends_with(",true"),
+            "replay should trace the seeded and the re-issued publication");
+
+        const auto reset = replayWith("false");
+        Require(
+            !reset.ok && reset.message.find(telemetry::kDeadlineTickFileName) != std::string::npos,
+            "a non-preserving publication before the tick should drop the pending hold");
+    }
+
+    void TestFlightRecorderDumpReplays()
+    {
+        const auto root = TempRoot() / "flight-recorder";
+        std::filesystem::remove_all(root);
+        auto& flight = telemetry::FlightRecorder::GetSingleton();
+        flight.ResetForTests();
+        Require(!flight.DumpNow(telemetry::FlightDumpTrigger::Hotkey), "an unarmed recorder has nothing to dump");
+
+        flight.Start({ .outputRoot = root / "dumps", .autoDump = false });
+        const auto golden = ProjectRoot() / "tests" / "replay" / "golden" / "phase0" / "09_combo_native_pause_screenshot_hotkeys";
+        const auto replayed = telemetry::ReplayScenario(golden, telemetry::ReplayMode::Dispatcher, root / "replayed");
+        Require(replayed.ok, replayed.message);
+        Require(flight.GetStats().captured > 0, "an armed recorder should capture submits, drains and poll frames");
+
+        const auto dump = flight.DumpNow(telemetry::FlightDumpTrigger::Hotkey, "test");
+        Require(dump.has_value(), "a dump should be written while the window holds records");
+        Require(std::filesystem::is_regular_file(*dump / telemetry::kTraceRecordFileName), "a dump should keep its binary trace");
+        const auto info = ReadLines(*dump / "flight_dump.txt");
+        Require(!info.empty() && info[0] == "trigger=hotkey", "a dump should record its trigger");
+
+        const auto schema = telemetry::ReplayScenario(*dump, telemetry::ReplayMode::ValidateSchema, root / "schema");
+        Require(schema.ok, schema.message);
+        const auto schedule = ReadLines(*dump / "dispatcher_schedule.csv");
+        Require(schedule.size() > 1 && schedule[1].find(",submit,") != std::string::npos, "a dump should start at a submit");
+        const auto captured = ReadLines(*dump / telemetry::kCapturedOutputsFileName);
+        Require(
+            std::ranges::find(captured, "expected_authoritative_poll.csv") != captured.end() &&
+                std::ranges::find(captured, "expected_keyboard_bridge.csv") == captured.end(),
+            "a dump should list only the outputs it captured");
+        Require(
+            ReadLines(*dump / "expected_keyboard_bridge.csv").size() == 1,
+            "a dump should not carry keyboard commands it never captured");
+
+        const auto redo = telemetry::ReplayScenario(*dump, telemetry::ReplayMode::Dispatcher, root / "redo");
+        Require(redo.ok, redo.message);
+        for (const auto fileName : {
+                 std::string_view("dispatcher_schedule.csv"),
+                 std::string_view("ingress_snapshot_events.csv"),
+                 std::string_view("expected_authoritative_poll.csv") }) {
+            const auto dumped = ReadLines(*dump / fileName);
+            Require(dumped.size() > 1, "a dump should carry the captured rows");
+            Require(ReadLines(root / "redo" / fileName) == dumped, "replaying a dump should reproduce its rows");
+        }
+        // The replay still runs the whole runtime; the F13 pulse of the
+        // final frame comes back although the dump never held it.
+        Require(
+            ReadLines(root / "redo" / "expected_keyboard_bridge.csv").back() ==
+                "9,0,pulse,100,VirtualKey.DIK_F13,Pulse,Gameplay",
+            "replaying a dump should reproduce the keyboard command of its last frame");
+
+        // Automatic triggers stay quiet when disabled; the hotkey always
+        // goes through the worker.
+        const auto suppressedBefore = flight.GetStats().suppressedDumps;
+        flight.RequestDump(telemetry::FlightDumpTrigger::QueueOverflow, "test");
+        flight.RequestDump(telemetry::FlightDumpTrigger::Hotkey, "test");
+        flight.WaitIdle();
+        const auto stats = flight.GetStats();
+        Require(
+            stats.dumps == 2 && stats.suppressedDumps == suppressedBefore + 1 && stats.failedDumps == 0,
+            "auto dumps should honour the options");
+        Require(stats.lastDumpDirectory != *dump, "each dump should get its own directory");
+
+        flight.ResetForTests();
+        Require(!flight.IsArmed() && flight.GetStats().captured == 0, "reset should disarm and clear the recorder");
+    }
+
     void GeneratePhase0RuntimeReplayForDiff()
     {
         const auto result = telemetry::ReplayBatch(
@@ -450,6 +799,13 @@ int main()
         TestProcessorModeProducesCandidateOutput();
         TestProcessorModeFailsOnBehavioralMismatch();
         TestProcessorModeCapturesRuntimeSurfaces();
+        TestBinaryTraceRestoresCrossThreadOrder();
+        TestBinaryTraceSegmentsAndTruncatedTail();
+        TestTraceEncoderZeroesPadding();
+        TestReplaySessionDoesNotDropRecords();
+        TestHoldDeadlineTickReplays();
+        TestManifestTransitionReplaysPreservation();
+        TestFlightRecorderDumpReplays();
         GeneratePhase0RuntimeReplayForDiff();
         TestPhase0SyntheticScenarioProducesRows();
         return 0;
@@ -0,0 +1,170 @@
+#include "pch.h"
+
+#include "input_v2/gameplay/AnalogGateKernel.h"
+
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    namespace gameplay = dualpad::input_v2::gameplay;
+
+    constexpr std::size_t kFrameCount = 1u << 16;
+    constexpr int kPasses = 64;
+
+    void Require(bool condition, std::string_view message)
+    {
+        if (!condition) {
+            throw std::runtime_error(std::string(message));
+        }
+    }
+
+    struct BenchFrame
+    {
+        std::array<float, 3> magnitudes{};
+        std::array<bool, 3> keyboardMouseActive{};
+        gameplay::PackedAnalogLanes lanes{};
+    };
+
+    struct BenchOutput
+    {
+        std::uint8_t owners{ 0 };
+        std::array<std::uint32_t, 6> laneBits{};
+    };
+
+    constexpr std::array<float, 3> kEnter{ 0.25f, 0.25f, 0.15f };
+    constexpr std::array<float, 3> kSustain{ 0.15f, 0.15f, 0.08f };
+
+    // The scalar threshold/owner/zeroing sequence ResolveGameplayProjection ran
+    // before the kernel, reduced to the analog channels.
+    BenchOutput RunScalar(const BenchFrame& frame, std::uint8_t previousOwners)
+    {
+        BenchOutput output{};
+        auto lanes = frame.lanes.values;
+        for (std::size_t channel = 0; channel < 3; ++channel) {
+            const bool previousGamepad = (previousOwners & (1u << channel)) != 0;
+            bool gamepad = previousGamepad;
+            if (frame.keyboardMouseActive[channel]) {
+                gamepad = false;
+            } else if (frame.magnitudes[channel] >= kEnter[channel] ||
+                       (previousGamepad && frame.magnitudes[channel] >= kSustain[channel])) {
+                gamepad = true;
+            }
+            if (gamepad) {
+                output.owners |= static_cast<std::uint8_t>(1u << channel);
+            } else {
+                lanes[channel * 2] = 0.0f;
+                lanes[channel * 2 + 1] = 0.0f;
+            }
+        }
+        for (std::size_t lane = 0; lane < output.laneBits.size(); ++lane) {
+            output.laneBits[lane] = std::bit_cast<std::uint32_t>(lanes[lane]);
+        }
+        return output;
+    }
+
+    BenchOutput RunKernel(const BenchFrame& frame, std::uint8_t previousOwners)
+    {
+        const auto thresholds = gameplay::EvaluateAnalogThresholds(
+            gameplay::PackedChannelMagnitudes{ { frame.magnitudes[0], frame.magnitudes[1], frame.magnitudes[2], 0.0f } },
+            gameplay::AnalogThresholds{
+                .enter = { { kEnter[0], kEnter[1], kEnter[2], 0.0f } },
+                .sustain = { { kSustain[0], kSustain[1], kSustain[2], 0.0f } }
+            },
+            previousOwners);
+        const auto ownership = gameplay::ResolveAnalogOwnership(gameplay::AnalogOwnershipInput{
+            .gamepadActiveMask = thresholds.activeMask,
+            .gamepadSustainedMask = thresholds.sustainedMask,
+            .previousGamepadMask = previousOwners,
+            .keyboardMouseActiveMask = static_cast<std::uint8_t>(
+                (frame.keyboardMouseActive[0] ? gameplay::AnalogChannelLook : 0) |
+                (frame.keyboardMouseActive[1] ? gameplay::AnalogChannelMove : 0) |
+                (frame.keyboardMouseActive[2] ? gameplay::AnalogChannelCombat : 0)),
+            .gameplayContext = true
+        });
+        const auto gated = gameplay::GateAnalogLanes(frame.lanes, ownership.gamepadOwnerMask);
+
+        BenchOutput output{ .owners = ownership.gamepadOwnerMask };
+        for (std::size_t lane = 0; lane < output.laneBits.size(); ++lane) {
+            output.laneBits[lane] = std::bit_cast<std::uint32_t>(gated.values[lane]);
+        }
+        return output;
+    }
+
+    std::vector<BenchFrame> BuildFrames()
+    {
+        std::mt19937 rng(0x0DA1u);
+        std::uniform_real_distribution<float> axis(-1.0f, 1.0f);
+        std::uniform_real_distribution<float> magnitude(0.0f, 0.4f);
+        std::bernoulli_distribution keyboardMouse(0.2);
+
+        std::vector<BenchFrame> frames(kFrameCount);
+        for (auto& frame : frames) {
+            for (std::size_t channel = 0; channel < 3; ++channel) {
+                frame.magnitudes[channel] = magnitude(rng);
+                frame.keyboardMouseActive[channel] = keyboardMouse(rng);
+            }
+            for (std::size_t lane = 0; lane < 6; ++lane) {
+                frame.lanes.values[lane] = axis(rng);
+            }
+        }
+        return frames;
+    }
+
+    template <class Fn>
+    double MeasureNsPerFrame(const std::vector<BenchFrame>& frames, Fn&& run, std::uint64_t& checksum)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (int pass = 0; pass < kPasses; ++pass) {
+            std::uint8_t owners = 0;
+            for (const auto& frame : frames) {
+                const auto output = run(frame, owners);
+                owners = output.owners;
+                checksum += output.owners + output.laneBits[0] + output.laneBits[5];
+            }
+        }
+        const auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        return elapsed / static_cast<double>(frames.size() * kPasses);
+    }
+}
+
+int main()
+{
+    try {
+        const auto frames = BuildFrames();
+
+        // Identity first: the kernel must reproduce the scalar path frame by
+        // frame, carrying owners forward the same way the runtime does.
+        std::uint8_t scalarOwners = 0;
+        std::uint8_t kernelOwners = 0;
+        for (const auto& frame : frames) {
+            const auto scalar = RunScalar(frame, scalarOwners);
+            const auto kernel = RunKernel(frame, kernelOwners);
+            Require(scalar.owners == kernel.owners && scalar.laneBits == kernel.laneBits, "analog kernel diverged from the scalar path");
+            scalarOwners = scalar.owners;
+            kernelOwners = kernel.owners;
+        }
+
+        std::uint64_t scalarChecksum = 0;
+        std::uint64_t kernelChecksum = 0;
+        const auto scalarNs = MeasureNsPerFrame(frames, RunScalar, scalarChecksum);
+        const auto kernelNs = MeasureNsPerFrame(frames, RunKernel, kernelChecksum);
+        Require(scalarChecksum == kernelChecksum, "analog kernel checksum diverged from the scalar path");
+
+        std::cout << "DualPadAnalogGateKernelBench frames=" << frames.size() * kPasses
+                  << " scalarNsPerFrame=" << scalarNs
+                  << " kernelNsPerFrame=" << kernelNs << '\n';
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << '\n';
+        return 1;
+    }
+}
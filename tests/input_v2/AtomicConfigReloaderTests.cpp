@@ -241,6 +241,8 @@ void RunAtomicConfigReloaderTests()
         cfg::AtomicConfigReloader::GetSingleton().ResetForTests();
         const auto res = cfg::AtomicConfigReloader::GetSingleton().LoadOrRecover(bindings3, policy3);
         Require(res.ok, "startup should succeed when config files are missing (built-in defaults)");
+        Require(res.message.find("not found; using built-in defaults") != std::string::npos, "missing config files should be reported");
+        Require(res.loadDurationUs > 0, "a successful load should report its duration");
     }
 
 }
@@ -1,13 +1,19 @@
 #include "pch.h"
 
 #include "input_v2/compat/LegacyInputContextCompat.h"
+#include "input_v2/config/LegacyIniImporter.h"
 #include "input_v2/context/ContextRefreshTick.h"
 #include "input_v2/context/ContextResolver.h"
 #include "input_v2/menu/MenuInstanceRegistry.h"
 
+#include <atomic>
 #include <iostream>
+#include <optional>
 #include <stdexcept>
+#include <string>
 #include <string_view>
+#include <thread>
+#include <vector>
 
 namespace
 {
@@ -70,6 +76,66 @@ void RunContextResolverTests()
         Require(stack.trackedMenus.front().lastSeenRevision == 1, "lastSeenRevision bookkeeping is not part of published revision semantics");
     }
 
+    {
+        menu::MenuInstanceRegistry registry;
+        const auto deepStack = [](std::uintptr_t messageBoxPtr) {
+            return menu::ObservedMenuSnapshot{
+                .completeness = menu::ObserverCompleteness::Complete,
+                .nodes = {
+                    Node(0x8000, "InventoryMenu", 4, 0x81, 0x91, 0),
+                    Node(0x8100, "ItemMenu", 5, 0x82, 0x92, 1),
+                    Node(messageBoxPtr, "MessageBoxMenu", 6, 0x83, 0x93, 2)
+                }
+            };
+        };
+
+        auto stack = registry.ReconcileAndPublish(deepStack(0x8200), catalog);
+        const auto messageBoxId = stack.trackedMenus.front().instanceId;
+        auto stats = registry.GetStats();
+        Require(stats.newInstances == 3 && stats.stablePointerHits == 0, "first observation should allocate every instance");
+        Require(stats.fingerprintFallbacks == 3 && stats.fingerprintRebinds == 0, "unknown pointers should miss the fingerprint index");
+
+        for (auto i = 0; i < 4; ++i) {
+            stack = registry.ReconcileAndPublish(deepStack(0x8200), catalog);
+        }
+        stats = registry.GetStats();
+        Require(stats.stablePointerHits == 12, "repeated observation should resolve through the pointer index");
+        Require(stats.fingerprintFallbacks == 3, "stable pointers must not fall back to fingerprints");
+        Require(stats.indexRebuilds == 1, "unchanged stacks must not rebuild the identity index");
+
+        stack = registry.ReconcileAndPublish(deepStack(0x8300), catalog);
+        stats = registry.GetStats();
+        Require(stack.trackedMenus.front().instanceId == messageBoxId, "moved menu pointer should rebind by fingerprint");
+        Require(
+            stack.trackedMenus.front().identityQuality == menu::MenuIdentityQuality::FingerprintRebound,
+            "fingerprint rebind should be reported");
+        Require(stats.fingerprintFallbacks == 4 && stats.fingerprintRebinds == 1, "rebind should count one fingerprint hit");
+
+        std::vector<menu::ObservedMenuNode> wide;
+        for (std::uint32_t i = 0; i < 40; ++i) {
+            wide.push_back(Node(0x10000 + i * 0x100, "InventoryMenu", static_cast<std::int32_t>(i), 0xA0, 0xB0 + i, i));
+        }
+        stack = registry.ReconcileAndPublish(
+            menu::ObservedMenuSnapshot{ .completeness = menu::ObserverCompleteness::Complete, .nodes = wide },
+            catalog);
+        Require(stack.trackedMenus.size() == 40, "wide stack should track every menu");
+        for (auto& node : wide) {
+            node.menuPtr += 0x8;
+        }
+        wide.push_back(Node(0x90000, "InventoryMenu", 50, 0xA0, 0xFFF, 40));
+        const auto before = registry.GetStats();
+        stack = registry.ReconcileAndPublish(
+            menu::ObservedMenuSnapshot{ .completeness = menu::ObserverCompleteness::Complete, .nodes = wide },
+            catalog);
+        stats = registry.GetStats();
+        Require(stats.fingerprintRebinds - before.fingerprintRebinds == 40, "unique fingerprints should rebind past probe collisions");
+        Require(stats.newInstances - before.newInstances == 1, "a fresh pointer and fingerprint needs a new id");
+        Require(stack.trackedMenus.size() == 41, "rebound wide stack should keep every instance");
+
+        registry.ResetForTests();
+        Require(registry.GetStats().indexRebuilds == 0, "reset should clear identity stats");
+    }
+
     {
         menu::MenuInstanceRegistry registry;
         const auto stack = registry.ReconcileAndPublish(
@@ -129,9 +195,9 @@ void RunContextResolverTests()
         const auto resolved = resolver.ResolveAndPublish(stack, ctx::GameplaySubstate::None, catalog);
         Require(resolved.uiContextId == ctx::UiContextId::Journal, "JournalMenu should resolve from compiled catalog");
         Require(resolved.legacyInputContext == InputContext::JournalMenu, "legacy mirror should come from catalog mapping");
-        Require(resolved.actionSetStack.baseSetId == "MenuBase", "menu action set base should be MenuBase");
-        Require(resolved.actionSetStack.layerIds == std::vector<std::string>{ "JournalLayer" }, "Journal layer should come from catalog");
-        Require(resolved.actionSetStack.scopeAnchorIds == std::vector<std::string>({ "MenuBase", "JournalLayer" }), "scope anchors should come from catalog");
+        Require(resolved.actionSetStack->baseSetId == "MenuBase", "menu action set base should be MenuBase");
+        Require(resolved.actionSetStack->layerIds == std::vector<std::string>{ "JournalLayer" }, "Journal layer should come from catalog");
+        Require(resolved.actionSetStack->scopeAnchorIds == std::vector<std::string>({ "MenuBase", "JournalLayer" }), "scope anchors should come from catalog");
         Require(resolved.presentationPolicyId == "JournalMenu", "presentationPolicyId must publish with resolved UiContextId");
         Require(resolved.menuStackRevision == stack.menuStackRevision, "resolver must forward registry menuStackRevision");
         Require(resolved.contextRevision == 1, "first resolved context should publish contextRevision 1");
@@ -173,8 +239,8 @@ void RunContextResolverTests()
         const auto resolved = resolver.ResolveAndPublish(stack, ctx::GameplaySubstate::None, catalog);
         Require(resolved.uiContextId == ctx::UiContextId::UnknownTrackedMenu, "degraded identity must fail closed to UnknownTrackedMenu");
         Require(resolved.legacyInputContext == InputContext::Menu, "unknown tracked menu should mirror legacy Menu");
-        Require(resolved.actionSetStack.baseSetId == "MenuBase", "unknown tracked base set should be MenuBase");
-        Require(resolved.actionSetStack.layerIds == std::vector<std::string>{ "UnknownTrackedMenuLayer" }, "unknown tracked layer must not guess specific menu layer");
+        Require(resolved.actionSetStack->baseSetId == "MenuBase", "unknown tracked base set should be MenuBase");
+        Require(resolved.actionSetStack->layerIds == std::vector<std::string>{ "UnknownTrackedMenuLayer" }, "unknown tracked layer must not guess specific menu layer");
         Require(resolved.presentationPolicyId == "Menu", "unknown tracked presentation policy must come from catalog sentinel");
     }
 
@@ -201,6 +267,57 @@ void RunContextResolverTests()
         Require(sneak.layerIds == std::vector<std::string>{ "SneakLayer" }, "sneaking layer should come from catalog");
     }
 
+    {
+        for (std::size_t index = 0; index < ctx::kUiContextIdCount; ++index) {
+            const auto id = static_cast<ctx::UiContextId>(index);
+            const auto shared = actions::ActionSetResolver::ResolveShared(catalog, id);
+            Require(shared != nullptr, "every UiContextId should have a precomputed action set stack");
+            Require(shared == catalog.actionSetStackById[index], "ResolveShared should hand out the catalog's stack");
+            Require(
+                *shared == ctx::ContextCatalog::BuildActionSetStack(ctx::ContextCatalog::FindById(catalog, id), id),
+                "precomputed stack should match the catalog defaults");
+        }
+        for (const auto& lhs : catalog.actionSetStackById) {
+            for (const auto& rhs : catalog.actionSetStackById) {
+                Require((lhs == rhs) == (*lhs == *rhs), "contexts with equal stacks should share one instance");
+            }
+        }
+
+        ctx::CompiledContextCatalog handBuilt{};
+        const auto fallback = actions::ActionSetResolver::ResolveShared(handBuilt, ctx::UiContextId::Journal);
+        Require(fallback && fallback->layerIds == std::vector<std::string>{ "UnknownTrackedMenuLayer" },
+            "catalogs without a stack table should fall back to the unknown-menu stack");
+        Require(
+            fallback == actions::ActionSetResolver::ResolveShared(handBuilt, ctx::UiContextId::Journal),
+            "an empty catalog's fallback stack should be built once, not per resolve");
+
+        menu::MenuInstanceRegistry registry;
+        ctx::ContextResolver resolver;
+        const menu::ReconciledMenuStack gameplayStack{};
+        const auto gameplay = resolver.ResolveAndPublish(gameplayStack, ctx::GameplaySubstate::None, catalog);
+        const auto journalStack = registry.ReconcileAndPublish(
+            menu::ObservedMenuSnapshot{
+                .completeness = menu::ObserverCompleteness::Complete,
+                .nodes = { Node(0x7000, "JournalMenu", 8) }
+            },
+            catalog);
+        const auto journal = resolver.ResolveAndPublish(journalStack, ctx::GameplaySubstate::None, catalog);
+        Require(journal.contextRevision == gameplay.contextRevision + 1, "menu transition should publish one revision");
+        Require(
+            journal.actionSetStack.Shared() == catalog.actionSetStackById[static_cast<std::size_t>(ctx::UiContextId::Journal)],
+            "menu transition should share the catalog's stack instead of copying it");
+        Require(
+            journal.actionSetStack == *catalog.actionSetStackById[static_cast<std::size_t>(ctx::UiContextId::Journal)],
+            "menu transition should publish the precomputed Journal stack");
+        const auto steady = resolver.ResolveAndPublish(journalStack, ctx::GameplaySubstate::None, catalog);
+        Require(steady.contextRevision == journal.contextRevision, "unchanged context must not republish");
+
+        const auto reloaded = ctx::ContextCatalog::Compile(dualpad::input_v2::config::LegacyMenuPolicyAst{}, catalog.manifestEpoch + 1);
+        Require(reloaded.ok, "reload catalog should compile");
+        const auto afterReload = resolver.ResolveAndPublish(journalStack, ctx::GameplaySubstate::None, reloaded.catalog);
+        Require(afterReload.contextRevision == journal.contextRevision, "equal stacks from a new epoch must not republish");
+    }
+
     {
         auto& tick = ctx::ContextRefreshTick::GetSingleton();
         tick.ResetForTests();
@@ -267,10 +384,243 @@ void RunContextResolverTests()
     }
 }
 
+// One writer republishes snapshots whose fields are all derived from the
+// revision while readers hammer both read paths; any torn read breaks the
+// derivation.
+namespace
+{
+    struct MenuReplayStep
+    {
+        std::vector<dualpad::input_v2::menu::ObservedMenuNode> nodes;
+        bool menuEvent{ false };
+        std::optional<bool> combat;
+        std::uint32_t idleFrames{ 1 };
+    };
+
+    struct MenuReplayScenario
+    {
+        std::string_view name;
+        std::vector<MenuReplayStep> steps;
+    };
+
+    // Menu round trips from the phase0 replay set, replayed as observer
+    // events. Every frame the dirty-tracked tick must publish the same
+    // context as a resolver that re-resolves unconditionally.
+    std::vector<MenuReplayScenario> MenuRoundTripScenarios()
+    {
+        const auto inventory = Node(0xA000, "InventoryMenu", 5, 0xA1, 0xA2);
+        const auto item = Node(0xA100, "ItemMenu", 6, 0xA3, 0xA4);
+        const auto messageBox = Node(0xA200, "MessageBoxMenu", 7, 0xA5, 0xA6);
+        const auto journal = Node(0xB000, "JournalMenu", 5, 0xB1, 0xB2);
+        const auto map = Node(0xC000, "MapMenu", 4, 0xC1, 0xC2);
+
+        return {
+            MenuReplayScenario{
+                .name = "02_gameplay_menu_roundtrip",
+                .steps = {
+                    { .nodes = {}, .idleFrames = 5 },
+                    { .nodes = { inventory }, .menuEvent = true, .idleFrames = 8 },
+                    { .nodes = {}, .menuEvent = true, .idleFrames = 8 },
+                    { .nodes = { inventory }, .menuEvent = true, .idleFrames = 3 },
+                    { .nodes = {}, .menuEvent = true, .idleFrames = 3 }
+                }
+            },
+            MenuReplayScenario{
+                .name = "04_journal_confirm_cancel",
+                .steps = {
+                    { .nodes = { journal }, .menuEvent = true, .idleFrames = 4 },
+                    { .nodes = { journal, messageBox }, .menuEvent = true, .idleFrames = 4 },
+                    { .nodes = { journal }, .menuEvent = true, .idleFrames = 4 },
+                    { .nodes = {}, .menuEvent = true, .idleFrames = 4 }
+                }
+            },
+            MenuReplayScenario{
+                .name = "05_map_cursor_zoom_open_journal",
+                .steps = {
+                    { .nodes = { map }, .menuEvent = true, .idleFrames = 6 },
+                    { .nodes = { journal }, .menuEvent = true, .idleFrames = 6 },
+                    { .nodes = { map }, .menuEvent = true, .idleFrames = 6 },
+                    { .nodes = {}, .menuEvent = true, .idleFrames = 2 }
+                }
+            },
+            MenuReplayScenario{
+                .name = "inventory_item_messagebox_combat",
+                .steps = {
+                    { .nodes = {}, .combat = true, .idleFrames = 3 },
+                    { .nodes = { inventory }, .menuEvent = true, .idleFrames = 2 },
+                    { .nodes = { inventory, item }, .menuEvent = true, .idleFrames = 2 },
+                    { .nodes = { inventory, item, messageBox }, .menuEvent = true, .idleFrames = 70 },
+                    { .nodes = { inventory, item }, .menuEvent = true, .combat = false, .idleFrames = 2 },
+                    { .nodes = {}, .menuEvent = true, .idleFrames = 2 }
+                }
+            }
+        };
+    }
+}
+
+void RunDirtyRefreshReplayTests()
+{
+    namespace ctx = dualpad::input_v2::context;
+    namespace menu = dualpad::input_v2::menu;
+
+    const auto& catalog = ctx::ContextCatalog::BuiltInCatalog();
+    auto& tick = ctx::ContextRefreshTick::GetSingleton();
+    auto& observer = menu::UiMenuObserver::GetSingleton();
+
+    for (const auto& scenario : MenuRoundTripScenarios()) {
+        tick.ResetForTests();
+        menu::MenuInstanceRegistry referenceRegistry;
+        ctx::ContextResolver referenceResolver;
+        bool combat = false;
+        std::uint64_t frames = 0;
+
+        for (const auto& step : scenario.steps) {
+            const menu::ObservedMenuSnapshot current{
+                .completeness = menu::ObserverCompleteness::Complete,
+                .nodes = step.nodes
+            };
+            if (step.menuEvent) {
+                observer.MarkMenuEvent(step.nodes.empty() ? "" : step.nodes.back().menuName, true);
+            }
+            if (step.combat) {
+                combat = *step.combat;
+                tick.MarkCombatEvent(combat);
+            }
+
+            for (std::uint32_t i = 0; i < step.idleFrames; ++i) {
+                ++frames;
+                tick.RefreshIfDirtyForTests(tick.BeginFrame(), current, catalog);
+
+                const auto referenceStack = referenceRegistry.ReconcileAndPublish(current, catalog);
+                const auto reference = referenceResolver.ResolveAndPublish(
+                    referenceStack,
+                    combat ? ctx::GameplaySubstate::Combat : ctx::GameplaySubstate::None,
+                    catalog);
+                const auto published = ctx::ContextResolver::GetSingleton().GetPublishedSnapshot();
+                const auto where = std::string(scenario.name) + " frame " + std::to_string(frames);
+                Require(published.uiContextId == reference.uiContextId, where + ": uiContextId diverged");
+                Require(published.hostMode == reference.hostMode, where + ": hostMode diverged");
+                Require(published.contextRevision == reference.contextRevision, where + ": contextRevision diverged");
+                Require(published.menuStackRevision == reference.menuStackRevision, where + ": menuStackRevision diverged");
+                Require(published.topMenuInstanceId == reference.topMenuInstanceId, where + ": top menu diverged");
+                Require(published.actionSetStack == reference.actionSetStack, where + ": action set stack diverged");
+            }
+        }
+
+        const auto stats = tick.GetStats();
+        Require(stats.executedRefreshes + stats.skippedRefreshes == frames, "every frame should either refresh or skip");
+        Require(stats.skippedRefreshes > stats.executedRefreshes, "idle frames should skip the refresh");
+    }
+
+    {
+        tick.ResetForTests();
+        const menu::ObservedMenuSnapshot idle{};
+        Require(tick.RefreshIfDirtyForTests(tick.BeginFrame(), idle, catalog), "first frame should always refresh");
+        for (std::uint32_t i = 1; i < ctx::ContextRefreshTick::kSafetyRefreshIntervalFrames; ++i) {
+            Require(!tick.RefreshIfDirtyForTests(tick.BeginFrame(), idle, catalog), "clean frames should skip");
+        }
+        Require(tick.RefreshIfDirtyForTests(tick.BeginFrame(), idle, catalog), "safety interval should force a refresh");
+        Require(tick.GetStats().safetyRefreshes == 1, "safety refresh should be counted");
+
+        tick.MarkCombatEvent(false);
+        Require(!tick.RefreshIfDirtyForTests(tick.BeginFrame(), idle, catalog), "unchanged combat fact should not dirty the context");
+
+        const auto reloaded = ctx::ContextCatalog::Compile(dualpad::input_v2::config::LegacyMenuPolicyAst{}, 7);
+        Require(reloaded.ok, "reload catalog should compile");
+        Require(tick.RefreshIfDirtyForTests(tick.BeginFrame(), idle, reloaded.catalog), "new catalog epoch should refresh");
+        tick.ResetForTests();
+    }
+}
+
+void RunPublishedSnapshotStressTests()
+{
+    namespace ctx = dualpad::input_v2::context;
+    using dualpad::input::InputContext;
+
+    constexpr std::uint32_t kPublications = 20'000;
+    constexpr std::size_t kReaders = 3;
+
+    const auto snapshotFor = [](std::uint32_t revision) {
+        const auto menu = (revision % 2) != 0;
+        ctx::ResolvedContextSnapshot snapshot{};
+        snapshot.hostMode = menu ? ctx::HostMode::Menu : ctx::HostMode::Gameplay;
+        snapshot.uiContextId = menu ? ctx::UiContextId::Inventory : ctx::UiContextId::None;
+        snapshot.menuStackRevision = (revision * 2) + 1;
+        snapshot.contextRevision = revision;
+        snapshot.legacyInputContext = menu ? InputContext::InventoryMenu : InputContext::Gameplay;
+        snapshot.legacyContextEpoch = revision + 7;
+        snapshot.presentationPolicyId = "Policy" + std::to_string(revision);
+        snapshot.actionSetStack = dualpad::input_v2::actions::ActionSetStack{
+            .baseSetId = "Set" + std::to_string(revision),
+            .layerIds = { "Layer" + std::to_string(revision) }
+        };
+        return snapshot;
+    };
+
+    ctx::ContextResolver resolver;
+    resolver.PublishSnapshotForReplayTests(snapshotFor(0));
+
+    std::atomic<bool> writerDone{ false };
+    std::atomic<bool> tornRead{ false };
+    std::atomic<std::size_t> totalReads{ 0 };
+    std::vector<std::thread> readers;
+    for (std::size_t index = 0; index < kReaders; ++index) {
+        readers.emplace_back([&] {
+            std::uint32_t lastFieldsRevision = 0;
+            std::uint32_t lastSnapshotRevision = 0;
+            std::size_t reads = 0;
+            while (!writerDone.load(std::memory_order_acquire)) {
+                const auto fields = resolver.ReadPublishedFields();
+                const auto menu = (fields.contextRevision % 2) != 0;
+                if (fields.menuStackRevision != (fields.contextRevision * 2) + 1 ||
+                    fields.legacyContextEpoch != fields.contextRevision + 7 ||
+                    (fields.hostMode == ctx::HostMode::Menu) != menu ||
+                    (fields.uiContextId == ctx::UiContextId::Inventory) != menu ||
+                    (fields.legacyInputContext == InputContext::InventoryMenu) != menu ||
+                    fields.contextRevision < lastFieldsRevision) {
+                    tornRead.store(true);
+                }
+                lastFieldsRevision = fields.contextRevision;
+
+                const auto snapshot = resolver.PinPublishedSnapshot();
+                const auto revision = snapshot->contextRevision;
+                if (snapshot->presentationPolicyId != "Policy" + std::to_string(revision) ||
+                    snapshot->actionSetStack->baseSetId != "Set" + std::to_string(revision) ||
+                    snapshot->actionSetStack->layerIds.size() != 1 ||
+                    snapshot->actionSetStack->layerIds.front() != "Layer" + std::to_string(revision) ||
+                    snapshot->menuStackRevision != (revision * 2) + 1 ||
+                    revision < lastSnapshotRevision) {
+                    tornRead.store(true);
+                }
+                lastSnapshotRevision = revision;
+                ++reads;
+            }
+            totalReads.fetch_add(reads);
+        });
+    }
+
+    for (std::uint32_t revision = 1; revision <= kPublications; ++revision) {
+        resolver.PublishSnapshotForReplayTests(snapshotFor(revision));
+    }
+    writerDone.store(true, std::memory_order_release);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    Require(!tornRead.load(), "concurrent readers must never observe a torn or regressing context snapshot");
+    Require(totalReads.load() > 0, "stress readers must overlap the writer");
+    Require(
+        resolver.ReadPublishedFields().contextRevision == kPublications &&
+            resolver.GetPublishedSnapshot() == snapshotFor(kPublications),
+        "both read paths must converge on the last publication");
+}
+
 int main()
 {
     try {
         RunContextResolverTests();
+        RunDirtyRefreshReplayTests();
+        RunPublishedSnapshotStressTests();
         return 0;
     } catch (const std::exception& e) {
         std::cerr << e.what() << '\n';
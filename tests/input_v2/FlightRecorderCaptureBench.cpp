@@ -0,0 +1,138 @@
+#include "pch.h"
+
+#include "input_v2/telemetry/FlightRecorder.h"
+#include "input_v2/telemetry/TraceRecordFormat.h"
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <iostream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace
+{
+    namespace input = dualpad::input;
+    namespace telemetry = dualpad::input_v2::telemetry;
+
+    constexpr std::uint64_t kFrameCount = 1u << 21;
+    // A stick sweep plus a button edge: more than an idle frame carries.
+    constexpr std::uint32_t kEventsPerFrame = 3;
+
+    void Require(bool condition, std::string_view message)
+    {
+        if (!condition) {
+            throw std::runtime_error(std::string(message));
+        }
+    }
+
+    input::PadEventSnapshot BuildSnapshot()
+    {
+        input::PadEventSnapshot snapshot{};
+        for (std::uint32_t i = 0; i < kEventsPerFrame; ++i) {
+            (void)snapshot.events.Push(input::PadEvent{
+                .type = input::PadEventType::AxisChange,
+                .code = i,
+                .value = 0.5f
+            });
+        }
+        return snapshot;
+    }
+
+    std::span<const input::PadEvent> Events(const input::PadEventSnapshot& snapshot)
+    {
+        return std::span<const input::PadEvent>(snapshot.events.events.data(), snapshot.events.count);
+    }
+
+    // What one dispatched frame hands the flight recorder: its submit and
+    // events, the drain that processed it and the poll frame it published.
+    void CaptureFrame(input::PadEventSnapshot& snapshot, input::AuthoritativePollFrame& poll, std::uint64_t sequence)
+    {
+        auto& flight = telemetry::FlightRecorder::GetSingleton();
+        snapshot.sequence = sequence;
+        flight.Capture(
+            telemetry::TraceDispatcherSubmit{
+                .frame = telemetry::MakeTraceSnapshotFrame(snapshot),
+                .pendingBefore = 0,
+                .pendingAfter = 1 },
+            Events(snapshot));
+        flight.Capture(telemetry::TraceDispatcherDrain{ .budget = 16, .drained = 1, .pendingBefore = 1 });
+        poll.pollSequence = sequence;
+        flight.Capture(telemetry::TracePollFrame{ .sequence = sequence, .poll = poll });
+    }
+
+    // The same frame as full trace records, which is what an armed
+    // recorder used to encode before copying it into its ring.
+    void EncodeFrame(std::string& buffer, input::PadEventSnapshot& snapshot, input::AuthoritativePollFrame& poll, std::uint64_t sequence)
+    {
+        buffer.clear();
+        snapshot.sequence = sequence;
+        const auto frame = telemetry::MakeTraceSnapshotFrame(snapshot);
+        {
+            telemetry::TraceRecordEncoder record(buffer, telemetry::TraceRecordKind::DispatcherSubmit, sequence * 3);
+            record.Put(telemetry::TraceDispatcherSubmit{ .frame = frame, .pendingBefore = 0, .pendingAfter = 1 });
+            record.PutSpan(Events(snapshot));
+            record.Finish();
+        }
+        {
+            telemetry::TraceRecordEncoder record(buffer, telemetry::TraceRecordKind::DispatcherDrain, sequence * 3 + 1);
+            record.Put(telemetry::TraceDispatcherDrain{ .budget = 16, .drained = 1, .pendingBefore = 1 });
+            record.Finish();
+        }
+        {
+            poll.pollSequence = sequence;
+            telemetry::TraceRecordEncoder record(buffer, telemetry::TraceRecordKind::ProcessedSnapshot, sequence * 3 + 2);
+            record.Put(telemetry::TraceProcessedSnapshot{ .frame = frame, .poll = poll });
+            record.PutSpan(Events(snapshot));
+            record.Finish();
+        }
+    }
+
+    template <class Fn>
+    double MeasureNsPerFrame(Fn&& run)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (std::uint64_t sequence = 0; sequence < kFrameCount; ++sequence) {
+            run(sequence);
+        }
+        const auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        return elapsed / static_cast<double>(kFrameCount);
+    }
+}
+
+int main()
+{
+    try {
+        auto& flight = telemetry::FlightRecorder::GetSingleton();
+        flight.ResetForTests();
+        auto snapshot = BuildSnapshot();
+        input::AuthoritativePollFrame poll{};
+        std::string buffer;
+
+        const auto disarmedNs = MeasureNsPerFrame([&](std::uint64_t sequence) { CaptureFrame(snapshot, poll, sequence); });
+        Require(flight.GetStats().captured == 0, "a disarmed recorder should capture nothing");
+
+        flight.Start({ .outputRoot = std::filesystem::temp_directory_path() / "dualpad-flight-bench", .autoDump = false });
+        // The first pass faults in the ring; the second is steady state.
+        (void)MeasureNsPerFrame([&](std::uint64_t sequence) { CaptureFrame(snapshot, poll, sequence); });
+        const auto armedNs = MeasureNsPerFrame([&](std::uint64_t sequence) { CaptureFrame(snapshot, poll, sequence); });
+        Require(
+            flight.GetStats().captured == kFrameCount * 2 * 4,
+            "an armed recorder should keep one slot per submit, its events, drain and poll frame");
+        flight.ResetForTests();
+
+        const auto encodeNs = MeasureNsPerFrame([&](std::uint64_t sequence) { EncodeFrame(buffer, snapshot, poll, sequence); });
+
+        std::cout << "DualPadFlightRecorderCaptureBench frames=" << kFrameCount
+                  << " eventsPerFrame=" << kEventsPerFrame
+                  << " disarmedNsPerFrame=" << disarmedNs
+                  << " armedNsPerFrame=" << armedNs
+                  << " fullTraceEncodeNsPerFrame=" << encodeNs << '\n';
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << '\n';
+        return 1;
+    }
+}
@@ -1,24 +1,63 @@
 #include "pch.h"
 
+#include "input_v2/gameplay/AnalogGateKernel.h"
 #include "input_v2/gameplay/DualPadRuntime.h"
 #include "input_v2/gameplay/GameplayPresentationPublisher.h"
 #include "input_v2/gameplay/GameplayProjectionFrame.h"
 #include "input_v2/gameplay/PollOutputAdapter.h"
+#include "input_v2/gameplay/PresentationPublicationCoalescer.h"
 #include "input_v2/gameplay/RecoveryPlan.h"
+#include "input_v2/ingress/FrameAssembler.h"
 
 #include <algorithm>
+#include <atomic>
+#include <bit>
+#include <limits>
+#include <cstdlib>
 #include <iostream>
+#include <new>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 #include <vector>
 
+namespace
+{
+    std::atomic<bool> g_countAllocations{ false };
+    std::atomic<std::size_t> g_allocationCount{ 0 };
+}
+
+// Replaced for the whole test binary so steady-state frame work can be checked
+// for heap traffic; counting is only armed inside AllocationCountScope.
+void* operator new(std::size_t size)
+{
+    if (g_countAllocations.load(std::memory_order_relaxed)) {
+        g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (void* block = std::malloc(size == 0 ? 1 : size)) {
+        return block;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* block) noexcept
+{
+    std::free(block);
+}
+
+void operator delete(void* block, std::size_t) noexcept
+{
+    std::free(block);
+}
+
 namespace
 {
     namespace actions = dualpad::input_v2::actions;
     namespace gameplay = dualpad::input_v2::gameplay;
     namespace presentation = dualpad::input_v2::presentation;
+    namespace prompt = dualpad::input_v2::prompt;
     namespace backend = dualpad::input::backend;
+    namespace ingress = dualpad::input_v2::ingress;
 
     void Require(bool condition, std::string_view message);
 
@@ -31,6 +70,7 @@ namespace
         std::size_t sustainedCount{ 0 };
         std::size_t transientCount{ 0 };
         std::size_t helperCount{ 0 };
+        std::size_t batchCount{ 0 };
 
         bool ClearNativeOutput() override
         {
@@ -62,36 +102,43 @@ namespace
             return true;
         }
 
-        bool ApplySustainedDigital(const gameplay::NativeSustainedCommand&) override
+        gameplay::PollOutputBatchResult ApplyFrameCommands(const gameplay::GameplayProjectionFrame& frame) override
         {
-            steps.push_back(gameplay::PollOutputApplyStep::ApplySustainedDigital);
-            ++sustainedCount;
-            return true;
-        }
+            ++batchCount;
+            gameplay::PollOutputBatchResult result{};
+            for (std::size_t index = 0; index < frame.gamepadPlan.sustainedDigital.count; ++index) {
+                steps.push_back(gameplay::PollOutputApplyStep::ApplySustainedDigital);
+                ++sustainedCount;
+                ++result.appliedSteps;
+            }
 
-        bool ApplyTransientDigital(const gameplay::NativeTransientCommand&) override
-        {
             const auto gateBeforeTransient = std::find(
                 steps.begin(),
                 steps.end(),
                 gameplay::PollOutputApplyStep::ApplyGatePlan) != steps.end();
-            Require(gateBeforeTransient, "transient digital must be applied after GatePlan");
-            steps.push_back(gameplay::PollOutputApplyStep::ApplyTransientDigital);
-            ++transientCount;
-            return true;
-        }
-
-        bool ApplyHelperCommand(const gameplay::HelperOutputCommand&) override
-        {
-            steps.push_back(gameplay::PollOutputApplyStep::ApplyHelperCommand);
-            ++helperCount;
-            return !failOnHelperCommand;
-        }
+            for (std::size_t index = 0; index < frame.gamepadPlan.transientDigital.count; ++index) {
+                Require(gateBeforeTransient, "transient digital must be applied after GatePlan");
+                steps.push_back(gameplay::PollOutputApplyStep::ApplyTransientDigital);
+                ++transientCount;
+                ++result.appliedSteps;
+            }
+
+            for (std::size_t index = 0; index < frame.helperPlan.commands.count; ++index) {
+                steps.push_back(gameplay::PollOutputApplyStep::ApplyHelperCommand);
+                ++helperCount;
+                if (failOnHelperCommand) {
+                    return result;
+                }
+                ++result.appliedSteps;
+            }
 
-        bool PublishAnalogState(const gameplay::ProjectedAnalogState&) override
-        {
             steps.push_back(gameplay::PollOutputApplyStep::PublishAnalogState);
-            return !failOnAnalogPublish;
+            if (failOnAnalogPublish) {
+                return result;
+            }
+            ++result.appliedSteps;
+            result.succeeded = true;
+            return result;
         }
 
         bool CommitCleanRecoveryBaseline() override
@@ -362,6 +409,57 @@ namespace
             "hard reset clean baseline must publish RecoveryRepublish reason");
     }
 
+    void RunPresentationPublicationCoalescerTests()
+    {
+        gameplay::PresentationPublicationCoalescer coalescer;
+        const prompt::PromptRuntimeBaseline baseline{ .manifestEpoch = 3, .configGeneration = 1 };
+
+        presentation::PublishedPresentationState state{};
+        state.epoch = 1;
+        state.dirty = presentation::PresentationDirtyFlags::Family;
+        coalescer.Stage(state, &baseline);
+        auto publication = coalescer.Flush();
+        Require(publication.surface && publication.prompt, "first stage must publish both sinks");
+
+        state.dirty = presentation::PresentationDirtyFlags::None;
+        coalescer.Stage(state, &baseline);
+        publication = coalescer.Flush();
+        Require(!publication.surface && !publication.prompt, "unchanged epoch and baseline must skip both sinks");
+        Require(!coalescer.Flush().surface, "flush without a stage must publish nothing");
+
+        state.epoch = 2;
+        state.dirty = presentation::PresentationDirtyFlags::Owner;
+        coalescer.Stage(state, &baseline);
+        state.epoch = 3;
+        state.dirty = presentation::PresentationDirtyFlags::Cursor;
+        coalescer.Stage(state, &baseline);
+        state.dirty = presentation::PresentationDirtyFlags::None;
+        coalescer.Stage(state, &baseline);
+        publication = coalescer.Flush();
+        Require(publication.surface && publication.surface->epoch == 3, "coalesced frames must publish the latest state once");
+        Require(
+            presentation::HasDirtyFlag(publication.surface->dirty, presentation::PresentationDirtyFlags::Owner) &&
+                presentation::HasDirtyFlag(publication.surface->dirty, presentation::PresentationDirtyFlags::Cursor),
+            "coalesced publication must carry every dirty flag of the batch");
+
+        state.epoch = 4;
+        coalescer.Stage(state, nullptr);
+        publication = coalescer.Flush();
+        Require(publication.surface && !publication.prompt, "degraded frames must update the surface but not the prompt scope");
+
+        auto reloaded = baseline;
+        reloaded.configGeneration = 2;
+        coalescer.Stage(state, &reloaded);
+        publication = coalescer.Flush();
+        Require(!publication.surface && publication.prompt, "baseline change alone must republish only the prompt scope");
+        Require(publication.prompt->state.epoch == 4, "prompt must catch up to the degraded frame's state");
+
+        const auto stats = coalescer.GetStats();
+        Require(stats.stagedFrames == 7 && stats.coalescedFrames == 2, "coalescer must count staged and coalesced frames");
+        Require(stats.surfacePublished == 3 && stats.surfaceSkipped == 2, "coalescer must count surface publishes and skips");
+        Require(stats.promptPublished == 3 && stats.promptSkipped == 1, "coalescer must count prompt publishes and skips");
+    }
+
     gameplay::GameplayProjectionFrame OutputFrameWithNativeHelperAndRecovery()
     {
         gameplay::GameplayProjectionFrame frame{};
@@ -430,7 +528,19 @@ namespace
             gameplay::PollOutputApplyStep::CommitCleanRecoveryBaseline
         };
         Require(executor.steps == expected, "PollOutputAdapter must apply recovery, gate, native, helper, analog, clean baseline in fixed order");
-        Require(result.steps == expected, "PollOutputAdapter result must expose the same fixed order for runtime diagnostics");
+        Require(std::ranges::equal(result.steps, expected), "PollOutputAdapter result must expose the same fixed order for runtime diagnostics");
+        Require(executor.batchCount == 1, "PollOutputAdapter must hand every command list to the executor in one batch");
+
+        RecordingPollOutputExecutor failingExecutor;
+        failingExecutor.failOnHelperCommand = true;
+        const auto failed = adapter.Apply(OutputFrameWithNativeHelperAndRecovery(), failingExecutor);
+        Require(!failed.outputApplySucceeded, "a failed batch command must fail the apply");
+        Require(
+            std::ranges::equal(failed.steps, failingExecutor.steps),
+            "a failed batch must record every step the executor ran, ending at the failing one");
+        Require(
+            failed.steps.back() == gameplay::PollOutputApplyStep::ApplyHelperCommand,
+            "a failed helper command must stop before the analog publish");
     }
 
     void RunDualPadRuntimePublisherSeamTests()
@@ -467,6 +577,245 @@ namespace
             "runtime owner must not publish gameplay presentation when outputApplySucceeded=false");
     }
 
+    class AllocationCountScope
+    {
+    public:
+        AllocationCountScope()
+        {
+            g_allocationCount.store(0, std::memory_order_relaxed);
+            g_countAllocations.store(true, std::memory_order_relaxed);
+        }
+
+        ~AllocationCountScope()
+        {
+            g_countAllocations.store(false, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] std::size_t Count() const
+        {
+            return g_allocationCount.load(std::memory_order_relaxed);
+        }
+    };
+
+    // The per-channel if/else-if chain ResolvePrimaryPathArbitration used
+    // before the mask kernel: 0 = keyboard/mouse won, 1 = gamepad won,
+    // 2 = carried previous owner.
+    int LegacyChannelDecision(bool keyboardMouseActive, bool gamepadActive, bool gamepadSustained)
+    {
+        if (keyboardMouseActive) {
+            return 0;
+        }
+        if (gamepadActive || gamepadSustained) {
+            return 1;
+        }
+        return 2;
+    }
+
+    void RunAnalogGateKernelTests()
+    {
+        // Exhaustive over every channel combination in gameplay context.
+        for (std::uint32_t bits = 0; bits < (1u << 12); ++bits) {
+            const gameplay::AnalogOwnershipInput input{
+                .gamepadActiveMask = static_cast<std::uint8_t>(bits & 7u),
+                .gamepadSustainedMask = static_cast<std::uint8_t>((bits >> 3) & 7u),
+                .previousGamepadMask = static_cast<std::uint8_t>((bits >> 6) & 7u),
+                .keyboardMouseActiveMask = static_cast<std::uint8_t>((bits >> 9) & 7u),
+                .gameplayContext = true
+            };
+            const auto result = gameplay::ResolveAnalogOwnership(input);
+            for (std::uint32_t channel = 0; channel < 3; ++channel) {
+                const auto bit = static_cast<std::uint8_t>(1u << channel);
+                const auto legacy = LegacyChannelDecision(
+                    (input.keyboardMouseActiveMask & bit) != 0,
+                    (input.gamepadActiveMask & bit) != 0,
+                    (input.gamepadSustainedMask & bit) != 0);
+                const bool legacyGamepadOwner = legacy == 1 || (legacy == 2 && (input.previousGamepadMask & bit) != 0);
+                Require(((result.gamepadOwnerMask & bit) != 0) == legacyGamepadOwner, "analog kernel owner must match the legacy branch chain");
+                Require(((result.keyboardMouseWonMask & bit) != 0) == (legacy == 0), "analog kernel keyboard/mouse reason must match the legacy branch chain");
+                Require(((result.gamepadWonMask & bit) != 0) == (legacy == 1), "analog kernel gamepad reason must match the legacy branch chain");
+            }
+
+            auto menu = input;
+            menu.gameplayContext = false;
+            const auto menuResult = gameplay::ResolveAnalogOwnership(menu);
+            Require(menuResult.gamepadOwnerMask == 0 && menuResult.gamepadWonMask == 0, "non-gameplay context must give every analog channel to keyboard/mouse");
+        }
+
+        const auto thresholds = gameplay::EvaluateAnalogThresholds(
+            gameplay::PackedChannelMagnitudes{ { 0.2f, 0.3f, std::numeric_limits<float>::quiet_NaN(), 0.0f } },
+            gameplay::AnalogThresholds{
+                .enter = { { 0.25f, 0.25f, 0.15f, 0.0f } },
+                .sustain = { { 0.15f, 0.15f, 0.08f, 0.0f } }
+            },
+            gameplay::AnalogChannelLook);
+        Require(thresholds.activeMask == gameplay::AnalogChannelMove, "enter mask must compare each channel against its own threshold and ignore padding");
+        Require(thresholds.sustainedMask == gameplay::AnalogChannelLook, "sustain mask must only keep channels the gamepad already owned");
+
+        // Gating keeps open lanes bit-exact (including -0 and NaN payloads)
+        // and writes +0.0f to closed and padding lanes, as the scalar
+        // assignments did.
+        const gameplay::PackedAnalogLanes lanes{ {
+            -0.0f,
+            std::numeric_limits<float>::quiet_NaN(),
+            0.5f,
+            -0.5f,
+            0.25f,
+            1.0f,
+            7.0f,
+            -7.0f } };
+        for (std::uint8_t open = 0; open < 8; ++open) {
+            const auto gated = gameplay::GateAnalogLanes(lanes, open);
+            for (std::size_t lane = 0; lane < gameplay::kAnalogLaneCount; ++lane) {
+                const bool laneOpen = lane < 6 && (open & (1u << (lane / 2))) != 0;
+                const auto expected = laneOpen ? std::bit_cast<std::uint32_t>(lanes.values[lane]) : 0u;
+                Require(std::bit_cast<std::uint32_t>(gated.values[lane]) == expected, "analog gate must keep open lanes bit-exact and zero the rest");
+            }
+        }
+    }
+
+    void RunAnalogPassthroughChannelTests()
+    {
+        using dualpad::input::PadAxisId;
+        const auto axisBinding = [](std::string actionId, PadAxisId axis) {
+            return actions::CompiledGraphBinding{
+                .actionId = std::move(actionId),
+                .paths = {
+                    actions::ControlPath{
+                        .kind = actions::ControlPathKind::AnalogAxis1D,
+                        .code = static_cast<std::uint32_t>(axis)
+                    }
+                },
+                .interaction = actions::InteractionSpec{ .kind = actions::InteractionKind::Value }
+            };
+        };
+        const auto resolve = [](const std::vector<actions::CompiledGraphBinding>& bindings) {
+            std::vector<const actions::CompiledGraphBinding*> active;
+            for (const auto& binding : bindings) {
+                active.push_back(&binding);
+            }
+            return gameplay::ResolveAnalogPassthroughChannels(active);
+        };
+
+        const std::vector<actions::CompiledGraphBinding> defaults{
+            axisBinding("Game.Move", PadAxisId::LeftStickX),
+            axisBinding("Game.Move", PadAxisId::LeftStickY),
+            axisBinding("Game.Look", PadAxisId::RightStickX),
+            axisBinding("Game.Look", PadAxisId::RightStickY)
+        };
+        Require(
+            resolve(defaults) == (gameplay::AnalogPassthroughMove | gameplay::AnalogPassthroughLook),
+            "default stick bindings should pass both sticks through regardless of their current value");
+
+        auto swapped = defaults;
+        swapped[2] = axisBinding("Game.Look", PadAxisId::LeftStickX);
+        swapped[3] = axisBinding("Game.Look", PadAxisId::LeftStickY);
+        Require(
+            resolve(swapped) == gameplay::AnalogPassthroughMove,
+            "look driven by the left stick must not latch the right stick");
+
+        auto scaled = defaults;
+        scaled[0].modifiers.push_back(actions::BindingModifier{ .kind = actions::BindingModifierKind::Scale, .primary = 0.5f });
+        Require(
+            resolve(scaled) == gameplay::AnalogPassthroughLook,
+            "a modifier on either move binding must keep move on the drained value");
+
+        const std::vector<actions::CompiledGraphBinding> halfStick{ axisBinding("Game.Move", PadAxisId::LeftStickX) };
+        Require(resolve(halfStick) == gameplay::AnalogPassthroughNone, "a stick with an unbound component must not latch");
+        Require(resolve({}) == gameplay::AnalogPassthroughNone, "unbound channels must not latch");
+    }
+
+    void RunSteadyStateFrameAllocationTests()
+    {
+        constexpr std::string_view kLongAxisActionId = "Game.SteadyStateAllocationProbe.LeftTriggerPressure";
+        actions::CompiledActionManifest manifest{};
+        manifest.manifestEpoch = 42;
+        manifest.actions = {
+            actions::ActionDefinition{ .id = "Game.Move", .valueKind = actions::ActionValueKind::Axis2D },
+            actions::ActionDefinition{ .id = "Game.Look", .valueKind = actions::ActionValueKind::Axis2D },
+            // Longer than any small-string buffer, so a per-frame copy of the
+            // id would show up as an allocation.
+            actions::ActionDefinition{ .id = std::string(kLongAxisActionId), .valueKind = actions::ActionValueKind::Axis1D }
+        };
+        const auto bindAxis = [&](std::string_view actionId, dualpad::input::PadAxisId axis) {
+            manifest.bindings.push_back(actions::CompiledBinding{
+                .actionId = std::string(actionId),
+                .baseSetId = "GameplayBase",
+                .legacyTrigger = dualpad::input::Trigger{
+                    .type = dualpad::input::TriggerType::Axis,
+                    .code = static_cast<std::uint32_t>(axis) }
+            });
+        };
+        bindAxis("Game.Move", dualpad::input::PadAxisId::LeftStickX);
+        bindAxis("Game.Move", dualpad::input::PadAxisId::LeftStickY);
+        bindAxis("Game.Look", dualpad::input::PadAxisId::RightStickX);
+        bindAxis("Game.Look", dualpad::input::PadAxisId::RightStickY);
+        bindAxis(kLongAxisActionId, dualpad::input::PadAxisId::LeftTrigger);
+        const auto compiled = actions::ActionGraphCompiler::Compile(manifest);
+        Require(compiled.ok, compiled.message);
+        const auto& graph = compiled.graph;
+
+        ingress::AssembledFactFrame stable{};
+        stable.kind = ingress::AssembledFrameKind::Stable;
+        stable.boundaryKey.manifestEpoch = 42;
+        stable.boundaryKey.contextRevision = 7;
+        for (const auto& binding : graph.bindings) {
+            stable.facts.controlSamples.push_back(actions::ControlSample{
+                .path = binding.paths[binding.interaction.primaryPathIndex],
+                .down = true
+            });
+        }
+
+        actions::ActionSetStack stack{};
+        stack.baseSetId = "GameplayBase";
+        actions::InteractionEngine engine;
+        actions::InteractionStateStore state;
+        actions::KernelFrame kernel{};
+        actions::ResolvedActionFrame resolved{};
+        gameplay::GameplayProjectionFrame projection{};
+        const gameplay::GameplayPolicy policy{};
+        const gameplay::GameplayRecoveryInput recovery{ .cleanFrame = true };
+
+        const auto runFrame = [&](std::uint64_t tick) {
+            stable.lastSeq = tick;
+            stable.facts.monotonicUs = 10'000 + (tick * 1'000);
+            for (auto& sample : stable.facts.controlSamples) {
+                sample.scalar = (tick % 2 == 0) ? 0.6f : -0.4f;
+                sample.timestampUs = stable.facts.monotonicUs;
+            }
+            ingress::BuildKernelFrame(stable, kernel);
+            engine.ResolveInto(graph, stack, kernel, state, resolved);
+            projection = gameplay::ResolveGameplayProjection(kernel, resolved, policy, projection, recovery);
+        };
+
+        for (std::uint64_t tick = 0; tick < 4; ++tick) {
+            runFrame(tick);
+        }
+
+        std::size_t allocations = 0;
+        {
+            AllocationCountScope scope;
+            for (std::uint64_t tick = 4; tick < 132; ++tick) {
+                runFrame(tick);
+            }
+            allocations = scope.Count();
+        }
+
+        Require(resolved.values.size() == 3, "steady-state frame must resolve both sticks and the trigger");
+        Require(resolved.changes.size() == 3, "steady-state frame must emit one Value change per analog action");
+        Require(
+            std::ranges::any_of(resolved.changes, [&](const actions::ActionPhaseChange& change) {
+                return change.actionId == kLongAxisActionId;
+            }),
+            "steady-state frame must carry the long action id");
+        Require(
+            projection.gamepadPlan.analog.moveX != 0.0f && projection.gamepadPlan.analog.lookY != 0.0f,
+            "steady-state projection must carry stick values");
+        Require(
+            allocations == 0,
+            "steady-state kernel build, interaction resolve and gameplay projection must not allocate, saw " +
+                std::to_string(allocations));
+    }
+
     void RunCoordinatorAuthorityCutoverTests()
     {
         Require(
@@ -482,10 +831,14 @@ int main()
         RunRecoveryPlanTests();
         RunProjectionClassificationAndGateTests();
         RunPrimaryPathArbitrationContractTests();
+        RunAnalogGateKernelTests();
+        RunAnalogPassthroughChannelTests();
         RunOverflowFailClosedTests();
         RunPresentationPublisherTests();
+        RunPresentationPublicationCoalescerTests();
         RunPollOutputAdapterExecutionTests();
         RunDualPadRuntimePublisherSeamTests();
+        RunSteadyStateFrameAllocationTests();
         RunCoordinatorAuthorityCutoverTests();
         return 0;
     } catch (const std::exception& e) {
@@ -0,0 +1,136 @@
+#include "input_v2/prompt/GlyphAtlasFormat.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    namespace fs = std::filesystem;
+    namespace prompt = dualpad::input_v2::prompt;
+
+    constexpr std::size_t kDdsHeaderBytes = 128;
+
+    void Require(bool condition, std::string_view message)
+    {
+        if (!condition) {
+            throw std::runtime_error(std::string(message));
+        }
+    }
+
+    std::vector<std::byte> ReadBytes(const fs::path& path)
+    {
+        std::ifstream input(path, std::ios::binary);
+        if (!input) {
+            throw std::runtime_error("cannot read " + path.generic_string());
+        }
+        const std::vector<char> chars((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+        std::vector<std::byte> bytes(chars.size());
+        std::memcpy(bytes.data(), chars.data(), chars.size());
+        return bytes;
+    }
+
+    // The lookup paths PromptService would hand the atlas for every source
+    // glyph: <root><platform>/<glyph>.svg.
+    std::vector<std::string> SourceLookupPaths(const fs::path& glyphRoot)
+    {
+        std::vector<std::string> paths;
+        for (const auto& platform : fs::directory_iterator(glyphRoot)) {
+            if (!platform.is_directory()) {
+                continue;
+            }
+            for (const auto& file : fs::directory_iterator(platform.path())) {
+                if (file.is_regular_file() && file.path().extension() == prompt::kGlyphAssetExtension) {
+                    paths.push_back(
+                        std::string(prompt::kGlyphAssetRoot) + platform.path().filename().string() + '/' +
+                        file.path().filename().string());
+                }
+            }
+        }
+        return paths;
+    }
+
+    std::uint32_t ReadU32(const std::vector<std::byte>& bytes, std::size_t offset)
+    {
+        std::uint32_t value = 0;
+        std::memcpy(&value, bytes.data() + offset, sizeof(value));
+        return value;
+    }
+
+    bool RectHasInk(const std::vector<std::byte>& dds, std::uint32_t atlasWidth, const prompt::GlyphAtlasRect& rect)
+    {
+        for (std::uint32_t y = rect.y; y < static_cast<std::uint32_t>(rect.y) + rect.height; ++y) {
+            for (std::uint32_t x = rect.x; x < static_cast<std::uint32_t>(rect.x) + rect.width; ++x) {
+                const auto alpha = kDdsHeaderBytes + (static_cast<std::size_t>(y) * atlasWidth + x) * 4 + 3;
+                if (dds[alpha] != std::byte{ 0 }) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+}
+
+// Usage: DualPadGlyphAtlasRoundTripTests <glyph-root> <atlas-dir>
+// Checks that what DualPadGlyphAtlasGen wrote for <glyph-root> into
+// <atlas-dir> parses with GlyphAtlasIndexView, resolves every source glyph
+// and points at rasterized pixels in the atlas image.
+int main(int argc, char** argv)
+{
+    try {
+        if (argc < 3) {
+            std::cerr << "Usage: DualPadGlyphAtlasRoundTripTests <glyph-root> <atlas-dir>\n";
+            return 2;
+        }
+        const fs::path glyphRoot(argv[1]);
+        const fs::path atlasDir(argv[2]);
+
+        const auto sources = SourceLookupPaths(glyphRoot);
+        Require(!sources.empty(), "glyph root must hold at least one <platform>/<glyph>.svg");
+
+        const auto indexBytes = ReadBytes(atlasDir / prompt::kGlyphAtlasIndexName);
+        const auto index = prompt::GlyphAtlasIndexView::Parse(indexBytes);
+        Require(index.has_value(), "generated glyph atlas index must parse");
+        Require(index->Size() == sources.size(), "generated index must hold one entry per source glyph");
+        Require(index->ImageName() == prompt::kGlyphAtlasImageName, "generated index must name the atlas image");
+
+        const auto width = index->AtlasWidth();
+        const auto height = index->AtlasHeight();
+        const auto dds = ReadBytes(atlasDir / prompt::kGlyphAtlasImageName);
+        Require(
+            dds.size() == kDdsHeaderBytes + static_cast<std::size_t>(width) * height * 4,
+            "atlas image must be a DDS header plus the index's width x height BGRA pixels");
+        Require(std::memcmp(dds.data(), "DDS ", 4) == 0, "atlas image must carry the DDS magic");
+        Require(ReadU32(dds, 12) == height && ReadU32(dds, 16) == width, "atlas image and index must agree on size");
+
+        for (const auto& path : sources) {
+            const auto rect = index->FindByAssetLookupPath(path);
+            Require(rect.has_value(), "generated index must resolve " + path);
+            Require(
+                rect->width > 0 && rect->height > 0 &&
+                    static_cast<std::uint32_t>(rect->x) + rect->width <= width &&
+                    static_cast<std::uint32_t>(rect->y) + rect->height <= height,
+                path + " must sit inside the atlas");
+            Require(
+                rect->u0 == static_cast<float>(rect->x) / static_cast<float>(width) &&
+                    rect->v1 == static_cast<float>(rect->y + rect->height) / static_cast<float>(height),
+                path + " UVs must be normalized to the atlas size");
+            Require(RectHasInk(dds, width, *rect), path + " must be rasterized into its atlas rect");
+        }
+
+        std::cout << "DualPadGlyphAtlasRoundTripTests resolved " << sources.size() << " glyphs in a "
+                  << width << 'x' << height << " atlas\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << '\n';
+        return 1;
+    }
+}
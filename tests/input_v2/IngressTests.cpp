@@ -595,6 +595,33 @@ namespace
         Require(ToGameplayRecoveryInput(*overflow).hardResetRequested, "queue overflow maps to hard recovery input");
     }
 
+    void TestPreservingManifestTransitionSkipsHardReset()
+    {
+        auto reload = Manifest(2);
+        reload.manifest.preservesInteractionState = true;
+
+        ingress::FrameAssembler assembler;
+        const auto frames = assembler.Assemble(AssignSeq({
+            Manifest(1),
+            Ui(1, 1),
+            PadSample(42, true, true, false),
+            reload
+        }));
+
+        const auto& transition = LastFrame(frames);
+        Require(transition.kind == ingress::AssembledFrameKind::Transition, "preserving reload must still emit a transition");
+        Require(transition.transition.reason == ingress::TransitionReason::ManifestEpochChanged, "preserving reload keeps manifest reason");
+        Require(transition.boundaryKey.manifestEpoch == 2, "preserving reload must advance the boundary epoch");
+        Require(transition.transition.preservesInteractionState, "preserving flag must reach the transition frame");
+        Require(!transition.transition.requestHardResync, "preserving reload must not hard reset");
+        Require(!transition.transition.flushPendingPulseEdges, "preserving reload must keep pending pulse edges");
+
+        const auto recovery = ToGameplayRecoveryInput(transition);
+        Require(
+            !recovery.hardResetRequested && !recovery.explicitResetRequested && !recovery.softResyncRequested,
+            "preserving reload must not request gameplay recovery");
+    }
+
     void TestFrameAssemblerDoesNotSortOutOfOrderEvents()
     {
         auto events = AssignSeq({
@@ -786,6 +813,7 @@ int main()
     TestStableMergeKeepsPulseLedger();
     TestBoundaryChangeFlushesStableThenTransition();
     TestRecoveryMarkersMapFailClosed();
+    TestPreservingManifestTransitionSkipsHardReset();
     TestFrameAssemblerDoesNotSortOutOfOrderEvents();
     TestFrameAssemblerRejectsMonotonicTimeRegression();
     TestFrameAssemblerOverflowPayloadBuildsBoundaryBaseline();
@@ -27,6 +27,7 @@
 #include <iostream>
 #include <stdexcept>
 #include <string_view>
+#include <thread>
 
 namespace
 {
@@ -118,28 +119,23 @@ namespace
             return true;
         }
 
-        bool ApplySustainedDigital(const gameplay::NativeSustainedCommand&) override
-        {
-            steps.push_back(gameplay::PollOutputApplyStep::ApplySustainedDigital);
-            return true;
-        }
-
-        bool ApplyTransientDigital(const gameplay::NativeTransientCommand&) override
-        {
-            steps.push_back(gameplay::PollOutputApplyStep::ApplyTransientDigital);
-            return true;
-        }
-
-        bool ApplyHelperCommand(const gameplay::HelperOutputCommand&) override
-        {
-            steps.push_back(gameplay::PollOutputApplyStep::ApplyHelperCommand);
-            return true;
-        }
-
-        bool PublishAnalogState(const gameplay::ProjectedAnalogState&) override
+        gameplay::PollOutputBatchResult ApplyFrameCommands(const gameplay::GameplayProjectionFrame& frame) override
         {
+            gameplay::PollOutputBatchResult result{ .succeeded = true };
+            for (std::size_t index = 0; index < frame.gamepadPlan.sustainedDigital.count; ++index) {
+                steps.push_back(gameplay::PollOutputApplyStep::ApplySustainedDigital);
+            }
+            for (std::size_t index = 0; index < frame.gamepadPlan.transientDigital.count; ++index) {
+                steps.push_back(gameplay::PollOutputApplyStep::ApplyTransientDigital);
+            }
+            for (std::size_t index = 0; index < frame.helperPlan.commands.count; ++index) {
+                steps.push_back(gameplay::PollOutputApplyStep::ApplyHelperCommand);
+            }
             steps.push_back(gameplay::PollOutputApplyStep::PublishAnalogState);
-            return true;
+            result.appliedSteps = frame.gamepadPlan.sustainedDigital.count +
+                frame.gamepadPlan.transientDigital.count +
+                frame.helperPlan.commands.count + 1;
+            return result;
         }
 
         bool CommitCleanRecoveryBaseline() override
@@ -193,10 +189,15 @@ namespace
             return true;
         }
 
-        bool ApplySustainedDigital(const gameplay::NativeSustainedCommand&) override { return true; }
-        bool ApplyTransientDigital(const gameplay::NativeTransientCommand&) override { return true; }
-        bool ApplyHelperCommand(const gameplay::HelperOutputCommand&) override { return true; }
-        bool PublishAnalogState(const gameplay::ProjectedAnalogState&) override { return true; }
+        gameplay::PollOutputBatchResult ApplyFrameCommands(const gameplay::GameplayProjectionFrame& frame) override
+        {
+            return gameplay::PollOutputBatchResult{
+                .succeeded = true,
+                .appliedSteps = frame.gamepadPlan.sustainedDigital.count +
+                    frame.gamepadPlan.transientDigital.count +
+                    frame.helperPlan.commands.count + 1
+            };
+        }
         bool CommitCleanRecoveryBaseline() override { return true; }
     };
 
@@ -720,6 +721,34 @@ namespace
             Require(resolved.values[0].y == -1.0f, "Axis2D Y must clamp to the [-1, 1] domain");
             Require(resolved.values[0].timestampUs == 1'650, "Axis2D coalesced value timestamp must use frame evaluation time");
             Require(resolved.changes[0].timestampUs == 1'650, "Axis2D Value change timestamp must use frame evaluation time");
+
+            const auto& graph = axis2DCompiled.graph;
+            Require(graph.axis2DSlots.size() == 1, "Axis2D pairing table must hold one slot per Axis2D action");
+            Require(
+                graph.Axis2DSlotFor(graph.bindings[0]) == 0 && graph.Axis2DSlotFor(graph.bindings[1]) == 0,
+                "X and Y bindings of one Axis2D action must share a slot");
+
+            auto& scratch = state.Axis2DScratch();
+            const auto* slotStorage = scratch.slots.data();
+            const auto touchedCapacity = scratch.touched.capacity();
+            Require(scratch.touched.empty(), "Axis2D scratch must be flushed at the end of Resolve");
+            for (std::uint64_t step = 1; step <= 8; ++step) {
+                legacy.monotonicUs = 1'650 + (step * 100);
+                legacy.samples = {
+                    AxisSample(static_cast<std::uint32_t>(dualpad::input::PadAxisId::RightStickX), 0.1f * static_cast<float>(step), legacy.monotonicUs),
+                    AxisSample(static_cast<std::uint32_t>(dualpad::input::PadAxisId::RightStickY), -0.1f * static_cast<float>(step), legacy.monotonicUs)
+                };
+                const auto stepResolved = engine.Resolve(
+                    graph,
+                    stack,
+                    actions::LegacyInteractionInputAdapter::BuildKernelFrame(legacy),
+                    state);
+                Require(stepResolved.values.size() == 1, "Axis2D pair must coalesce on every frame");
+                Require(stepResolved.changes[0].bindingId == graph.bindings[0].bindingId, "Axis2D value must report the lowest contributing binding");
+            }
+            Require(
+                scratch.slots.data() == slotStorage && scratch.touched.capacity() == touchedCapacity,
+                "steady-state Axis2D resolution must reuse the pairing scratch storage");
         }
 
         state.Reset();
@@ -897,6 +926,263 @@ namespace
         }
     }
 
+    actions::KernelFrame DigitalFrame(
+        std::uint32_t code,
+        bool down,
+        bool pressed,
+        bool released,
+        std::uint64_t downAtUs,
+        std::uint64_t now)
+    {
+        actions::LegacyInteractionInputFrame legacy{};
+        legacy.manifestEpoch = 42;
+        legacy.contextRevision = 7;
+        legacy.monotonicUs = now;
+        legacy.samples = {
+            Sample(actions::ControlPath{ .kind = actions::ControlPathKind::DigitalButton, .code = code }, down, pressed, released, downAtUs, now)
+        };
+        return actions::LegacyInteractionInputAdapter::BuildKernelFrame(legacy);
+    }
+
+    void RunInteractionTimerWheelTests()
+    {
+        using actions::InteractionDeadlineKind;
+
+        actions::InteractionTimerWheel wheel;
+        std::vector<actions::InteractionDeadline> expired;
+        wheel.Advance(1'000'000, expired);
+        Require(expired.empty(), "empty timer wheel must not expire anything");
+
+        wheel.Schedule(1, InteractionDeadlineKind::Hold, 1'350'500);
+        wheel.Schedule(2, InteractionDeadlineKind::Repeat, 1'010'000);
+        wheel.Schedule(3, InteractionDeadlineKind::TapWindow, 12'000'000);
+        wheel.Schedule(4, InteractionDeadlineKind::Hold, 400'000'000);
+        wheel.Schedule(2, InteractionDeadlineKind::Repeat, 1'020'000);
+        Require(wheel.PendingCount() == 4, "rescheduling an existing deadline must replace it");
+
+        wheel.Advance(1'019'999, expired);
+        Require(expired.empty(), "replaced deadline must not fire at its old time");
+        wheel.Advance(1'020'000, expired);
+        Require(expired.size() == 1 && expired[0].bindingId == 2, "deadline must fire exactly at its microsecond timestamp");
+
+        expired.clear();
+        wheel.Advance(1'350'000, expired);
+        Require(expired.empty(), "sub-tick deadline must not fire before it is due");
+        wheel.Advance(1'350'500, expired);
+        Require(expired.size() == 1 && expired[0].deadlineUs == 1'350'500, "sub-tick deadline must fire once due");
+
+        expired.clear();
+        wheel.Cancel(4, InteractionDeadlineKind::Hold);
+        Require(!wheel.Contains(4, InteractionDeadlineKind::Hold), "cancel must remove the deadline");
+        for (std::uint64_t now = 1'350'500; now < 12'000'000; now += 16'667) {
+            wheel.Advance(now, expired);
+        }
+        Require(expired.empty(), "second-level deadline must not fire early while cascading");
+        wheel.Advance(12'000'000, expired);
+        Require(expired.size() == 1 && expired[0].bindingId == 3, "second-level deadline must cascade and fire on time");
+
+        expired.clear();
+        wheel.Schedule(5, InteractionDeadlineKind::Hold, 12'500'000);
+        wheel.Schedule(6, InteractionDeadlineKind::Hold, 900'000'000);
+        wheel.Advance(600'000'000, expired);
+        Require(expired.size() == 1 && expired[0].bindingId == 5, "long stall must resync and fire only due deadlines");
+        Require(wheel.Contains(6, InteractionDeadlineKind::Hold), "long stall must keep future deadlines");
+        wheel.Reset();
+        Require(wheel.PendingCount() == 0, "reset must clear every deadline");
+    }
+
+    void RunInteractionDeadlineTickTests()
+    {
+        constexpr std::uint64_t kTickUs = 16'667;
+
+        auto manifest = ManifestWithActions();
+        manifest.bindings.push_back(Binding("PowerAttack", Trigger(dualpad::input::TriggerType::Hold, 11)));
+        const auto compiled = actions::ActionGraphCompiler::Compile(manifest);
+        Require(compiled.ok, compiled.message);
+
+        actions::ActionSetStack stack{};
+        stack.baseSetId = "GameplayBase";
+        const auto facts = actions::KernelFacts{ .manifestEpoch = 42, .contextRevision = 7 };
+
+        actions::InteractionEngine engine;
+        actions::InteractionStateStore state;
+
+        {
+            constexpr std::uint64_t pressAt = 2'000'000;
+            constexpr auto holdDue = pressAt + actions::kLegacyHoldThresholdUs;
+            const auto pressed = engine.Resolve(compiled.graph, stack, DigitalFrame(11, true, true, false, pressAt, pressAt), state);
+            Require(pressed.changes.empty(), "hold press must not fire before its threshold");
+            Require(state.Deadlines().Contains(1, actions::InteractionDeadlineKind::Hold), "hold press must schedule a deadline");
+
+            std::size_t holdCount = 0;
+            for (auto now = pressAt; now < pressAt + 1'000'000; now += kTickUs) {
+                auto tickFacts = facts;
+                tickFacts.monotonicUs = now;
+                const auto resolved = engine.ResolveDeadlines(compiled.graph, stack, tickFacts, state);
+                for (const auto& change : resolved.changes) {
+                    Require(change.phase == actions::ActionPhase::Hold, "hold deadline tick must only emit Hold");
+                    Require(change.timestampUs == holdDue, "hold must be stamped with its exact deadline");
+                    Require(change.evaluationUs >= holdDue && change.evaluationUs < holdDue + kTickUs,
+                        "hold must fire within one runtime tick of its configured threshold");
+                    ++holdCount;
+                }
+            }
+            Require(holdCount == 1, "hold deadline must fire exactly once without new frames");
+
+            const auto held = engine.Resolve(compiled.graph, stack, DigitalFrame(11, true, false, false, pressAt, pressAt + 1'000'000), state);
+            Require(held.changes.empty(), "frame after deadline-fired hold must not fire it again");
+
+            const auto released = engine.Resolve(compiled.graph, stack, DigitalFrame(11, false, false, true, pressAt, pressAt + 1'050'000), state);
+            Require(released.changes.size() == 1 && released.changes[0].phase == actions::ActionPhase::Release,
+                "release after deadline-fired hold must emit Release");
+            Require(state.Deadlines().PendingCount() == 0, "release must leave no pending deadlines");
+        }
+
+        state.Reset();
+        {
+            constexpr std::uint64_t pressAt = 5'000'000;
+            (void)engine.Resolve(compiled.graph, stack, DigitalFrame(11, true, true, false, pressAt, pressAt), state);
+            (void)engine.Resolve(compiled.graph, stack, DigitalFrame(11, false, false, true, pressAt, pressAt + 100'000), state);
+            Require(state.Deadlines().PendingCount() == 0, "release before threshold must cancel the hold deadline");
+
+            auto tickFacts = facts;
+            tickFacts.monotonicUs = pressAt + 1'000'000;
+            const auto resolved = engine.ResolveDeadlines(compiled.graph, stack, tickFacts, state);
+            Require(resolved.changes.empty(), "cancelled hold must not fire on a later tick");
+        }
+
+        state.Reset();
+        {
+            actions::CompiledActionGraph graph{};
+            graph.manifestEpoch = 42;
+            graph.actions = {
+                actions::ActionDefinition{ .id = "Jump", .valueKind = actions::ActionValueKind::Digital }
+            };
+            graph.bindings.push_back(actions::CompiledGraphBinding{
+                .bindingId = 77,
+                .actionId = "Jump",
+                .actionSetId = "GameplayBase",
+                .paths = {
+                    actions::ControlPath{ .kind = actions::ControlPathKind::DigitalButton, .code = 11 }
+                },
+                .interaction = actions::InteractionSpec{
+                    .kind = actions::InteractionKind::Repeat,
+                    .repeatDelayUs = actions::kLegacyRepeatDelayUs,
+                    .repeatIntervalUs = actions::kLegacyRepeatIntervalUs
+                },
+                .matchPolicy = actions::BindingMatchPolicy::ExactOnly
+            });
+            graph.lookups.bindingIndexById[77] = 0;
+            graph.lookups.bindingIdsByActionSetId["GameplayBase"].push_back(77);
+
+            constexpr std::uint64_t pressAt = 8'000'000;
+            const auto pressed = engine.Resolve(graph, stack, DigitalFrame(11, true, true, false, pressAt, pressAt), state);
+            Require(pressed.changes.size() == 1 && pressed.changes[0].phase == actions::ActionPhase::Press, "repeat press must emit Press");
+
+            std::vector<std::uint64_t> repeatTimestamps;
+            for (auto now = pressAt; now < pressAt + 790'000; now += kTickUs) {
+                auto tickFacts = facts;
+                tickFacts.monotonicUs = now;
+                const auto resolved = engine.ResolveDeadlines(graph, stack, tickFacts, state);
+                for (const auto& change : resolved.changes) {
+                    Require(change.phase == actions::ActionPhase::Repeat, "repeat deadline tick must only emit Repeat");
+                    Require(change.evaluationUs - change.timestampUs < kTickUs, "repeat must fire within one runtime tick of its deadline");
+                    repeatTimestamps.push_back(change.timestampUs);
+                }
+            }
+            Require(repeatTimestamps.size() == 5, "repeat cadence must be driven by deadlines between frames");
+            for (std::size_t index = 0; index < repeatTimestamps.size(); ++index) {
+                Require(
+                    repeatTimestamps[index] == pressAt + actions::kLegacyRepeatDelayUs + (index * actions::kLegacyRepeatIntervalUs),
+                    "repeat deadlines must stay on a fixed grid regardless of tick pacing");
+            }
+
+            const auto released = engine.Resolve(graph, stack, DigitalFrame(11, false, false, true, pressAt, pressAt + 820'000), state);
+            Require(released.changes.size() == 1 && released.changes[0].phase == actions::ActionPhase::Release, "repeat release must emit Release");
+            Require(state.Deadlines().PendingCount() == 0, "repeat release must cancel the next repeat deadline");
+        }
+    }
+
+    void RunActionGraphReloadBindingIdTests()
+    {
+        auto manifest = ManifestWithActions();
+        manifest.bindings.push_back(Binding("Jump", Trigger(dualpad::input::TriggerType::Button, 10)));
+        manifest.bindings.push_back(Binding("PowerAttack", Trigger(dualpad::input::TriggerType::Hold, 11)));
+        manifest.bindings.push_back(Binding("NativeCombo", Trigger(dualpad::input::TriggerType::Button, 12), "MenuBase"));
+        manifest.bindings.push_back(Binding("Jump", Trigger(dualpad::input::TriggerType::Button, 13), "MenuBase"));
+        const auto initial = actions::ActionGraphCompiler::Compile(manifest);
+        Require(initial.ok, initial.message);
+        Require(initial.graph.nextBindingId == 5, "full compile must track the next free binding id");
+
+        // Edit one menu binding: the gameplay set must keep its BindingIds.
+        auto edited = manifest;
+        edited.manifestEpoch = 43;
+        edited.bindings[3].legacyTrigger = Trigger(dualpad::input::TriggerType::Button, 14);
+        const auto reloaded = actions::ActionGraphCompiler::CompilePreservingBindingIds(edited, initial.graph);
+        Require(reloaded.ok, reloaded.message);
+        Require(reloaded.unchangedActionSets == 1 && reloaded.changedActionSets == 1,
+            "a reload compile must report only the edited action set as changed");
+        Require(reloaded.graph.manifestEpoch == 43, "reload compile must carry the new epoch");
+        for (std::size_t index = 0; index < 3; ++index) {
+            Require(reloaded.graph.bindings[index] == initial.graph.bindings[index],
+                "unchanged bindings must keep their compiled form and BindingId");
+        }
+        Require(reloaded.graph.bindings[3].bindingId == 5, "edited binding must draw a fresh BindingId");
+        Require(reloaded.graph.FindBinding(4) == nullptr, "retired BindingId must not survive the edit");
+        Require(reloaded.graph.nextBindingId == 6, "reload compile must advance the next free binding id");
+
+        const auto full = actions::ActionGraphCompiler::Compile(edited);
+        Require(full.ok, full.message);
+        Require(full.graph.bindings.size() == reloaded.graph.bindings.size(), "reload and full compile must agree on binding count");
+        for (std::size_t index = 0; index < full.graph.bindings.size(); ++index) {
+            auto expected = full.graph.bindings[index];
+            expected.bindingId = reloaded.graph.bindings[index].bindingId;
+            Require(expected == reloaded.graph.bindings[index], "reload compile must lower bindings like a full compile");
+            Require(
+                full.graph.displayBindings[index].priority == reloaded.graph.displayBindings[index].priority &&
+                    full.graph.displayBindings[index].token == reloaded.graph.displayBindings[index].token,
+                "reload compile must produce the same display records");
+        }
+
+        actions::ActionSetStack stack{};
+        stack.baseSetId = "GameplayBase";
+        actions::InteractionEngine engine;
+        actions::InteractionStateStore state;
+
+        // A sprint-style hold in flight must survive the menu edit and fire on the new graph.
+        constexpr std::uint64_t pressAt = 3'000'000;
+        (void)engine.Resolve(initial.graph, stack, DigitalFrame(11, true, true, false, pressAt, pressAt), state);
+        const auto migrated = engine.MigrateState(initial.graph, reloaded.graph, pressAt + 100'000, state);
+        Require(migrated.changes.empty(), "migrating an untouched binding must not emit changes");
+        Require(state.Find(2) != nullptr && state.Find(2)->active, "untouched hold state must survive the reload");
+        Require(state.Deadlines().Contains(2, actions::InteractionDeadlineKind::Hold), "untouched hold deadline must survive the reload");
+
+        const auto tickFacts = actions::KernelFacts{
+            .manifestEpoch = 43,
+            .contextRevision = 7,
+            .monotonicUs = pressAt + actions::kLegacyHoldThresholdUs
+        };
+        const auto fired = engine.ResolveDeadlines(reloaded.graph, stack, tickFacts, state);
+        Require(fired.changes.size() == 1 && fired.changes[0].phase == actions::ActionPhase::Hold,
+            "migrated hold must fire on the new graph");
+
+        // Dropping the held binding must close the phase it left open.
+        auto removed = edited;
+        removed.manifestEpoch = 44;
+        removed.bindings.erase(removed.bindings.begin() + 1);
+        const auto shrunk = actions::ActionGraphCompiler::CompilePreservingBindingIds(removed, reloaded.graph);
+        Require(shrunk.ok, shrunk.message);
+        Require(shrunk.graph.FindBinding(1) != nullptr && shrunk.graph.FindBinding(1)->actionId == "Jump",
+            "surviving binding in an edited set must keep its BindingId");
+        const auto released = engine.MigrateState(reloaded.graph, shrunk.graph, pressAt + 900'000, state);
+        Require(released.changes.size() == 1 &&
+                released.changes[0].phase == actions::ActionPhase::Release &&
+                released.changes[0].actionId == "PowerAttack",
+            "removed binding with a fired hold must emit Release");
+        Require(state.Find(2) == nullptr && state.Deadlines().PendingCount() == 0,
+            "removed binding must leave no state or deadlines behind");
+    }
+
     void RunRuntimePublishedSurfacePipelineTests()
     {
         gameplay::DualPadRuntime runtime;
@@ -937,6 +1223,72 @@ namespace
             "stable gamepad evidence must update IsUsingGamepadHook through committed input_v2 state");
     }
 
+    void RunSkyrimCompatibilityHookViewTests()
+    {
+        auto& compat = presentation::SkyrimCompatibilitySurface::GetSingleton();
+        compat.ResetHookReadStatsForTests();
+
+        presentation::PublishedPresentationState state{};
+        state.owner = presentation::PresentationOwner::Gamepad;
+        state.cursorOwner = presentation::CursorOwner::KeyboardMouse;
+        state.epoch = 5;
+        compat.Commit(state);
+        const auto view = compat.GetHookView();
+        Require(
+            view.epoch == 5 && view.isUsingGamepad && !view.gamepadControlsCursor,
+            "hook view must mirror the committed owner, cursor owner and epoch");
+
+        compat.SampleHookReadsForFrame();
+        Require(compat.IsUsingGamepadHook(), "IsUsingGamepad hook must read the hook view");
+        Require(!compat.GamepadControlsCursorHook(), "cursor hook must read the hook view");
+        Require(compat.IsGamepadDeviceEnabledHook(false), "device hook outside remap mode must stay enabled");
+        Require(compat.IsGamepadDeviceEnabledHook(true), "device hook in remap mode must follow the owner");
+        (void)compat.IsUsingGamepadHook();
+        compat.SampleHookReadsForFrame();
+        compat.SampleHookReadsForFrame();
+        auto stats = compat.GetHookReadStats();
+        Require(
+            stats.isUsingGamepadReads == 2 && stats.gamepadCursorReads == 1 && stats.deviceEnabledReads == 1,
+            "hook reads must be counted per callback, excluding the remap-free device fast path");
+        Require(
+            stats.frames == 3 && stats.lastFrameReads == 0 && stats.maxFrameReads == 4,
+            "hook reads must be bucketed per sampled frame");
+
+        // Odd epochs are gamepad-owned with a gamepad cursor; a torn read
+        // would pair an epoch with the other owner.
+        state.owner = presentation::PresentationOwner::KeyboardMouse;
+        state.epoch = 6;
+        compat.Commit(state);
+        std::atomic<bool> done{ false };
+        std::thread publisher([&] {
+            for (std::uint32_t epoch = 7; epoch < 20000; ++epoch) {
+                presentation::PublishedPresentationState next{};
+                const bool gamepad = (epoch & 1u) != 0;
+                next.owner = gamepad ? presentation::PresentationOwner::Gamepad : presentation::PresentationOwner::KeyboardMouse;
+                next.cursorOwner = gamepad ? presentation::CursorOwner::Gamepad : presentation::CursorOwner::KeyboardMouse;
+                next.epoch = epoch;
+                compat.Commit(next);
+            }
+            done.store(true);
+        });
+        std::uint32_t lastEpoch = 0;
+        bool torn = false;
+        bool regressed = false;
+        while (!done.load()) {
+            const auto read = compat.GetHookView();
+            const bool gamepad = (read.epoch & 1u) != 0;
+            torn |= read.isUsingGamepad != gamepad || read.gamepadControlsCursor != gamepad;
+            regressed |= read.epoch < lastEpoch;
+            lastEpoch = read.epoch;
+        }
+        publisher.join();
+        Require(!torn, "hook view must never pair one commit's epoch with another commit's owner");
+        Require(!regressed, "hook view epochs must not go backwards on one reader");
+
+        compat.Commit(presentation::PublishedPresentationState{});
+        compat.ResetHookReadStatsForTests();
+    }
+
     void RunRuntimeLiveStyleGamepadPublishTests()
     {
         gameplay::DualPadRuntime runtime;
@@ -1768,8 +2120,12 @@ int main()
         RunCompiledActionGraphPublisherTests();
         RunLegacyInteractionInputAdapterTests();
         RunInteractionEngineTests();
+        RunInteractionTimerWheelTests();
+        RunInteractionDeadlineTickTests();
+        RunActionGraphReloadBindingIdTests();
         RunLegacyLifecycleBridgeTests();
         RunRuntimePublishedSurfacePipelineTests();
+        RunSkyrimCompatibilityHookViewTests();
         RunRuntimeLiveStyleGamepadPublishTests();
         RunRuntimeLiveKeyboardMouseEvidenceProducerTests();
         RunRuntimeGraphSkewHealthTests();
@@ -74,6 +74,8 @@ void RunLegacyIniImporterTests()
         Require(res.ok, "LegacyIniImporter::Import(missing) should still be ok");
         Require(res.bundle.bindingsMissing, "bindingsMissing should be true");
         Require(res.bundle.menuPolicyMissing, "menuPolicyMissing should be true");
+        Require(Contains(res.message, "bindings ini not found"), "missing bindings should be reported");
+        Require(Contains(res.message, "menu policy ini not found"), "missing menu policy should be reported");
     }
 
     {
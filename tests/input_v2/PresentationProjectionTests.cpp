@@ -24,7 +24,7 @@ namespace
         dualpad::input_v2::context::ResolvedContextSnapshot context{};
         context.hostMode = dualpad::input_v2::context::HostMode::Gameplay;
         context.uiContextId = dualpad::input_v2::context::UiContextId::None;
-        context.actionSetStack.baseSetId = "GameplayBase";
+        context.actionSetStack = dualpad::input_v2::actions::ActionSetStack{ .baseSetId = "GameplayBase" };
         context.presentationPolicyId = "GameplayPolicyFromPH2";
         context.contextRevision = 7;
         return context;
@@ -35,9 +35,11 @@ namespace
         auto context = GameplayContext();
         context.hostMode = dualpad::input_v2::context::HostMode::Menu;
         context.uiContextId = dualpad::input_v2::context::UiContextId::Journal;
-        context.actionSetStack.baseSetId = "MenuBase";
-        context.actionSetStack.layerIds = { "JournalLayer" };
-        context.actionSetStack.scopeAnchorIds = { "MenuBase", "JournalLayer" };
+        context.actionSetStack = dualpad::input_v2::actions::ActionSetStack{
+            .baseSetId = "MenuBase",
+            .layerIds = { "JournalLayer" },
+            .scopeAnchorIds = { "MenuBase", "JournalLayer" }
+        };
         context.presentationPolicyId = "PolicyOnlyPH2MayChoose";
         context.contextRevision = 8;
         context.menuStackRevision = 4;
@@ -225,6 +227,43 @@ void RunPresentationProjectionTests()
         Require(diff.diffs.size() == 1 && diff.diffs.front() == "isUsingGamepad", "shadow parity must report hook field diffs");
     }
 
+    {
+        presentation::PresentationProjection projection;
+        presentation::SourceEvidenceSnapshot snapshot{};
+        snapshot.deviceFamilyEvidence.family = presentation::DeviceFamily::Gamepad;
+        snapshot.deviceFamilyEvidence.deviceFamilyRevision = 1;
+        snapshot.gamepadEvidence = true;
+
+        presentation::PublishedGameplayPresentation gameplay{};
+        gameplay.engineOwner = presentation::PresentationOwner::Gamepad;
+        gameplay.gameplayPresentationRevision = 1;
+
+        const auto first = projection.Project(snapshot, GameplayContext(), gameplay);
+        Require(first.epoch == 1, "first projection must publish a change");
+        const auto settled = projection.Project(snapshot, GameplayContext(), gameplay);
+        Require(settled.dirty == presentation::PresentationDirtyFlags::None, "repeat inputs must settle to clean");
+        Require(projection.GetStats().projected == 2, "a dirty projection must be re-run once to reach a fixed point");
+
+        for (int frame = 0; frame < 8; ++frame) {
+            auto moving = snapshot;
+            moving.collectedTick = 1000 + static_cast<std::uint64_t>(frame);
+            const auto published = projection.Project(moving, GameplayContext(), gameplay);
+            Require(published.epoch == settled.epoch, "unchanged fingerprints must not advance epoch");
+        }
+        auto stats = projection.GetStats();
+        Require(stats.skipped == 8, "stick-only frames with unchanged fingerprints must skip projection");
+        Require(stats.projected == 2 && stats.changed == 1, "skipped frames must not count as projected or changed");
+
+        auto keyboard = snapshot;
+        keyboard.gamepadEvidence = false;
+        keyboard.keyboardEvidence = true;
+        auto menu = MenuContext();
+        const auto changed = projection.Project(keyboard, menu, gameplay);
+        Require(changed.epoch == settled.epoch + 1, "a fingerprint change must re-project and publish");
+        stats = projection.GetStats();
+        Require(stats.projected == 3 && stats.changed == 2, "fingerprint change must count as projected and changed");
+    }
+
     {
         const auto site = presentation::detail::MakeVfuncPatchSite(0x1000, 0x8);
         Require(
@@ -1,19 +1,26 @@
 #include "pch.h"
 
 #include "input_v2/context/ContextCatalog.h"
+#include "input_v2/context/ContextResolver.h"
 #include "input_v2/actions/CompiledActionGraphPublisher.h"
 #include "input_v2/config/AtomicConfigReloader.h"
 #include "input_v2/presentation/PresentationProjection.h"
+#include "input_v2/prompt/GlyphAtlasIndex.h"
 #include "input_v2/prompt/PromptProjection.h"
 #include "input_v2/prompt/PromptRuntimeOwner.h"
 #include "input_v2/prompt/ScaleformPromptAdapter.h"
 #include "input_v2/prompt/PromptService.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <memory>
 #include <stdexcept>
 #include <string_view>
+#include <vector>
 
 namespace
 {
@@ -473,6 +480,441 @@ namespace
         LoadRuntimeConfigForPromptTests();
         owner.ResetForTests();
     }
+    void RunPromptRuntimeOwnerResolutionTableTests()
+    {
+        auto& owner = prompt::PromptRuntimeOwner::GetSingleton();
+        owner.ResetForTests();
+        owner.SetScopePrefetchEnabledForTests(false);
+        LoadRuntimeConfigForPromptTests();
+
+        const auto bundle = config::AtomicConfigReloader::GetSingleton().GetActiveBundleSnapshot();
+        Require(bundle != nullptr, "resolution table test needs an active bundle");
+        const prompt::PromptRuntimeBaseline baseline{
+            .manifestEpoch = bundle->manifestEpoch,
+            .configGeneration = bundle->manifestEpoch,
+            .bundle = bundle,
+            .graph = actions::PublishedActionGraphSnapshot{
+                .manifestEpoch = bundle->manifestEpoch,
+                .graph = std::make_shared<const actions::CompiledActionGraph>(Graph(bundle->manifestEpoch))
+            }
+        };
+        owner.PublishPresentationState(JournalPresentation(), baseline);
+
+        const prompt::PromptQuery query{
+            .actionId = "Menu.Accept",
+            .selectorKind = prompt::PromptScopeSelectorKind::ExplicitContextName,
+            .contextName = "JournalMenu"
+        };
+        const auto first = owner.ResolveShared(query);
+        const auto second = owner.ResolveShared(query);
+        Require(first && first->ok && first->primary->token == "Circle", "memoized resolve must match PromptService");
+        Require(first == second, "repeat query under one scope revision must share the memoized descriptor");
+        Require(
+            owner.ResolveLegacyGlyphToken("Menu.Accept", "JournalMenu") == "Circle",
+            "legacy token API must read through the memo table");
+
+        const auto current = owner.ResolveShared(prompt::PromptQuery{ .actionId = "Menu.Accept", .contextName = "Ignored" });
+        Require(
+            current == owner.ResolveShared(prompt::PromptQuery{ .actionId = "Menu.Accept" }),
+            "current-scope queries must not key on the unused context name");
+
+        auto stats = owner.GetResolutionStats();
+        Require(stats.hits == 3 && stats.misses == 2 && stats.entries == 2, "memo table must count hits and misses");
+
+        owner.PublishPresentationState(JournalPresentation(), baseline);
+        Require(owner.ResolveShared(query) == first, "republishing an unchanged scope must keep the memo table");
+
+        auto keyboardMouse = JournalPresentation();
+        keyboardMouse.family = presentation::DeviceFamily::KeyboardMouse;
+        owner.PublishPresentationState(keyboardMouse, baseline);
+        const auto afterFamilyChange = owner.ResolveShared(query);
+        Require(afterFamilyChange != first, "device family change must invalidate the memo table");
+        Require(
+            afterFamilyChange->promptScopeRevision == first->promptScopeRevision + 1,
+            "invalidated descriptor must carry the new scope revision");
+        Require(
+            afterFamilyChange->status == prompt::PromptQueryStatus::DeviceFamilyMismatch,
+            "invalidated descriptor must resolve against the new device family");
+        stats = owner.GetResolutionStats();
+        Require(
+            stats.invalidations == 0 && stats.entries == 1,
+            "device family change must park the previous scope's entries rather than resolve against them");
+
+        LoadRuntimeConfigForPromptTests();
+        owner.ResetForTests();
+    }
+
+    void RunPromptSnapshotGraphPinTests()
+    {
+        auto& owner = prompt::PromptRuntimeOwner::GetSingleton();
+        owner.ResetForTests();
+        LoadRuntimeConfigForPromptTests();
+
+        const auto bundle = config::AtomicConfigReloader::GetSingleton().GetActiveBundleSnapshot();
+        Require(bundle != nullptr, "graph pin test needs an active bundle");
+        auto graph = std::make_shared<const actions::CompiledActionGraph>(Graph(bundle->manifestEpoch));
+        const std::weak_ptr<const actions::CompiledActionGraph> weakGraph = graph;
+        const auto* circleDisplay = &graph->displayBindings[1];
+        owner.PublishPresentationState(
+            JournalPresentation(),
+            prompt::PromptRuntimeBaseline{
+                .manifestEpoch = bundle->manifestEpoch,
+                .configGeneration = bundle->manifestEpoch,
+                .bundle = bundle,
+                .graph = actions::PublishedActionGraphSnapshot{ .manifestEpoch = bundle->manifestEpoch, .graph = graph }
+            });
+
+        const auto snapshot = owner.Snapshot(prompt::PromptQuery{
+            .actionId = "Menu.Accept",
+            .selectorKind = prompt::PromptScopeSelectorKind::ExplicitContextName,
+            .contextName = "JournalMenu"
+        });
+        Require(snapshot.primary && snapshot.primary->token == "Circle", "pinned snapshot must resolve through the owner");
+        Require(
+            snapshot.primary->token.data() == circleDisplay->token.data() &&
+                snapshot.primary->localizedLabel.data() == circleDisplay->localizedLabel.data(),
+            "snapshot candidate strings must view the compiled graph instead of copying it");
+        Require(
+            snapshot.resolvedSet && snapshot.resolvedSet->data() == graph->lookups.bindingIdsByActionSetId.find("JournalLayer")->first.data(),
+            "resolved set must view the graph's action set key");
+
+        const auto copy = snapshot;
+        Require(
+            copy.primary->assetLookupPath.data() == snapshot.primary->assetLookupPath.data() && copy.strings == snapshot.strings,
+            "copying a snapshot must share the interned strings");
+
+        owner.ResetForTests();
+        graph.reset();
+        Require(!weakGraph.expired(), "a live snapshot must pin its epoch's compiled graph");
+        Require(
+            copy.primary->glyphId == "Circle" &&
+                copy.primary->assetLookupPath == "Interface/Exported/DualPad/Glyphs/DualSense/Circle.svg" &&
+                copy.primary->source == "JournalLayer:2:PromptSnapshotTest",
+            "pinned snapshot strings must stay readable after the owner drops the graph");
+
+        LoadRuntimeConfigForPromptTests();
+    }
+
+    void RunPromptRuntimeOwnerContextGlyphTokenTests()
+    {
+        auto& owner = prompt::PromptRuntimeOwner::GetSingleton();
+        owner.ResetForTests();
+        owner.SetScopePrefetchEnabledForTests(false);
+        LoadRuntimeConfigForPromptTests();
+
+        const auto bundle = config::AtomicConfigReloader::GetSingleton().GetActiveBundleSnapshot();
+        Require(bundle != nullptr, "context glyph token test needs an active bundle");
+        const prompt::PromptRuntimeBaseline baseline{
+            .manifestEpoch = bundle->manifestEpoch,
+            .configGeneration = bundle->manifestEpoch,
+            .bundle = bundle,
+            .graph = actions::PublishedActionGraphSnapshot{
+                .manifestEpoch = bundle->manifestEpoch,
+                .graph = std::make_shared<const actions::CompiledActionGraph>(Graph(bundle->manifestEpoch))
+            }
+        };
+
+        const auto unavailable = owner.ResolveContextGlyphTokens("JournalMenu");
+        Require(
+            unavailable->status == prompt::PromptQueryStatus::ScopeUnavailable && unavailable->tokens.empty(),
+            "context glyph tokens must fail closed before a prompt scope is published");
+
+        owner.PublishPresentationState(JournalPresentation(), baseline);
+        auto& adapter = prompt::ScaleformPromptAdapter::GetSingleton();
+        const auto table = adapter.ResolveContextGlyphTokensForRuntime("JournalMenu");
+        Require(table->status == prompt::PromptQueryStatus::Ok, "context glyph tokens must resolve for a scoped context");
+        Require(table->tokens.size() == 2, "context glyph tokens must hold only renderable actions");
+        Require(
+            table->tokens[0].actionId == "Menu.Accept" && table->tokens[1].actionId == "Menu.Back",
+            "context glyph tokens must be sorted by action id");
+        for (const auto actionId : { "Menu.Accept", "Menu.Back", "Menu.Hidden", "Menu.KbmOnly", "Menu.NoDisplay" }) {
+            Require(
+                table->FindToken(actionId) == adapter.ResolveLegacyGlyphTokenForRuntime(actionId, "JournalMenu"),
+                "context glyph token table must match the per-action legacy token path");
+        }
+        Require(
+            owner.ResolveContextGlyphTokens("JournalMenu") == table,
+            "repeat context glyph token fetch under one scope revision must share the table");
+
+        const auto unknown = owner.ResolveContextGlyphTokens("NotAContext");
+        Require(
+            unknown->status == prompt::PromptQueryStatus::UnknownContext && unknown->tokens.empty(),
+            "unknown context must fail closed instead of falling back to Menu");
+
+        auto stats = owner.GetResolutionStats();
+        Require(stats.contextTableBuilds == 1 && stats.contextTableHits == 1, "context glyph tables must be counted");
+        Require(stats.contextTables == 1, "unknown contexts must not be stored");
+
+        auto keyboardMouse = JournalPresentation();
+        keyboardMouse.family = presentation::DeviceFamily::KeyboardMouse;
+        owner.PublishPresentationState(keyboardMouse, baseline);
+        const auto rebuilt = owner.ResolveContextGlyphTokens("JournalMenu");
+        Require(rebuilt != table, "device family change must rebuild the context glyph table");
+        Require(
+            rebuilt->tokens.size() == 1 && rebuilt->FindToken("Menu.KbmOnly") == "Enter",
+            "rebuilt context glyph table must follow the new device family");
+        Require(rebuilt->promptScopeRevision == table->promptScopeRevision + 1, "rebuilt table must carry the new revision");
+
+        LoadRuntimeConfigForPromptTests();
+        owner.ResetForTests();
+    }
+    void RunPromptScopePrefetchTests()
+    {
+        auto& owner = prompt::PromptRuntimeOwner::GetSingleton();
+        owner.ResetForTests();
+        LoadRuntimeConfigForPromptTests();
+
+        const auto bundle = config::AtomicConfigReloader::GetSingleton().GetActiveBundleSnapshot();
+        Require(bundle != nullptr, "scope prefetch test needs an active bundle");
+        const auto graph = std::make_shared<const actions::CompiledActionGraph>(Graph(bundle->manifestEpoch));
+        const prompt::PromptRuntimeBaseline baseline{
+            .manifestEpoch = bundle->manifestEpoch,
+            .configGeneration = bundle->manifestEpoch,
+            .bundle = bundle,
+            .graph = actions::PublishedActionGraphSnapshot{ .manifestEpoch = bundle->manifestEpoch, .graph = graph }
+        };
+
+        owner.PublishPresentationState(JournalPresentation(), baseline);
+        owner.WaitForPrefetchForTests();
+        auto stats = owner.GetResolutionStats();
+        Require(stats.prefetchMerges == 1 && stats.prefetchedEntries > 0, "published scope must be warmed off-thread");
+
+        const auto tokens = owner.ResolveContextGlyphTokens("JournalMenu");
+        Require(
+            tokens->status == prompt::PromptQueryStatus::Ok && tokens->tokens.size() == 2,
+            "warmed context glyph table must match a lazily built one");
+        const auto accept = owner.ResolveShared(prompt::PromptQuery{
+            .actionId = "Menu.Accept",
+            .selectorKind = prompt::PromptScopeSelectorKind::ExplicitContextName,
+            .contextName = "Journal Menu"
+        });
+        Require(accept->ok && accept->primary->token == "Circle", "warmed alias descriptor must resolve like the service");
+        Require(
+            owner.ResolveShared(prompt::PromptQuery{ .actionId = "Menu.Back" })->primary->token ==
+                tokens->FindToken("Menu.Back"),
+            "warmed current-scope descriptor must agree with the context table");
+        stats = owner.GetResolutionStats();
+        Require(
+            stats.contextTableHits == 1 && stats.contextTableBuilds == 0 && stats.hits == 2 && stats.misses == 0,
+            "first queries after a warmed publish must not resolve on the calling thread");
+
+        const auto scheduled = owner.GetPrefetchStats().scheduled;
+        owner.PublishPresentationState(JournalPresentation(), baseline);
+        owner.WaitForPrefetchForTests();
+        Require(owner.GetPrefetchStats().scheduled == scheduled, "republishing an unchanged scope must not requeue a warm-up");
+
+        auto keyboardMouse = JournalPresentation();
+        keyboardMouse.family = presentation::DeviceFamily::KeyboardMouse;
+        owner.PublishPresentationState(keyboardMouse, baseline);
+        owner.WaitForPrefetchForTests();
+        const auto rebuilt = owner.ResolveContextGlyphTokens("JournalMenu");
+        Require(
+            rebuilt->tokens.size() == 1 && rebuilt->FindToken("Menu.KbmOnly") == "Enter",
+            "a new scope revision must be warmed for the new device family");
+        Require(owner.GetResolutionStats().contextTableBuilds == 0, "rewarmed scope must still hit on first query");
+
+        owner.ResetForTests();
+        context::ResolvedContextSnapshot resolved{};
+        resolved.uiContextId = context::UiContextId::Journal;
+        resolved.actionSetStack = JournalPresentation().actionSetStack;
+        owner.PrefetchResolvedContext(resolved, presentation::DeviceFamily::Gamepad, baseline);
+        owner.WaitForPrefetchForTests();
+        Require(owner.GetResolutionStats().prefetchMerges == 0, "a transition warm-up must wait for its scope to be published");
+        const auto scheduledAhead = owner.GetPrefetchStats().scheduled;
+        owner.PublishPresentationState(JournalPresentation(), baseline);
+        Require(
+            owner.GetPrefetchStats().scheduled == scheduledAhead && owner.GetResolutionStats().prefetchMerges == 1,
+            "publishing a scope warmed ahead must adopt it without requeueing");
+        Require(
+            owner.ResolveContextGlyphTokens("JournalMenu")->tokens.size() == 2 &&
+                owner.GetResolutionStats().contextTableBuilds == 0,
+            "first query after a transition warm-up must hit");
+
+        const auto scope = JournalScope();
+        const prompt::PromptScopePrefetcher::Request stale{
+            .key = prompt::PromptResolutionTableKey{ .catalog = &bundle->catalog, .graph = graph.get(), .manifestEpoch = 42, .promptScopeRevision = 1 },
+            .scope = scope,
+            .bundle = bundle,
+            .graph = std::make_shared<const actions::CompiledActionGraph>(Graph(42))
+        };
+        auto staged = prompt::PromptScopePrefetcher::Warm(stale);
+        Require(staged.table.GetStats().entries > 0, "warming a ready scope must stage descriptors");
+        prompt::PromptResolutionTable live;
+        live.Bind(prompt::PromptResolutionTableKey{ .catalog = &bundle->catalog, .graph = graph.get(), .manifestEpoch = 42, .promptScopeRevision = 2 });
+        Require(live.Merge(staged.table) == 0 && live.GetStats().entries == 0, "a warm-up for a superseded scope must be dropped");
+
+        LoadRuntimeConfigForPromptTests();
+        owner.ResetForTests();
+    }
+
+    void RunPromptRuntimeOwnerFamilySwitchTests()
+    {
+        auto& owner = prompt::PromptRuntimeOwner::GetSingleton();
+        owner.ResetForTests();
+        owner.SetScopePrefetchEnabledForTests(false);
+        LoadRuntimeConfigForPromptTests();
+
+        const auto bundle = config::AtomicConfigReloader::GetSingleton().GetActiveBundleSnapshot();
+        Require(bundle != nullptr, "family switch test needs an active bundle");
+        const prompt::PromptRuntimeBaseline baseline{
+            .manifestEpoch = bundle->manifestEpoch,
+            .configGeneration = bundle->manifestEpoch,
+            .bundle = bundle,
+            .graph = actions::PublishedActionGraphSnapshot{
+                .manifestEpoch = bundle->manifestEpoch,
+                .graph = std::make_shared<const actions::CompiledActionGraph>(Graph(bundle->manifestEpoch))
+            }
+        };
+        const prompt::PromptQuery query{
+            .actionId = "Menu.Accept",
+            .selectorKind = prompt::PromptScopeSelectorKind::ExplicitContextName,
+            .contextName = "JournalMenu"
+        };
+        auto keyboardMouse = JournalPresentation();
+        keyboardMouse.family = presentation::DeviceFamily::KeyboardMouse;
+
+        owner.PublishPresentationState(JournalPresentation(), baseline);
+        const auto gamepad = owner.ResolveShared(query);
+        const auto gamepadTokens = owner.ResolveContextGlyphTokens("JournalMenu");
+        owner.PublishPresentationState(keyboardMouse, baseline);
+        (void)owner.ResolveShared(query);
+        auto switches = owner.GetFamilySwitchStats();
+        Require(switches.switches == 1 && switches.standbyRestores == 0, "first flip must build the new family's table");
+        Require(switches.lastSwitchUs > 0.0, "first flip must charge its re-resolution to the switch cost");
+
+        owner.PublishPresentationState(JournalPresentation(), baseline);
+        const auto restored = owner.ResolveShared(query);
+        const auto restoredTokens = owner.ResolveContextGlyphTokens("JournalMenu");
+        const auto revision = owner.GetPublishedPromptScopeForTests().promptScopeRevision;
+        Require(revision == gamepad->promptScopeRevision + 2, "flipping back must still advance the scope revision");
+        Require(
+            restored->primary && restored->primary->token == gamepad->primary->token &&
+                restored->promptScopeRevision == revision && restoredTokens->promptScopeRevision == revision &&
+                restoredTokens->tokens.size() == gamepadTokens->tokens.size(),
+            "restored entries must match the original resolve but carry the current revision");
+        Require(owner.ResolveShared(query) == restored, "restamped entries must be stored back into the table");
+
+        switches = owner.GetFamilySwitchStats();
+        const auto stats = owner.GetResolutionStats();
+        Require(
+            switches.switches == 2 && switches.standbyRestores == 1 && switches.rapidSwitches == 1,
+            "flipping back must swap in the parked table and count as a rapid switch");
+        Require(
+            stats.restamps == 2 && stats.contextTableBuilds == 1 && stats.invalidations == 0,
+            "flipping back must not re-resolve or drop entries");
+        Require(switches.maxSwitchUs >= switches.lastSwitchUs, "switch cost must track its maximum");
+
+        owner.ResetForTests();
+        LoadRuntimeConfigForPromptTests();
+
+        owner.PublishPresentationState(JournalPresentation(), baseline);
+        owner.PublishPresentationState(keyboardMouse, baseline);
+        auto menu = JournalPresentation();
+        menu.uiContextId = context::UiContextId::UnknownTrackedMenu;
+        menu.actionSetStack = actions::ActionSetStack{
+            .baseSetId = "MenuBase",
+            .scopeAnchorIds = { "MenuBase" }
+        };
+        owner.PublishPresentationState(menu, baseline);
+        owner.WaitForPrefetchForTests();
+        auto keyboardMouseMenu = menu;
+        keyboardMouseMenu.family = presentation::DeviceFamily::KeyboardMouse;
+        owner.PublishPresentationState(keyboardMouseMenu, baseline);
+        Require(
+            owner.GetFamilySwitchStats().standbyRestores == 1,
+            "after one flip the other family's table must be kept prebuilt for each new scope");
+        const auto builds = owner.GetResolutionStats().contextTableBuilds;
+        Require(
+            owner.ResolveContextGlyphTokens("Menu")->promptScopeRevision ==
+                    owner.GetPublishedPromptScopeForTests().promptScopeRevision &&
+                owner.GetResolutionStats().contextTableBuilds == builds,
+            "a flip to a prebuilt family must not rebuild glyph tables on the calling thread");
+
+        LoadRuntimeConfigForPromptTests();
+        owner.ResetForTests();
+    }
+
+    void RunGlyphAtlasIndexTests()
+    {
+        const auto layout = prompt::PackGlyphAtlas(
+            {
+                prompt::GlyphAtlasPlacement{ .platformId = "DualSense", .glyphId = "Circle", .width = 64, .height = 64 },
+                prompt::GlyphAtlasPlacement{ .platformId = "DualSense", .glyphId = "Wide", .width = 128, .height = 48 },
+                prompt::GlyphAtlasPlacement{ .platformId = "KeyboardMouse", .glyphId = "Enter", .width = 96, .height = 64 }
+            },
+            160,
+            2);
+        Require(layout.has_value(), "glyph atlas packer must fit the test glyph set");
+        Require(layout->width == 256 && layout->height == 256, "glyph atlas dimensions must round up to powers of two");
+        for (std::size_t i = 0; i < layout->placements.size(); ++i) {
+            const auto& a = layout->placements[i];
+            Require(a.x + a.width <= 160 && a.y + a.height <= layout->height, "packed glyph must stay inside the atlas");
+            for (std::size_t j = i + 1; j < layout->placements.size(); ++j) {
+                const auto& b = layout->placements[j];
+                const bool disjoint = a.x + a.width <= b.x || b.x + b.width <= a.x || a.y + a.height <= b.y || b.y + b.height <= a.y;
+                Require(disjoint, "packed glyphs must not overlap");
+            }
+        }
+        Require(
+            !prompt::PackGlyphAtlas({ prompt::GlyphAtlasPlacement{ .platformId = "P", .glyphId = "G", .width = 200, .height = 8 } }, 160, 2),
+            "glyph wider than the atlas must be rejected");
+
+        const auto bytes = prompt::SerializeGlyphAtlasIndex(*layout);
+        const auto path = std::filesystem::temp_directory_path() / "DualPadPromptSnapshotTests_GlyphAtlas.idx";
+        {
+            std::ofstream out(path, std::ios::binary | std::ios::trunc);
+            out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        }
+
+        const auto descriptor = Resolve(Graph(), JournalScope(), "Menu.Accept", "JournalMenu");
+        Require(descriptor.ok && descriptor.primary, "atlas test needs a resolved prompt");
+
+        prompt::GlyphAtlasIndex atlas;
+        Require(!atlas.Resolve(descriptor.primary->assetLookupPath), "closed atlas must not resolve glyphs");
+        Require(atlas.Open(path), "serialized glyph atlas index must map and validate");
+        const auto rect = atlas.Resolve(descriptor.primary->assetLookupPath);
+        Require(rect.has_value(), "atlas must resolve the PromptService asset lookup path");
+        Require(rect->width == 64 && rect->height == 64, "atlas rect must keep the glyph size");
+        Require(
+            rect->u0 == static_cast<float>(rect->x) / 256.0f && rect->v1 == static_cast<float>(rect->y + rect->height) / 256.0f,
+            "atlas UVs must be normalized to the atlas size");
+        Require(atlas.AtlasImagePath() == "Interface/Exported/DualPad/Glyphs/GlyphAtlas.dds", "atlas must name its packed raster image");
+        Require(
+            atlas.Resolve("Interface/Exported/DualPad/Glyphs/KeyboardMouse/Enter.svg")->width == 96,
+            "atlas must resolve per device profile");
+        Require(!atlas.Resolve("Interface/Exported/DualPad/Glyphs/DualSense/Missing.svg"), "unknown glyph must not resolve");
+        Require(!atlas.Resolve("Interface/Exported/DualPad/Glyphs/Circle.svg"), "path without a platform must not resolve");
+        Require(!atlas.Resolve("Interface/Other/DualSense/Circle.svg"), "path outside the glyph root must not resolve");
+        atlas.Close();
+
+        {
+            std::ofstream out(path, std::ios::binary | std::ios::trunc);
+            out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size() - 4));
+        }
+        Require(!atlas.Open(path), "truncated glyph atlas index must fail validation");
+        Require(!atlas.IsOpen(), "failed open must leave the atlas unavailable");
+        std::filesystem::remove(path);
+
+        // Find binary-searches, so the reader must refuse keys out of order.
+        const auto entryAt = [&](std::vector<std::byte>& data, std::size_t index) {
+            return data.data() + sizeof(prompt::GlyphAtlasIndexHeader) + index * sizeof(prompt::GlyphAtlasIndexEntry);
+        };
+        auto unsorted = bytes;
+        std::swap_ranges(entryAt(unsorted, 0), entryAt(unsorted, 1), entryAt(unsorted, 1));
+        Require(!prompt::GlyphAtlasIndexView::Parse(unsorted), "unsorted glyph atlas keys must fail validation");
+        auto duplicated = bytes;
+        std::memcpy(entryAt(duplicated, 1), entryAt(duplicated, 0), sizeof(prompt::GlyphAtlasIndexEntry));
+        Require(!prompt::GlyphAtlasIndexView::Parse(duplicated), "duplicate glyph atlas keys must fail validation");
+        Require(prompt::GlyphAtlasIndexView::Parse(bytes).has_value(), "sorted glyph atlas keys must validate");
+
+        const std::vector<std::uint8_t> pixels(4 * 2 * 4, 0x7F);
+        const auto dds = prompt::SerializeGlyphAtlasDds(4, 2, pixels);
+        std::uint32_t ddsWords[6]{};
+        std::memcpy(ddsWords, dds.data(), sizeof(ddsWords));
+        Require(dds.size() == 128 + pixels.size(), "atlas DDS must be a 128-byte header plus raw pixels");
+        Require(std::memcmp(dds.data(), "DDS ", 4) == 0 && ddsWords[1] == 124, "atlas DDS must carry the DDS magic and header size");
+        Require(ddsWords[3] == 2 && ddsWords[4] == 4 && ddsWords[5] == 16, "atlas DDS must record height, width and pitch");
+    }
 }
 
 int main()
@@ -485,6 +927,12 @@ int main()
         RunPromptRuntimeOwnerReloadInterleavingTests();
         RunPromptRuntimeOwnerEpochSkewTests();
         RunPromptRuntimeOwnerTests();
+        RunPromptRuntimeOwnerResolutionTableTests();
+        RunPromptSnapshotGraphPinTests();
+        RunPromptRuntimeOwnerContextGlyphTokenTests();
+        RunPromptScopePrefetchTests();
+        RunPromptRuntimeOwnerFamilySwitchTests();
+        RunGlyphAtlasIndexTests();
         return 0;
     } catch (const std::exception& e) {
         std::cerr << e.what() << '\n';
@@ -84,6 +84,7 @@ int main()
     graph.lookups.bindingIndexById[1] = 0;
     graph.lookups.bindingIndexById[2] = 1;
     graph.lookups.bindingIdsByActionSetId["GameplayBase"] = { 1, 2 };
+    graph.RebuildAxis2DSlots();
 
     actions::KernelFrame axisFrame{};
     axisFrame.facts.manifestEpoch = 1;
@@ -89,7 +89,7 @@ namespace
         std::exit(1);
     }
 
-    void TestPhase0MandatoryReplayCoverageRemainsTenScenarios()
+    void TestPhase0MandatoryReplayCoverageRemainsElevenScenarios()
     {
         const auto root = FindProjectRoot();
         const auto phase0 = root / "tests" / "replay" / "golden" / "phase0";
@@ -99,7 +99,7 @@ namespace
                 ++scenarioCount;
             }
         }
-        Require(scenarioCount == 10, "phase0 mandatory replay coverage must remain 10 scenarios");
+        Require(scenarioCount == 11, "phase0 mandatory replay coverage must remain 11 scenarios");
     }
 
     void TestManifestReloadReplayProducesHardResetTransition()
@@ -145,7 +145,7 @@ namespace
 
 int main()
 {
-    TestPhase0MandatoryReplayCoverageRemainsTenScenarios();
+    TestPhase0MandatoryReplayCoverageRemainsElevenScenarios();
     TestManifestReloadReplayProducesHardResetTransition();
     TestReplaySequenceGapDoesNotReachStableConsumer();
     std::cout << "DualPadReplayTests passed\n";
@@ -0,0 +1,435 @@
+#include "input_v2/prompt/GlyphAtlasFormat.h"
+
+#include <Windows.h>
+#include <d2d1_3.h>
+#include <shlwapi.h>
+#include <wincodec.h>
+#include <wrl/client.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+    namespace fs = std::filesystem;
+    namespace prompt = dualpad::input_v2::prompt;
+    using Microsoft::WRL::ComPtr;
+
+    constexpr std::string_view kGeneratorVersion = "DualPadGlyphAtlasGen/v2";
+    constexpr std::uint32_t kMaxAtlasWidth = 2048;
+    constexpr std::uint32_t kPadding = 2;
+    // Same nominal cell the ButtonArt token chain assumes.
+    constexpr double kDefaultGlyphSize = 64.0;
+    constexpr double kMaxGlyphSize = 1024.0;
+
+    struct GlyphSource
+    {
+        std::string platformId;
+        std::string glyphId;
+        std::string viewBox;
+        std::string body;
+        std::uint16_t width{ 0 };
+        std::uint16_t height{ 0 };
+    };
+
+    std::string ReadFile(const fs::path& path)
+    {
+        std::ifstream input(path, std::ios::binary);
+        if (!input) {
+            throw std::runtime_error("cannot read " + path.generic_string());
+        }
+        std::ostringstream buffer;
+        buffer << input.rdbuf();
+        return buffer.str();
+    }
+
+    void WriteFile(const fs::path& path, std::string_view content)
+    {
+        fs::create_directories(path.parent_path());
+        std::ofstream output(path, std::ios::binary | std::ios::trunc);
+        if (!output) {
+            throw std::runtime_error("cannot write " + path.generic_string());
+        }
+        output.write(content.data(), static_cast<std::streamsize>(content.size()));
+    }
+
+    void Check(HRESULT hr, std::string_view what)
+    {
+        if (FAILED(hr)) {
+            throw std::runtime_error(std::format("{} failed: 0x{:08X}", what, static_cast<std::uint32_t>(hr)));
+        }
+    }
+
+    class ComApartment
+    {
+    public:
+        ComApartment()
+        {
+            Check(::CoInitializeEx(nullptr, COINIT_MULTITHREADED), "CoInitializeEx");
+        }
+
+        ~ComApartment()
+        {
+            ::CoUninitialize();
+        }
+
+        ComApartment(const ComApartment&) = delete;
+        ComApartment& operator=(const ComApartment&) = delete;
+    };
+
+    // End of the tag starting at `open`, skipping '>' inside quoted values.
+    std::size_t FindTagEnd(std::string_view text, std::size_t open)
+    {
+        char quote = 0;
+        for (auto i = open; i < text.size(); ++i) {
+            const auto c = text[i];
+            if (quote) {
+                if (c == quote) {
+                    quote = 0;
+                }
+            } else if (c == '"' || c == '\'') {
+                quote = c;
+            } else if (c == '>') {
+                return i;
+            }
+        }
+        return std::string_view::npos;
+    }
+
+    std::optional<std::string> Attribute(std::string_view tag, std::string_view name)
+    {
+        for (auto pos = tag.find(name); pos != std::string_view::npos; pos = tag.find(name, pos + 1)) {
+            if (pos == 0 || !std::isspace(static_cast<unsigned char>(tag[pos - 1]))) {
+                continue;
+            }
+            auto cursor = pos + name.size();
+            while (cursor < tag.size() && std::isspace(static_cast<unsigned char>(tag[cursor]))) {
+                ++cursor;
+            }
+            if (cursor >= tag.size() || tag[cursor] != '=') {
+                continue;
+            }
+            ++cursor;
+            while (cursor < tag.size() && std::isspace(static_cast<unsigned char>(tag[cursor]))) {
+                ++cursor;
+            }
+            if (cursor >= tag.size() || (tag[cursor] != '"' && tag[cursor] != '\'')) {
+                continue;
+            }
+            const auto quote = tag[cursor];
+            const auto close = tag.find(quote, cursor + 1);
+            if (close == std::string_view::npos) {
+                return std::nullopt;
+            }
+            return std::string(tag.substr(cursor + 1, close - cursor - 1));
+        }
+        return std::nullopt;
+    }
+
+    // Absolute user units only; percentages and relative units fall back to
+    // the viewBox.
+    std::optional<double> ParseLength(const std::optional<std::string>& value)
+    {
+        if (!value) {
+            return std::nullopt;
+        }
+        char* end = nullptr;
+        const auto number = std::strtod(value->c_str(), &end);
+        const std::string_view unit(end);
+        if (end == value->c_str() || !(unit.empty() || unit == "px") || !(number > 0.0)) {
+            return std::nullopt;
+        }
+        return number;
+    }
+
+    std::optional<std::pair<double, double>> ViewBoxSize(const std::optional<std::string>& viewBox)
+    {
+        if (!viewBox) {
+            return std::nullopt;
+        }
+        std::string normalized = *viewBox;
+        std::replace(normalized.begin(), normalized.end(), ',', ' ');
+        std::istringstream in(normalized);
+        double minX = 0.0;
+        double minY = 0.0;
+        double width = 0.0;
+        double height = 0.0;
+        if (!(in >> minX >> minY >> width >> height) || !(width > 0.0) || !(height > 0.0)) {
+            return std::nullopt;
+        }
+        return std::pair{ width, height };
+    }
+
+    std::uint16_t PixelSize(double size)
+    {
+        return static_cast<std::uint16_t>(std::ceil((std::clamp)(size, 1.0, kMaxGlyphSize)));
+    }
+
+    // Glyphs share one document in the atlas, so local ids and the
+    // references to them get a per-glyph prefix.
+    std::string PrefixIds(std::string body, std::string_view prefix)
+    {
+        constexpr std::string_view kMarkers[] = { "id=\"", "id='", "url(#", "href=\"#", "href='#" };
+        for (const auto marker : kMarkers) {
+            const bool isIdAttribute = marker.starts_with("id");
+            std::size_t pos = 0;
+            while ((pos = body.find(marker, pos)) != std::string::npos) {
+                pos += marker.size();
+                // Skip attributes that merely end in "id", e.g. grid="...".
+                const auto attributeStart = pos - marker.size();
+                if (isIdAttribute && attributeStart > 0 &&
+                    !std::isspace(static_cast<unsigned char>(body[attributeStart - 1]))) {
+                    continue;
+                }
+                body.insert(pos, prefix);
+                pos += prefix.size();
+            }
+        }
+        return body;
+    }
+
+    GlyphSource LoadGlyph(const fs::path& path, std::string platformId)
+    {
+        const auto text = ReadFile(path);
+        const auto open = text.find("<svg");
+        const auto tagEnd = open == std::string::npos ? std::string::npos : FindTagEnd(text, open);
+        if (tagEnd == std::string::npos) {
+            throw std::runtime_error(path.generic_string() + ": no <svg> root element");
+        }
+
+        const std::string_view tag(text.data() + open, tagEnd - open);
+        const bool selfClosing = tag.ends_with("/");
+        const auto viewBox = Attribute(tag, "viewBox");
+        const auto viewBoxSize = ViewBoxSize(viewBox);
+        const auto width = ParseLength(Attribute(tag, "width"));
+        const auto height = ParseLength(Attribute(tag, "height"));
+
+        GlyphSource glyph{};
+        glyph.platformId = std::move(platformId);
+        glyph.glyphId = path.stem().string();
+        glyph.width = PixelSize(width.value_or(viewBoxSize ? viewBoxSize->first : kDefaultGlyphSize));
+        glyph.height = PixelSize(height.value_or(viewBoxSize ? viewBoxSize->second : kDefaultGlyphSize));
+        glyph.viewBox = viewBox.value_or("0 0 " + std::to_string(glyph.width) + ' ' + std::to_string(glyph.height));
+
+        if (!selfClosing) {
+            const auto close = text.rfind("</svg>");
+            if (close == std::string::npos || close <= tagEnd) {
+                throw std::runtime_error(path.generic_string() + ": unterminated <svg> root element");
+            }
+            glyph.body = PrefixIds(
+                text.substr(tagEnd + 1, close - tagEnd - 1),
+                glyph.platformId + '-' + glyph.glyphId + '-');
+        }
+        return glyph;
+    }
+
+    // Layout mirrors PromptService asset paths: <root>/<platform>/<glyph>.svg.
+    std::vector<GlyphSource> LoadGlyphs(const fs::path& glyphRoot)
+    {
+        std::vector<GlyphSource> glyphs;
+        if (!fs::is_directory(glyphRoot)) {
+            throw std::runtime_error("glyph root " + glyphRoot.generic_string() + " does not exist");
+        }
+        for (const auto& platform : fs::directory_iterator(glyphRoot)) {
+            if (!platform.is_directory()) {
+                continue;
+            }
+            for (const auto& file : fs::directory_iterator(platform.path())) {
+                if (file.is_regular_file() && file.path().extension() == prompt::kGlyphAssetExtension) {
+                    glyphs.push_back(LoadGlyph(file.path(), platform.path().filename().string()));
+                }
+            }
+        }
+        std::sort(glyphs.begin(), glyphs.end(), [](const GlyphSource& lhs, const GlyphSource& rhs) {
+            return std::tie(lhs.platformId, lhs.glyphId) < std::tie(rhs.platformId, rhs.glyphId);
+        });
+        if (glyphs.empty()) {
+            throw std::runtime_error("no <platform>/<glyph>.svg sources under " + glyphRoot.generic_string());
+        }
+        return glyphs;
+    }
+
+    // One document holding every glyph at its packed position; only fed to
+    // the rasterizer, never shipped.
+    std::string AtlasDocument(const prompt::GlyphAtlasLayout& layout, const std::vector<GlyphSource>& glyphs)
+    {
+        std::ostringstream out;
+        out << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+        out << "<!-- generated by " << kGeneratorVersion << "; do not edit -->\n";
+        out << "<svg xmlns=\"http://www.w3.org/2000/svg\" xmlns:xlink=\"http://www.w3.org/1999/xlink\" width=\""
+            << layout.width << "\" height=\"" << layout.height << "\" viewBox=\"0 0 "
+            << layout.width << ' ' << layout.height << "\">\n";
+        for (std::size_t i = 0; i < glyphs.size(); ++i) {
+            const auto& glyph = glyphs[i];
+            const auto& placement = layout.placements[i];
+            out << "<svg id=\"" << glyph.platformId << '/' << glyph.glyphId << "\" x=\"" << placement.x << "\" y=\"" << placement.y
+                << "\" width=\"" << placement.width << "\" height=\"" << placement.height
+                << "\" viewBox=\"" << glyph.viewBox << "\">" << glyph.body << "</svg>\n";
+        }
+        out << "</svg>\n";
+        return out.str();
+    }
+
+    // Renders the composite atlas document with Direct2D's SVG renderer
+    // and returns straight-alpha BGRA rows, top row first.
+    std::vector<std::uint8_t> RasterizeAtlas(std::string_view document, std::uint32_t width, std::uint32_t height)
+    {
+        const ComApartment apartment;
+
+        ComPtr<IWICImagingFactory> wicFactory;
+        Check(
+            ::CoCreateInstance(CLSID_WICImagingFactory, nullptr, CLSCTX_INPROC_SERVER, IID_PPV_ARGS(wicFactory.GetAddressOf())),
+            "create WIC factory");
+        ComPtr<IWICBitmap> bitmap;
+        Check(
+            wicFactory->CreateBitmap(width, height, GUID_WICPixelFormat32bppPBGRA, WICBitmapCacheOnLoad, bitmap.GetAddressOf()),
+            "create atlas bitmap");
+
+        ComPtr<ID2D1Factory> d2dFactory;
+        Check(::D2D1CreateFactory(D2D1_FACTORY_TYPE_SINGLE_THREADED, d2dFactory.GetAddressOf()), "create Direct2D factory");
+        ComPtr<ID2D1RenderTarget> target;
+        Check(
+            d2dFactory->CreateWicBitmapRenderTarget(
+                bitmap.Get(),
+                D2D1::RenderTargetProperties(
+                    D2D1_RENDER_TARGET_TYPE_SOFTWARE,
+                    D2D1::PixelFormat(DXGI_FORMAT_B8G8R8A8_UNORM, D2D1_ALPHA_MODE_PREMULTIPLIED)),
+                target.GetAddressOf()),
+            "create atlas render target");
+        ComPtr<ID2D1DeviceContext5> context;
+        Check(target.As(&context), "query SVG-capable device context (Windows 10 1703 or later)");
+
+        ComPtr<IStream> stream;
+        stream.Attach(::SHCreateMemStream(reinterpret_cast<const BYTE*>(document.data()), static_cast<UINT>(document.size())));
+        if (!stream) {
+            throw std::runtime_error("cannot wrap the atlas document in a stream");
+        }
+        ComPtr<ID2D1SvgDocument> svg;
+        Check(
+            context->CreateSvgDocument(
+                stream.Get(),
+                D2D1::SizeF(static_cast<float>(width), static_cast<float>(height)),
+                svg.GetAddressOf()),
+            "parse atlas document");
+
+        context->BeginDraw();
+        context->Clear(D2D1::ColorF(0.0f, 0.0f, 0.0f, 0.0f));
+        context->DrawSvgDocument(svg.Get());
+        Check(context->EndDraw(), "render atlas");
+
+        const WICRect rect{ 0, 0, static_cast<INT>(width), static_cast<INT>(height) };
+        ComPtr<IWICBitmapLock> lock;
+        Check(bitmap->Lock(&rect, WICBitmapLockRead, lock.GetAddressOf()), "lock atlas bitmap");
+        UINT stride = 0;
+        UINT size = 0;
+        BYTE* data = nullptr;
+        Check(lock->GetStride(&stride), "read atlas stride");
+        Check(lock->GetDataPointer(&size, &data), "read atlas pixels");
+
+        const auto rowBytes = static_cast<std::size_t>(width) * 4;
+        std::vector<std::uint8_t> pixels(rowBytes * height);
+        for (std::uint32_t y = 0; y < height; ++y) {
+            const auto* source = data + static_cast<std::size_t>(y) * stride;
+            auto* row = pixels.data() + y * rowBytes;
+            for (std::size_t x = 0; x < rowBytes; x += 4) {
+                const auto alpha = source[x + 3];
+                for (std::size_t channel = 0; channel < 3; ++channel) {
+                    row[x + channel] = alpha == 0 ?
+                        0 :
+                        static_cast<std::uint8_t>((std::min)(255u, (source[x + channel] * 255u + alpha / 2u) / alpha));
+                }
+                row[x + 3] = alpha;
+            }
+        }
+        return pixels;
+    }
+
+    fs::path FindProjectRoot(const char* argv0)
+    {
+        auto current = fs::current_path();
+        for (;;) {
+            if (fs::exists(current / "xmake.lua") && fs::exists(current / "config/DualPadBindings.ini")) {
+                return current;
+            }
+            if (current == current.root_path()) {
+                break;
+            }
+            current = current.parent_path();
+        }
+
+        auto exe = fs::absolute(argv0).parent_path();
+        for (;;) {
+            if (fs::exists(exe / "xmake.lua") && fs::exists(exe / "config/DualPadBindings.ini")) {
+                return exe;
+            }
+            if (exe == exe.root_path()) {
+                break;
+            }
+            exe = exe.parent_path();
+        }
+        throw std::runtime_error("cannot locate project root");
+    }
+}
+
+// Usage: DualPadGlyphAtlasGen [glyph-root] [output-dir]
+// Packs every <glyph-root>/<platform>/<glyph>.svg into one rasterized
+// GlyphAtlas.dds plus the GlyphAtlas.idx binary index GlyphAtlasIndex maps at
+// runtime. Rasterizing uses Direct2D's SVG renderer.
+// Both default to the project's Interface/Exported/DualPad/Glyphs.
+int main(int argc, char** argv)
+{
+    try {
+        const auto glyphRoot = argc > 1
+            ? fs::path(argv[1])
+            : FindProjectRoot(argc > 0 ? argv[0] : "") / prompt::kGlyphAssetRoot;
+        const auto outputDir = argc > 2 ? fs::path(argv[2]) : glyphRoot;
+
+        const auto glyphs = LoadGlyphs(glyphRoot);
+        std::vector<prompt::GlyphAtlasPlacement> placements;
+        placements.reserve(glyphs.size());
+        for (const auto& glyph : glyphs) {
+            placements.push_back(prompt::GlyphAtlasPlacement{
+                .platformId = glyph.platformId,
+                .glyphId = glyph.glyphId,
+                .width = glyph.width,
+                .height = glyph.height
+            });
+        }
+
+        const auto layout = prompt::PackGlyphAtlas(std::move(placements), kMaxAtlasWidth, kPadding);
+        if (!layout) {
+            throw std::runtime_error("glyph set does not fit a " + std::to_string(kMaxAtlasWidth) + "px wide atlas");
+        }
+
+        const auto pixels = RasterizeAtlas(AtlasDocument(*layout, glyphs), layout->width, layout->height);
+        const auto image = prompt::SerializeGlyphAtlasDds(layout->width, layout->height, pixels);
+        const auto index = prompt::SerializeGlyphAtlasIndex(*layout);
+        WriteFile(
+            outputDir / prompt::kGlyphAtlasImageName,
+            std::string_view(reinterpret_cast<const char*>(image.data()), image.size()));
+        WriteFile(
+            outputDir / prompt::kGlyphAtlasIndexName,
+            std::string_view(reinterpret_cast<const char*>(index.data()), index.size()));
+
+        std::cout << "DualPadGlyphAtlasGen packed " << glyphs.size() << " glyphs into "
+                  << layout->width << 'x' << layout->height << " at " << outputDir.generic_string() << '\n';
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "DualPadGlyphAtlasGen failed: " << e.what() << '\n';
+        return 1;
+    }
+}
@@ -157,16 +157,19 @@ local ph4_action_graph_files = {
     "src/input_v2/actions/CompiledActionGraph.cpp",
     "src/input_v2/actions/CompiledActionGraphPublisher.cpp",
     "src/input_v2/actions/InteractionEngine.cpp",
+    "src/input_v2/actions/InteractionTimerWheel.cpp",
     "src/input_v2/actions/LegacyInteractionInputAdapter.cpp",
     "src/input_v2/actions/LegacyLifecycleBridge.cpp"
 }
 
 local ph5_gameplay_projection_files = {
+    "src/input/backend/FrameActionPlanDelta.cpp",
     "src/input_v2/gameplay/DualPadRuntime.cpp",
     "src/input_v2/gameplay/GameplayProjectionFrame.cpp",
     "src/input_v2/gameplay/PollOutputAdapter.cpp",
     "src/input_v2/gameplay/RecoveryPlan.cpp",
     "src/input_v2/gameplay/GameplayPresentationPublisher.cpp",
+    "src/input_v2/gameplay/PresentationPublicationCoalescer.cpp",
     "src/input_v2/gameplay/RuntimeDiagnostics.cpp"
 }
 
@@ -175,10 +178,14 @@ local ph5_gameplay_runtime_files = {
 }
 
 local ph6_prompt_files = {
+    "src/input_v2/prompt/GlyphAtlasIndex.cpp",
     "src/input_v2/prompt/PromptScope.cpp",
     "src/input_v2/prompt/PromptSnapshotRecord.cpp",
     "src/input_v2/prompt/PromptProjection.cpp",
+    "src/input_v2/prompt/PromptDisplayStrings.cpp",
     "src/input_v2/prompt/PromptService.cpp",
+    "src/input_v2/prompt/PromptResolutionTable.cpp",
+    "src/input_v2/prompt/PromptScopePrefetcher.cpp",
     "src/input_v2/prompt/PromptRuntimeOwner.cpp"
 }
 
@@ -373,6 +380,19 @@ target("DualPadDocGen")
     add_files("tools/docgen/DualPadDocGenMain.cpp")
     add_cxflags("/utf-8", {tools = "cl"})
 
+target("DualPadGlyphAtlasGen")
+    set_kind("binary")
+    add_files("tools/glyphatlas/DualPadGlyphAtlasGenMain.cpp")
+    add_includedirs("src")
+    add_syslinks("d2d1", "ole32", "shlwapi", "windowscodecs")
+    add_cxflags("/utf-8", {tools = "cl"})
+
+target("DualPadGlyphAtlasRoundTripTests")
+    set_kind("binary")
+    add_files("tests/input_v2/GlyphAtlasRoundTripTests.cpp")
+    add_includedirs("src")
+    add_cxflags("/utf-8", {tools = "cl"})
+
 target("DualPadRouteHealthContractTests")
     set_kind("binary")
     add_deps("commonlibsse-ng")
@@ -385,6 +405,73 @@ target("DualPadRouteHealthContractTests")
     add_includedirs("src")
     set_pcxxheader("src/pch.h")
 
+target("DualPadAuthoritativePollStateTests")
+    set_kind("binary")
+    add_deps("commonlibsse-ng")
+    add_syslinks("ole32", "user32")
+
+    add_files(
+        "tests/AuthoritativePollStateTests.cpp",
+        "src/input/AuthoritativePollState.cpp")
+    add_headerfiles("tests/**.h")
+    add_includedirs("src")
+    set_pcxxheader("src/pch.h")
+
+target("DualPadPollCommitCoordinatorTests")
+    set_kind("binary")
+    add_deps("commonlibsse-ng")
+    add_syslinks("ole32", "user32")
+
+    add_files(
+        "tests/PollCommitCoordinatorTests.cpp",
+        "src/input/backend/PollCommitCoordinator.cpp",
+        "src/input/RuntimeConfig.cpp")
+    add_headerfiles("tests/**.h")
+    add_includedirs("src")
+    set_pcxxheader("src/pch.h")
+
+target("DualPadFrameActionPlanDeltaTests")
+    set_kind("binary")
+    add_deps("commonlibsse-ng")
+    add_syslinks("ole32", "user32")
+
+    add_files(
+        "tests/FrameActionPlanDeltaTests.cpp",
+        "src/input/backend/FrameActionPlanDelta.cpp")
+    add_headerfiles("tests/**.h")
+    add_includedirs("src")
+    set_pcxxheader("src/pch.h")
+
+target("DualPadAnalogGateKernelBench")
+    set_kind("binary")
+    add_deps("commonlibsse-ng")
+    add_syslinks("ole32", "user32")
+
+    add_files(
+        "tests/input_v2/AnalogGateKernelBench.cpp")
+    add_headerfiles("tests/**.h")
+    add_includedirs("src")
+    set_pcxxheader("src/pch.h")
+
+target("DualPadFlightRecorderCaptureBench")
+    set_kind("binary")
+    add_deps("commonlibsse-ng")
+    add_syslinks("ole32", "user32")
+
+    add_files(
+        "tests/input_v2/FlightRecorderCaptureBench.cpp",
+        "src/input_v2/telemetry/FlightRecorder.cpp",
+        "src/input_v2/telemetry/TraceCsvConverter.cpp",
+        "src/input_v2/telemetry/TraceRecordFormat.cpp",
+        "src/input_v2/telemetry/TraceSchema.cpp",
+        "src/input_v2/gameplay/RuntimeDiagnostics.cpp",
+        "src/input_v2/presentation/PresentationProjection.cpp",
+        "src/input_v2/presentation/SkyrimCompatibilitySurface.cpp",
+        "src/input/injection/RouteHealthContract.cpp")
+    add_headerfiles("tests/**.h")
+    add_includedirs("src")
+    set_pcxxheader("src/pch.h")
+
 target("DualPadGlyphResolutionCompatTests")
     set_kind("binary")
     add_deps("commonlibsse-ng")
@@ -404,7 +491,11 @@ target("DualPadGlyphResolutionCompatTests")
 
 local replay_runtime_files = {
     "src/input_v2/telemetry/TraceSchema.cpp",
+    "src/input_v2/telemetry/TraceRecordFormat.cpp",
+    "src/input_v2/telemetry/TraceRecordRing.cpp",
+    "src/input_v2/telemetry/TraceCsvConverter.cpp",
     "src/input_v2/telemetry/InputTraceRecorder.cpp",
+    "src/input_v2/telemetry/FlightRecorder.cpp",
     "src/input_v2/telemetry/ReplayHarness.cpp",
     "src/input_v2/telemetry/ActionExecutorReplayStub.cpp",
     "src/input_v2/telemetry/GameplayKbmFactTrackerReplayStub.cpp",
@@ -489,6 +580,21 @@ target("DualPadReplayHarnessTests")
     add_includedirs("src")
     set_pcxxheader("src/pch.h")
 
+target("DualPadTraceCsv")
+    set_kind("binary")
+    add_deps("commonlibsse-ng")
+    add_syslinks("ole32", "user32")
+
+    add_files(
+        "tools/tracecsv/DualPadTraceCsvMain.cpp",
+        "src/input_v2/telemetry/TraceCsvConverter.cpp",
+        "src/input_v2/telemetry/TraceRecordFormat.cpp",
+        "src/input_v2/telemetry/TraceSchema.cpp",
+        "src/input/injection/RouteHealthContract.cpp")
+    add_headerfiles("src/input_v2/telemetry/**.h")
+    add_includedirs("src")
+    set_pcxxheader("src/pch.h")
+
 target("DualPadDInput8Proxy")
     set_kind("shared")
     set_basename("dinput8")